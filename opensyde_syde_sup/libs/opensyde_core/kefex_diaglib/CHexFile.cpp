@@ -32,6 +32,8 @@
 
 #include <cstring>
 #include <cctype>
+#include <algorithm>
+#include <thread>
 
 #include "CHexFile.h"
 #include "stwtypes.h"
@@ -90,10 +92,37 @@ static const uint32 mu32_XADR32_MASK  =   0xFFFF0000U;
 static const uint32 mu32_MAX_DWORD    =   0xFFFFFFFFU;
 static const uint32 mu32_MIN_DWORD    =   0x00000000U;
 
+// LoadDataDumpFromMemory: files smaller than this are parsed in one piece
+static const uint32 mu32_DUMP_MIN_CHUNK_SIZE = 0x100000U;
+// LoadDataDumpFromMemory: maximum number of chunks parsed in parallel
+static const uint32 mu32_DUMP_MAX_NUM_CHUNKS = 8U;
+
+// value of ASCII hex digits; 0xFF: no hex digit
+static const uint8 mau8_HEX_NIBBLES[256] =
+{
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+};
+
 //------------------------------------------------------------------------
 
 C_HexFile::C_HexFile(void) :
-   mu32_LastOverlayErrorAddress(0U)
+   mu32_LastOverlayErrorAddress(0U),
+   mu32_DumpError(NO_ERR)
 {
    InitHexFile();
 }
@@ -421,6 +450,676 @@ uint32 C_HexFile::LoadSRecord(std::FILE * const opt_File)
    return u32_Error;
 }
 
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Convert ASCII hex characters to bytes
+
+   \param[in]     opcn_String    first character to convert
+   \param[in]     ou32_NumBytes  number of bytes to convert (two characters each)
+   \param[out]    opu8_Data      converted bytes
+
+   \return
+   true     all characters converted
+   false    invalid character found
+*/
+//-----------------------------------------------------------------------------
+static bool m_DecodeHexBytes(const charn * const opcn_String, const uint32 ou32_NumBytes, uint8 * const opu8_Data)
+{
+   uint8 u8_Invalid = 0U;
+
+   for (uint32 u32_Index = 0U; u32_Index < ou32_NumBytes; u32_Index++)
+   {
+      const uint8 u8_HiNib = mau8_HEX_NIBBLES[static_cast<uint8>(opcn_String[u32_Index * 2U])];
+      const uint8 u8_LoNib = mau8_HEX_NIBBLES[static_cast<uint8>(opcn_String[(u32_Index * 2U) + 1U])];
+      //invalid characters have bit 7 set; so we can check all of them at once at the end
+      u8_Invalid |= static_cast<uint8>(u8_HiNib | u8_LoNib);
+      opu8_Data[u32_Index] = static_cast<uint8>((static_cast<uint8>(u8_HiNib << 4)) | u8_LoNib);
+   }
+   return ((u8_Invalid & 0x80U) == 0U);
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Load hex file directly into data dump
+
+   Faster alternative to LoadFromFile for users that only work with the data dump
+    (GetDataDump, GetDataByAddress, FindPattern, ByteCount, MinAdr, MaxAdr).
+   The file is read into memory at once and parsed with LoadDataDumpFromMemory.
+   So the line based functions (LineInit, NextLine, SaveToFile, Optimize, ...) have no data to work with afterwards.
+
+   Supported formats, checks and results: see LoadDataDumpFromMemory
+
+   \param[in]  opcn_FileName   file name (C-string)
+
+   \return
+   see LoadDataDumpFromMemory
+   ERR_CANT_OPEN_FILE      0xF0000000
+*/
+//-----------------------------------------------------------------------------
+uint32 C_HexFile::LoadDataDumpFromFile(const charn * const opcn_FileName)
+{
+   uint32 u32_Error = NO_ERR;
+   std::vector<charn> c_File;
+   std::FILE * pt_File;
+
+   this->Clear();
+   this->mc_Dump.at_Blocks.SetLength(0);
+
+   //read complete file:
+   pt_File = std::fopen(opcn_FileName, "rb");
+   if (pt_File == NULL)
+   {
+      u32_Error = ERR_CANT_OPEN_FILE;
+   }
+   else
+   {
+      sint32 s32_FileSize = -1;
+
+      if (std::fseek(pt_File, 0, SEEK_END) == 0)
+      {
+         s32_FileSize = static_cast<sint32>(std::ftell(pt_File));
+         std::rewind(pt_File);
+      }
+
+      if (s32_FileSize < 0)
+      {
+         u32_Error = ERR_CANT_OPEN_FILE;
+      }
+      else if (s32_FileSize == 0)
+      {
+         u32_Error = ERR_HEXLINE_SYNTAX;
+      }
+      else
+      {
+         try
+         {
+            c_File.resize(static_cast<uintn>(s32_FileSize));
+         }
+         catch (...)
+         {
+            u32_Error = ERR_NOT_ENOUGH_MEMORY;
+         }
+         if ((u32_Error == NO_ERR) && (std::fread(&c_File[0], 1U, c_File.size(), pt_File) != c_File.size()))
+         {
+            u32_Error = ERR_CANT_OPEN_FILE;
+         }
+      }
+      (void)std::fclose(pt_File);
+   }
+
+   if (u32_Error == NO_ERR)
+   {
+      u32_Error = this->LoadDataDumpFromMemory(&c_File[0], static_cast<uint32>(c_File.size()));
+   }
+
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Load hex file content from memory directly into data dump
+
+   Same as LoadDataDumpFromFile for hex file content that is already in memory
+    (e.g. extracted from an archive).
+   Big contents are split into chunks of complete lines that are parsed in parallel (std::thread: this library is
+    also used without TGL and Qt, so there is no other thread class to use; the workers share no data, each one
+    fills its own chunk result). Then the records are resolved in file order (address offset records), sorted by
+    address and copied into the data dump without creating the ring buffer of hex lines.
+   So the line based functions (LineInit, NextLine, SaveToFile, Optimize, ...) have no data to work with afterwards.
+
+   Supported formats, checks and results are the same as for LoadFromFile followed by GetDataDump:
+   * errors in the content are reported first
+   * then a missing EOF record (the data dump is created nevertheless)
+   * then problems of the data dump (overlay, no data); GetDataDump reports them as well
+   Exception: data records without data bytes are ignored. LoadFromFile keeps them as lines; GetDataDump then
+    reports an overlay if their address is within data of another record and starts a new block at their address
+    (moving the data of the following record there). MinAdr and MaxAdr also do not consider them.
+
+   \param[in]  opcn_Data   hex file content (not zero terminated)
+   \param[in]  ou32_Size   number of bytes in opcn_Data
+
+   \return
+   NO_ERR                  data dump created
+   WRN_NO_EOF_RECORD       0x10000000 (Intel HEX file without EOF record; data dump created nevertheless)
+   WRN_RECORD_OVERLAY      0x2yyyyyyy
+   ERR_HEXLINE_SYNTAX      0x8xxxxxxx
+   ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
+   ERR_HEXLINE_COMMAND     0xAxxxxxxx
+   ERR_NO_DATA             0xB0000000
+   ERR_NOT_ENOUGH_MEMORY   0xE0000000
+
+   xxxxxxx = error line number of input file
+   yyyyyyy = lowest 7 nibbles of the offending address (see GetLastOverlayErrorAddress)
+*/
+//-----------------------------------------------------------------------------
+uint32 C_HexFile::LoadDataDumpFromMemory(const charn * const opcn_Data, const uint32 ou32_Size)
+{
+   uint32 u32_Error = NO_ERR;
+   sint32 s32_FileType = ms32_HEXFILE_ERR;
+   bool q_EofFound = false;
+   std::vector<C_DumpChunk> c_Chunks;
+   std::vector<C_DumpRecord> c_Records;
+
+   this->Clear();
+   this->mc_Dump.at_Blocks.SetLength(0);
+
+   if ((opcn_Data == NULL) || (ou32_Size == 0U))
+   {
+      u32_Error = ERR_HEXLINE_SYNTAX;
+   }
+
+   // intel-hex, s-record, ...
+   if (u32_Error == NO_ERR)
+   {
+      if (opcn_Data[0] == ':')
+      {
+         s32_FileType = ms32_HEXFILE_IHEX;
+      }
+      else if (opcn_Data[0] == 'S')
+      {
+         s32_FileType = ms32_HEXFILE_SREC;
+      }
+      else
+      {
+         u32_Error = ERR_HEXLINE_SYNTAX;
+      }
+   }
+
+   //split into chunks of complete lines:
+   if (u32_Error == NO_ERR)
+   {
+      const charn * const pcn_FileEnd = opcn_Data + ou32_Size;
+      const charn * pcn_ChunkStart = opcn_Data;
+      uint32 u32_NumChunks = 1U;
+
+      if (ou32_Size >= (2U * mu32_DUMP_MIN_CHUNK_SIZE))
+      {
+         u32_NumChunks = std::min(static_cast<uint32>(std::thread::hardware_concurrency()),
+                                  ou32_Size / mu32_DUMP_MIN_CHUNK_SIZE);
+         u32_NumChunks = std::min(std::max(u32_NumChunks, static_cast<uint32>(1U)), mu32_DUMP_MAX_NUM_CHUNKS);
+      }
+
+      c_Chunks.resize(u32_NumChunks);
+      for (uint32 u32_Chunk = 0U; u32_Chunk < u32_NumChunks; u32_Chunk++)
+      {
+         const charn * pcn_ChunkEnd = pcn_FileEnd;
+         if (u32_Chunk < (u32_NumChunks - 1U))
+         {
+            //end chunk after the next line feed
+            pcn_ChunkEnd = opcn_Data + ((ou32_Size / u32_NumChunks) * (u32_Chunk + 1U));
+            pcn_ChunkEnd = std::max(pcn_ChunkEnd, pcn_ChunkStart);
+            pcn_ChunkEnd = static_cast<const charn *>(std::memchr(pcn_ChunkEnd, '\n',
+                                                                  static_cast<uintn>(pcn_FileEnd - pcn_ChunkEnd)));
+            pcn_ChunkEnd = (pcn_ChunkEnd == NULL) ? pcn_FileEnd : (pcn_ChunkEnd + 1);
+         }
+         c_Chunks[u32_Chunk].pcn_Start = pcn_ChunkStart;
+         c_Chunks[u32_Chunk].pcn_End = pcn_ChunkEnd;
+         pcn_ChunkStart = pcn_ChunkEnd;
+      }
+   }
+
+   //parse the chunks; first one in this thread, all others in parallel
+   if (u32_Error == NO_ERR)
+   {
+      void (* const pr_ParseChunk)(C_DumpChunk * const opc_Chunk) =
+         (s32_FileType == ms32_HEXFILE_IHEX) ? &C_HexFile::ParseIntelHexChunk : &C_HexFile::ParseSRecordChunk;
+      std::vector<std::thread> c_Threads;
+
+      c_Threads.reserve(c_Chunks.size()); //no reallocation while threads are added
+      for (uint32 u32_Chunk = 1U; u32_Chunk < c_Chunks.size(); u32_Chunk++)
+      {
+         try
+         {
+            c_Threads.push_back(std::thread(pr_ParseChunk, &c_Chunks[u32_Chunk]));
+         }
+         catch (...)
+         {
+            //could not start thread: do it ourselves
+            pr_ParseChunk(&c_Chunks[u32_Chunk]);
+         }
+      }
+      pr_ParseChunk(&c_Chunks[0]);
+      for (uint32 u32_Thread = 0U; u32_Thread < c_Threads.size(); u32_Thread++)
+      {
+         c_Threads[u32_Thread].join();
+      }
+   }
+
+   //resolve address offsets in file order:
+   if (u32_Error == NO_ERR)
+   {
+      uint32 u32_NumRecords = 0U;
+
+      for (uint32 u32_Chunk = 0U; u32_Chunk < c_Chunks.size(); u32_Chunk++)
+      {
+         u32_NumRecords += static_cast<uint32>(c_Chunks[u32_Chunk].c_Records.size());
+      }
+      try
+      {
+         c_Records.reserve(u32_NumRecords);
+      }
+      catch (...)
+      {
+         u32_Error = ERR_NOT_ENOUGH_MEMORY;
+      }
+   }
+
+   for (uint32 u32_Chunk = 0U; (u32_Chunk < c_Chunks.size()) && (u32_Error == NO_ERR) && (q_EofFound == false);
+        u32_Chunk++)
+   {
+      C_DumpChunk & rc_Chunk = c_Chunks[u32_Chunk];
+
+      for (uint32 u32_Record = 0U; (u32_Record < rc_Chunk.c_Records.size()) && (q_EofFound == false); u32_Record++)
+      {
+         C_DumpRecord & rc_Record = rc_Chunk.c_Records[u32_Record];
+
+         switch (rc_Record.u8_Command)
+         {
+         case mu8_CMD_DATA:
+            rc_Record.u32_Address += mu32_AdrOffs;
+            rc_Record.pu8_Data = &rc_Chunk.c_Data[rc_Record.u32_DataIndex];
+            c_Records.push_back(rc_Record);
+            mu32_NumRawBytes += rc_Record.u8_Length;
+            mu32_MinAdr = std::min(mu32_MinAdr, rc_Record.u32_Address);
+            mu32_MaxAdr = std::max(mu32_MaxAdr, (rc_Record.u32_Address + rc_Record.u8_Length) - 1U);
+            break;
+         case mu8_CMD_XADR16:
+         case mu8_CMD_XADR32:
+            mu32_AdrOffs = rc_Record.u32_Address;
+            break;
+         case mu8_CMD_EOF:
+            q_EofFound = true;
+            break;
+         default:
+            break;
+         }
+      }
+
+      mu32_LineCount += rc_Chunk.u32_NumLines;
+      mu8_MaxRecordLength = std::max(mu8_MaxRecordLength, rc_Chunk.u8_MaxRecordLength);
+      //errors after the EOF record are irrelevant
+      if ((q_EofFound == false) && (rc_Chunk.u32_Error != NO_ERR))
+      {
+         u32_Error = rc_Chunk.u32_Error | (mu32_LineCount & ~ERR_MASK); // set line number info
+      }
+   }
+
+   if (u32_Error == NO_ERR)
+   {
+      //remember the result for GetDataDump
+      mu32_DumpError = this->CreateDataDump(c_Records);
+      mq_DumpIsDirty = false;
+
+      //same as LoadFromFile: a missing EOF record is reported instead of problems of the data dump
+      if ((s32_FileType == ms32_HEXFILE_IHEX) && (q_EofFound == false))
+      {
+         u32_Error = WRN_NO_EOF_RECORD;
+      }
+      else
+      {
+         u32_Error = mu32_DumpError;
+      }
+   }
+
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Parse one chunk of an Intel HEX file
+
+   Thread function for LoadDataDumpFromMemory.
+   Parses lines until the end of the chunk, the EOF record or the first error.
+   Data record addresses are not resolved (16bit offset as in file).
+
+   \param[in,out]  opc_Chunk   chunk to parse (pcn_Start and pcn_End must be set)
+*/
+//-----------------------------------------------------------------------------
+void C_HexFile::ParseIntelHexChunk(C_DumpChunk * const opc_Chunk)
+{
+   const charn * pcn_Line = opc_Chunk->pcn_Start;
+   uint8 au8_Record[static_cast<uintn>(mu8_MAX_RECSIZE) + 5U];
+   bool q_Finished = false;
+
+   opc_Chunk->u32_NumLines = 0U;
+   opc_Chunk->u32_Error = NO_ERR;
+   opc_Chunk->u8_MaxRecordLength = 0U;
+
+   try
+   {
+      while ((pcn_Line < opc_Chunk->pcn_End) && (q_Finished == false))
+      {
+         const charn * pcn_LineEnd = static_cast<const charn *>(
+            std::memchr(pcn_Line, '\n', static_cast<uintn>(opc_Chunk->pcn_End - pcn_Line)));
+         uint32 u32_LineLength;
+
+         pcn_LineEnd = (pcn_LineEnd == NULL) ? opc_Chunk->pcn_End : pcn_LineEnd;
+         u32_LineLength = static_cast<uint32>(pcn_LineEnd - pcn_Line);
+         opc_Chunk->u32_NumLines++;
+
+         //decode complete record and check syntax, checksum and command:
+         opc_Chunk->u32_Error = ERR_HEXLINE_SYNTAX;
+         if ((u32_LineLength >= 3U) && (pcn_Line[0] == ':') && (m_DecodeHexBytes(&pcn_Line[1], 1U, au8_Record) == true))
+         {
+            const uint32 u32_NumBytes = static_cast<uint32>(au8_Record[mu8_INTEL_LEN]) + mu8_INTEL_DAT + 1U;
+            if ((u32_LineLength >= (1U + (u32_NumBytes * 2U))) &&
+                (m_DecodeHexBytes(&pcn_Line[1], u32_NumBytes, au8_Record) == true))
+            {
+               uint8 u8_Checksum = 0U;
+               for (uint32 u32_Byte = 0U; u32_Byte < u32_NumBytes; u32_Byte++)
+               {
+                  u8_Checksum += au8_Record[u32_Byte];
+               }
+
+               if (u8_Checksum != 0x00U)
+               {
+                  opc_Chunk->u32_Error = ERR_HEXLINE_CHECKSUM;
+               }
+               else if (au8_Record[mu8_INTEL_CMD] > mu8_CMD_START32)
+               {
+                  opc_Chunk->u32_Error = ERR_HEXLINE_COMMAND;
+               }
+               else
+               {
+                  opc_Chunk->u32_Error = NO_ERR;
+               }
+            }
+         }
+
+         if (opc_Chunk->u32_Error == NO_ERR)
+         {
+            const uint8 u8_Length = au8_Record[mu8_INTEL_LEN];
+            C_DumpRecord c_Record;
+
+            opc_Chunk->u8_MaxRecordLength = std::max(opc_Chunk->u8_MaxRecordLength, u8_Length);
+            c_Record.u8_Command = au8_Record[mu8_INTEL_CMD];
+            c_Record.u8_Length = 0U;
+            c_Record.u32_DataIndex = 0U;
+            c_Record.pu8_Data = NULL;
+
+            switch (c_Record.u8_Command)
+            {
+            case mu8_CMD_DATA:
+               if (u8_Length > 0U)
+               {
+                  c_Record.u32_Address = (static_cast<uint32>(au8_Record[mu8_INTEL_ADRH]) << 8) +
+                                         au8_Record[mu8_INTEL_ADRL];
+                  c_Record.u32_DataIndex = static_cast<uint32>(opc_Chunk->c_Data.size());
+                  c_Record.u8_Length = u8_Length;
+                  opc_Chunk->c_Data.insert(opc_Chunk->c_Data.end(), &au8_Record[mu8_INTEL_DAT],
+                                           &au8_Record[mu8_INTEL_DAT + u8_Length]);
+                  opc_Chunk->c_Records.push_back(c_Record);
+               }
+               break;
+            case mu8_CMD_XADR16:
+            case mu8_CMD_XADR32:
+               if (u8_Length < 2U)
+               {
+                  opc_Chunk->u32_Error = ERR_HEXLINE_SYNTAX;
+               }
+               else
+               {
+                  c_Record.u32_Address = (static_cast<uint32>(au8_Record[mu8_INTEL_DAT]) << 8) +
+                                         au8_Record[mu8_INTEL_DAT + 1U];
+                  c_Record.u32_Address <<= (c_Record.u8_Command == mu8_CMD_XADR16) ? 4U : 16U;
+                  opc_Chunk->c_Records.push_back(c_Record);
+               }
+               break;
+            case mu8_CMD_EOF:
+               c_Record.u32_Address = 0U;
+               opc_Chunk->c_Records.push_back(c_Record);
+               q_Finished = true;
+               break;
+            default:
+               break;
+            }
+         }
+
+         if (opc_Chunk->u32_Error != NO_ERR)
+         {
+            q_Finished = true;
+         }
+         pcn_Line = (pcn_LineEnd < opc_Chunk->pcn_End) ? (pcn_LineEnd + 1) : opc_Chunk->pcn_End;
+      }
+   }
+   catch (...)
+   {
+      opc_Chunk->u32_Error = ERR_NOT_ENOUGH_MEMORY;
+   }
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Parse one chunk of a Motorola S-Record file
+
+   Thread function for LoadDataDumpFromMemory.
+   Parses lines until the end of the chunk or the first error.
+   Data records are stored as Intel HEX data records with absolute addresses.
+
+   \param[in,out]  opc_Chunk   chunk to parse (pcn_Start and pcn_End must be set)
+*/
+//-----------------------------------------------------------------------------
+void C_HexFile::ParseSRecordChunk(C_DumpChunk * const opc_Chunk)
+{
+   const charn * pcn_Line = opc_Chunk->pcn_Start;
+   uint8 au8_Record[static_cast<uintn>(mu8_MAX_RECSIZE) + 5U];
+   bool q_Finished = false;
+
+   opc_Chunk->u32_NumLines = 0U;
+   opc_Chunk->u32_Error = NO_ERR;
+   opc_Chunk->u8_MaxRecordLength = 0U;
+
+   try
+   {
+      while ((pcn_Line < opc_Chunk->pcn_End) && (q_Finished == false))
+      {
+         const charn * pcn_LineEnd = static_cast<const charn *>(
+            std::memchr(pcn_Line, '\n', static_cast<uintn>(opc_Chunk->pcn_End - pcn_Line)));
+         uint32 u32_LineLength;
+         uint8 u8_RecordType = 0U;
+
+         pcn_LineEnd = (pcn_LineEnd == NULL) ? opc_Chunk->pcn_End : pcn_LineEnd;
+         u32_LineLength = static_cast<uint32>(pcn_LineEnd - pcn_Line);
+         opc_Chunk->u32_NumLines++;
+
+         //decode complete record and check syntax, checksum and record type:
+         opc_Chunk->u32_Error = ERR_HEXLINE_SYNTAX;
+         if ((u32_LineLength >= 4U) && (pcn_Line[0] == 'S') && (m_DecodeHexBytes(&pcn_Line[2], 1U, au8_Record) == true))
+         {
+            const uint32 u32_NumBytes = static_cast<uint32>(au8_Record[mu8_SREC_LEN]) + 1U;
+            if ((u32_LineLength >= (2U + (u32_NumBytes * 2U))) &&
+                (m_DecodeHexBytes(&pcn_Line[2], u32_NumBytes, au8_Record) == true))
+            {
+               uint8 u8_Checksum = 0U;
+               for (uint32 u32_Byte = 0U; u32_Byte < u32_NumBytes; u32_Byte++)
+               {
+                  u8_Checksum += au8_Record[u32_Byte];
+               }
+
+               u8_RecordType = static_cast<uint8>(static_cast<uint8>(pcn_Line[1]) - 0x30U);
+               if (u8_Checksum != 0xFFU)
+               {
+                  opc_Chunk->u32_Error = ERR_HEXLINE_CHECKSUM;
+               }
+               else if (u8_RecordType > mu8_SREC_END16)
+               {
+                  opc_Chunk->u32_Error = ERR_HEXLINE_COMMAND;
+               }
+               else
+               {
+                  opc_Chunk->u32_Error = NO_ERR;
+               }
+            }
+         }
+
+         if (opc_Chunk->u32_Error == NO_ERR)
+         {
+            opc_Chunk->u8_MaxRecordLength = std::max(opc_Chunk->u8_MaxRecordLength, au8_Record[mu8_SREC_LEN]);
+
+            if ((u8_RecordType == mu8_SREC_DATA16) || (u8_RecordType == mu8_SREC_DATA24) ||
+                (u8_RecordType == mu8_SREC_DATA32))
+            {
+               //length includes address and checksum
+               const uint32 u32_NumAddressBytes = static_cast<uint32>(u8_RecordType) + 1U;
+               if (au8_Record[mu8_SREC_LEN] < (u32_NumAddressBytes + 1U))
+               {
+                  opc_Chunk->u32_Error = ERR_HEXLINE_SYNTAX;
+               }
+               else
+               {
+                  const uint8 u8_Length = static_cast<uint8>(au8_Record[mu8_SREC_LEN] - (u32_NumAddressBytes + 1U));
+                  C_DumpRecord c_Record;
+
+                  c_Record.u8_Command = mu8_CMD_DATA;
+                  c_Record.u32_Address = 0U;
+                  for (uint32 u32_Byte = 0U; u32_Byte < u32_NumAddressBytes; u32_Byte++)
+                  {
+                     c_Record.u32_Address = (c_Record.u32_Address << 8) + au8_Record[mu8_SREC_ADR + u32_Byte];
+                  }
+                  c_Record.u32_DataIndex = static_cast<uint32>(opc_Chunk->c_Data.size());
+                  c_Record.u8_Length = u8_Length;
+                  c_Record.pu8_Data = NULL;
+                  if (u8_Length > 0U)
+                  {
+                     opc_Chunk->c_Data.insert(opc_Chunk->c_Data.end(),
+                                              &au8_Record[mu8_SREC_ADR + u32_NumAddressBytes],
+                                              &au8_Record[mu8_SREC_ADR + u32_NumAddressBytes + u8_Length]);
+                     opc_Chunk->c_Records.push_back(c_Record);
+                  }
+               }
+            }
+         }
+
+         if (opc_Chunk->u32_Error != NO_ERR)
+         {
+            q_Finished = true;
+         }
+         pcn_Line = (pcn_LineEnd < opc_Chunk->pcn_End) ? (pcn_LineEnd + 1) : opc_Chunk->pcn_End;
+      }
+   }
+   catch (...)
+   {
+      opc_Chunk->u32_Error = ERR_NOT_ENOUGH_MEMORY;
+   }
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Compare records by address
+
+   For sorting in CreateDataDump.
+
+   \param[in]  orc_Other   record to compare with
+
+   \return
+   true    address of this record is lower
+   false   else
+*/
+//-----------------------------------------------------------------------------
+bool C_HexFile::C_DumpRecord::operator <(const C_DumpRecord & orc_Other) const
+{
+   return (this->u32_Address < orc_Other.u32_Address);
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Create data dump from resolved data records
+
+   Same result as GetDataDump for the same data: sorted by address, a new block starts at each gap.
+
+   \param[in,out]  orc_Records   data records with absolute addresses (will be sorted by address)
+
+   \return
+   NO_ERR                  data dump created
+   WRN_RECORD_OVERLAY      address in hex file multiply used (lowest 7 nibbles contain lowest 7 nibbles of the
+                           offending address)
+   ERR_NOT_ENOUGH_MEMORY   out of memory
+   ERR_NO_DATA             no data available
+*/
+//-----------------------------------------------------------------------------
+uint32 C_HexFile::CreateDataDump(std::vector<C_DumpRecord> & orc_Records)
+{
+   uint32 u32_Error = NO_ERR;
+
+   if (orc_Records.empty() == true)
+   {
+      u32_Error = ERR_NO_DATA;
+   }
+   else if (std::is_sorted(orc_Records.begin(), orc_Records.end()) == false)
+   {
+      //stable: keep file order of records at the same address (same as the sorted insert of LoadFromFile)
+      std::stable_sort(orc_Records.begin(), orc_Records.end());
+   }
+   else
+   {
+      //usual case: hex file is already sorted
+   }
+
+   try
+   {
+      std::vector<uint32> c_BlockSizes;
+      sint64 s64_LastAddress = -2; //-2 -> make sure that a block is detected at the first record
+
+      //detect blocks and their sizes:
+      for (uint32 u32_Record = 0U; (u32_Record < orc_Records.size()) && (u32_Error == NO_ERR); u32_Record++)
+      {
+         const C_DumpRecord & rc_Record = orc_Records[u32_Record];
+         if (static_cast<sint64>(rc_Record.u32_Address) < s64_LastAddress)
+         {
+            u32_Error = WRN_RECORD_OVERLAY | ((rc_Record.u32_Address) & ~ERR_MASK);
+            mu32_LastOverlayErrorAddress = rc_Record.u32_Address;
+         }
+         else
+         {
+            if (static_cast<sint64>(rc_Record.u32_Address) > s64_LastAddress)
+            {
+               c_BlockSizes.push_back(0U); //new block detected
+            }
+            c_BlockSizes.back() += rc_Record.u8_Length;
+            s64_LastAddress = static_cast<sint64>(rc_Record.u32_Address) + rc_Record.u8_Length;
+         }
+      }
+
+      //copy data:
+      if (u32_Error == NO_ERR)
+      {
+         sint32 s32_BlockIndex = -1;
+         sint32 s32_Index = 0;
+
+         mc_Dump.at_Blocks.SetLength(static_cast<sint32>(c_BlockSizes.size()));
+         s64_LastAddress = -2;
+         for (uint32 u32_Record = 0U; u32_Record < orc_Records.size(); u32_Record++)
+         {
+            const C_DumpRecord & rc_Record = orc_Records[u32_Record];
+            if (static_cast<sint64>(rc_Record.u32_Address) > s64_LastAddress)
+            {
+               s32_BlockIndex++; //new block detected
+               s32_Index = 0;
+               mc_Dump.at_Blocks[s32_BlockIndex].u32_AddressOffset = rc_Record.u32_Address;
+               mc_Dump.at_Blocks[s32_BlockIndex].au8_Data.SetLength(
+                  static_cast<sint32>(c_BlockSizes[static_cast<uintn>(s32_BlockIndex)]));
+            }
+            (void)std::memcpy(&mc_Dump.at_Blocks[s32_BlockIndex].au8_Data[s32_Index], rc_Record.pu8_Data,
+                              rc_Record.u8_Length);
+            s32_Index += static_cast<sint32>(rc_Record.u8_Length);
+            s64_LastAddress = static_cast<sint64>(rc_Record.u32_Address) + rc_Record.u8_Length;
+         }
+         mq_DumpIsDirty = false;
+      }
+   }
+   catch (...)
+   {
+      u32_Error = ERR_NOT_ENOUGH_MEMORY;
+   }
+
+   if (u32_Error != NO_ERR)
+   {
+      mc_Dump.at_Blocks.SetLength(0);
+   }
+
+   return u32_Error;
+}
+
 //************************************************************************
 // .FUNCTION    GetFileType
 // .GROUP
@@ -717,6 +1416,7 @@ void C_HexFile::InitHexFile(void)
    mu8_MaxRecordLength = 0U;
    mu32_NumRawBytes = 0U;
    mu32_LastOverlayErrorAddress = 0U;
+   mu32_DumpError = NO_ERR;
    mpt_DataEntry = NULL;
    mpt_HexData = NULL;
    mpt_Prev = NULL;
@@ -1975,50 +2675,16 @@ uint32 C_HexFile::CalcCheck(charn * const opcn_String)
 uint32 C_HexFile::GetByte(const charn * const opcn_String, const uint32 ou32_Index, uint8 & oru8_Data)
 {
    uint32 u32_Error = ERR_HEXLINE_SYNTAX;
-   uint32 u32_Index = ou32_Index;
-   uint8 u8_HiNib;
-   uint8 u8_LoNib;
-
-   u32_Index = (u32_Index * 2U) + 1U;
-   u8_HiNib = static_cast<uint8>(opcn_String[u32_Index]);
-   u8_LoNib = static_cast<uint8>(opcn_String[u32_Index + 1]);
+   const uint32 u32_Index = (ou32_Index * 2U) + 1U;
+   const uint8 u8_HiNib = mau8_HEX_NIBBLES[static_cast<uint8>(opcn_String[u32_Index])];
+   const uint8 u8_LoNib = mau8_HEX_NIBBLES[static_cast<uint8>(opcn_String[u32_Index + 1])];
 
-   if ((u8_HiNib >= static_cast<uint8>('0')) && (u8_HiNib <= static_cast<uint8>('9')))
+   if ((u8_HiNib != 0xFFU) && (u8_LoNib != 0xFFU))
    {
-      u8_HiNib = static_cast<uint8>((static_cast<uint8>(u8_HiNib - 0x30U)) << 4);
+      oru8_Data = static_cast<uint8>((static_cast<uint8>(u8_HiNib << 4)) | u8_LoNib);
+      u32_Error = NO_ERR;
    }
-   else
-   {
-      u8_HiNib |= 0x20U; // A..F to lower case a..f
-      if ((u8_HiNib >= 0x61U) && (u8_HiNib <= 0x66U))
-      {
-         u8_HiNib = static_cast<uint8>((static_cast<uint8>(u8_HiNib - 0x57U)) << 4);
-      }
-      else
-      {
-         return (u32_Error);
-      }
-   }
-
-   if ((u8_LoNib >= static_cast<uint8>('0')) && (u8_LoNib <= static_cast<uint8>('9')))
-   {
-      u8_LoNib = static_cast<uint8>(u8_LoNib - 0x30U);
-   }
-   else
-   {
-      u8_LoNib |= 0x20U; // A..F to lower case a..f
-      if ((u8_LoNib >= 0x61U) && (u8_LoNib <= 0x66U))
-      {
-         u8_LoNib = static_cast<uint8>(u8_LoNib - 0x57U);
-      }
-      else
-      {
-         return (u32_Error);
-      }
-   }
-
-   oru8_Data = (u8_HiNib | u8_LoNib);
-   return NO_ERR;
+   return u32_Error;
 }
 
 //************************************************************************
@@ -2409,8 +3075,9 @@ const C_HexDataDump * C_HexFile::GetDataDump(uint32 & oru32_ErrorResult)
 
    if (mq_DumpIsDirty == false)
    {
-      oru32_ErrorResult = NO_ERR;
-      return &this->mc_Dump;
+      //result of last creation (can be an error if created by LoadDataDumpFromFile)
+      oru32_ErrorResult = mu32_DumpError;
+      return (mu32_DumpError == NO_ERR) ? &this->mc_Dump : NULL;
    }
    //First go through whole data and detect number of blocks
    //This will improve speed as we do not need to resize the DynamicArray, potentially
@@ -2533,6 +3200,7 @@ const C_HexDataDump * C_HexFile::GetDataDump(uint32 & oru32_ErrorResult)
       }
    }
    oru32_ErrorResult = NO_ERR;
+   mu32_DumpError = NO_ERR;
    mq_DumpIsDirty = false;
    return &this->mc_Dump;
 }
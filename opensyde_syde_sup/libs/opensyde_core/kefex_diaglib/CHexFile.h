@@ -12,6 +12,7 @@
 #define CHEXFILEH
 
 #include <cstdio> //for "FILE"
+#include <vector>
 #include "stwtypes.h"
 #include "SCLDynamicArray.h"
 
@@ -87,6 +88,11 @@ public:
 
    void Clear(void);
    stw_types::uint32 LoadFromFile(const stw_types::charn * const opcn_FileName);
+   //Load hex file directly into the data dump (much faster for big files; line based functions are not available
+   //                   afterwards)
+   stw_types::uint32 LoadDataDumpFromFile(const stw_types::charn * const opcn_FileName);
+   stw_types::uint32 LoadDataDumpFromMemory(const stw_types::charn * const opcn_Data,
+                                            const stw_types::uint32 ou32_Size);
    stw_types::uint32 SaveToFile(const stw_types::charn * const opcn_FileName);
 
    //Reformat hex file (uses a memory dump internally); only use if you know there are no bigger gaps in the hex file
@@ -160,11 +166,42 @@ protected:
    bool mq_DumpIsDirty;   //flags whether dump has been compromised by changing hex data contents since it was
                           // last built
    stw_types::uint32 mu32_LastOverlayErrorAddress;
+   stw_types::uint32 mu32_DumpError; //result of last dump creation; reported by GetDataDump while dump is not dirty
 
    void InitHexFile(void);
    stw_types::uint32 GetFileType(std::FILE * const opt_File, stw_types::sint32 & ors32_FileType) const;
    stw_types::uint32 LoadIntelHex(std::FILE * const opt_File);
    stw_types::uint32 LoadSRecord(std::FILE * const opt_File);
+
+   ///record parsed by LoadDataDumpFromMemory
+   class C_DumpRecord
+   {
+   public:
+      stw_types::uint32 u32_Address;     ///< data: address (Intel: 16bit offset until resolved); XADR: new offset
+      stw_types::uint32 u32_DataIndex;   ///< index of first data byte in chunk's data buffer
+      const stw_types::uint8 * pu8_Data; ///< data bytes (set after all chunks are parsed)
+      stw_types::uint8 u8_Command;       ///< Intel HEX command (S-Records are converted to mu8_CMD_DATA)
+      stw_types::uint8 u8_Length;        ///< number of data bytes
+
+      bool operator <(const C_DumpRecord & orc_Other) const;
+   };
+
+   ///part of the file parsed by one thread in LoadDataDumpFromMemory
+   class C_DumpChunk
+   {
+   public:
+      const stw_types::charn * pcn_Start; ///< first character of chunk (start of line)
+      const stw_types::charn * pcn_End;   ///< first character after chunk
+      std::vector<C_DumpRecord> c_Records;
+      std::vector<stw_types::uint8> c_Data;
+      stw_types::uint32 u32_NumLines;     ///< number of lines parsed (up to EOF record or error)
+      stw_types::uint32 u32_Error;        ///< first error in chunk (without line number)
+      stw_types::uint8 u8_MaxRecordLength;
+   };
+
+   static void ParseIntelHexChunk(C_DumpChunk * const opc_Chunk);
+   static void ParseSRecordChunk(C_DumpChunk * const opc_Chunk);
+   stw_types::uint32 CreateDataDump(std::vector<C_DumpRecord> & orc_Records);
    stw_types::uint32 CopyHex2Mem(stw_types::uint16 * opu16_BinImage, const stw_types::uint32 ou32_Offset);
    stw_types::uint32 CloseRecord(stw_types::charn * const opcn_Record, bool & orq_RecordOpen);
    static const stw_types::charn * HexLineString(const stw_types::uint8 * const opu8_HexLine);
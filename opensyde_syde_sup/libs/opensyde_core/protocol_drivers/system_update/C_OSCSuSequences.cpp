@@ -27,6 +27,7 @@
 #include "C_OsyHexFile.h"
 #include "C_OSCLoggingHandler.h"
 #include "C_OSCUtils.h"
+#include "C_OSCZipFile.h"
 #include "C_OSCDataDealerNvmSafe.h"
 #include "C_OSCDiagProtocolOsy.h"
 
@@ -288,6 +289,7 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
    uint32 u32_Return;
 
    std::vector<uint32> c_SignatureAddresses(orc_FilesToFlash.size()); ///< addresses of signatures within hex files
+   C_SCLString c_PackageFileName;
 
    //C_OsyHexFile cannot be copied; so we cannot put it into a resizable vector
    //-> create instances manually
@@ -302,7 +304,29 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
    {
       (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_HEX_OPEN_START, C_NO_ERR, 0U, mc_CurrentNode,
                              "Opening HEX file " + orc_FilesToFlash[u32_File] + ".");
-      u32_Return = c_Files[u32_File]->LoadFromFile(orc_FilesToFlash[u32_File].c_str());
+      if ((TGL_FileExists(orc_FilesToFlash[u32_File]) == false) &&
+          (this->m_GetUpdatePackageFileName(orc_FilesToFlash[u32_File], c_PackageFileName) == true))
+      {
+         //not unpacked: parse directly from the update package
+         std::vector<uint8> c_FileContent;
+         if (C_OSCZipFile::h_ReadFileFromZipFile(this->mc_UpdatePackagePath, c_PackageFileName,
+                                                 c_FileContent) == C_NO_ERR)
+         {
+            //lint -e{926} hex file content is text
+            const charn * const pcn_Content =
+               (c_FileContent.size() > 0U) ? reinterpret_cast<const charn *>(&c_FileContent[0]) : NULL;
+            u32_Return = c_Files[u32_File]->LoadDataDumpFromMemory(pcn_Content,
+                                                                   static_cast<uint32>(c_FileContent.size()));
+         }
+         else
+         {
+            u32_Return = stw_hex_file::ERR_CANT_OPEN_FILE;
+         }
+      }
+      else
+      {
+         u32_Return = c_Files[u32_File]->LoadFromFile(orc_FilesToFlash[u32_File].c_str());
+      }
       if (u32_Return != stw_hex_file::NO_ERR)
       {
          C_SCLString c_ErrorText = c_Files[u32_File]->ErrorCodeToErrorText(u32_Return);
@@ -1543,7 +1567,9 @@ sint32 C_OSCSuSequences::m_ReadDeviceInformationStwFlashloader(const uint8 ou8_P
 C_OSCSuSequences::C_OSCSuSequences(void) :
    C_OSCComSequencesBase(true),
    mu32_CurrentNode(0U),
-   mu32_CurrentFile(0U)
+   mu32_CurrentFile(0U),
+   mc_UpdatePackagePath(""),
+   mc_UpdatePackageUnzipPath("")
 {
 }
 
@@ -1573,6 +1599,9 @@ C_OSCSuSequences::~C_OSCSuSequences(void)
    * Files for address based targets and NVM files will be renamed to prevent possible conflicts
    * Flash files for file based devices will not be renamed (as they need to be unique anyway)
    * Does not report any progress via m_ReportProgress().
+   * With oq_CopyFiles = false only the (empty) target folder is created and the resulting paths are returned
+     without copying any file. This can be used by callers that stream the files to their destination on their own
+     (e.g. into a zip archive).
 
    \param[in]     orc_Nodes               List of nodes (part of system definition)
    \param[in]     orc_ActiveNodes         Vector of flags for each node in orc_Nodes
@@ -1583,6 +1612,8 @@ C_OSCSuSequences::~C_OSCSuSequences(void)
                                           out: Paths to resulting files copied and renamed by this function
                                           if the function returns an error this parameter will not be modified
    \param[in,out] opc_ErrorPath           Optional pointer to store path error details (current: which file did fail)
+   \param[in]     oq_CopyFiles            true: copy files and create sub folders of nodes
+                                          false: do not copy files; only determine resulting paths
 
    \return
    C_NO_ERR    files copied
@@ -1603,7 +1634,7 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                                                  const std::vector<uint8> & orc_ActiveNodes,
                                                  const C_SCLString & orc_TargetPath,
                                                  std::vector<C_DoFlash> & orc_ApplicationsToWrite,
-                                                 C_SCLString * const opc_ErrorPath)
+                                                 C_SCLString * const opc_ErrorPath, const bool oq_CopyFiles)
 {
    sint32 s32_Return = C_NO_ERR;
 
@@ -1763,7 +1794,10 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                c_NodeTargetPaths[u16_Node] = TGL_FileIncludeTrailingDelimiter(
                   orc_TargetPath + orc_Nodes[u16_Node].c_Properties.c_Name);
 
-               s32_Return = TGL_CreateDirectory(c_NodeTargetPaths[u16_Node]);
+               if (oq_CopyFiles == true)
+               {
+                  s32_Return = TGL_CreateDirectory(c_NodeTargetPaths[u16_Node]);
+               }
                if (s32_Return != 0)
                {
                   if (opc_ErrorPath != NULL)
@@ -1809,7 +1843,10 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                }
 
                //copy file
-               s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               if (oq_CopyFiles == true)
+               {
+                  s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               }
                if (s32_Return == C_NO_ERR)
                {
                   c_NodesToFlashNewPaths[u16_Node].c_FilesToFlash[u16_File] = c_TargetFileName;
@@ -1834,7 +1871,10 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                   TGL_ExtractFileName(orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u16_File]);
 
                //copy file
-               s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               if (oq_CopyFiles == true)
+               {
+                  s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               }
                if (s32_Return == C_NO_ERR)
                {
                   c_NodesToFlashNewPaths[u16_Node].c_FilesToWriteToNvm[u16_File] = c_TargetFileName;
@@ -2748,12 +2788,20 @@ sint32 C_OSCSuSequences::UpdateSystem(const std::vector<C_OSCSuSequences::C_DoFl
 
                if (s32_Return == C_NO_ERR)
                {
+                  //HEX files for address based openSYDE nodes can be parsed directly from the update package
+                  const C_OSCNode & rc_Node = this->mpc_SystemDefinition->c_Nodes[u16_Node];
+                  const bool q_HexFileFromPackage =
+                     (rc_Node.c_Properties.e_FlashLoader == C_OSCNodeProperties::eFL_OPEN_SYDE) &&
+                     (rc_Node.pc_DeviceDefinition != NULL) &&
+                     (rc_Node.pc_DeviceDefinition->q_FlashloaderOpenSydeIsFileBased == false);
+
                   //do all files exist ?
                   //files for flash:
                   for (uint32 u32_File = 0U; u32_File < orc_ApplicationsToWrite[u16_Node].c_FilesToFlash.size();
                        u32_File++)
                   {
-                     if (TGL_FileExists(orc_ApplicationsToWrite[u16_Node].c_FilesToFlash[u32_File]) == false)
+                     if (this->m_ProvideFile(orc_ApplicationsToWrite[u16_Node].c_FilesToFlash[u32_File],
+                                             q_HexFileFromPackage) != C_NO_ERR)
                      {
                         osc_write_log_error("System Update", "Could not find file \"" +
                                             orc_ApplicationsToWrite[u16_Node].c_FilesToFlash[u32_File] + "\" !");
@@ -2765,7 +2813,8 @@ sint32 C_OSCSuSequences::UpdateSystem(const std::vector<C_OSCSuSequences::C_DoFl
                   for (uint32 u32_File = 0U; u32_File < orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm.size();
                        u32_File++)
                   {
-                     if (TGL_FileExists(orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u32_File]) == false)
+                     if (this->m_ProvideFile(orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u32_File],
+                                             false) != C_NO_ERR)
                      {
                         osc_write_log_error("System Update", "Could not find file \"" +
                                             orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u32_File] + "\" !");
@@ -2954,6 +3003,24 @@ sint32 C_OSCSuSequences::UpdateSystem(const std::vector<C_OSCSuSequences::C_DoFl
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set service update package the files to update were not unpacked from
+
+   Counterpart of C_OSCSuServiceUpdatePackage::h_UnpackPackage with oq_UnpackFilesToUpdate = false.
+   UpdateSystem then takes files located in orc_UnzipPath that are not present on disk from the package:
+   * HEX files for address based openSYDE nodes are parsed directly from the package in memory
+   * all other files are unpacked on demand before the update starts (their consumers work on files)
+
+   \param[in]  orc_PackagePath   path of service update package; empty: do not use a package (default)
+   \param[in]  orc_UnzipPath     path the package was unpacked to (as passed to h_UnpackPackage)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCSuSequences::SetUpdatePackage(const C_SCLString & orc_PackagePath, const C_SCLString & orc_UnzipPath)
+{
+   this->mc_UpdatePackagePath = orc_PackagePath;
+   this->mc_UpdatePackageUnzipPath = orc_UnzipPath;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Reset all devices in the system
 
@@ -3637,6 +3704,87 @@ sint32 C_OSCSuSequences::m_DisconnectFromTargetServer(const bool oq_DisconnectOn
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name of file within the service update package
+
+   \param[in]   orc_FilePath   path of file
+   \param[out]  orc_FileName   name of file within the service update package (only valid if true is returned)
+
+   \return
+   true    update package is set (see SetUpdatePackage) and file is located in its unzip path
+   false   file does not belong to an update package
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCSuSequences::m_GetUpdatePackageFileName(const C_SCLString & orc_FilePath, C_SCLString & orc_FileName) const
+{
+   bool q_Return = false;
+
+   if (this->mc_UpdatePackagePath != "")
+   {
+      const C_SCLString c_UnzipPath = TGL_FileIncludeTrailingDelimiter(this->mc_UpdatePackageUnzipPath);
+      if ((orc_FilePath.Length() > c_UnzipPath.Length()) && (orc_FilePath.Pos(c_UnzipPath) == 1U))
+      {
+         orc_FileName = C_OSCZipFile::h_GetArchiveFileName(
+            orc_FilePath.SubString(c_UnzipPath.Length() + 1U, orc_FilePath.Length() - c_UnzipPath.Length()));
+         q_Return = true;
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Make sure a file to update is available
+
+   Files that are not present on disk are taken from the service update package (see SetUpdatePackage).
+
+   \param[in]  orc_FilePath          path of file
+   \param[in]  oq_KeepInPackage      true: the consumer can work with the file content from the package;
+                                      only check the file is contained
+                                     false: the consumer needs the file on disk; unpack it from the package
+
+   \return
+   C_NO_ERR   file is available
+   C_RD_WR    file is neither present on disk nor in the update package (or could not be unpacked)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCSuSequences::m_ProvideFile(const C_SCLString & orc_FilePath, const bool oq_KeepInPackage) const
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (TGL_FileExists(orc_FilePath) == false)
+   {
+      C_SCLString c_FileName;
+
+      s32_Return = C_RD_WR;
+      if (this->m_GetUpdatePackageFileName(orc_FilePath, c_FileName) == true)
+      {
+         if (oq_KeepInPackage == true)
+         {
+            if (C_OSCZipFile::h_IsFileInZipFile(this->mc_UpdatePackagePath, c_FileName) == true)
+            {
+               s32_Return = C_NO_ERR;
+            }
+         }
+         else
+         {
+            C_SCLString c_ErrorText;
+            if (C_OSCZipFile::h_UnpackFileFromZipFile(this->mc_UpdatePackagePath, c_FileName, orc_FilePath,
+                                                      &c_ErrorText) == C_NO_ERR)
+            {
+               s32_Return = C_NO_ERR;
+            }
+            else
+            {
+               osc_write_log_error("System Update", c_ErrorText);
+            }
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Copies a file from source to target folder (internal function).
 
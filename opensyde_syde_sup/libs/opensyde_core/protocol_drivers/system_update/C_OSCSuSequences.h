@@ -193,7 +193,8 @@ public:
                                                     const std::vector<stw_types::uint8> & orc_ActiveNodes,
                                                     const stw_scl::C_SCLString & orc_TargetPath,
                                                     std::vector<C_DoFlash> & orc_ApplicationsToWrite,
-                                                    stw_scl::C_SCLString * const opc_ErrorPath = NULL);
+                                                    stw_scl::C_SCLString * const opc_ErrorPath = NULL,
+                                                    const bool oq_CopyFiles = true);
    static void h_CheckForChangedApplications(const std::vector<C_ApplicationProperties> & orc_ClientSideApplications,
                                              const std::vector<C_ApplicationProperties> & orc_ServerSideApplications,
                                              std::vector<stw_types::uint8> & orc_ApplicationsPresentOnServer);
@@ -202,6 +203,7 @@ public:
    stw_types::sint32 ReadDeviceInformation(const bool oq_FailOnFirstError = true);
    stw_types::sint32 UpdateSystem(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
                                   const std::vector<stw_types::uint32> & orc_NodesOrder);
+   void SetUpdatePackage(const stw_scl::C_SCLString & orc_PackagePath, const stw_scl::C_SCLString & orc_UnzipPath);
    stw_types::sint32 ResetSystem(void);
 
    static void h_OpenSydeFlashloaderInformationToText(const C_OsyDeviceInformation & orc_Info,
@@ -235,6 +237,9 @@ private:
 
    C_OSCProtocolDriverOsyNode mc_CurrentNode; //node we currently deal with
 
+   stw_scl::C_SCLString mc_UpdatePackagePath;      ///< update package to take missing files from; empty: none
+   stw_scl::C_SCLString mc_UpdatePackageUnzipPath; ///< path the update package was unpacked to
+
    stw_types::sint32 m_FlashNodeOpenSydeHex(const std::vector<stw_scl::C_SCLString> & orc_FilesToFlash,
                                             const std::vector<stw_scl::C_SCLString> & orc_OtherAcceptedDeviceNames,
                                             const stw_types::uint32 ou32_RequestDownloadTimeout,
@@ -268,6 +273,10 @@ private:
                                                const stw_types::uint32 ou32_NodeIndex = 0U);
    stw_types::sint32 m_DisconnectFromTargetServer(const bool oq_DisconnectOnIp2IpRouting = true);
 
+   bool m_GetUpdatePackageFileName(const stw_scl::C_SCLString & orc_FilePath,
+                                   stw_scl::C_SCLString & orc_FileName) const;
+   stw_types::sint32 m_ProvideFile(const stw_scl::C_SCLString & orc_FilePath, const bool oq_KeepInPackage) const;
+
    static stw_types::sint32 mh_CopyFile(const stw_scl::C_SCLString & orc_SourceFile,
                                         const stw_scl::C_SCLString & orc_TargetFile,
                                         stw_scl::C_SCLString * const opc_ErrorPath = NULL);
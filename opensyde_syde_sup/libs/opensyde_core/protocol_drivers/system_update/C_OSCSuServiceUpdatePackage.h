@@ -56,7 +56,8 @@ public:
                                             std::vector<stw_types::uint32> & orc_NodesUpdateOrder,
                                             std::vector<C_OSCSuSequences::C_DoFlash> & orc_ApplicationsToWrite,
                                             stw_scl::C_SCLStringList & orc_WarningMessages,
-                                            stw_scl::C_SCLString & orc_ErrorMessage);
+                                            stw_scl::C_SCLString & orc_ErrorMessage,
+                                            const bool oq_UnpackFilesToUpdate = true);
 
    static stw_scl::C_SCLString h_GetPackageExtension();
 
@@ -93,9 +94,6 @@ protected:
                                                          const std::vector<stw_types::uint32> & orc_NodesUpdateOrder,
                                                          const std::vector<stw_opensyde_core::C_OSCSuSequences::C_DoFlash> & orc_ApplicationsToWrite);
 
-   static stw_types::sint32 h_CopyFile(const stw_scl::C_SCLString & orc_SourceFile,
-                                       const stw_scl::C_SCLString & orc_TargetFile);
-
    static void h_CreateUpdatePackageDefFile(const stw_scl::C_SCLString & orc_Path,
                                             const C_SupDefContent & orc_SupDefContent);
 
@@ -118,9 +116,13 @@ protected:
    static stw_types::sint32 h_SetNodesUpdateOrder(const std::map<stw_types::uint32,
                                                                  stw_types::uint32> & orc_UpdateOrderByNodes,
                                                   std::vector<stw_types::uint32> & orc_NodesUpdateOrder);
-   static void h_AppendFilesRelative(std::set<stw_scl::C_SCLString> & orc_Set,
+   static void h_AppendFilesRelative(std::map<stw_scl::C_SCLString, stw_scl::C_SCLString> & orc_Map,
                                      const std::vector<stw_scl::C_SCLString> & orc_Files,
+                                     const std::vector<stw_scl::C_SCLString> & orc_SourceFiles,
                                      const stw_scl::C_SCLString & orc_BasePath);
+   static void h_AppendArchiveFileNames(std::set<stw_scl::C_SCLString> & orc_Set,
+                                        const std::vector<stw_scl::C_SCLString> & orc_Files,
+                                        const stw_scl::C_SCLString & orc_BasePath);
    static void h_LoadFilesSection(std::vector<stw_scl::C_SCLString> & orc_Files,
                                   const stw_types::uint32 ou32_NodeCounter, const stw_types::uint32 ou32_UpdatePos,
                                   std::map<stw_types::uint32,
@@ -10,19 +10,619 @@
 //----------------------------------------------------------------------------------------------------------------------
 #include "precomp_headers.h" //pre-compiled headers
 
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+#include <algorithm>
+#include <sys/stat.h>
+
 #include "stwtypes.h"
 #include "stwerrors.h"
 #include "C_OsyHexFile.h"
 #include "CSCLString.h"
 #include "CXFLECUInformation.h"
+#include "TGLFile.h"
 #include "TGLUtils.h"
+#include "C_OSCUtils.h"
+#include "C_OSCLoggingHandler.h"
 
 using namespace stw_types;
 using namespace stw_errors;
 using namespace stw_opensyde_core;
 using namespace stw_scl;
+using namespace stw_tgl;
 using namespace stw_diag_lib;
 
+//constants of the XXH64 hash algorithm
+static const uint64 mu64_HASH_PRIME_1 = 0x9E3779B185EBCA87ULL;
+static const uint64 mu64_HASH_PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64 mu64_HASH_PRIME_3 = 0x165667B19E3779F9ULL;
+static const uint64 mu64_HASH_PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64 mu64_HASH_PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+///cache file found by C_OsyHexFile::h_CleanUpCacheDirectory
+class C_HexCacheFileInfo
+{
+public:
+   C_SCLString c_FileName;
+   uint64 u64_Size;
+   std::time_t t_ModificationTime;
+
+   //sort newest files first
+   bool operator <(const C_HexCacheFileInfo & orc_Other) const
+   {
+      return (this->t_ModificationTime > orc_Other.t_ModificationTime);
+   }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append 32bit value to buffer (little endian)
+
+   \param[in,out]  orc_Buffer   buffer to append to
+   \param[in]      ou32_Value   value to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_AppendUint32(std::vector<uint8> & orc_Buffer, const uint32 ou32_Value)
+{
+   orc_Buffer.push_back(static_cast<uint8>(ou32_Value));
+   orc_Buffer.push_back(static_cast<uint8>(ou32_Value >> 8U));
+   orc_Buffer.push_back(static_cast<uint8>(ou32_Value >> 16U));
+   orc_Buffer.push_back(static_cast<uint8>(ou32_Value >> 24U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append signed 32bit value to buffer (little endian; two's complement)
+
+   \param[in,out]  orc_Buffer   buffer to append to
+   \param[in]      os32_Value   value to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_AppendSint32(std::vector<uint8> & orc_Buffer, const sint32 os32_Value)
+{
+   m_AppendUint32(orc_Buffer, static_cast<uint32>(os32_Value));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append raw bytes to buffer
+
+   \param[in,out]  orc_Buffer      buffer to append to
+   \param[in]      opv_Data        data to append
+   \param[in]      ou32_NumBytes   number of bytes to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_AppendBytes(std::vector<uint8> & orc_Buffer, const void * const opv_Data, const uint32 ou32_NumBytes)
+{
+   if (ou32_NumBytes > 0U)
+   {
+      const uint32 u32_Index = static_cast<uint32>(orc_Buffer.size());
+      orc_Buffer.resize(u32_Index + ou32_NumBytes);
+      (void)std::memcpy(&orc_Buffer[u32_Index], opv_Data, ou32_NumBytes);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 32bit value from buffer (little endian)
+
+   \param[in]      orc_Buffer    buffer to read from
+   \param[in,out]  oru32_Index   in: index of first byte to read; out: index behind the value
+   \param[out]     oru32_Value   read value
+
+   \return
+   true    value read
+   false   not enough data in buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_ReadUint32(const std::vector<uint8> & orc_Buffer, uint32 & oru32_Index, uint32 & oru32_Value)
+{
+   bool q_Return = false;
+
+   if ((orc_Buffer.size() >= 4U) && (oru32_Index <= (orc_Buffer.size() - 4U)))
+   {
+      oru32_Value = static_cast<uint32>(orc_Buffer[oru32_Index]) +
+                    (static_cast<uint32>(orc_Buffer[static_cast<size_t>(oru32_Index) + 1U]) << 8U) +
+                    (static_cast<uint32>(orc_Buffer[static_cast<size_t>(oru32_Index) + 2U]) << 16U) +
+                    (static_cast<uint32>(orc_Buffer[static_cast<size_t>(oru32_Index) + 3U]) << 24U);
+      oru32_Index += 4U;
+      q_Return = true;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read signed 32bit value from buffer (little endian; two's complement)
+
+   sint32 might be wider than 32bit on some platforms; so we cannot simply cast the unsigned value.
+
+   \param[in]      orc_Buffer    buffer to read from
+   \param[in,out]  oru32_Index   in: index of first byte to read; out: index behind the value
+   \param[out]     ors32_Value   read value
+
+   \return
+   true    value read
+   false   not enough data in buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_ReadSint32(const std::vector<uint8> & orc_Buffer, uint32 & oru32_Index, sint32 & ors32_Value)
+{
+   uint32 u32_Value = 0U;
+   const bool q_Return = m_ReadUint32(orc_Buffer, oru32_Index, u32_Value);
+
+   if ((u32_Value & 0x80000000U) != 0U)
+   {
+      ors32_Value = -static_cast<sint32>((~u32_Value) & 0x7FFFFFFFU) - 1;
+   }
+   else
+   {
+      ors32_Value = static_cast<sint32>(u32_Value);
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read raw bytes from buffer
+
+   \param[in]      orc_Buffer      buffer to read from
+   \param[in,out]  oru32_Index     in: index of first byte to read; out: index behind the read bytes
+   \param[out]     opv_Data        read bytes
+   \param[in]      ou32_NumBytes   number of bytes to read
+
+   \return
+   true    bytes read
+   false   not enough data in buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_ReadBytes(const std::vector<uint8> & orc_Buffer, uint32 & oru32_Index, void * const opv_Data,
+                        const uint32 ou32_NumBytes)
+{
+   bool q_Return = false;
+
+   if ((oru32_Index <= orc_Buffer.size()) && (ou32_NumBytes <= (orc_Buffer.size() - oru32_Index)))
+   {
+      if (ou32_NumBytes > 0U)
+      {
+         (void)std::memcpy(opv_Data, &orc_Buffer[oru32_Index], ou32_NumBytes);
+      }
+      oru32_Index += ou32_NumBytes;
+      q_Return = true;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 64bit value from memory (little endian)
+
+   \param[in]  opu8_Data   data to read from
+
+   \return
+   read value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64 m_GetUint64(const uint8 * const opu8_Data)
+{
+   uint64 u64_Value = 0U;
+
+   for (uint32 u32_Byte = 8U; u32_Byte > 0U; u32_Byte--)
+   {
+      u64_Value = (u64_Value << 8U) + opu8_Data[u32_Byte - 1U];
+   }
+   return u64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Rotate 64bit value to the left
+
+   \param[in]  ou64_Value  value to rotate
+   \param[in]  ou8_Bits    number of bits to rotate by (1..63)
+
+   \return
+   rotated value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64 m_RotateLeft(const uint64 ou64_Value, const uint8 ou8_Bits)
+{
+   return (ou64_Value << ou8_Bits) | (ou64_Value >> (64U - ou8_Bits));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   One round of the hash algorithm (see m_CalcHash)
+
+   \param[in]  ou64_Accumulator  accumulator
+   \param[in]  ou64_Input        input value
+
+   \return
+   new accumulator value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64 m_HashRound(const uint64 ou64_Accumulator, const uint64 ou64_Input)
+{
+   return m_RotateLeft(ou64_Accumulator + (ou64_Input * mu64_HASH_PRIME_2), 31U) * mu64_HASH_PRIME_1;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Calculate 64bit hash over a block of data
+
+   Implements the XXH64 algorithm of xxHash (seed 0).
+   Used to identify hex files and to check the integrity of cache files.
+   It is several times faster than MD5 or CRC32 which makes a difference for hex files of dozens of MB.
+   The hash is not cryptographically secure; so it is not meant to protect against deliberate manipulations.
+
+   \param[in]  opu8_Data       data to hash
+   \param[in]  ou32_NumBytes   number of bytes to hash
+
+   \return
+   hash value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64 m_CalcHash(const uint8 * const opu8_Data, const uint32 ou32_NumBytes)
+{
+   uint64 u64_Hash;
+   uint32 u32_Index = 0U;
+
+   if (ou32_NumBytes >= 32U)
+   {
+      uint64 au64_Accumulators[4] =
+      {
+         mu64_HASH_PRIME_1 + mu64_HASH_PRIME_2, mu64_HASH_PRIME_2, 0U, 0U - mu64_HASH_PRIME_1
+      };
+
+      for (; u32_Index <= (ou32_NumBytes - 32U); u32_Index += 32U)
+      {
+         for (uint32 u32_Lane = 0U; u32_Lane < 4U; u32_Lane++)
+         {
+            au64_Accumulators[u32_Lane] = m_HashRound(au64_Accumulators[u32_Lane],
+                                                      m_GetUint64(&opu8_Data[u32_Index + (u32_Lane * 8U)]));
+         }
+      }
+
+      u64_Hash = m_RotateLeft(au64_Accumulators[0], 1U) + m_RotateLeft(au64_Accumulators[1], 7U) +
+                 m_RotateLeft(au64_Accumulators[2], 12U) + m_RotateLeft(au64_Accumulators[3], 18U);
+      for (uint32 u32_Lane = 0U; u32_Lane < 4U; u32_Lane++)
+      {
+         u64_Hash ^= m_HashRound(0U, au64_Accumulators[u32_Lane]);
+         u64_Hash = (u64_Hash * mu64_HASH_PRIME_1) + mu64_HASH_PRIME_4;
+      }
+   }
+   else
+   {
+      u64_Hash = mu64_HASH_PRIME_5;
+   }
+
+   u64_Hash += ou32_NumBytes;
+
+   //remaining bytes:
+   for (; (u32_Index + 8U) <= ou32_NumBytes; u32_Index += 8U)
+   {
+      u64_Hash ^= m_HashRound(0U, m_GetUint64(&opu8_Data[u32_Index]));
+      u64_Hash = (m_RotateLeft(u64_Hash, 27U) * mu64_HASH_PRIME_1) + mu64_HASH_PRIME_4;
+   }
+   if ((u32_Index + 4U) <= ou32_NumBytes)
+   {
+      const uint64 u64_Value = static_cast<uint64>(opu8_Data[u32_Index]) +
+                               (static_cast<uint64>(opu8_Data[u32_Index + 1U]) << 8U) +
+                               (static_cast<uint64>(opu8_Data[u32_Index + 2U]) << 16U) +
+                               (static_cast<uint64>(opu8_Data[u32_Index + 3U]) << 24U);
+      u64_Hash ^= u64_Value * mu64_HASH_PRIME_1;
+      u64_Hash = (m_RotateLeft(u64_Hash, 23U) * mu64_HASH_PRIME_2) + mu64_HASH_PRIME_3;
+      u32_Index += 4U;
+   }
+   for (; u32_Index < ou32_NumBytes; u32_Index++)
+   {
+      u64_Hash ^= static_cast<uint64>(opu8_Data[u32_Index]) * mu64_HASH_PRIME_5;
+      u64_Hash = m_RotateLeft(u64_Hash, 11U) * mu64_HASH_PRIME_1;
+   }
+
+   //final mix:
+   u64_Hash ^= u64_Hash >> 33U;
+   u64_Hash *= mu64_HASH_PRIME_2;
+   u64_Hash ^= u64_Hash >> 29U;
+   u64_Hash *= mu64_HASH_PRIME_3;
+   u64_Hash ^= u64_Hash >> 32U;
+
+   return u64_Hash;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read complete file into memory
+
+   \param[in]   orc_FileName   path of file
+   \param[out]  orc_Content    file content
+
+   \return
+   C_NO_ERR   file read
+   C_RD_WR    could not read file (or file is empty)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static sint32 m_ReadFile(const C_SCLString & orc_FileName, std::vector<uint8> & orc_Content)
+{
+   sint32 s32_Return = C_RD_WR;
+   const sint32 s32_FileSize = TGL_FileSize(orc_FileName);
+
+   orc_Content.clear();
+   if (s32_FileSize > 0)
+   {
+      std::FILE * const pt_File = std::fopen(orc_FileName.c_str(), "rb");
+      if (pt_File != NULL)
+      {
+         orc_Content.resize(static_cast<size_t>(s32_FileSize));
+         if (std::fread(&orc_Content[0], 1U, orc_Content.size(), pt_File) == orc_Content.size())
+         {
+            s32_Return = C_NO_ERR;
+         }
+         (void)std::fclose(pt_File);
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OsyHexFile::C_OsyHexFile(void) :
+   C_XFLHexFile(),
+   mq_LoadedFromCache(false),
+   mq_ScanResultsValid(false),
+   ms32_SignatureBlockResult(C_NOACT),
+   mu32_SignatureBlockAddress(0U),
+   ms32_DeviceIdResult(C_NOACT),
+   ms32_ApplicationInfoResult(C_NOACT)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load hex file
+
+   Drops all cached information, then loads the file with C_HexFile::LoadFromFile.
+
+   \param[in]  opcn_FileName  path of hex file
+
+   \return
+   see C_HexFile::LoadFromFile
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OsyHexFile::LoadFromFile(const charn * const opcn_FileName)
+{
+   this->mq_LoadedFromCache = false;
+   this->mq_ScanResultsValid = false;
+   return C_XFLHexFile::LoadFromFile(opcn_FileName);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load hex file directly into data dump
+
+   Drops all cached information, then loads the file with C_HexFile::LoadDataDumpFromFile.
+
+   \param[in]  opcn_FileName  path of hex file
+
+   \return
+   see C_HexFile::LoadDataDumpFromFile
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OsyHexFile::LoadDataDumpFromFile(const charn * const opcn_FileName)
+{
+   this->mq_LoadedFromCache = false;
+   this->mq_ScanResultsValid = false;
+   return C_XFLHexFile::LoadDataDumpFromFile(opcn_FileName);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load hex file content from memory directly into data dump
+
+   Drops all cached information, then loads the content with C_HexFile::LoadDataDumpFromMemory.
+
+   \param[in]  opcn_Data   hex file content
+   \param[in]  ou32_Size   number of bytes in opcn_Data
+
+   \return
+   see C_HexFile::LoadDataDumpFromMemory
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OsyHexFile::LoadDataDumpFromMemory(const charn * const opcn_Data, const uint32 ou32_Size)
+{
+   this->mq_LoadedFromCache = false;
+   this->mq_ScanResultsValid = false;
+   return C_XFLHexFile::LoadDataDumpFromMemory(opcn_Data, ou32_Size);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load hex file directly into data dump using a cache
+
+   Reads the file and passes its content to LoadDataDumpFromMemoryCached.
+   If no cache directory is set or the file cannot be read the file is loaded with LoadDataDumpFromFile.
+
+   \param[in]  orc_FileName         path of hex file
+   \param[in]  orc_CacheDirectory   directory to store cache files in; will be created if it does not exist;
+                                    if empty the cache is not used
+
+   \return
+   see C_HexFile::LoadDataDumpFromFile
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OsyHexFile::LoadDataDumpFromFileCached(const C_SCLString & orc_FileName,
+                                                const C_SCLString & orc_CacheDirectory)
+{
+   uint32 u32_Return;
+   std::vector<uint8> c_FileContent;
+
+   if ((orc_CacheDirectory != "") && (m_ReadFile(orc_FileName, c_FileContent) == C_NO_ERR))
+   {
+      u32_Return = this->LoadDataDumpFromMemoryCached(c_FileContent, orc_CacheDirectory);
+   }
+   else
+   {
+      u32_Return = this->LoadDataDumpFromFile(orc_FileName.c_str());
+   }
+
+   return u32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load hex file content from memory directly into data dump using a cache
+
+   The cache is content addressed: the name of the cache file is a hash over the content of the hex file.
+   So renamed or copied files are found in the cache while modified files are never confused with their older
+    versions. The same cache file is used no matter whether the content was read from a file or from an archive.
+
+   If a valid cache file exists the data dump and the results of GetSignatureBlockAddress, ScanDeviceIdFromHexFile
+    and ScanApplicationInformationBlockFromHexFile are taken from there without parsing or scanning the hex file.
+   Otherwise the content is loaded with LoadDataDumpFromMemory, scanned and a cache file is written.
+
+   Problems with the cache (directory cannot be created, broken cache file, ...) are not reported as errors.
+   In this case we fall back to parsing the content.
+
+   The cached scan results stay valid until the next file is loaded.
+   So do not modify the hex file contents after loading it with this function.
+
+   \param[in]  orc_Content          hex file content
+   \param[in]  orc_CacheDirectory   directory to store cache files in; will be created if it does not exist;
+                                    if empty the cache is not used
+
+   \return
+   see C_HexFile::LoadDataDumpFromMemory
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OsyHexFile::LoadDataDumpFromMemoryCached(const std::vector<uint8> & orc_Content,
+                                                  const C_SCLString & orc_CacheDirectory)
+{
+   uint32 u32_Return = stw_hex_file::NO_ERR;
+   const uint32 u32_FileSize = static_cast<uint32>(orc_Content.size());
+   //lint -e{926} hex file content is text
+   const charn * const pcn_Content = (u32_FileSize > 0U) ? reinterpret_cast<const charn *>(&orc_Content[0]) : NULL;
+   uint64 u64_FileHash = 0U;
+   C_SCLString c_CacheFileName;
+   bool q_UseCache = false;
+
+   this->mq_LoadedFromCache = false;
+   this->mq_ScanResultsValid = false;
+
+   if ((orc_CacheDirectory != "") && (u32_FileSize > 0U))
+   {
+      C_SCLString c_Hash;
+      u64_FileHash = m_CalcHash(&orc_Content[0], u32_FileSize);
+      c_Hash.PrintFormatted("%08X%08X", static_cast<uint32>(u64_FileHash >> 32U),
+                            static_cast<uint32>(u64_FileHash & 0xFFFFFFFFU));
+      c_CacheFileName = TGL_FileIncludeTrailingDelimiter(orc_CacheDirectory) + c_Hash + ".syde_hexcache";
+      q_UseCache = true;
+   }
+
+   if ((q_UseCache == true) && (TGL_FileExists(c_CacheFileName) == true) &&
+       (this->m_LoadCacheFile(c_CacheFileName, u64_FileHash, u32_FileSize) == C_NO_ERR))
+   {
+      this->mq_LoadedFromCache = true;
+   }
+   else
+   {
+      u32_Return = C_XFLHexFile::LoadDataDumpFromMemory(pcn_Content, u32_FileSize);
+      if ((u32_Return == stw_hex_file::NO_ERR) && (q_UseCache == true))
+      {
+         this->m_ScanInformation();
+         if ((TGL_DirectoryExists(orc_CacheDirectory) == true) ||
+             (C_OSCUtils::h_CreateFolderRecursively(orc_CacheDirectory) == C_NO_ERR))
+         {
+            if (this->m_SaveCacheFile(c_CacheFileName, u64_FileHash, u32_FileSize) != C_NO_ERR)
+            {
+               osc_write_log_warning("HEX file cache", "Could not write cache file \"" + c_CacheFileName + "\".");
+            }
+         }
+         else
+         {
+            osc_write_log_warning("HEX file cache", "Could not create cache directory \"" + orc_CacheDirectory + "\".");
+         }
+      }
+   }
+
+   return u32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get whether the last cached load took the data from the cache
+
+   \return
+   true    data was taken from the cache
+   false   data was loaded from the hex file (or not loaded at all)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OsyHexFile::IsLoadedFromCache(void) const
+{
+   return this->mq_LoadedFromCache;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove cache files exceeding the age or size limits
+
+   Removes the cache files written by LoadDataDumpFromFileCached and LoadDataDumpFromMemoryCached from the cache
+    directory:
+   * files written more than ou32_MaxAgeDays days ago
+   * then the oldest files until the total size of the remaining files is ou64_MaxTotalSize or less
+
+   The age is the time since the cache file was written, not since it was used last.
+   A frequently used file is removed after the age limit and written again when it is loaded the next time.
+   Other files in the directory are not touched.
+   Files that cannot be removed (e.g. as they are used by another process) are skipped.
+
+   \param[in]  orc_CacheDirectory   directory cache files are stored in
+   \param[in]  ou64_MaxTotalSize    maximum total size of all cache files in bytes
+   \param[in]  ou32_MaxAgeDays      maximum age of a cache file in days
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyHexFile::h_CleanUpCacheDirectory(const C_SCLString & orc_CacheDirectory, const uint64 ou64_MaxTotalSize,
+                                           const uint32 ou32_MaxAgeDays)
+{
+   SCLDynamicArray<TGL_FileSearchRecord> c_FoundFiles;
+   std::vector<C_HexCacheFileInfo> c_CacheFiles;
+   const std::time_t t_Now = std::time(NULL);
+   const std::time_t t_MaxAge = static_cast<std::time_t>(ou32_MaxAgeDays) * static_cast<std::time_t>(86400);
+   uint64 u64_TotalSize = 0U;
+   uint32 u32_RemovedFiles = 0U;
+
+   if ((orc_CacheDirectory != "") &&
+       (TGL_FileFind(TGL_FileIncludeTrailingDelimiter(orc_CacheDirectory) + "*.syde_hexcache", c_FoundFiles) ==
+        C_NO_ERR))
+   {
+      for (sint32 s32_File = 0; s32_File < c_FoundFiles.GetLength(); s32_File++)
+      {
+         struct stat c_Stat;
+         if (stat(c_FoundFiles[s32_File].c_FileName.c_str(), &c_Stat) == 0)
+         {
+            C_HexCacheFileInfo c_Info;
+            c_Info.c_FileName = c_FoundFiles[s32_File].c_FileName;
+            c_Info.u64_Size = static_cast<uint64>(c_Stat.st_size);
+            c_Info.t_ModificationTime = c_Stat.st_mtime;
+            c_CacheFiles.push_back(c_Info);
+         }
+      }
+      std::sort(c_CacheFiles.begin(), c_CacheFiles.end());
+
+      for (uint32 u32_File = 0U; u32_File < c_CacheFiles.size(); u32_File++)
+      {
+         const C_HexCacheFileInfo & rc_Info = c_CacheFiles[u32_File];
+         if (((t_Now - rc_Info.t_ModificationTime) > t_MaxAge) ||
+             ((u64_TotalSize + rc_Info.u64_Size) > ou64_MaxTotalSize))
+         {
+            if (std::remove(rc_Info.c_FileName.c_str()) == 0)
+            {
+               u32_RemovedFiles++;
+            }
+            else
+            {
+               u64_TotalSize += rc_Info.u64_Size;
+            }
+         }
+         else
+         {
+            u64_TotalSize += rc_Info.u64_Size;
+         }
+      }
+
+      if (u32_RemovedFiles > 0U)
+      {
+         osc_write_log_info("HEX file cache", "Removed " + C_SCLString::IntToStr(u32_RemovedFiles) +
+                            " file(s) exceeding the cache limits from \"" + orc_CacheDirectory + "\".");
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   get address of signature block from hex file
 
@@ -32,6 +632,9 @@ using namespace stw_diag_lib;
    Possible approach when we have the flash packages: put the address into the package information.
     The signature generator has this information anyway.
 
+   If the file was loaded with one of the cached loaders the result of the scan is already known and returned
+    directly.
+
    \param[out]     oru32_Address             address of signature block
 
    \return
@@ -43,13 +646,21 @@ sint32 C_OsyHexFile::GetSignatureBlockAddress(uint32 & oru32_Address)
 {
    sint32 s32_Return;
 
-   oru32_Address = this->mu32_MinAdr;
-
-   //lint -e{926}
-   s32_Return = this->FindPattern(oru32_Address, 10, reinterpret_cast<const uint8 *>(";zwm2KgUZ!"));
-   if (s32_Return == -1)
+   if (this->mq_ScanResultsValid == true)
    {
-      s32_Return = C_NOACT;
+      oru32_Address = this->mu32_SignatureBlockAddress;
+      s32_Return = this->ms32_SignatureBlockResult;
+   }
+   else
+   {
+      oru32_Address = this->mu32_MinAdr;
+
+      //lint -e{926}
+      s32_Return = this->FindPattern(oru32_Address, 10, reinterpret_cast<const uint8 *>(";zwm2KgUZ!"));
+      if (s32_Return == -1)
+      {
+         s32_Return = C_NOACT;
+      }
    }
    return s32_Return;
 }
@@ -61,6 +672,8 @@ sint32 C_OsyHexFile::GetSignatureBlockAddress(uint32 & oru32_Address)
    Then extract the device ID from it and return it.
    If the application_info structure with the device ID information is in the hex file more than once, AND
     the device ID in at least one of the copies is different, we fail.
+   If the file was loaded with one of the cached loaders the result of the scan is already known and returned
+    directly.
 
    \param[out]    orc_DeviceID                     device ID found in hex-file
 
@@ -77,7 +690,15 @@ sint32 C_OsyHexFile::ScanDeviceIdFromHexFile(C_SCLString & orc_DeviceID)
    C_SCLString c_DeviceID = "";
 
    SCLDynamicArray<C_XFLECUInformation> c_InfoBlocks;
-   s32_Return = this->GetECUInformationBlocks(c_InfoBlocks, 0x0U, false, false, true);
+   if (this->mq_ScanResultsValid == true)
+   {
+      s32_Return = this->ms32_DeviceIdResult;
+      c_DeviceID = this->mc_DeviceId;
+   }
+   else
+   {
+      s32_Return = this->GetECUInformationBlocks(c_InfoBlocks, 0x0U, false, false, true);
+   }
    if ((s32_Return == C_NO_ERR) && (c_InfoBlocks.GetLength() > 0))
    {
       for (s32_Index = 0; s32_Index < c_InfoBlocks.GetLength(); s32_Index++)
@@ -121,6 +742,8 @@ sint32 C_OsyHexFile::ScanDeviceIdFromHexFile(C_SCLString & orc_DeviceID)
    Then extract the information from it and return it.
    Multiple instances of the application_info structure are considered an error
    or warning depending on the device names reported in all application blocks.
+   If the file was loaded with one of the cached loaders the result of the scan is already known and returned
+    directly.
 
    \param[out]    orc_InfoBlock        application info block found in hex file
 
@@ -137,34 +760,311 @@ sint32 C_OsyHexFile::ScanApplicationInformationBlockFromHexFile(C_XFLECUInformat
    sint32 s32_Return;
 
    SCLDynamicArray<C_XFLECUInformation> c_InfoBlocks;
-   s32_Return = this->GetECUInformationBlocks(c_InfoBlocks, 0x0U, false, false, true);
-   tgl_assert(s32_Return == C_NO_ERR); //no plausible reasons documented
 
-   if (c_InfoBlocks.GetLength() == 0)
+   if (this->mq_ScanResultsValid == true)
    {
-      s32_Return = C_NOACT;
+      s32_Return = this->ms32_ApplicationInfoResult;
+      if ((s32_Return == C_NO_ERR) || (s32_Return == C_WARN))
+      {
+         orc_InfoBlock = this->mc_ApplicationInfo;
+      }
    }
-   else if (c_InfoBlocks.GetLength() > 1)
+   else
    {
-      for (sint32 s32_Pos = 1; s32_Pos < c_InfoBlocks.GetLength(); s32_Pos++)
+      s32_Return = this->GetECUInformationBlocks(c_InfoBlocks, 0x0U, false, false, true);
+      tgl_assert(s32_Return == C_NO_ERR); //no plausible reasons documented
+
+      if (c_InfoBlocks.GetLength() == 0)
+      {
+         s32_Return = C_NOACT;
+      }
+      else if (c_InfoBlocks.GetLength() > 1)
       {
-         // compare every device name with first device name, this is enough because all must be equal
-         if (c_InfoBlocks[0].GetDeviceID() != c_InfoBlocks[s32_Pos].GetDeviceID())
+         for (sint32 s32_Pos = 1; s32_Pos < c_InfoBlocks.GetLength(); s32_Pos++)
          {
-            s32_Return = C_OVERFLOW;
+            // compare every device name with first device name, this is enough because all must be equal
+            if (c_InfoBlocks[0].GetDeviceID() != c_InfoBlocks[s32_Pos].GetDeviceID())
+            {
+               s32_Return = C_OVERFLOW;
+            }
+            else
+            {
+               orc_InfoBlock = c_InfoBlocks[0];
+               s32_Return = C_WARN;
+            }
          }
-         else
+      }
+      else
+      {
+         //one block found !
+         orc_InfoBlock = c_InfoBlocks[0];
+         s32_Return = C_NO_ERR;
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run all scan functions and remember their results
+
+   Results are used by the scan functions and written to cache files.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyHexFile::m_ScanInformation(void)
+{
+   this->mq_ScanResultsValid = false;
+   this->mu32_SignatureBlockAddress = 0U;
+   this->mc_DeviceId = "";
+   this->mc_ApplicationInfo.ClearContents();
+
+   this->ms32_SignatureBlockResult = this->GetSignatureBlockAddress(this->mu32_SignatureBlockAddress);
+   this->ms32_DeviceIdResult = this->ScanDeviceIdFromHexFile(this->mc_DeviceId);
+   this->ms32_ApplicationInfoResult = this->ScanApplicationInformationBlockFromHexFile(this->mc_ApplicationInfo);
+   this->mq_ScanResultsValid = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load data dump and scan results from cache file
+
+   Cache file layout (all values little endian):
+   * magic "OHXC"; file version (uint16); hash of hex file (uint64); size of hex file (uint32)
+   * lowest address; highest address; number of data bytes (uint32 each)
+   * result and address of signature block (sint32, uint32)
+   * result of device ID scan (sint32); length of device ID (uint8); device ID
+   * result of application information scan (sint32); application information block
+   * number of data dump blocks (uint32); for each block: address, size (uint32 each) and data
+   * hash over all preceding bytes (uint64)
+   64bit values are stored as two uint32 values (lower half first).
+
+   \param[in]  orc_CacheFileName  path of cache file
+   \param[in]  ou64_FileHash      expected hash of hex file
+   \param[in]  ou32_FileSize      expected size of hex file
+
+   \return
+   C_NO_ERR   data loaded
+   C_RD_WR    cache file could not be read or is invalid (data dump and scan results are cleared)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OsyHexFile::m_LoadCacheFile(const C_SCLString & orc_CacheFileName, const uint64 ou64_FileHash,
+                                     const uint32 ou32_FileSize)
+{
+   std::vector<uint8> c_Buffer;
+   sint32 s32_Return = m_ReadFile(orc_CacheFileName, c_Buffer);
+
+   if ((s32_Return == C_NO_ERR) && (c_Buffer.size() > 8U))
+   {
+      uint32 u32_Index = static_cast<uint32>(c_Buffer.size() - 8U);
+      uint32 u32_HashLow = 0U;
+      uint32 u32_HashHigh = 0U;
+
+      (void)m_ReadUint32(c_Buffer, u32_Index, u32_HashLow);
+      (void)m_ReadUint32(c_Buffer, u32_Index, u32_HashHigh);
+      c_Buffer.resize(c_Buffer.size() - 8U);
+      if (m_CalcHash(&c_Buffer[0], static_cast<uint32>(c_Buffer.size())) !=
+          ((static_cast<uint64>(u32_HashHigh) << 32U) + u32_HashLow))
+      {
+         s32_Return = C_RD_WR;
+      }
+   }
+   else
+   {
+      s32_Return = C_RD_WR;
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      charn acn_Magic[4];
+      uint8 au8_Version[2];
+      uint32 u32_HashLow = 0U;
+      uint32 u32_HashHigh = 0U;
+      uint32 u32_FileSize = 0U;
+      uint32 u32_Index = 0U;
+      uint32 u32_NumBlocks = 0U;
+      uint8 u8_Length = 0U;
+      charn acn_DeviceId[256];
+      C_XFLECUInformation & rc_Info = this->mc_ApplicationInfo;
+      bool q_Ok;
+
+      this->Clear();
+      this->mc_Dump.at_Blocks.SetLength(0);
+      this->mc_DeviceId = "";
+      rc_Info.ClearContents();
+
+      q_Ok = m_ReadBytes(c_Buffer, u32_Index, &acn_Magic[0], sizeof(acn_Magic)) &&
+             m_ReadBytes(c_Buffer, u32_Index, &au8_Version[0], sizeof(au8_Version)) &&
+             m_ReadUint32(c_Buffer, u32_Index, u32_HashLow) && m_ReadUint32(c_Buffer, u32_Index, u32_HashHigh) &&
+             m_ReadUint32(c_Buffer, u32_Index, u32_FileSize);
+      //the hash is part of the file name; but make sure we do not use a renamed cache file of another hex file
+      q_Ok = q_Ok && (std::memcmp(&acn_Magic[0], "OHXC", sizeof(acn_Magic)) == 0) &&
+             ((static_cast<uint16>(au8_Version[0]) + (static_cast<uint16>(au8_Version[1]) << 8U)) ==
+              mhu16_CACHE_FILE_VERSION) &&
+             (((static_cast<uint64>(u32_HashHigh) << 32U) + u32_HashLow) == ou64_FileHash) &&
+             (u32_FileSize == ou32_FileSize);
+      q_Ok = q_Ok && m_ReadUint32(c_Buffer, u32_Index, this->mu32_MinAdr) &&
+             m_ReadUint32(c_Buffer, u32_Index, this->mu32_MaxAdr) &&
+             m_ReadUint32(c_Buffer, u32_Index, this->mu32_NumRawBytes);
+      q_Ok = q_Ok && m_ReadSint32(c_Buffer, u32_Index, this->ms32_SignatureBlockResult) &&
+             m_ReadUint32(c_Buffer, u32_Index, this->mu32_SignatureBlockAddress);
+      q_Ok = q_Ok && m_ReadSint32(c_Buffer, u32_Index, this->ms32_DeviceIdResult) &&
+             m_ReadBytes(c_Buffer, u32_Index, &u8_Length, 1U) &&
+             m_ReadBytes(c_Buffer, u32_Index, &acn_DeviceId[0], u8_Length);
+      if (q_Ok == true)
+      {
+         this->mc_DeviceId = C_SCLString(&acn_DeviceId[0], u8_Length);
+      }
+      q_Ok = q_Ok && m_ReadSint32(c_Buffer, u32_Index, this->ms32_ApplicationInfoResult) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.acn_Magic[0], sizeof(rc_Info.acn_Magic)) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.u8_StructVersion, 1U) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.u8_ContentMap, 1U) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.acn_DeviceID[0], sizeof(rc_Info.acn_DeviceID)) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.acn_Date[0], sizeof(rc_Info.acn_Date)) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.acn_Time[0], sizeof(rc_Info.acn_Time)) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.acn_ProjectName[0], sizeof(rc_Info.acn_ProjectName)) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.acn_ProjectVersion[0], sizeof(rc_Info.acn_ProjectVersion)) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.u8_LenAdditionalInfo, 1U) &&
+             m_ReadBytes(c_Buffer, u32_Index, &rc_Info.acn_AdditionalInfo[0], sizeof(rc_Info.acn_AdditionalInfo));
+
+      q_Ok = q_Ok && m_ReadUint32(c_Buffer, u32_Index, u32_NumBlocks) &&
+             (u32_NumBlocks <= ((c_Buffer.size() - u32_Index) / 8U)); //plausibility check before allocating
+      if (q_Ok == true)
+      {
+         this->mc_Dump.at_Blocks.SetLength(static_cast<sint32>(u32_NumBlocks));
+      }
+      for (uint32 u32_Block = 0U; (u32_Block < u32_NumBlocks) && (q_Ok == true); u32_Block++)
+      {
+         stw_hex_file::C_HexDataDumpBlock & rc_Block = this->mc_Dump.at_Blocks[static_cast<sint32>(u32_Block)];
+         uint32 u32_Size = 0U;
+
+         q_Ok = m_ReadUint32(c_Buffer, u32_Index, rc_Block.u32_AddressOffset) &&
+                m_ReadUint32(c_Buffer, u32_Index, u32_Size) &&
+                (u32_Size > 0U) && (u32_Size <= (c_Buffer.size() - u32_Index));
+         if (q_Ok == true)
          {
-            orc_InfoBlock = c_InfoBlocks[0];
-            s32_Return = C_WARN;
+            rc_Block.au8_Data.SetLength(static_cast<sint32>(u32_Size));
+            q_Ok = m_ReadBytes(c_Buffer, u32_Index, &rc_Block.au8_Data[0], u32_Size);
          }
       }
+
+      if ((q_Ok == true) && (u32_Index == c_Buffer.size()))
+      {
+         this->mq_DumpIsDirty = false;
+         this->mq_ScanResultsValid = true;
+      }
+      else
+      {
+         this->Clear();
+         this->mc_Dump.at_Blocks.SetLength(0);
+         s32_Return = C_RD_WR;
+      }
    }
-   else
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write data dump and scan results to cache file
+
+   For the file layout see m_LoadCacheFile.
+   The file is written under a temporary name and renamed when complete.
+   So parallel or aborted runs never leave a partially written cache file behind.
+
+   Prerequisites:
+   * data dump is loaded
+   * m_ScanInformation was called
+
+   \param[in]  orc_CacheFileName  path of cache file
+   \param[in]  ou64_FileHash      hash of hex file
+   \param[in]  ou32_FileSize      size of hex file
+
+   \return
+   C_NO_ERR   cache file written
+   C_RD_WR    could not write cache file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OsyHexFile::m_SaveCacheFile(const C_SCLString & orc_CacheFileName, const uint64 ou64_FileHash,
+                                     const uint32 ou32_FileSize) const
+{
+   sint32 s32_Return = C_RD_WR;
+   std::vector<uint8> c_Buffer;
+   const C_XFLECUInformation & rc_Info = this->mc_ApplicationInfo;
+   C_SCLString c_TempFileName;
+   const uint8 u8_DeviceIdLength = static_cast<uint8>((this->mc_DeviceId.Length() > 255) ?
+                                                      255 : this->mc_DeviceId.Length());
+   const uint8 au8_Version[2] =
+   {
+      static_cast<uint8>(mhu16_CACHE_FILE_VERSION), static_cast<uint8>(mhu16_CACHE_FILE_VERSION >> 8U)
+   };
+   uint64 u64_Hash;
+   std::FILE * pt_File;
+
+   tgl_assert(this->mq_ScanResultsValid == true);
+
+   //the same hex file might be cached by multiple instances in parallel; so use an instance specific temporary file
+   c_TempFileName.PrintFormatted("%s.%p.tmp", orc_CacheFileName.c_str(), static_cast<const void *>(this));
+
+   c_Buffer.reserve(static_cast<size_t>(this->mu32_NumRawBytes) + 1024U);
+   m_AppendBytes(c_Buffer, "OHXC", 4U);
+   m_AppendBytes(c_Buffer, &au8_Version[0], sizeof(au8_Version));
+   m_AppendUint32(c_Buffer, static_cast<uint32>(ou64_FileHash & 0xFFFFFFFFU));
+   m_AppendUint32(c_Buffer, static_cast<uint32>(ou64_FileHash >> 32U));
+   m_AppendUint32(c_Buffer, ou32_FileSize);
+   m_AppendUint32(c_Buffer, this->mu32_MinAdr);
+   m_AppendUint32(c_Buffer, this->mu32_MaxAdr);
+   m_AppendUint32(c_Buffer, this->mu32_NumRawBytes);
+   m_AppendSint32(c_Buffer, this->ms32_SignatureBlockResult);
+   m_AppendUint32(c_Buffer, this->mu32_SignatureBlockAddress);
+   m_AppendSint32(c_Buffer, this->ms32_DeviceIdResult);
+   m_AppendBytes(c_Buffer, &u8_DeviceIdLength, 1U);
+   m_AppendBytes(c_Buffer, this->mc_DeviceId.c_str(), u8_DeviceIdLength);
+   m_AppendSint32(c_Buffer, this->ms32_ApplicationInfoResult);
+   m_AppendBytes(c_Buffer, &rc_Info.acn_Magic[0], sizeof(rc_Info.acn_Magic));
+   m_AppendBytes(c_Buffer, &rc_Info.u8_StructVersion, 1U);
+   m_AppendBytes(c_Buffer, &rc_Info.u8_ContentMap, 1U);
+   m_AppendBytes(c_Buffer, &rc_Info.acn_DeviceID[0], sizeof(rc_Info.acn_DeviceID));
+   m_AppendBytes(c_Buffer, &rc_Info.acn_Date[0], sizeof(rc_Info.acn_Date));
+   m_AppendBytes(c_Buffer, &rc_Info.acn_Time[0], sizeof(rc_Info.acn_Time));
+   m_AppendBytes(c_Buffer, &rc_Info.acn_ProjectName[0], sizeof(rc_Info.acn_ProjectName));
+   m_AppendBytes(c_Buffer, &rc_Info.acn_ProjectVersion[0], sizeof(rc_Info.acn_ProjectVersion));
+   m_AppendBytes(c_Buffer, &rc_Info.u8_LenAdditionalInfo, 1U);
+   m_AppendBytes(c_Buffer, &rc_Info.acn_AdditionalInfo[0], sizeof(rc_Info.acn_AdditionalInfo));
+   m_AppendUint32(c_Buffer, static_cast<uint32>(this->mc_Dump.at_Blocks.GetLength()));
+   for (sint32 s32_Block = 0; s32_Block < this->mc_Dump.at_Blocks.GetLength(); s32_Block++)
+   {
+      const stw_hex_file::C_HexDataDumpBlock & rc_Block = this->mc_Dump.at_Blocks[s32_Block];
+      m_AppendUint32(c_Buffer, rc_Block.u32_AddressOffset);
+      m_AppendUint32(c_Buffer, static_cast<uint32>(rc_Block.au8_Data.GetLength()));
+      m_AppendBytes(c_Buffer, &rc_Block.au8_Data[0], static_cast<uint32>(rc_Block.au8_Data.GetLength()));
+   }
+   u64_Hash = m_CalcHash(&c_Buffer[0], static_cast<uint32>(c_Buffer.size()));
+   m_AppendUint32(c_Buffer, static_cast<uint32>(u64_Hash & 0xFFFFFFFFU));
+   m_AppendUint32(c_Buffer, static_cast<uint32>(u64_Hash >> 32U));
+
+   pt_File = std::fopen(c_TempFileName.c_str(), "wb");
+   if (pt_File != NULL)
+   {
+      if (std::fwrite(&c_Buffer[0], 1U, c_Buffer.size(), pt_File) == c_Buffer.size())
+      {
+         s32_Return = C_NO_ERR;
+      }
+      if (std::fclose(pt_File) != 0)
+      {
+         s32_Return = C_RD_WR;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      //rename does not replace existing files on all platforms
+      (void)std::remove(orc_CacheFileName.c_str());
+      if (std::rename(c_TempFileName.c_str(), orc_CacheFileName.c_str()) != 0)
+      {
+         s32_Return = C_RD_WR;
+      }
+   }
+   if (s32_Return != C_NO_ERR)
    {
-      //one block found !
-      orc_InfoBlock = c_InfoBlocks[0];
-      s32_Return = C_NO_ERR;
+      (void)std::remove(c_TempFileName.c_str());
    }
 
    return s32_Return;
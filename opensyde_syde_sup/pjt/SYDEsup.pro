@@ -32,6 +32,7 @@ include(../libs/opensyde_core/opensyde_core.pri)
 SOURCES += ../src/C_SUPSuSequences.cpp \
            ../src/C_SYDEsup.cpp \
            ../src/main.cpp \
+           ../libs/opensyde_core/C_OSCZipData.cpp \
            ../libs/opensyde_core/C_OSCZipFile.cpp
 
 #using our standard compiler warning switches we will get some (non-critical) warnings in miniz.c
@@ -54,6 +55,7 @@ win32-g++ {
 
 HEADERS += ../src/C_SUPSuSequences.h \
            ../src/C_SYDEsup.h \
+           ../libs/opensyde_core/C_OSCZipData.h \
            ../libs/opensyde_core/C_OSCZipFile.h \
            ../libs/opensyde_core/miniz/miniz.h
 
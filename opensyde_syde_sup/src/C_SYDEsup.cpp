@@ -297,11 +297,12 @@ C_SYDEsup::E_Result C_SYDEsup::Update(void) const
    else
    {
       // unpack Service Update Package which was created with openSYDE (also checks if paths are valid)
+      // the files to update are not unpacked; the sequence takes them from the package (see SetUpdatePackage below)
       s32_Return = C_OSCSuServiceUpdatePackage::h_UnpackPackage(mc_SUPFilePath, mc_UnzipPath,
                                                                 c_SystemDefinition, u32_ActiveBusIndex,
                                                                 c_ActiveNodes, c_NodesUpdateOrder,
                                                                 c_ApplicationsToWrite,
-                                                                c_WarningMessages, c_ErrorMessage);
+                                                                c_WarningMessages, c_ErrorMessage, false);
 
       // report success or translate errors
       switch (s32_Return) // here s32_Return is result of h_UnpackPackage
@@ -412,6 +413,8 @@ C_SYDEsup::E_Result C_SYDEsup::Update(void) const
                                    &c_IpDispatcher);
       // tell report methods to not print to console
       c_Sequence.SetQuiet(mq_Quiet);
+      // HEX files are parsed straight from the package; other files are unpacked when the update starts
+      c_Sequence.SetUpdatePackage(mc_SUPFilePath, mc_UnzipPath);
    }
 
    // activate Flashloader if previous step was successful and return errors else
@@ -12,6 +12,9 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h"
 
+#include <algorithm>
+#include <thread>
+
 #define MINIZ_NO_ZLIB_COMPATIBLE_NAMES //prevent namespace pollution
 #include "miniz.h"
 #include "stwtypes.h"
@@ -46,19 +49,28 @@ using namespace stw_opensyde_core;
                                            out: used number of bytes
    \param[in]     opu8_Source              source data to compress
    \param[in]     ou32_SourceLength        size of data referenced by opu8_Source in bytes
+   \param[in]     ou8_CompressionLevel     compression level (0 = store ... 9 = best compression)
 
    \return
    C_NO_ERR   data compressed
+   C_RANGE    invalid compression level
    C_NOACT    error (e.g. destination buffer too small)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCZipData::h_Zip(uint8 * const opu8_Destination, uint32 & oru32_DestinationLength,
-                           const uint8 * const opu8_Source, const uint32 ou32_SourceLength)
+                           const uint8 * const opu8_Source, const uint32 ou32_SourceLength,
+                           const uint8 ou8_CompressionLevel)
 {
    sint32 s32_Return;
    mz_ulong u32_DestinationLength = oru32_DestinationLength;
 
-   s32_Return = mz_compress(opu8_Destination, &u32_DestinationLength, opu8_Source, ou32_SourceLength);
+   if (ou8_CompressionLevel > hu8_COMPRESSION_LEVEL_BEST)
+   {
+      return C_RANGE;
+   }
+
+   s32_Return = mz_compress2(opu8_Destination, &u32_DestinationLength, opu8_Source, ou32_SourceLength,
+                             static_cast<sintn>(ou8_CompressionLevel));
    if (s32_Return == MZ_OK)
    {
       oru32_DestinationLength = u32_DestinationLength;
@@ -67,6 +79,141 @@ sint32 C_OSCZipData::h_Zip(uint8 * const opu8_Destination, uint32 & oru32_Destin
    return C_NOACT;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Deflate data in memory
+
+   Creates a raw deflate stream (RFC 1951; no zlib header and checksum) as used within zip archives.
+
+   If parallel compression is requested and the data is large enough it is split into chunks of
+   mhu32_DEFLATE_CHUNK_SIZE bytes. Each chunk is deflated independently by one of up to
+   hardware_concurrency threads. All chunks but the last one are terminated with a sync flush so the byte aligned
+   chunk results can simply be concatenated to one valid stream.
+   For the same reason a stream can be created piece by piece: all calls but the last one pass oq_Finish = false,
+   the results of all calls are concatenated.
+
+   \param[out]    orc_Destination          deflated data
+   \param[in]     opu8_Source              source data to compress
+   \param[in]     ou32_SourceLength        size of data referenced by opu8_Source in bytes
+   \param[in]     ou8_CompressionLevel     compression level (0 = store ... 9 = best compression)
+   \param[in]     oq_Parallel              true: split large data into chunks compressed in parallel
+                                           false: compress in the calling thread
+   \param[in]     oq_Finish                true: terminate the deflate stream
+                                           false: end with a sync flush; more data of the stream will follow
+
+   \return
+   C_NO_ERR   data compressed
+   C_RANGE    invalid compression level
+   C_NOACT    error (e.g. not enough memory)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCZipData::h_Deflate(std::vector<uint8> & orc_Destination, const uint8 * const opu8_Source,
+                               const uint32 ou32_SourceLength, const uint8 ou8_CompressionLevel,
+                               const bool oq_Parallel, const bool oq_Finish)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   std::vector<C_DeflateChunk> c_Chunks;
+   uint32 u32_NumChunks = 1U;
+
+   orc_Destination.clear();
+
+   if (ou8_CompressionLevel > hu8_COMPRESSION_LEVEL_BEST)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      if ((oq_Parallel == true) && (ou32_SourceLength >= (2U * mhu32_DEFLATE_CHUNK_SIZE)))
+      {
+         u32_NumChunks = ((ou32_SourceLength - 1U) / mhu32_DEFLATE_CHUNK_SIZE) + 1U;
+      }
+      try
+      {
+         c_Chunks.resize(u32_NumChunks);
+      }
+      catch (...)
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      const sint32 s32_Flags = static_cast<sint32>(
+         tdefl_create_comp_flags_from_zip_params(static_cast<sintn>(ou8_CompressionLevel), -MZ_DEFAULT_WINDOW_BITS,
+                                                 MZ_DEFAULT_STRATEGY));
+      const uint32 u32_NumThreads =
+         std::max(std::min(static_cast<uint32>(std::thread::hardware_concurrency()), u32_NumChunks),
+                  static_cast<uint32>(1U));
+      std::vector<std::thread> c_Threads;
+      uint32 u32_Size = 0U;
+
+      for (uint32 u32_Chunk = 0U; u32_Chunk < u32_NumChunks; u32_Chunk++)
+      {
+         C_DeflateChunk & rc_Chunk = c_Chunks[u32_Chunk];
+         const bool q_LastChunk = (u32_Chunk == (u32_NumChunks - 1U));
+         rc_Chunk.pu8_Source = &opu8_Source[u32_Chunk * mhu32_DEFLATE_CHUNK_SIZE];
+         rc_Chunk.q_Last = (q_LastChunk == true) && (oq_Finish == true);
+         rc_Chunk.u32_SourceLength = (q_LastChunk == true) ?
+                                     (ou32_SourceLength - (u32_Chunk * mhu32_DEFLATE_CHUNK_SIZE)) :
+                                     mhu32_DEFLATE_CHUNK_SIZE;
+         rc_Chunk.s32_Result = C_NOACT;
+      }
+
+      //compress the chunks; each thread takes every n-th chunk; the first share is done in this thread
+      c_Threads.reserve(u32_NumThreads); //no reallocation while threads are added
+      for (uint32 u32_Thread = 1U; u32_Thread < u32_NumThreads; u32_Thread++)
+      {
+         try
+         {
+            c_Threads.push_back(std::thread(&C_OSCZipData::mh_DeflateChunks, &c_Chunks, u32_Thread, u32_NumThreads,
+                                            s32_Flags));
+         }
+         catch (...)
+         {
+            //could not start thread: do it ourselves
+            mh_DeflateChunks(&c_Chunks, u32_Thread, u32_NumThreads, s32_Flags);
+         }
+      }
+      mh_DeflateChunks(&c_Chunks, 0U, u32_NumThreads, s32_Flags);
+      for (uint32 u32_Thread = 0U; u32_Thread < c_Threads.size(); u32_Thread++)
+      {
+         c_Threads[u32_Thread].join();
+      }
+
+      //concatenate results:
+      for (uint32 u32_Chunk = 0U; u32_Chunk < u32_NumChunks; u32_Chunk++)
+      {
+         if (c_Chunks[u32_Chunk].s32_Result != C_NO_ERR)
+         {
+            s32_Return = C_NOACT;
+         }
+         u32_Size += static_cast<uint32>(c_Chunks[u32_Chunk].c_Output.size());
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         try
+         {
+            orc_Destination.reserve(u32_Size);
+            for (uint32 u32_Chunk = 0U; u32_Chunk < u32_NumChunks; u32_Chunk++)
+            {
+               orc_Destination.insert(orc_Destination.end(), c_Chunks[u32_Chunk].c_Output.begin(),
+                                      c_Chunks[u32_Chunk].c_Output.end());
+               //free memory as early as possible
+               std::vector<uint8>().swap(c_Chunks[u32_Chunk].c_Output);
+            }
+         }
+         catch (...)
+         {
+            orc_Destination.clear();
+            s32_Return = C_NOACT;
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Unzip data in memory
 
@@ -116,3 +263,66 @@ uint32 C_OSCZipData::h_GetRequiredBufSizeForZipping(const uint32 ou32_SourceLeng
 {
    return mz_compressBound(ou32_SourceLength);
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Deflate chunks of data
+
+   Deflates every ou32_Step-th chunk starting with chunk ou32_First.
+   Executed in parallel by multiple threads; each thread works on its own chunks with its own compressor.
+
+   \param[in,out] opc_Chunks   chunks to compress; results are placed in c_Output and s32_Result
+   \param[in]     ou32_First   index of first chunk to compress
+   \param[in]     ou32_Step    distance between chunks to compress
+   \param[in]     os32_Flags   tdefl compression flags
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCZipData::mh_DeflateChunks(std::vector<C_DeflateChunk> * const opc_Chunks, const uint32 ou32_First,
+                                    const uint32 ou32_Step, const sint32 os32_Flags)
+{
+   tdefl_compressor * pc_Compressor = NULL;
+
+   try
+   {
+      //a few hundred kB; too much for the stack
+      pc_Compressor = new tdefl_compressor;
+   }
+   catch (...)
+   {
+      //reported by the chunk results
+   }
+
+   for (uint32 u32_Chunk = ou32_First; (u32_Chunk < opc_Chunks->size()) && (pc_Compressor != NULL);
+        u32_Chunk += ou32_Step)
+   {
+      C_DeflateChunk & rc_Chunk = (*opc_Chunks)[u32_Chunk];
+      //upper limit of compressed size (stored blocks) plus reserve for the flush:
+      const size_t un_BufferSize = static_cast<size_t>(mz_compressBound(rc_Chunk.u32_SourceLength));
+      size_t un_InSize = rc_Chunk.u32_SourceLength;
+      size_t un_OutSize = un_BufferSize;
+
+      try
+      {
+         rc_Chunk.c_Output.resize(un_BufferSize);
+      }
+      catch (...)
+      {
+         break;
+      }
+
+      if (tdefl_init(pc_Compressor, NULL, NULL, os32_Flags) == TDEFL_STATUS_OKAY)
+      {
+         const tdefl_status e_Status =
+            tdefl_compress(pc_Compressor, rc_Chunk.pu8_Source, &un_InSize, &rc_Chunk.c_Output[0], &un_OutSize,
+                           (rc_Chunk.q_Last == true) ? TDEFL_FINISH : TDEFL_SYNC_FLUSH);
+         //everything consumed and output buffer not exhausted ?
+         if ((e_Status >= TDEFL_STATUS_OKAY) && (un_InSize == rc_Chunk.u32_SourceLength) &&
+             (un_OutSize < un_BufferSize))
+         {
+            rc_Chunk.c_Output.resize(un_OutSize);
+            rc_Chunk.s32_Result = C_NO_ERR;
+         }
+      }
+   }
+
+   delete pc_Compressor;
+}
@@ -24,6 +24,7 @@
 #define C_OSCZIPDATAH
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
 #include "stwtypes.h"
 #include "CSCLString.h"
 
@@ -37,15 +38,42 @@ namespace stw_opensyde_core
 class C_OSCZipData
 {
 public:
+   static const stw_types::uint8 hu8_COMPRESSION_LEVEL_STORE = 0U;   ///< no compression
+   static const stw_types::uint8 hu8_COMPRESSION_LEVEL_DEFAULT = 6U; ///< balanced speed and size
+   static const stw_types::uint8 hu8_COMPRESSION_LEVEL_BEST = 9U;    ///< smallest result
+
    static stw_types::sint32 h_Zip(stw_types::uint8 * const opu8_Destination,
                                   stw_types::uint32 & oru32_DestinationLength,
                                   const stw_types::uint8 * const opu8_Source,
-                                  const stw_types::uint32 ou32_SourceLength);
+                                  const stw_types::uint32 ou32_SourceLength,
+                                  const stw_types::uint8 ou8_CompressionLevel = hu8_COMPRESSION_LEVEL_DEFAULT);
+   static stw_types::sint32 h_Deflate(std::vector<stw_types::uint8> & orc_Destination,
+                                      const stw_types::uint8 * const opu8_Source,
+                                      const stw_types::uint32 ou32_SourceLength,
+                                      const stw_types::uint8 ou8_CompressionLevel, const bool oq_Parallel,
+                                      const bool oq_Finish = true);
    static stw_types::sint32 h_Unzip(stw_types::uint8 * const opu8_Destination,
                                     stw_types::uint32 & oru32_DestinationLength,
                                     const stw_types::uint8 * const opu8_Source,
                                     const stw_types::uint32 ou32_SourceLength);
    static stw_types::uint32 h_GetRequiredBufSizeForZipping(const stw_types::uint32 ou32_SourceLength);
+
+private:
+   static const stw_types::uint32 mhu32_DEFLATE_CHUNK_SIZE = 0x100000U; ///< size of independently deflated chunks
+
+   ///one chunk of data deflated by one thread
+   class C_DeflateChunk
+   {
+   public:
+      const stw_types::uint8 * pu8_Source;
+      stw_types::uint32 u32_SourceLength;
+      bool q_Last; ///< last chunk of finished stream; terminates the deflate stream
+      std::vector<stw_types::uint8> c_Output;
+      stw_types::sint32 s32_Result;
+   };
+
+   static void mh_DeflateChunks(std::vector<C_DeflateChunk> * const opc_Chunks, const stw_types::uint32 ou32_First,
+                                const stw_types::uint32 ou32_Step, const stw_types::sint32 os32_Flags);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
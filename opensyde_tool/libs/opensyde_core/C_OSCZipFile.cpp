@@ -12,7 +12,10 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h"
 
-#include <fstream>
+#include <cstdio>
+#include <algorithm>
+#include <thread>
+#include <sys/stat.h>
 
 #include "TGLFile.h"
 #define MINIZ_NO_ZLIB_COMPATIBLE_NAMES //prevent namespace pollution
@@ -32,67 +35,136 @@ using namespace stw_opensyde_core;
 using namespace std;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+//passed to miniz instead of the compressed data of a streamed entry; m_WriteToArchive copies the data from file then
+static const uint8 mu8_COMPRESSED_DATA_FROM_FILE = 0U;
+static const uint32 mu32_COPY_BUFFER_SIZE = 0x10000U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
+///target of the archive writer (see m_WriteToArchive)
+class C_ZipArchiveOutput
+{
+public:
+   std::FILE * pt_Archive;
+   uint64 u64_Position;           ///< current position in archive file
+   std::FILE * pt_CompressedData; ///< compressed data of the streamed entry being added; NULL: none
+};
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static size_t m_WriteToArchive(void * const opv_Output, const mz_uint64 ou64_Offset, const void * const opv_Buffer,
+                               const size_t oun_Size);
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Create ZIP archive from files
 
-   In the unlikely case that function fails there is no clean-up done and
-   "it's possible the archive could be left without a central directory"
-   (see miniz.c).
+   Convenience variant for files located in one folder.
+   The relative file paths are used as names of the files within the archive.
+
+   See h_CreateZipFile with map of files for details.
+
+   \param[in]  orc_SourcePath                path of folder containing files to add to archive
+                                              (needs trailing path terminator)
+   \param[in]  orc_SupFiles                  relative file paths for zip archive (files to add to archive)
+   \param[in]  orc_ZipArchivePath            zip archive name with full path
+   \param[out] opc_ErrorText                 if != NULL and return value != C_NO_ERR: will be filled with textual
+                                              details of problem
+
+   \return
+   C_NO_ERR    success
+   C_CONFIG    at least one input file does not exist
+   C_RD_WR     could not open input file
+   C_NOACT     could not add data to zip file (does the path to the file exist ?)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCZipFile::h_CreateZipFile(const C_SCLString & orc_SourcePath, const std::set<C_SCLString> & orc_SupFiles,
+                                     const C_SCLString & orc_ZipArchivePath, stw_scl::C_SCLString * const opc_ErrorText)
+{
+   std::map<C_SCLString, C_SCLString> c_FilesToZip;
+
+   std::set<C_SCLString>::const_iterator c_Iter;
+
+   for (c_Iter = orc_SupFiles.begin(); c_Iter != orc_SupFiles.end(); ++c_Iter)
+   {
+      c_FilesToZip[*c_Iter] = orc_SourcePath + (*c_Iter);
+   }
+
+   return h_CreateZipFile(c_FilesToZip, orc_ZipArchivePath, opc_ErrorText);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create ZIP archive from files
+
+   The files are read directly from their source location. So there is no need to copy them to a common folder
+   before.
+
+   Compression is done in parallel in batches of up to mhu32_MAX_BATCH_SIZE bytes:
+   * small files are compressed concurrently, one file per thread
+   * large files are split into chunks which are compressed concurrently (see C_OSCZipData::h_Deflate)
+   The compressed data is then written to the archive in order of the map.
+   Files too large for one batch are read in windows of mhu32_MAX_BATCH_SIZE bytes. Each window is compressed with
+   parallel chunks as well and appended to a temporary file next to the archive. When the file is complete the
+   compressed data is copied from there into the archive (see m_WriteToArchive).
+   So the memory used is bounded by a small multiple of mhu32_MAX_BATCH_SIZE (source data plus compressed data)
+   whatever the file sizes are.
+   The central directory is written once after all files were added.
+   The workers are std::threads as TGL offers no thread class and the Core must not use Qt.
+
+   In case of an error the incomplete zip file is removed.
 
    The function will not
    * create the target folder
-   * erase a pre-existing zip file
 
-   If the zip file already exists with behavior is undefined
-   (technically the function will probably add to the existing file but this has not been tested).
+   A pre-existing zip file is overwritten.
 
    Assumptions:
    * consistent data
-   * moderate file sizes to zip
-    (is not zipping files by chunk, with files greater than 0.5 GB there can occur problems)
 
-   \param[in]  orc_SourcePath                path of folder containing files to add to archive
-                                              (needs trailing path terminator)
-   \param[in]  orc_SupFiles                  relative file paths for zip archive (files to add to archive)
+   \param[in]  orc_FilesToZip                files to add to archive
+                                              key: relative file path within zip archive
+                                              value: path of source file
    \param[in]  orc_ZipArchivePath            zip archive name with full path
    \param[out] opc_ErrorText                 if != NULL and return value != C_NO_ERR: will be filled with textual
                                               details of problem
+   \param[in]  ou8_CompressionLevel          compression level (0 = store ... 9 = best compression)
 
    \return
    C_NO_ERR    success
+   C_RANGE     invalid compression level
    C_CONFIG    at least one input file does not exist
    C_RD_WR     could not open input file
    C_NOACT     could not add data to zip file (does the path to the file exist ?)
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_OSCZipFile::h_CreateZipFile(const C_SCLString & orc_SourcePath, const std::set<C_SCLString> & orc_SupFiles,
-                                     const C_SCLString & orc_ZipArchivePath, stw_scl::C_SCLString * const opc_ErrorText)
+sint32 C_OSCZipFile::h_CreateZipFile(const std::map<C_SCLString, C_SCLString> & orc_FilesToZip,
+                                     const C_SCLString & orc_ZipArchivePath, C_SCLString * const opc_ErrorText,
+                                     const uint8 ou8_CompressionLevel)
 {
    sint32 s32_Return = C_NO_ERR;
 
-   std::set<C_SCLString>::const_iterator c_Iter;
+   std::map<C_SCLString, C_SCLString>::const_iterator c_Iter;
+
+   if (ou8_CompressionLevel > C_OSCZipData::hu8_COMPRESSION_LEVEL_BEST)
+   {
+      if (opc_ErrorText != NULL)
+      {
+         (*opc_ErrorText) = "Invalid compression level.";
+      }
+      s32_Return = C_RANGE;
+   }
 
    // check whether input file(s) exist:
-   // go through all files and store in zip archive
-   for (c_Iter = orc_SupFiles.begin(); c_Iter != orc_SupFiles.end(); ++c_Iter)
+   for (c_Iter = orc_FilesToZip.begin(); (c_Iter != orc_FilesToZip.end()) && (s32_Return == C_NO_ERR); ++c_Iter)
    {
-      const C_SCLString c_AbsPath = orc_SourcePath + (*c_Iter);
-      if (TGL_FileExists(c_AbsPath) == false)
+      if (TGL_FileExists(c_Iter->second) == false)
       {
          if (opc_ErrorText != NULL)
          {
-            (*opc_ErrorText) = "Input file \"" + c_AbsPath + "\" does not exist.";
+            (*opc_ErrorText) = "Input file \"" + c_Iter->second + "\" does not exist.";
          }
          s32_Return = C_CONFIG;
          break;
@@ -101,73 +173,220 @@ sint32 C_OSCZipFile::h_CreateZipFile(const C_SCLString & orc_SourcePath, const s
 
    if (s32_Return == C_NO_ERR)
    {
-      sintn sn_MzStatus = MZ_TRUE;
-      // go through all files and store in zip archive
-      for (c_Iter = orc_SupFiles.begin(); (c_Iter != orc_SupFiles.end()) && (sn_MzStatus == MZ_TRUE); ++c_Iter)
+      mz_zip_archive c_ZipArchive;
+      C_ZipArchiveOutput c_Output;
+
+      // write the archive file ourselves so data compressed to a temporary file can be copied into it
+      c_Output.pt_Archive = std::fopen(orc_ZipArchivePath.c_str(), "wb");
+      c_Output.u64_Position = 0U;
+      c_Output.pt_CompressedData = NULL;
+      memset(&c_ZipArchive, 0, sizeof(c_ZipArchive));
+      c_ZipArchive.m_pWrite = &m_WriteToArchive;
+      c_ZipArchive.m_pIO_opaque = &c_Output;
+      if ((c_Output.pt_Archive == NULL) || (mz_zip_writer_init(&c_ZipArchive, 0U) == MZ_FALSE))
       {
-         C_SCLString c_FileName = *c_Iter;
-         const C_SCLString c_AbsPath = orc_SourcePath + c_FileName;                  // absolute path
-         ifstream c_FileStream(c_AbsPath.c_str(), ifstream::binary | ifstream::ate); // open file and set pos
-                                                                                     // to the end of file
-         if (c_FileStream.is_open() == true)
+         if (opc_ErrorText != NULL)
          {
-            C_SCLString c_FilePathWithSlashes;
-            // get file length, position is at the end of the input sequence
-            const sintn sn_FileLength = static_cast<sintn>(c_FileStream.tellg());
-            // set position to the beginning of the input sequence
-            c_FileStream.seekg(0LL, ifstream::beg);
-
-            // allocate memory
-            charn * const pcn_FileData = new charn[static_cast<uintn>(sn_FileLength)];
-            const C_SCLString c_Comment = "Zipping file: " + c_FileName; // set filename as comment
-
-            // read file content
-            c_FileStream.read(pcn_FileData, sn_FileLength);
+            (*opc_ErrorText) = "Could not create zip file \"" + orc_ZipArchivePath + "\".";
+         }
+         if (c_Output.pt_Archive != NULL)
+         {
+            (void)std::fclose(c_Output.pt_Archive);
+         }
+         s32_Return = C_NOACT;
+      }
+      else
+      {
+         std::vector<C_ZipEntry> c_Batch;
 
-            // close file
-            c_FileStream.close();
+         // go through all files batch by batch and store in zip archive
+         c_Iter = orc_FilesToZip.begin();
+         while ((c_Iter != orc_FilesToZip.end()) && (s32_Return == C_NO_ERR))
+         {
+            uint32 u32_BatchSize = 0U;
+            uint32 u32_NumSmallEntries = 0U;
+            uint32 u32_NumThreads;
+            std::vector<std::thread> c_Threads;
+
+            // collect files to compress in memory at once
+            c_Batch.clear();
+            while (c_Iter != orc_FilesToZip.end())
+            {
+               const sint32 s32_FileSize = TGL_FileSize(c_Iter->second);
+               C_ZipEntry c_Entry;
+
+               c_Entry.c_ArchiveName = c_Iter->first;
+               c_Entry.c_SourcePath = c_Iter->second;
+               c_Entry.q_Streamed = (ou8_CompressionLevel == C_OSCZipData::hu8_COMPRESSION_LEVEL_STORE) ||
+                                    (s32_FileSize < 0) ||
+                                    (static_cast<uint32>(s32_FileSize) > mhu32_MAX_BATCH_SIZE);
+               c_Entry.q_Large = (c_Entry.q_Streamed == false) &&
+                                 (static_cast<uint32>(s32_FileSize) >= mhu32_LARGE_FILE_SIZE);
+               c_Entry.u32_CompressedSize = 0U;
+               c_Entry.u32_UncompressedSize = 0U;
+               c_Entry.u32_Crc32 = 0U;
+               c_Entry.s32_Result = C_NOACT;
+               if (c_Entry.q_Streamed == false)
+               {
+                  if ((c_Batch.empty() == false) &&
+                      ((u32_BatchSize + static_cast<uint32>(s32_FileSize)) > mhu32_MAX_BATCH_SIZE))
+                  {
+                     break; // next batch
+                  }
+                  u32_BatchSize += static_cast<uint32>(s32_FileSize);
+                  if (c_Entry.q_Large == false)
+                  {
+                     u32_NumSmallEntries++;
+                  }
+               }
+               c_Batch.push_back(c_Entry);
+               ++c_Iter;
+            }
 
-            // miniz cannot handle windows '\\' directories
-            // therefore change to '/'
-            for (uint32 u32_Pos = 1U; u32_Pos <= c_FileName.Length(); u32_Pos++)
+            // compress small files in parallel; each thread takes every n-th file; first share in this thread
+            u32_NumThreads = std::max(std::min(static_cast<uint32>(std::thread::hardware_concurrency()),
+                                               u32_NumSmallEntries), static_cast<uint32>(1U));
+            c_Threads.reserve(u32_NumThreads); //no reallocation while threads are added
+            for (uint32 u32_Thread = 1U; u32_Thread < u32_NumThreads; u32_Thread++)
             {
-               if (c_FileName[u32_Pos] == '\\')
+               try
                {
-                  c_FilePathWithSlashes += '/';
+                  c_Threads.push_back(std::thread(&C_OSCZipFile::mh_CompressEntries, &c_Batch, u32_Thread,
+                                                  u32_NumThreads, ou8_CompressionLevel));
                }
-               else
+               catch (...)
                {
-                  c_FilePathWithSlashes += c_FileName[u32_Pos];
+                  //could not start thread: do it ourselves
+                  mh_CompressEntries(&c_Batch, u32_Thread, u32_NumThreads, ou8_CompressionLevel);
                }
             }
+            mh_CompressEntries(&c_Batch, 0U, u32_NumThreads, ou8_CompressionLevel);
+            for (uint32 u32_Thread = 0U; u32_Thread < c_Threads.size(); u32_Thread++)
+            {
+               c_Threads[u32_Thread].join();
+            }
 
-            // store file content to zip archive
-            // mz_zip_add_mem_to_archive_file_in_place is creating, appending and always finalizing the archive
-            // after successful operation
-            sn_MzStatus = mz_zip_add_mem_to_archive_file_in_place(
-               orc_ZipArchivePath.c_str(), c_FilePathWithSlashes.c_str(),
-               pcn_FileData, sn_FileLength,
-               c_Comment.c_str(), static_cast<uint16>(c_Comment.Length()),
-               MZ_BEST_COMPRESSION);
-            if (sn_MzStatus == MZ_FALSE)
+            // large files one by one; each one compressed by all threads
+            for (uint32 u32_Entry = 0U; u32_Entry < c_Batch.size(); u32_Entry++)
             {
-               if (opc_ErrorText != NULL)
+               if (c_Batch[u32_Entry].q_Large == true)
                {
-                  (*opc_ErrorText) = "Could not create zip file \"" + c_FileName + "\".";
+                  mh_CompressEntry(c_Batch[u32_Entry], ou8_CompressionLevel);
                }
-               s32_Return = C_NOACT;
             }
 
-            // free memory
-            delete[] pcn_FileData;
+            // write to archive in order
+            for (uint32 u32_Entry = 0U; (u32_Entry < c_Batch.size()) && (s32_Return == C_NO_ERR); u32_Entry++)
+            {
+               C_ZipEntry & rc_Entry = c_Batch[u32_Entry];
+               const C_SCLString c_FileName = h_GetArchiveFileName(rc_Entry.c_ArchiveName);
+               const C_SCLString c_Comment = "Zipping file: " + rc_Entry.c_ArchiveName; // set filename as comment
+               struct stat c_Stat;
+               MZ_TIME_T * const pc_FileTime = (stat(rc_Entry.c_SourcePath.c_str(), &c_Stat) == 0) ?
+                                               &c_Stat.st_mtime : NULL;
+               mz_bool q_Added = MZ_FALSE;
+
+               if ((rc_Entry.q_Streamed == true) &&
+                   (ou8_CompressionLevel == C_OSCZipData::hu8_COMPRESSION_LEVEL_STORE))
+               {
+                  // nothing to compress; miniz copies the source file in chunks
+                  q_Added = mz_zip_writer_add_file(&c_ZipArchive, c_FileName.c_str(), rc_Entry.c_SourcePath.c_str(),
+                                                   c_Comment.c_str(), static_cast<uint16>(c_Comment.Length()),
+                                                   static_cast<mz_uint>(ou8_CompressionLevel));
+                  if ((q_Added == MZ_FALSE) && (mz_zip_get_last_error(&c_ZipArchive) == MZ_ZIP_FILE_OPEN_FAILED))
+                  {
+                     rc_Entry.s32_Result = C_RD_WR;
+                  }
+               }
+               else if (rc_Entry.q_Streamed == true)
+               {
+                  const C_SCLString c_TempPath = orc_ZipArchivePath + ".tmp";
+                  c_Output.pt_CompressedData = std::fopen(c_TempPath.c_str(), "w+b");
+                  if (c_Output.pt_CompressedData != NULL)
+                  {
+                     mh_CompressStreamedEntry(rc_Entry, c_Output.pt_CompressedData, ou8_CompressionLevel);
+                     if (rc_Entry.s32_Result == C_NO_ERR)
+                     {
+                        // the marker makes m_WriteToArchive copy the compressed data from the temporary file
+                        q_Added = mz_zip_writer_add_mem_ex_v2(&c_ZipArchive, c_FileName.c_str(),
+                                                              &mu8_COMPRESSED_DATA_FROM_FILE,
+                                                              rc_Entry.u32_CompressedSize,
+                                                              c_Comment.c_str(),
+                                                              static_cast<uint16>(c_Comment.Length()),
+                                                              static_cast<mz_uint>(ou8_CompressionLevel) |
+                                                              static_cast<mz_uint>(MZ_ZIP_FLAG_COMPRESSED_DATA),
+                                                              rc_Entry.u32_UncompressedSize, rc_Entry.u32_Crc32,
+                                                              pc_FileTime, NULL, 0U, NULL, 0U);
+                     }
+                     (void)std::fclose(c_Output.pt_CompressedData);
+                     c_Output.pt_CompressedData = NULL;
+                     (void)std::remove(c_TempPath.c_str());
+                  }
+               }
+               else if (rc_Entry.s32_Result == C_NO_ERR)
+               {
+                  // add the data compressed before; empty files are stored
+                  const bool q_Empty = (rc_Entry.u32_UncompressedSize == 0U);
+                  const mz_uint u32_Flags = (q_Empty == true) ? static_cast<mz_uint>(MZ_NO_COMPRESSION) :
+                                            (static_cast<mz_uint>(ou8_CompressionLevel) |
+                                             static_cast<mz_uint>(MZ_ZIP_FLAG_COMPRESSED_DATA));
+
+                  q_Added = mz_zip_writer_add_mem_ex_v2(&c_ZipArchive, c_FileName.c_str(),
+                                                        (q_Empty == true) ? NULL : &rc_Entry.c_Compressed[0],
+                                                        (q_Empty == true) ? 0U : rc_Entry.c_Compressed.size(),
+                                                        c_Comment.c_str(), static_cast<uint16>(c_Comment.Length()),
+                                                        u32_Flags, rc_Entry.u32_UncompressedSize,
+                                                        rc_Entry.u32_Crc32, pc_FileTime, NULL, 0U, NULL, 0U);
+                  std::vector<uint8>().swap(rc_Entry.c_Compressed); //free memory as early as possible
+               }
+
+               if (q_Added == MZ_FALSE)
+               {
+                  if (rc_Entry.s32_Result == C_RD_WR)
+                  {
+                     if (opc_ErrorText != NULL)
+                     {
+                        (*opc_ErrorText) = "Could not open file \"" + rc_Entry.c_SourcePath +
+                                           "\" for zipping into archive.";
+                     }
+                     s32_Return = C_RD_WR;
+                  }
+                  else
+                  {
+                     if (opc_ErrorText != NULL)
+                     {
+                        (*opc_ErrorText) = "Could not create zip file \"" + rc_Entry.c_ArchiveName + "\".";
+                     }
+                     s32_Return = C_NOACT;
+                  }
+               }
+            }
          }
-         else
+
+         if ((s32_Return == C_NO_ERR) && (mz_zip_writer_finalize_archive(&c_ZipArchive) == MZ_FALSE))
          {
             if (opc_ErrorText != NULL)
             {
-               (*opc_ErrorText) = "Could not open file \"" + c_FileName + "\" for zipping into archive.";
+               (*opc_ErrorText) = "Could not finalize zip file \"" + orc_ZipArchivePath + "\".";
             }
-            s32_Return = C_RD_WR;
+            s32_Return = C_NOACT;
+         }
+
+         // close the archive, freeing any resources it was using
+         (void)mz_zip_writer_end(&c_ZipArchive);
+         if ((std::fclose(c_Output.pt_Archive) != 0) && (s32_Return == C_NO_ERR))
+         {
+            if (opc_ErrorText != NULL)
+            {
+               (*opc_ErrorText) = "Could not write zip file \"" + orc_ZipArchivePath + "\".";
+            }
+            s32_Return = C_NOACT;
+         }
+
+         if (s32_Return != C_NO_ERR)
+         {
+            // do not leave an archive without central directory
+            (void)std::remove(orc_ZipArchivePath.c_str());
          }
       }
    }
@@ -178,6 +397,8 @@ sint32 C_OSCZipFile::h_CreateZipFile(const C_SCLString & orc_SourcePath, const s
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Unpacks source zip archive and stores the contents to target unzip path.
 
+   The files are decompressed directly into the target files in chunks.
+
    Assumptions:
    * valid paths
    * read/write permissions
@@ -189,6 +410,8 @@ sint32 C_OSCZipFile::h_CreateZipFile(const C_SCLString & orc_SourcePath, const s
                                               (with or without trailing path delimiter)
    \param[out] opc_ErrorText                 if != NULL and return value != C_NO_ERR: will be filled with textual
                                               details of problem
+   \param[in]  opc_FilesToSkip               if != NULL: names of files within the zip archive not to unpack
+                                              (as returned by h_GetArchiveFileName)
 
    \return
    C_NO_ERR    success
@@ -196,7 +419,8 @@ sint32 C_OSCZipFile::h_CreateZipFile(const C_SCLString & orc_SourcePath, const s
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCZipFile::h_UnpackZipFile(const C_SCLString & orc_SourcePath, const C_SCLString & orc_TargetUnzipPath,
-                                     stw_scl::C_SCLString * const opc_ErrorText)
+                                     stw_scl::C_SCLString * const opc_ErrorText,
+                                     const std::set<C_SCLString> * const opc_FilesToSkip)
 {
    sint32 s32_Return = C_NO_ERR;
 
@@ -227,7 +451,6 @@ sint32 C_OSCZipFile::h_UnpackZipFile(const C_SCLString & orc_SourcePath, const C
          sn_MzStatus = mz_zip_reader_file_stat(&c_ZipArchive, un_Pos, &c_FileStat);
          if (sn_MzStatus == MZ_FALSE)
          {
-            mz_zip_reader_end(&c_ZipArchive);
             if (opc_ErrorText != NULL)
             {
                (*opc_ErrorText) = "Could not get information of zip archive \"" + orc_SourcePath +
@@ -235,88 +458,490 @@ sint32 C_OSCZipFile::h_UnpackZipFile(const C_SCLString & orc_SourcePath, const C
             }
             s32_Return = C_RD_WR;
          }
-         else
+         else if ((opc_FilesToSkip == NULL) || (opc_FilesToSkip->count(c_FileStat.m_filename) == 0U))
          {
             // remember file for unpacking
             c_Files.push_back(c_FileStat);
          }
+         else
+         {
+            // Nothing to do
+         }
       }
 
       vector<mz_zip_archive_file_stat>::const_iterator c_Iter;
       for (c_Iter = c_Files.begin(); (c_Iter != c_Files.end()) && (s32_Return == C_NO_ERR); ++c_Iter)
       {
-         size_t un_UncompFileSize;
-         void * pv_Data = mz_zip_reader_extract_file_to_heap(&c_ZipArchive, c_Iter->m_filename, &un_UncompFileSize, 0);
-         if (pv_Data != NULL)
-         {
-            // get complete file path of current file
-            const C_SCLString c_CompleteFilePath = TGL_FileIncludeTrailingDelimiter(orc_TargetUnzipPath) +
-                                                   c_Iter->m_filename;
+         // get complete file path of current file
+         const C_SCLString c_CompleteFilePath = TGL_FileIncludeTrailingDelimiter(orc_TargetUnzipPath) +
+                                                c_Iter->m_filename;
 
-            // check if we have to create a subfolder
-            const C_SCLString c_Path = TGL_ExtractFilePath(c_CompleteFilePath);
-            if (TGL_DirectoryExists(c_Path) == false)
+         // check if we have to create a subfolder
+         const C_SCLString c_Path = TGL_ExtractFilePath(c_CompleteFilePath);
+         if (TGL_DirectoryExists(c_Path) == false)
+         {
+            // create subfolder
+            s32_Return = C_OSCUtils::h_CreateFolderRecursively(c_Path);
+            if ((s32_Return != C_NO_ERR) && (opc_ErrorText != NULL))
             {
-               // create subfolder
-               s32_Return = C_OSCUtils::h_CreateFolderRecursively(c_Path);
-               if ((s32_Return != C_NO_ERR) && (opc_ErrorText != NULL))
-               {
-                  (*opc_ErrorText) = "Could not create subfolder \"" + c_Path + "\".";
-               }
+               (*opc_ErrorText) = "Could not create subfolder \"" + c_Path + "\".";
             }
-            // is it a file or just the folder itself ?
-            if (c_Iter->m_is_directory == MZ_FALSE)
+         }
+         // is it a file or just the folder itself ?
+         if ((s32_Return == C_NO_ERR) && (c_Iter->m_is_directory == MZ_FALSE))
+         {
+            //it's a file -> more to do
+            if (mz_zip_reader_extract_to_file(&c_ZipArchive, c_Iter->m_file_index, c_CompleteFilePath.c_str(),
+                                              0U) == MZ_FALSE)
             {
-               //it's a file -> more to do
-               // create new empty file
-               if (s32_Return == C_NO_ERR)
+               if (opc_ErrorText != NULL)
                {
-                  FILE * pc_File = fopen(c_CompleteFilePath.c_str(), "wb");
-                  // write data
-                  if (pc_File != NULL)
-                  {
-                     size_t un_SizeOfElement = sizeof(charn);
-                     size_t un_NumOfBytesWritten = fwrite(pv_Data, un_SizeOfElement, un_UncompFileSize, pc_File);
-                     if (un_NumOfBytesWritten != un_UncompFileSize)
-                     {
-                        // data not written completely
-                        if (opc_ErrorText != NULL)
-                        {
-                           (*opc_ErrorText) = "Could not unpack file \"" +
-                                              c_CompleteFilePath + "\" of zip archive \"" + orc_SourcePath + "\".";
-                        }
-                        s32_Return = C_RD_WR;
-                     }
-                     fclose(pc_File);
-                  }
-                  else
-                  {
-                     if (opc_ErrorText != NULL)
-                     {
-                        (*opc_ErrorText) = "Could not create file \"" +
-                                           c_CompleteFilePath + "\" to unpack from zip archive \"" + orc_SourcePath +
-                                           "\".";
-                     }
-                     s32_Return = C_RD_WR;
-                  }
+                  (*opc_ErrorText) = "Could not unpack file \"" +
+                                     c_CompleteFilePath + "\" of zip archive \"" + orc_SourcePath + "\".";
                }
+               s32_Return = C_RD_WR;
             }
          }
-         else
+      }
+   }
+   // Close the archive, freeing any resources it was using
+   mz_zip_reader_end(&c_ZipArchive);
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Unpacks one file of a zip archive
+
+   The file is decompressed directly into the target file in chunks.
+   If the folder of the target file does not exist the function will try to create it.
+
+   \param[in]  orc_ZipArchivePath            path of zip archive
+   \param[in]  orc_FileName                  name of file within the zip archive (as returned by h_GetArchiveFileName)
+   \param[in]  orc_TargetFilePath            full path of file to create
+   \param[out] opc_ErrorText                 if != NULL and return value != C_NO_ERR: will be filled with textual
+                                              details of problem
+
+   \return
+   C_NO_ERR    success
+   C_RANGE     file is not contained in zip archive
+   C_RD_WR     could not open zip archive or could not unpack file to target path
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCZipFile::h_UnpackFileFromZipFile(const C_SCLString & orc_ZipArchivePath, const C_SCLString & orc_FileName,
+                                             const C_SCLString & orc_TargetFilePath, C_SCLString * const opc_ErrorText)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   mz_zip_archive c_ZipArchive;
+
+   memset(&c_ZipArchive, 0, sizeof(c_ZipArchive));
+   if (mz_zip_reader_init_file(&c_ZipArchive, orc_ZipArchivePath.c_str(), 0U) == MZ_FALSE)
+   {
+      if (opc_ErrorText != NULL)
+      {
+         (*opc_ErrorText) = "Could not open zip archive \"" + orc_ZipArchivePath + "\".";
+      }
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      const sintn sn_Index = mz_zip_reader_locate_file(&c_ZipArchive, orc_FileName.c_str(), NULL, 0U);
+      const C_SCLString c_Path = TGL_ExtractFilePath(orc_TargetFilePath);
+
+      if (sn_Index < 0)
+      {
+         if (opc_ErrorText != NULL)
+         {
+            (*opc_ErrorText) = "File \"" + orc_FileName + "\" is not contained in zip archive \"" +
+                               orc_ZipArchivePath + "\".";
+         }
+         s32_Return = C_RANGE;
+      }
+      else if ((c_Path != "") && (TGL_DirectoryExists(c_Path) == false) &&
+               (C_OSCUtils::h_CreateFolderRecursively(c_Path) != C_NO_ERR))
+      {
+         if (opc_ErrorText != NULL)
+         {
+            (*opc_ErrorText) = "Could not create subfolder \"" + c_Path + "\".";
+         }
+         s32_Return = C_RD_WR;
+      }
+      else if (mz_zip_reader_extract_to_file(&c_ZipArchive, static_cast<mz_uint>(sn_Index),
+                                             orc_TargetFilePath.c_str(), 0U) == MZ_FALSE)
+      {
+         if (opc_ErrorText != NULL)
+         {
+            (*opc_ErrorText) = "Could not unpack file \"" + orc_TargetFilePath + "\" of zip archive \"" +
+                               orc_ZipArchivePath + "\".";
+         }
+         s32_Return = C_RD_WR;
+      }
+      else
+      {
+         // Nothing to do
+      }
+      mz_zip_reader_end(&c_ZipArchive);
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read one file of a zip archive into memory
+
+   Allows to work with the content of a file without unpacking it to disk.
+
+   \param[in]  orc_ZipArchivePath            path of zip archive
+   \param[in]  orc_FileName                  name of file within the zip archive (as returned by h_GetArchiveFileName)
+   \param[out] orc_FileContent               uncompressed content of file
+   \param[out] opc_ErrorText                 if != NULL and return value != C_NO_ERR: will be filled with textual
+                                              details of problem
+
+   \return
+   C_NO_ERR    success
+   C_RANGE     file is not contained in zip archive
+   C_RD_WR     could not open zip archive or could not read file from zip archive
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCZipFile::h_ReadFileFromZipFile(const C_SCLString & orc_ZipArchivePath, const C_SCLString & orc_FileName,
+                                           std::vector<uint8> & orc_FileContent, C_SCLString * const opc_ErrorText)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   mz_zip_archive c_ZipArchive;
+
+   orc_FileContent.clear();
+   memset(&c_ZipArchive, 0, sizeof(c_ZipArchive));
+   if (mz_zip_reader_init_file(&c_ZipArchive, orc_ZipArchivePath.c_str(), 0U) == MZ_FALSE)
+   {
+      if (opc_ErrorText != NULL)
+      {
+         (*opc_ErrorText) = "Could not open zip archive \"" + orc_ZipArchivePath + "\".";
+      }
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      const sintn sn_Index = mz_zip_reader_locate_file(&c_ZipArchive, orc_FileName.c_str(), NULL, 0U);
+      mz_zip_archive_file_stat c_FileStat;
+
+      if (sn_Index < 0)
+      {
+         if (opc_ErrorText != NULL)
+         {
+            (*opc_ErrorText) = "File \"" + orc_FileName + "\" is not contained in zip archive \"" +
+                               orc_ZipArchivePath + "\".";
+         }
+         s32_Return = C_RANGE;
+      }
+      else if (mz_zip_reader_file_stat(&c_ZipArchive, static_cast<mz_uint>(sn_Index), &c_FileStat) == MZ_FALSE)
+      {
+         s32_Return = C_RD_WR;
+      }
+      else if (c_FileStat.m_uncomp_size > 0U)
+      {
+         try
+         {
+            orc_FileContent.resize(static_cast<size_t>(c_FileStat.m_uncomp_size));
+         }
+         catch (...)
+         {
+            s32_Return = C_RD_WR;
+         }
+         if ((s32_Return == C_NO_ERR) &&
+             (mz_zip_reader_extract_to_mem(&c_ZipArchive, static_cast<mz_uint>(sn_Index), &orc_FileContent[0],
+                                           orc_FileContent.size(), 0U) == MZ_FALSE))
          {
-            if (opc_ErrorText != NULL)
-            {
-               (*opc_ErrorText) = static_cast<C_SCLString>("Could not read file \"") +
-                                  c_Iter->m_filename + "\" from zip archive \"" + orc_SourcePath + "\".";
-            }
             s32_Return = C_RD_WR;
          }
-         // we're done, get next file content in case of no error
-         mz_free(pv_Data);
       }
+      else
+      {
+         // Nothing to do: empty file
+      }
+
+      if ((s32_Return == C_RD_WR) && (opc_ErrorText != NULL))
+      {
+         (*opc_ErrorText) = "Could not read file \"" + orc_FileName + "\" from zip archive \"" +
+                            orc_ZipArchivePath + "\".";
+      }
+      mz_zip_reader_end(&c_ZipArchive);
+   }
+
+   if (s32_Return != C_NO_ERR)
+   {
+      orc_FileContent.clear();
    }
-   // Close the archive, freeing any resources it was using
-   mz_zip_reader_end(&c_ZipArchive);
 
    return s32_Return;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether a zip archive contains a file
+
+   \param[in]  orc_ZipArchivePath            path of zip archive
+   \param[in]  orc_FileName                  name of file within the zip archive (as returned by h_GetArchiveFileName)
+
+   \return
+   true    file is contained in zip archive
+   false   file is not contained in zip archive or zip archive could not be opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCZipFile::h_IsFileInZipFile(const C_SCLString & orc_ZipArchivePath, const C_SCLString & orc_FileName)
+{
+   bool q_Return = false;
+
+   mz_zip_archive c_ZipArchive;
+
+   memset(&c_ZipArchive, 0, sizeof(c_ZipArchive));
+   if (mz_zip_reader_init_file(&c_ZipArchive, orc_ZipArchivePath.c_str(), 0U) == MZ_TRUE)
+   {
+      q_Return = (mz_zip_reader_locate_file(&c_ZipArchive, orc_FileName.c_str(), NULL, 0U) >= 0);
+      mz_zip_reader_end(&c_ZipArchive);
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name of file within zip archive
+
+   miniz cannot handle windows '\\' directories, therefore change to '/'.
+
+   \param[in]  orc_RelativeFilePath   file path relative to the root of the zip archive
+
+   \return
+   name of file within zip archive
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCZipFile::h_GetArchiveFileName(const C_SCLString & orc_RelativeFilePath)
+{
+   C_SCLString c_FilePathWithSlashes;
+
+   for (uint32 u32_Pos = 1U; u32_Pos <= orc_RelativeFilePath.Length(); u32_Pos++)
+   {
+      if (orc_RelativeFilePath[u32_Pos] == '\\')
+      {
+         c_FilePathWithSlashes += '/';
+      }
+      else
+      {
+         c_FilePathWithSlashes += orc_RelativeFilePath[u32_Pos];
+      }
+   }
+
+   return c_FilePathWithSlashes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compress one file in memory
+
+   Reads the source file and places its raw deflate data, size and checksum in the entry.
+   Large files are compressed with parallel chunks.
+
+   \param[in,out] orc_Entry              file to compress; result is placed in s32_Result:
+                                         C_NO_ERR   compressed
+                                         C_RD_WR    could not read file
+                                         C_NOACT    could not compress
+   \param[in]     ou8_CompressionLevel   compression level
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCZipFile::mh_CompressEntry(C_ZipEntry & orc_Entry, const uint8 ou8_CompressionLevel)
+{
+   const sint32 s32_FileSize = TGL_FileSize(orc_Entry.c_SourcePath);
+   std::FILE * const pt_File = (s32_FileSize >= 0) ? std::fopen(orc_Entry.c_SourcePath.c_str(), "rb") : NULL;
+
+   orc_Entry.s32_Result = C_RD_WR;
+   if (pt_File != NULL)
+   {
+      std::vector<uint8> c_Data;
+      bool q_Read = false;
+
+      try
+      {
+         c_Data.resize(static_cast<size_t>(s32_FileSize));
+         q_Read = (c_Data.size() == 0) || (std::fread(&c_Data[0], 1U, c_Data.size(), pt_File) == c_Data.size());
+      }
+      catch (...)
+      {
+         orc_Entry.s32_Result = C_NOACT; // not enough memory
+      }
+      (void)std::fclose(pt_File);
+
+      if (q_Read == true)
+      {
+         const uint8 * const pu8_Data = (c_Data.size() == 0) ? NULL : &c_Data[0];
+         orc_Entry.u32_UncompressedSize = static_cast<uint32>(c_Data.size());
+         orc_Entry.u32_Crc32 = static_cast<uint32>(mz_crc32(MZ_CRC32_INIT, pu8_Data, c_Data.size()));
+         if (C_OSCZipData::h_Deflate(orc_Entry.c_Compressed, pu8_Data, orc_Entry.u32_UncompressedSize,
+                                     ou8_CompressionLevel, orc_Entry.q_Large) == C_NO_ERR)
+         {
+            orc_Entry.s32_Result = C_NO_ERR;
+         }
+         else
+         {
+            orc_Entry.s32_Result = C_NOACT;
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compress small files in memory
+
+   Compresses every ou32_Step-th entry starting with entry ou32_First.
+   Streamed and large entries are skipped.
+   Executed in parallel by multiple threads.
+
+   \param[in,out] opc_Entries            entries to compress
+   \param[in]     ou32_First             index of first entry to compress
+   \param[in]     ou32_Step              distance between entries to compress
+   \param[in]     ou8_CompressionLevel   compression level
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCZipFile::mh_CompressEntries(std::vector<C_ZipEntry> * const opc_Entries, const uint32 ou32_First,
+                                      const uint32 ou32_Step, const uint8 ou8_CompressionLevel)
+{
+   uint32 u32_SmallEntry = 0U;
+
+   //count only the entries compressed here so the work is distributed evenly
+   for (uint32 u32_Entry = 0U; u32_Entry < opc_Entries->size(); u32_Entry++)
+   {
+      C_ZipEntry & rc_Entry = (*opc_Entries)[u32_Entry];
+      if ((rc_Entry.q_Streamed == false) && (rc_Entry.q_Large == false))
+      {
+         if ((u32_SmallEntry % ou32_Step) == ou32_First)
+         {
+            mh_CompressEntry(rc_Entry, ou8_CompressionLevel);
+         }
+         u32_SmallEntry++;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compress one file too large for one batch
+
+   Reads the source file in windows of mhu32_MAX_BATCH_SIZE bytes. Each window is compressed with parallel chunks.
+   The compressed windows form one raw deflate stream that is written to the target file.
+
+   \param[in,out] orc_Entry              file to compress; sizes and checksum are placed in the entry,
+                                         the result in s32_Result:
+                                         C_NO_ERR   compressed
+                                         C_RD_WR    could not read file
+                                         C_NOACT    could not compress or write compressed data
+   \param[in]     opt_Target             file to write the compressed data to
+   \param[in]     ou8_CompressionLevel   compression level
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCZipFile::mh_CompressStreamedEntry(C_ZipEntry & orc_Entry, std::FILE * const opt_Target,
+                                            const uint8 ou8_CompressionLevel)
+{
+   const sint32 s32_FileSize = TGL_FileSize(orc_Entry.c_SourcePath);
+   std::FILE * const pt_File = (s32_FileSize >= 0) ? std::fopen(orc_Entry.c_SourcePath.c_str(), "rb") : NULL;
+
+   orc_Entry.s32_Result = C_RD_WR;
+   orc_Entry.u32_CompressedSize = 0U;
+   orc_Entry.u32_UncompressedSize = 0U;
+   orc_Entry.u32_Crc32 = static_cast<uint32>(MZ_CRC32_INIT);
+   if (pt_File != NULL)
+   {
+      const uint32 u32_FileSize = static_cast<uint32>(s32_FileSize);
+      std::vector<uint8> c_Window;
+      std::vector<uint8> c_Compressed;
+
+      try
+      {
+         c_Window.resize(std::min(u32_FileSize, mhu32_MAX_BATCH_SIZE));
+         orc_Entry.s32_Result = C_NO_ERR;
+      }
+      catch (...)
+      {
+         orc_Entry.s32_Result = C_NOACT; // not enough memory
+      }
+
+      while ((orc_Entry.u32_UncompressedSize < u32_FileSize) && (orc_Entry.s32_Result == C_NO_ERR))
+      {
+         const uint32 u32_Size = std::min(u32_FileSize - orc_Entry.u32_UncompressedSize,
+                                          static_cast<uint32>(c_Window.size()));
+         const bool q_Last = ((orc_Entry.u32_UncompressedSize + u32_Size) == u32_FileSize);
+
+         if (std::fread(&c_Window[0], 1U, u32_Size, pt_File) != u32_Size)
+         {
+            orc_Entry.s32_Result = C_RD_WR;
+         }
+         else if ((C_OSCZipData::h_Deflate(c_Compressed, &c_Window[0], u32_Size, ou8_CompressionLevel, true,
+                                           q_Last) != C_NO_ERR) ||
+                  (c_Compressed.size() == 0) ||
+                  (std::fwrite(&c_Compressed[0], 1U, c_Compressed.size(), opt_Target) != c_Compressed.size()))
+         {
+            orc_Entry.s32_Result = C_NOACT;
+         }
+         else
+         {
+            orc_Entry.u32_Crc32 = static_cast<uint32>(mz_crc32(orc_Entry.u32_Crc32, &c_Window[0], u32_Size));
+            orc_Entry.u32_CompressedSize += static_cast<uint32>(c_Compressed.size());
+            orc_Entry.u32_UncompressedSize += u32_Size;
+         }
+      }
+      (void)std::fclose(pt_File);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write data to zip archive file
+
+   Write function of the miniz archive writer.
+   If miniz passes mu8_COMPRESSED_DATA_FROM_FILE as data, the compressed data of the streamed entry is copied from
+   its temporary file instead. So miniz never needs the complete compressed data in memory.
+
+   \param[in,out] opv_Output    archive output (C_ZipArchiveOutput)
+   \param[in]     ou64_Offset   position in archive file to write to
+   \param[in]     opv_Buffer    data to write
+   \param[in]     oun_Size      number of bytes to write
+
+   \return
+   number of bytes written (== oun_Size on success)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static size_t m_WriteToArchive(void * const opv_Output, const mz_uint64 ou64_Offset, const void * const opv_Buffer,
+                               const size_t oun_Size)
+{
+   C_ZipArchiveOutput & rc_Output = *static_cast<C_ZipArchiveOutput *>(opv_Output);
+   size_t un_Written = 0U;
+   bool q_Positioned = true;
+
+   // miniz writes sequentially; but do not rely on it
+   if (ou64_Offset != rc_Output.u64_Position)
+   {
+      q_Positioned = (std::fseek(rc_Output.pt_Archive, static_cast<long>(ou64_Offset), SEEK_SET) == 0);
+      rc_Output.u64_Position = ou64_Offset;
+   }
+
+   if (q_Positioned == true)
+   {
+      if ((opv_Buffer == &mu8_COMPRESSED_DATA_FROM_FILE) && (rc_Output.pt_CompressedData != NULL))
+      {
+         std::vector<uint8> c_Buffer(std::min(oun_Size, static_cast<size_t>(mu32_COPY_BUFFER_SIZE)));
+         bool q_Ok = (c_Buffer.size() > 0) && (std::fseek(rc_Output.pt_CompressedData, 0, SEEK_SET) == 0);
+
+         while ((un_Written < oun_Size) && (q_Ok == true))
+         {
+            const size_t un_Size = std::min(oun_Size - un_Written, c_Buffer.size());
+            q_Ok = (std::fread(&c_Buffer[0], 1U, un_Size, rc_Output.pt_CompressedData) == un_Size) &&
+                   (std::fwrite(&c_Buffer[0], 1U, un_Size, rc_Output.pt_Archive) == un_Size);
+            if (q_Ok == true)
+            {
+               un_Written += un_Size;
+            }
+         }
+      }
+      else
+      {
+         un_Written = std::fwrite(opv_Buffer, 1U, oun_Size, rc_Output.pt_Archive);
+      }
+      rc_Output.u64_Position += un_Written;
+   }
+   return un_Written;
+}
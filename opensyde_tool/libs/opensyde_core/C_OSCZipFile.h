@@ -16,9 +16,13 @@
 #define C_OSCZIPFILEH
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <map>
 #include <set>
+#include <vector>
 #include "stwtypes.h"
 #include "CSCLString.h"
+#include "C_OSCZipData.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw_opensyde_core
@@ -35,9 +39,54 @@ public:
                                             const stw_scl::C_SCLString & orc_ZipArchivePath,
                                             stw_scl::C_SCLString * const opc_ErrorText = NULL);
 
+   static stw_types::sint32 h_CreateZipFile(const std::map<stw_scl::C_SCLString,
+                                                            stw_scl::C_SCLString> & orc_FilesToZip,
+                                            const stw_scl::C_SCLString & orc_ZipArchivePath,
+                                            stw_scl::C_SCLString * const opc_ErrorText = NULL,
+                                            const stw_types::uint8 ou8_CompressionLevel =
+                                               C_OSCZipData::hu8_COMPRESSION_LEVEL_BEST);
+
    static stw_types::sint32 h_UnpackZipFile(const stw_scl::C_SCLString & orc_SourcePath,
                                             const stw_scl::C_SCLString & orc_TargetUnzipPath,
-                                            stw_scl::C_SCLString * const opc_ErrorText = NULL);
+                                            stw_scl::C_SCLString * const opc_ErrorText = NULL,
+                                            const std::set<stw_scl::C_SCLString> * const opc_FilesToSkip = NULL);
+   static stw_types::sint32 h_UnpackFileFromZipFile(const stw_scl::C_SCLString & orc_ZipArchivePath,
+                                                    const stw_scl::C_SCLString & orc_FileName,
+                                                    const stw_scl::C_SCLString & orc_TargetFilePath,
+                                                    stw_scl::C_SCLString * const opc_ErrorText = NULL);
+   static stw_types::sint32 h_ReadFileFromZipFile(const stw_scl::C_SCLString & orc_ZipArchivePath,
+                                                  const stw_scl::C_SCLString & orc_FileName,
+                                                  std::vector<stw_types::uint8> & orc_FileContent,
+                                                  stw_scl::C_SCLString * const opc_ErrorText = NULL);
+   static bool h_IsFileInZipFile(const stw_scl::C_SCLString & orc_ZipArchivePath,
+                                 const stw_scl::C_SCLString & orc_FileName);
+   static stw_scl::C_SCLString h_GetArchiveFileName(const stw_scl::C_SCLString & orc_RelativeFilePath);
+
+private:
+   ///max. size of files compressed in memory at once; limits memory usage, larger files are streamed
+   static const stw_types::uint32 mhu32_MAX_BATCH_SIZE = 0x1000000U;
+   static const stw_types::uint32 mhu32_LARGE_FILE_SIZE = 0x200000U; ///< files compressed with parallel chunks
+
+   ///file to add to archive
+   class C_ZipEntry
+   {
+   public:
+      stw_scl::C_SCLString c_ArchiveName;
+      stw_scl::C_SCLString c_SourcePath;
+      bool q_Streamed;                            ///< true: too large to compress in memory; streamed into archive
+      bool q_Large;                               ///< true: compressed with parallel chunks instead of per file
+      std::vector<stw_types::uint8> c_Compressed; ///< raw deflate data
+      stw_types::uint32 u32_CompressedSize;       ///< size of raw deflate data of streamed entry
+      stw_types::uint32 u32_UncompressedSize;
+      stw_types::uint32 u32_Crc32;
+      stw_types::sint32 s32_Result;
+   };
+
+   static void mh_CompressEntry(C_ZipEntry & orc_Entry, const stw_types::uint8 ou8_CompressionLevel);
+   static void mh_CompressStreamedEntry(C_ZipEntry & orc_Entry, std::FILE * const opt_Target,
+                                        const stw_types::uint8 ou8_CompressionLevel);
+   static void mh_CompressEntries(std::vector<C_ZipEntry> * const opc_Entries, const stw_types::uint32 ou32_First,
+                                  const stw_types::uint32 ou32_Step, const stw_types::uint8 ou8_CompressionLevel);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
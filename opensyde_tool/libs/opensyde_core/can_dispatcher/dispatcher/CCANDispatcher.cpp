@@ -28,6 +28,7 @@ using namespace stw_errors;
 using namespace stw_can;
 
 /* -- Defines ------------------------------------------------------------------------------------------------------- */
+static const uint32 mu32_STD_ID_COUNT = 0x800U; ///< number of possible 11bit IDs
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -113,6 +114,23 @@ bool C_CAN_RXFilter::DoesMessagePass(const T_STWCAN_Msg_RX & orc_Message) const
    return q_Pass;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether filter lets exactly one ID pass
+
+   Used by the dispatcher to decide whether the filter can be placed in its ID lookup index.
+   If true the filter passes exactly the messages with u32_ID == u32_Code and u8_XTD == q_XTD
+   (and the RTR condition, which the dispatcher still checks via DoesMessagePass).
+
+   \return
+   true    -> filter passes one specific 11bit or 29bit ID     \n
+   false   -> filter uses a mask or passes both ID types
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CAN_RXFilter::IsSingleIDFilter(void) const
+{
+   return ((u32_Mask == 0xFFFFFFFFUL) && (q_XTDMustMatch == true));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   constructor
 
@@ -267,6 +285,266 @@ sint32 C_CAN_RXQueue::GetStatus(void)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   constructor
+
+   Init instance.
+   The ring buffer has no capacity until SetCapacity() was called.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CAN_RXRingBuffer::C_CAN_RXRingBuffer(void) :
+   mc_WriteIndex(0U),
+   mu32_CachedReadIndex(0U),
+   mc_ReadIndex(0U),
+   mc_OverflowCount(0U),
+   mu32_Capacity(0U),
+   mu32_IndexMask(0U)
+{
+   (void)std::memset(&mau8_PaddingFront[0], 0, sizeof(mau8_PaddingFront));
+   (void)std::memset(&mau8_PaddingWrite[0], 0, sizeof(mau8_PaddingWrite));
+   (void)std::memset(&mau8_PaddingRead[0], 0, sizeof(mau8_PaddingRead));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   add element to ring buffer
+
+   Producer side: add one more element.
+   Must not be called from more than one thread at the same time.
+
+   \param[in]   orc_Message   message to add
+
+   \return
+   C_NO_ERR    element added                         \n
+   C_OVERFLOW  ring buffer full -> not added; overflow counter incremented
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_RXRingBuffer::Push(const T_STWCAN_Msg_RX & orc_Message)
+{
+   sint32 s32_Return = C_NO_ERR;
+   const uint32 u32_WriteIndex = mc_WriteIndex.load(std::memory_order_relaxed);
+
+   if ((u32_WriteIndex - mu32_CachedReadIndex) >= mu32_Capacity)
+   {
+      //looks full; get the actual read index from the consumer:
+      mu32_CachedReadIndex = mc_ReadIndex.load(std::memory_order_acquire);
+      if ((u32_WriteIndex - mu32_CachedReadIndex) >= mu32_Capacity)
+      {
+         (void)mc_OverflowCount.fetch_add(1U, std::memory_order_relaxed);
+         s32_Return = C_OVERFLOW;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      mc_Slots[u32_WriteIndex & mu32_IndexMask] = orc_Message;
+      //publish the slot:
+      mc_WriteIndex.store(u32_WriteIndex + 1U, std::memory_order_release);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   get oldest element from ring buffer
+
+   Consumer side: get oldest element.
+
+   \param[out]   orc_Message   read message
+
+   \return
+   C_NO_ERR    element read                            \n
+   C_NOACT     no element available
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_RXRingBuffer::Pop(T_STWCAN_Msg_RX & orc_Message)
+{
+   sint32 s32_Return = C_NOACT;
+   const uint32 u32_ReadIndex = mc_ReadIndex.load(std::memory_order_relaxed);
+
+   if (u32_ReadIndex != mc_WriteIndex.load(std::memory_order_acquire))
+   {
+      orc_Message = mc_Slots[u32_ReadIndex & mu32_IndexMask];
+      //release the slot to the producer:
+      mc_ReadIndex.store(u32_ReadIndex + 1U, std::memory_order_release);
+      s32_Return = C_NO_ERR;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   get multiple elements from ring buffer
+
+   Consumer side: get up to ou32_MaxMessages of the oldest elements in one go.
+   Only one synchronization with the producer is required for the whole batch.
+
+   \param[out]   opt_Messages       buffer to copy read messages to (must have space for ou32_MaxMessages entries)
+   \param[in]    ou32_MaxMessages   maximum number of messages to read
+
+   \return
+   number of messages read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_CAN_RXRingBuffer::PopMultiple(T_STWCAN_Msg_RX * const opt_Messages, const uint32 ou32_MaxMessages)
+{
+   const uint32 u32_ReadIndex = mc_ReadIndex.load(std::memory_order_relaxed);
+   uint32 u32_NumRead = mc_WriteIndex.load(std::memory_order_acquire) - u32_ReadIndex;
+
+   if (u32_NumRead > ou32_MaxMessages)
+   {
+      u32_NumRead = ou32_MaxMessages;
+   }
+
+   if ((u32_NumRead > 0U) && (opt_Messages != NULL))
+   {
+      //copy in up to two contiguous chunks (wrap-around at end of storage):
+      const uint32 u32_FirstSlot = u32_ReadIndex & mu32_IndexMask;
+      uint32 u32_FirstChunk = mu32_Capacity - u32_FirstSlot;
+      if (u32_FirstChunk > u32_NumRead)
+      {
+         u32_FirstChunk = u32_NumRead;
+      }
+      (void)std::memcpy(&opt_Messages[0], &mc_Slots[u32_FirstSlot], u32_FirstChunk * sizeof(T_STWCAN_Msg_RX));
+      if (u32_NumRead > u32_FirstChunk)
+      {
+         (void)std::memcpy(&opt_Messages[u32_FirstChunk], &mc_Slots[0],
+                           (u32_NumRead - u32_FirstChunk) * sizeof(T_STWCAN_Msg_RX));
+      }
+      mc_ReadIndex.store(u32_ReadIndex + u32_NumRead, std::memory_order_release);
+   }
+   else
+   {
+      u32_NumRead = 0U;
+   }
+   return u32_NumRead;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set ring buffer capacity
+
+   Allocates the storage. The capacity is rounded up to the next power of two.
+   Discards all existing entries.
+   Not thread safe: must only be called while neither producer nor consumer access the buffer.
+
+   \param[in]   ou32_Capacity  requested number of entries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN_RXRingBuffer::SetCapacity(const uint32 ou32_Capacity)
+{
+   uint32 u32_Capacity = 0U;
+
+   if (ou32_Capacity > 0U)
+   {
+      //limit to 2^31 so the free-running index difference stays unambiguous
+      u32_Capacity = 1U;
+      while ((u32_Capacity < ou32_Capacity) && (u32_Capacity < 0x80000000UL))
+      {
+         u32_Capacity <<= 1U;
+      }
+   }
+
+   mc_Slots.resize(u32_Capacity);
+   mu32_Capacity = u32_Capacity;
+   mu32_IndexMask = (u32_Capacity > 0U) ? (u32_Capacity - 1U) : 0U;
+   mc_WriteIndex.store(0U);
+   mc_ReadIndex.store(0U);
+   mu32_CachedReadIndex = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get ring buffer capacity
+
+   \return
+   Number of entries the buffer can hold
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_CAN_RXRingBuffer::GetCapacity(void) const
+{
+   return mu32_Capacity;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get actual number of entries
+
+   Result is only a snapshot if the producer is active at the same time.
+
+   \return
+   Number of entries in the buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_CAN_RXRingBuffer::GetSize(void) const
+{
+   return mc_WriteIndex.load(std::memory_order_acquire) - mc_ReadIndex.load(std::memory_order_acquire);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Clear all entries
+
+   Consumer side: discard all entries available at the time of the call.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN_RXRingBuffer::Clear(void)
+{
+   mc_ReadIndex.store(mc_WriteIndex.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of dropped messages
+
+   \return
+   Number of messages that could not be added because the buffer was full (since construction;
+   neither SetCapacity() nor Clear() reset the counter)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_CAN_RXRingBuffer::GetOverflowCount(void) const
+{
+   return mc_OverflowCount.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   constructor
+
+   Init instance.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CAN_DispatchClient::C_CAN_DispatchClient(void) :
+   u16_Handle(0U),
+   q_UseRingBuffer(false),
+   u32_OverflowCount(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   add message to the client's queue
+
+   Adds the message to the configured queue type.
+   The caller is responsible for serializing calls.
+
+   \param[in]   orc_Message   message to add
+
+   \return
+   C_NO_ERR    element added                                 \n
+   C_OVERFLOW  maximum configured size reached -> not added  \n
+   C_NOACT     could not add new element -> not added
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_DispatchClient::Push(const T_STWCAN_Msg_RX & orc_Message)
+{
+   sint32 s32_Return;
+
+   if (q_UseRingBuffer == true)
+   {
+      s32_Return = c_RXRingBuffer.Push(orc_Message);
+   }
+   else
+   {
+      s32_Return = c_RXQueue.Push(orc_Message);
+      if (s32_Return != C_NO_ERR)
+      {
+         u32_OverflowCount++;
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   constructor
 
@@ -301,8 +579,13 @@ C_CAN_Dispatcher::C_CAN_Dispatcher(const uint8 ou8_CommChannel) :
 //----------------------------------------------------------------------------------------------------------------------
 C_CAN_Dispatcher::~C_CAN_Dispatcher(void)
 {
-   //nothing more than base class destrcutor to do yet ...
-   //RX-queue will clean up itself
+   sint32 s32_Index;
+
+   for (s32_Index = 0; s32_Index < mc_InstalledClients.GetLength(); s32_Index++)
+   {
+      delete mc_InstalledClients[s32_Index];
+      mc_InstalledClients[s32_Index] = NULL;
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -320,35 +603,93 @@ C_CAN_Dispatcher::~C_CAN_Dispatcher(void)
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_CAN_Dispatcher::DispatchIncoming(void)
 {
-   T_STWCAN_Msg_RX t_Msg;
+   T_STWCAN_Msg_RX at_Msg[mu32_CAN_DISPATCH_BATCH_SIZE];
    sint32 s32_Return = C_NO_ERR;
    sint32 s32_NumMessages = 0;
-   sint32 s32_Loop;
+   uint32 u32_NumRead;
+   uint32 u32_Index;
 
    while (s32_Return == C_NO_ERR)
    {
       // Need to lock the read of the message too, because of the order of pushing the messages in the queue
       // by at least two threads is not guaranteed if only the push is locked.
       // An older message could be pushed into the queue after a newer message.
-      mc_CriticalSection.Acquire();
-      s32_Return = m_CAN_Read_Msg(t_Msg);
+      // The driver might block while reading (e.g. SocketCAN waits for the receive timeout), so this uses a separate
+      // lock: clients can still look up their queues and read from them in the meantime.
+      mc_ReadCriticalSection.Acquire();
+      s32_Return = m_CAN_Read_Msgs(&at_Msg[0], mu32_CAN_DISPATCH_BATCH_SIZE, u32_NumRead);
       if (s32_Return == C_NO_ERR)
       {
-         s32_NumMessages++;
-         for (s32_Loop = 0; s32_Loop < mc_InstalledClients.GetLength(); s32_Loop++)
+         s32_NumMessages += static_cast<sint32>(u32_NumRead);
+         mc_CriticalSection.Acquire();
+         for (u32_Index = 0U; u32_Index < u32_NumRead; u32_Index++)
          {
-            if (mc_InstalledClients[s32_Loop].c_RXFilter.DoesMessagePass(t_Msg) == true)
-            {
-               (void)mc_InstalledClients[s32_Loop].c_RXQueue.Push(t_Msg);
-            }
+            m_DispatchToClients(at_Msg[u32_Index]);
          }
+         mc_CriticalSection.Release();
       }
-      mc_CriticalSection.Release();
+      mc_ReadCriticalSection.Release();
    }
 
    return s32_NumMessages;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read multiple incoming CAN messages
+
+   Read up to ou32_MaxMessages incoming messages from the CAN driver.
+   This default implementation calls m_CAN_Read_Msg() until no more messages are available.
+   Drivers that can fetch multiple messages with one call to the underlying driver shall override this function.
+
+   \param[out]  opt_Messages       buffer for read messages; must have space for ou32_MaxMessages entries
+   \param[in]   ou32_MaxMessages   maximum number of messages to read
+   \param[out]  oru32_NumRead      number of messages placed in opt_Messages
+
+   \return
+   C_NO_ERR   at least one message read
+   else       no message read or error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Dispatcher::m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opt_Messages, const uint32 ou32_MaxMessages,
+                                         uint32 & oru32_NumRead)
+{
+   sint32 s32_Return = C_NOACT;
+
+   oru32_NumRead = 0U;
+   while (oru32_NumRead < ou32_MaxMessages)
+   {
+      s32_Return = m_CAN_Read_Msg(opt_Messages[oru32_NumRead]);
+      if (s32_Return != C_NO_ERR)
+      {
+         break;
+      }
+      oru32_NumRead++;
+   }
+   return (oru32_NumRead > 0U) ? C_NO_ERR : s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming CAN messages
+
+   Block the calling thread until the CAN driver has at least one message to be read or the timeout expired.
+   The message is not read; this is up to the next call of DispatchIncoming().
+   This default implementation does not support waiting.
+   Drivers that can wait for an event of the underlying driver shall override this function.
+
+   \param[in]   ou32_MaxWaitTimeMS   maximum time to wait
+
+   \return
+   C_NO_ERR   message available
+   C_TIMEOUT  no message received within timeout
+   C_NOACT    waiting is not supported by the driver
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Dispatcher::m_CAN_WaitForMsg(const uint32 ou32_MaxWaitTimeMS)
+{
+   (void)ou32_MaxWaitTimeMS;
+   return C_NOACT;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Register RX client.
 
@@ -358,9 +699,16 @@ sint32 C_CAN_Dispatcher::DispatchIncoming(void)
    The registered queue will be added to the list maintained in this class.
    Subsequent incoming messages detected in DispatchIncoming() will be added to all registered queues.
 
+   With eQUEUE_SPSC_RING the client gets a preallocated lock-free ring buffer.
+   Its size is rounded up to the next power of two.
+   Reading from this queue only locks for looking up the handle. This lock is not held while DispatchIncoming() reads
+   from the driver and popping is done without it, so reading does not wait for the driver or for dispatching. The client must make sure ReadFromQueue() and ClearQueue() are only called from one thread
+   and that RemoveClient() is not called for its handle while reading.
+
    \param[out]    oru16_Handle      Handle to RX queue to be used in subsequent actions
    \param[in]     opc_RXFilter      RX filter configuration (optional)
    \param[in]     oru32_BufferSize  size of buffer for this client
+   \param[in]     oe_QueueType      type of queue to install for this client
 
    \return
    C_NO_ERR   -> installed (or reconfigured)
@@ -368,27 +716,38 @@ sint32 C_CAN_Dispatcher::DispatchIncoming(void)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_CAN_Dispatcher::RegisterClient(uint16 & oru16_Handle, const C_CAN_RXFilter * const opc_RXFilter,
-                                        const uint32 & oru32_BufferSize)
+                                        const uint32 & oru32_BufferSize, const E_QueueType oe_QueueType)
 {
    uint16 u16_Handle;
    bool q_Found = false;
+   C_CAN_DispatchClient * pc_Client;
 
    if (mc_InstalledClients.GetHigh() >= 0xFFFF)
    {
       return C_OVERFLOW;
    }
 
-   mc_InstalledClients.IncLength(1);
+   pc_Client = new C_CAN_DispatchClient();
    if (opc_RXFilter != NULL)
    {
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].c_RXFilter = *opc_RXFilter;
+      pc_Client->c_RXFilter = *opc_RXFilter;
    }
    else
    {
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].c_RXFilter.PassAll();
+      pc_Client->c_RXFilter.PassAll();
+   }
+   if (oe_QueueType == eQUEUE_SPSC_RING)
+   {
+      pc_Client->q_UseRingBuffer = true;
+      pc_Client->c_RXRingBuffer.SetCapacity(oru32_BufferSize);
+   }
+   else
+   {
+      pc_Client->c_RXQueue.SetMaxSize(oru32_BufferSize);
    }
-   mc_InstalledClients[mc_InstalledClients.GetHigh()].c_RXQueue.SetMaxSize(oru32_BufferSize);
 
+   //do not modify the client list while messages are being dispatched or handles are looked up:
+   mc_CriticalSection.Acquire();
    //is there a free one ?
    for (u16_Handle = 0U; u16_Handle < mc_ClientsByHandle.GetLength(); u16_Handle++)
    {
@@ -402,15 +761,18 @@ sint32 C_CAN_Dispatcher::RegisterClient(uint16 & oru16_Handle, const C_CAN_RXFil
    if (q_Found == true)
    {
       //insert here !
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].u16_Handle = u16_Handle;
+      pc_Client->u16_Handle = u16_Handle;
    }
    else
    {
-      mc_InstalledClients[mc_InstalledClients.GetHigh()].u16_Handle =
-         static_cast<uint16>(mc_ClientsByHandle.GetLength());
+      pc_Client->u16_Handle = static_cast<uint16>(mc_ClientsByHandle.GetLength());
    }
 
+   mc_InstalledClients.IncLength(1);
+   mc_InstalledClients[mc_InstalledClients.GetHigh()] = pc_Client;
    m_ResyncShortcutPointers();
+   m_RebuildFilterIndex();
+   mc_CriticalSection.Release();
    oru16_Handle = u16_Handle;
    return C_NO_ERR;
 }
@@ -430,30 +792,55 @@ sint32 C_CAN_Dispatcher::RegisterClient(uint16 & oru16_Handle, const C_CAN_RXFil
 sint32 C_CAN_Dispatcher::RemoveClient(const uint16 ou16_Handle)
 {
    uint16 u16_Index;
+   C_CAN_DispatchClient * pc_Client;
 
-   if (ou16_Handle >= mc_ClientsByHandle.GetLength())
-   {
-      return C_NOACT;
-   }
-   if (mc_ClientsByHandle[ou16_Handle] == NULL)
+   mc_CriticalSection.Acquire();
+   pc_Client = m_GetClient(ou16_Handle);
+   if (pc_Client == NULL)
    {
       //nothing installed there ...
+      mc_CriticalSection.Release();
       return C_NOACT;
    }
 
    //find it in the list:
    for (u16_Index = 0U; u16_Index < mc_InstalledClients.GetLength(); u16_Index++)
    {
-      if (mc_ClientsByHandle[ou16_Handle] == &mc_InstalledClients[u16_Index])
+      if (pc_Client == mc_InstalledClients[u16_Index])
       {
+         delete mc_InstalledClients[u16_Index];
          mc_InstalledClients.Delete(u16_Index);
          break;
       }
    }
    m_ResyncShortcutPointers();
+   m_RebuildFilterIndex();
+   mc_CriticalSection.Release();
    return C_NO_ERR;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Look up client by handle
+
+   Must be called with mc_CriticalSection acquired as mc_ClientsByHandle is rebuilt when clients are added or removed.
+
+   \param[in]  ou16_Handle   Handle of the client
+
+   \return
+   client (NULL if there is no client with this handle)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CAN_DispatchClient * C_CAN_Dispatcher::m_GetClient(const uint16 ou16_Handle) const
+{
+   C_CAN_DispatchClient * pc_Client = NULL;
+
+   if (ou16_Handle < mc_ClientsByHandle.GetLength())
+   {
+      pc_Client = mc_ClientsByHandle[ou16_Handle];
+   }
+   return pc_Client;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_CAN_Dispatcher::m_ResyncShortcutPointers(void)
@@ -472,9 +859,9 @@ void C_CAN_Dispatcher::m_ResyncShortcutPointers(void)
    u16_Max = 0U;
    for (u16_Index = 0U; u16_Index < mc_InstalledClients.GetLength(); u16_Index++)
    {
-      if (mc_InstalledClients[u16_Index].u16_Handle > u16_Max)
+      if (mc_InstalledClients[u16_Index]->u16_Handle > u16_Max)
       {
-         u16_Max = mc_InstalledClients[u16_Index].u16_Handle;
+         u16_Max = mc_InstalledClients[u16_Index]->u16_Handle;
       }
    }
    mc_ClientsByHandle.SetLength(static_cast<sint32>(u16_Max) + 1);
@@ -488,12 +875,132 @@ void C_CAN_Dispatcher::m_ResyncShortcutPointers(void)
    for (u16_Index = 0U; u16_Index < mc_InstalledClients.GetLength(); u16_Index++)
    {
       //find client with this handle
-      u16_Handle = mc_InstalledClients[u16_Index].u16_Handle;
+      u16_Handle = mc_InstalledClients[u16_Index]->u16_Handle;
       if (u16_Handle > mc_ClientsByHandle.GetHigh())
       {
          return; //internal problem
       }
-      mc_ClientsByHandle[u16_Handle] = &mc_InstalledClients[u16_Index];
+      mc_ClientsByHandle[u16_Handle] = mc_InstalledClients[u16_Index];
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compile the RX filters of all installed clients into the ID lookup index
+
+   Clients with single-ID filters (as set up by C_CAN_RXFilter::PassOneID) are sorted into
+   the 11bit table or the 29bit map. All other clients are placed in the list of unindexed clients.
+   Must be called with mc_CriticalSection acquired whenever a client or filter changes.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN_Dispatcher::m_RebuildFilterIndex(void)
+{
+   sint32 s32_Index;
+   uint32 u32_ID;
+   std::vector<uint32> c_StdIDCounts(mu32_STD_ID_COUNT, 0U);
+
+   mc_ExtIDIndex.clear();
+   mc_UnindexedClients.clear();
+
+   //first pass: count 11bit clients per ID; sort out the rest
+   for (s32_Index = 0; s32_Index < mc_InstalledClients.GetLength(); s32_Index++)
+   {
+      C_CAN_DispatchClient * const pc_Client = mc_InstalledClients[s32_Index];
+      const C_CAN_RXFilter & rc_Filter = pc_Client->c_RXFilter;
+      if (rc_Filter.IsSingleIDFilter() == false)
+      {
+         mc_UnindexedClients.push_back(pc_Client);
+      }
+      else if (rc_Filter.q_XTD == true)
+      {
+         mc_ExtIDIndex[rc_Filter.u32_Code].push_back(pc_Client);
+      }
+      else if (rc_Filter.u32_Code < mu32_STD_ID_COUNT)
+      {
+         c_StdIDCounts[rc_Filter.u32_Code]++;
+      }
+      else
+      {
+         //invalid 11bit ID; keep original semantics by checking it the conventional way
+         mc_UnindexedClients.push_back(pc_Client);
+      }
+   }
+
+   //second pass: fill flat 11bit table
+   mc_StdIDIndexStart.resize(mu32_STD_ID_COUNT + 1U);
+   mc_StdIDIndexStart[0] = 0U;
+   for (u32_ID = 0U; u32_ID < mu32_STD_ID_COUNT; u32_ID++)
+   {
+      mc_StdIDIndexStart[static_cast<size_t>(u32_ID) + 1U] = mc_StdIDIndexStart[u32_ID] + c_StdIDCounts[u32_ID];
+      c_StdIDCounts[u32_ID] = mc_StdIDIndexStart[u32_ID]; //reuse as insert position
+   }
+   mc_StdIDIndexClients.resize(mc_StdIDIndexStart[mu32_STD_ID_COUNT]);
+   for (s32_Index = 0; s32_Index < mc_InstalledClients.GetLength(); s32_Index++)
+   {
+      C_CAN_DispatchClient * const pc_Client = mc_InstalledClients[s32_Index];
+      const C_CAN_RXFilter & rc_Filter = pc_Client->c_RXFilter;
+      if ((rc_Filter.IsSingleIDFilter() == true) && (rc_Filter.q_XTD == false) &&
+          (rc_Filter.u32_Code < mu32_STD_ID_COUNT))
+      {
+         mc_StdIDIndexClients[c_StdIDCounts[rc_Filter.u32_Code]] = pc_Client;
+         c_StdIDCounts[rc_Filter.u32_Code]++;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Place message into the queues of all clients whose filter it passes
+
+   Uses the compiled filter index so only clients that can match are checked.
+   Must be called with mc_CriticalSection acquired.
+
+   \param[in]  orc_Message   message to dispatch
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN_Dispatcher::m_DispatchToClients(const T_STWCAN_Msg_RX & orc_Message)
+{
+   uint32 u32_Index;
+
+   if (orc_Message.u8_XTD == 0U)
+   {
+      if ((orc_Message.u32_ID < mu32_STD_ID_COUNT) && (mc_StdIDIndexStart.size() > mu32_STD_ID_COUNT))
+      {
+         const uint32 u32_End = mc_StdIDIndexStart[static_cast<size_t>(orc_Message.u32_ID) + 1U];
+         for (u32_Index = mc_StdIDIndexStart[orc_Message.u32_ID]; u32_Index < u32_End; u32_Index++)
+         {
+            //still need to check the RTR condition:
+            if (mc_StdIDIndexClients[u32_Index]->c_RXFilter.DoesMessagePass(orc_Message) == true)
+            {
+               (void)mc_StdIDIndexClients[u32_Index]->Push(orc_Message);
+            }
+         }
+      }
+   }
+   else if (mc_ExtIDIndex.empty() == false)
+   {
+      const std::map<uint32, std::vector<C_CAN_DispatchClient *> >::const_iterator c_It =
+         mc_ExtIDIndex.find(orc_Message.u32_ID);
+      if (c_It != mc_ExtIDIndex.end())
+      {
+         for (u32_Index = 0U; u32_Index < c_It->second.size(); u32_Index++)
+         {
+            if (c_It->second[u32_Index]->c_RXFilter.DoesMessagePass(orc_Message) == true)
+            {
+               (void)c_It->second[u32_Index]->Push(orc_Message);
+            }
+         }
+      }
+   }
+   else
+   {
+      //no 29bit clients in index
+   }
+
+   for (u32_Index = 0U; u32_Index < mc_UnindexedClients.size(); u32_Index++)
+   {
+      if (mc_UnindexedClients[u32_Index]->c_RXFilter.DoesMessagePass(orc_Message) == true)
+      {
+         (void)mc_UnindexedClients[u32_Index]->Push(orc_Message);
+      }
    }
 }
 
@@ -514,19 +1021,110 @@ void C_CAN_Dispatcher::m_ResyncShortcutPointers(void)
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_CAN_Dispatcher::ReadFromQueue(const uint16 ou16_Handle, T_STWCAN_Msg_RX & orc_Message)
 {
-   sint32 s32_Return;
+   sint32 s32_Return = C_RANGE;
+   C_CAN_DispatchClient * pc_Client;
+
+   mc_CriticalSection.Acquire();
+   pc_Client = m_GetClient(ou16_Handle);
+   if ((pc_Client != NULL) && (pc_Client->q_UseRingBuffer == false))
+   {
+      s32_Return = pc_Client->c_RXQueue.Pop(orc_Message);
+   }
+   mc_CriticalSection.Release();
 
-   if (ou16_Handle >= mc_ClientsByHandle.GetLength())
+   if ((pc_Client != NULL) && (pc_Client->q_UseRingBuffer == true))
+   {
+      //lock-free: we are the only consumer of this queue
+      s32_Return = pc_Client->c_RXRingBuffer.Pop(orc_Message);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read multiple messages from queue
+
+   Pop up to ou32_MaxMessages of the oldest messages from queue.
+   Will not dispatch incoming messages.
+   Reading in batches reduces synchronization overhead compared to calling ReadFromQueue() for each message.
+
+   \param[in]  ou16_Handle        Handle of the client
+   \param[out] opt_Messages       buffer for read messages; must have space for ou32_MaxMessages entries
+   \param[in]  ou32_MaxMessages   maximum number of messages to read
+   \param[out] oru32_NumRead      number of messages placed in opt_Messages
+
+   \return
+   C_NO_ERR   -> at least one message read   \n
+   C_RANGE    -> invalid ou16_Handle or opt_Messages is NULL  \n
+   C_NOACT    -> no new message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Dispatcher::ReadFromQueue(const uint16 ou16_Handle, T_STWCAN_Msg_RX * const opt_Messages,
+                                       const uint32 ou32_MaxMessages, uint32 & oru32_NumRead)
+{
+   C_CAN_DispatchClient * pc_Client;
+
+   oru32_NumRead = 0U;
+   if (opt_Messages == NULL)
    {
       return C_RANGE;
    }
-   if (mc_ClientsByHandle[ou16_Handle] == NULL)
+
+   mc_CriticalSection.Acquire();
+   pc_Client = m_GetClient(ou16_Handle);
+   if ((pc_Client != NULL) && (pc_Client->q_UseRingBuffer == false))
+   {
+      while ((oru32_NumRead < ou32_MaxMessages) &&
+             (pc_Client->c_RXQueue.Pop(opt_Messages[oru32_NumRead]) == C_NO_ERR))
+      {
+         oru32_NumRead++;
+      }
+   }
+   mc_CriticalSection.Release();
+
+   if (pc_Client == NULL)
    {
       return C_RANGE;
    }
+   if (pc_Client->q_UseRingBuffer == true)
+   {
+      //lock-free: we are the only consumer of this queue
+      oru32_NumRead = pc_Client->c_RXRingBuffer.PopMultiple(opt_Messages, ou32_MaxMessages);
+   }
+   return (oru32_NumRead > 0U) ? C_NO_ERR : C_NOACT;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of dropped messages
+
+   Get number of messages that could not be placed into the client's queue because it was full.
+
+   \param[in]  ou16_Handle   Handle of the client
+   \param[out] oru32_Count   number of dropped messages since registration
+
+   \return
+   C_NO_ERR   -> count read      \n
+   C_RANGE    -> invalid ou16_Handle
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Dispatcher::GetQueueOverflowCount(const uint16 ou16_Handle, uint32 & oru32_Count)
+{
+   sint32 s32_Return = C_RANGE;
+   const C_CAN_DispatchClient * pc_Client;
 
    mc_CriticalSection.Acquire();
-   s32_Return = mc_ClientsByHandle[ou16_Handle]->c_RXQueue.Pop(orc_Message);
+   pc_Client = m_GetClient(ou16_Handle);
+   if (pc_Client != NULL)
+   {
+      s32_Return = C_NO_ERR;
+      if (pc_Client->q_UseRingBuffer == true)
+      {
+         oru32_Count = pc_Client->c_RXRingBuffer.GetOverflowCount();
+      }
+      else
+      {
+         oru32_Count = pc_Client->u32_OverflowCount;
+      }
+   }
    mc_CriticalSection.Release();
    return s32_Return;
 }
@@ -546,14 +1144,74 @@ sint32 C_CAN_Dispatcher::ReadFromQueue(const uint16 ou16_Handle, T_STWCAN_Msg_RX
 sint32 C_CAN_Dispatcher::ClearQueue(const uint16 ou16_Handle)
 {
    sint32 s32_Return = C_RANGE;
+   C_CAN_DispatchClient * pc_Client;
 
-   if ((ou16_Handle < mc_ClientsByHandle.GetLength()) &&
-       (mc_ClientsByHandle[ou16_Handle] != NULL))
+   mc_CriticalSection.Acquire();
+   pc_Client = m_GetClient(ou16_Handle);
+   if (pc_Client != NULL)
    {
       s32_Return = C_NO_ERR;
-      mc_CriticalSection.Acquire();
-      mc_ClientsByHandle[ou16_Handle]->c_RXQueue.Clear();
-      mc_CriticalSection.Release();
+      if (pc_Client->q_UseRingBuffer == true)
+      {
+         pc_Client->c_RXRingBuffer.Clear();
+      }
+      else
+      {
+         pc_Client->c_RXQueue.Clear();
+      }
+   }
+   mc_CriticalSection.Release();
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming messages for a client
+
+   Block the calling thread until there might be new messages for the client or the timeout expired.
+   Returns immediately if the queue of the client is not empty.
+   Otherwise the CAN driver is asked to wait for the next incoming message (see m_CAN_WaitForMsg()).
+   As the incoming message is not dispatched and might not pass the filter of the client
+    the caller needs to call DispatchIncoming() and ReadFromQueue() and wait again if nothing arrived for him.
+
+   \param[in]  ou16_Handle          Handle of the client
+   \param[in]  ou32_MaxWaitTimeMS   maximum time to wait
+
+   \return
+   C_NO_ERR   -> messages might be available \n
+   C_TIMEOUT  -> no message received within timeout \n
+   C_NOACT    -> waiting is not supported by the driver \n
+   C_RANGE    -> invalid ou16_Handle
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Dispatcher::WaitForIncoming(const uint16 ou16_Handle, const uint32 ou32_MaxWaitTimeMS)
+{
+   sint32 s32_Return;
+   const C_CAN_DispatchClient * pc_Client;
+
+   mc_CriticalSection.Acquire();
+   pc_Client = m_GetClient(ou16_Handle);
+   if (pc_Client == NULL)
+   {
+      s32_Return = C_RANGE;
+   }
+   else if (pc_Client->q_UseRingBuffer == true)
+   {
+      s32_Return = (pc_Client->c_RXRingBuffer.GetSize() > 0U) ? C_NO_ERR : C_NOACT;
+   }
+   else
+   {
+      s32_Return = (pc_Client->c_RXQueue.GetSize() > 0U) ? C_NO_ERR : C_NOACT;
+   }
+   mc_CriticalSection.Release();
+
+   if (s32_Return == C_RANGE)
+   {
+      return C_RANGE;
+   }
+   if (s32_Return != C_NO_ERR)
+   {
+      //do not lock while waiting: other threads shall still be able to dispatch and send
+      s32_Return = m_CAN_WaitForMsg(ou32_MaxWaitTimeMS);
    }
    return s32_Return;
 }
@@ -594,21 +1252,15 @@ sint32 C_CAN_Dispatcher::CAN_Read_Msg(const uint16 ou16_Handle, T_STWCAN_Msg_RX
 sint32 C_CAN_Dispatcher::CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
 {
    sint32 s32_Return;
-   sint32 s32_Loop;
 
    s32_Return = m_CAN_Read_Msg(orc_Message);
    if (s32_Return == C_NO_ERR)
    {
       //dispatch to installed clients:
-      for (s32_Loop = 0; s32_Loop < mc_InstalledClients.GetLength(); s32_Loop++)
-      {
-         if (mc_InstalledClients[s32_Loop].c_RXFilter.DoesMessagePass(orc_Message) == true)
-         {
-            mc_CriticalSection.Acquire();
-            (void)mc_InstalledClients[s32_Loop].c_RXQueue.Push(orc_Message);
-            mc_CriticalSection.Release();
-         }
-      }
+      //the lock also serializes the producer side of ring buffers
+      mc_CriticalSection.Acquire();
+      m_DispatchToClients(orc_Message);
+      mc_CriticalSection.Release();
    }
    else
    {
@@ -634,15 +1286,17 @@ sint32 C_CAN_Dispatcher::CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_CAN_Dispatcher::SetRXFilter(const uint16 ou16_Handle, const C_CAN_RXFilter & orc_RXFilter)
 {
-   if (ou16_Handle >= mc_ClientsByHandle.GetLength())
-   {
-      return C_RANGE;
-   }
-   if (mc_ClientsByHandle[ou16_Handle] == NULL)
+   sint32 s32_Return = C_RANGE;
+   C_CAN_DispatchClient * pc_Client;
+
+   mc_CriticalSection.Acquire();
+   pc_Client = m_GetClient(ou16_Handle);
+   if (pc_Client != NULL)
    {
-      return C_RANGE;
+      pc_Client->c_RXFilter = orc_RXFilter;
+      m_RebuildFilterIndex();
+      s32_Return = C_NO_ERR;
    }
-
-   mc_ClientsByHandle[ou16_Handle]->c_RXFilter = orc_RXFilter;
-   return C_NO_ERR;
+   mc_CriticalSection.Release();
+   return s32_Return;
 }
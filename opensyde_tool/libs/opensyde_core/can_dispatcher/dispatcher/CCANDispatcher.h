@@ -16,6 +16,9 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <deque>
+#include <vector>
+#include <map>
+#include <atomic>
 #include "stwtypes.h"
 #include "CCANBase.h"
 #include "TGLTasks.h"
@@ -36,6 +39,8 @@ namespace stw_can
 #endif
 
 const stw_types::uint32 mu32_CAN_QUEUE_DEFAULT_MAX_SIZE = 2048U;
+const stw_types::uint32 mu32_CAN_DISPATCH_BATCH_SIZE = 64U; ///< max. number of messages read from driver in one go
+const stw_types::uint32 mu32_CAN_CACHE_LINE_SIZE = 64U; ///< assumed cache line size for padding of shared indexes
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 ///We wrap up a deque in order to provide thread safety.
@@ -61,6 +66,48 @@ public:
    stw_types::sint32 GetStatus(void);
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+///Fixed-capacity single-producer/single-consumer ring buffer.
+//Push() must only be called from one thread at a time (the dispatcher serializes this with its critical section).
+//Pop(), PopMultiple() and Clear() must only be called by the one thread owning the client.
+//Both sides work without locks and without allocating memory once the capacity is set.
+class STWCAN_PACKAGE C_CAN_RXRingBuffer
+{
+private:
+   //this class can not be copied (atomics):
+   C_CAN_RXRingBuffer(const C_CAN_RXRingBuffer & orc_Source);
+   C_CAN_RXRingBuffer & operator = (const C_CAN_RXRingBuffer & orc_Source);
+
+   //producer and consumer indexes are placed in separate cache lines to prevent false sharing
+   //indexes are free-running; the slot is determined by masking with the (power of two) capacity
+   stw_types::uint8 mau8_PaddingFront[mu32_CAN_CACHE_LINE_SIZE];
+   std::atomic<stw_types::uint32> mc_WriteIndex; ///< next slot to write; only modified by producer
+   stw_types::uint32 mu32_CachedReadIndex;       ///< producer's last known read index; avoids touching consumer line
+   stw_types::uint8 mau8_PaddingWrite[mu32_CAN_CACHE_LINE_SIZE];
+   std::atomic<stw_types::uint32> mc_ReadIndex;  ///< next slot to read; only modified by consumer
+   stw_types::uint8 mau8_PaddingRead[mu32_CAN_CACHE_LINE_SIZE];
+   std::atomic<stw_types::uint32> mc_OverflowCount; ///< number of messages dropped because the buffer was full
+
+   std::vector<T_STWCAN_Msg_RX> mc_Slots;
+   stw_types::uint32 mu32_Capacity;
+   stw_types::uint32 mu32_IndexMask;
+
+public:
+   C_CAN_RXRingBuffer(void);
+
+   stw_types::sint32 Push(const T_STWCAN_Msg_RX & orc_Message);
+   stw_types::sint32 Pop(T_STWCAN_Msg_RX & orc_Message);
+   stw_types::uint32 PopMultiple(T_STWCAN_Msg_RX * const opt_Messages, const stw_types::uint32 ou32_MaxMessages);
+
+   void SetCapacity(const stw_types::uint32 ou32_Capacity);
+   stw_types::uint32 GetCapacity(void) const;
+
+   stw_types::uint32 GetSize(void) const;
+   void Clear(void);
+
+   stw_types::uint32 GetOverflowCount(void) const;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 ///Reception filter configuration
 //lint -sem(stw_can::C_CAN_RXFilter::PassAll,initializer)
@@ -81,16 +128,29 @@ public:
    void PassOneID(const stw_types::uint32 ou32_ID, const bool oq_ExtID, const bool oq_RTR);
 
    bool DoesMessagePass(const T_STWCAN_Msg_RX & orc_Message) const;
+   bool IsSingleIDFilter(void) const;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
 ///Information about one registered dispatch client
 class STWCAN_PACKAGE C_CAN_DispatchClient
 {
+private:
+   //this class can not be copied:
+   C_CAN_DispatchClient(const C_CAN_DispatchClient & orc_Source);
+   C_CAN_DispatchClient & operator = (const C_CAN_DispatchClient & orc_Source);
+
 public:
-   C_CAN_RXQueue c_RXQueue;
+   C_CAN_DispatchClient(void);
+
+   C_CAN_RXQueue c_RXQueue;           ///< used if q_UseRingBuffer is false
+   C_CAN_RXRingBuffer c_RXRingBuffer; ///< used if q_UseRingBuffer is true
    C_CAN_RXFilter c_RXFilter;
    stw_types::uint16 u16_Handle; //for resyncing with pointer list
+   bool q_UseRingBuffer;
+   stw_types::uint32 u32_OverflowCount; ///< number of messages dropped by c_RXQueue
+
+   stw_types::sint32 Push(const T_STWCAN_Msg_RX & orc_Message);
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -99,11 +159,27 @@ class STWCAN_PACKAGE C_CAN_Dispatcher : public C_CAN_Base
 {
 private:
    stw_scl::SCLDynamicArray <C_CAN_DispatchClient *> mc_ClientsByHandle;
-   stw_scl::SCLDynamicArray <C_CAN_DispatchClient> mc_InstalledClients;
+   //clients are allocated on the heap so their queues do not move in memory when other clients are (un)registered:
+   stw_scl::SCLDynamicArray <C_CAN_DispatchClient *> mc_InstalledClients;
 
    void m_ResyncShortcutPointers(void);
+   C_CAN_DispatchClient * m_GetClient(const stw_types::uint16 ou16_Handle) const;
+
+   //compiled filter index; rebuilt whenever clients or filters change
+   //single-ID filters are looked up by ID; all other filters are checked one by one
+   //11bit IDs: clients for ID n are mc_StdIDIndexClients[mc_StdIDIndexStart[n] .. mc_StdIDIndexStart[n + 1] - 1]
+   std::vector<stw_types::uint32> mc_StdIDIndexStart;
+   std::vector<C_CAN_DispatchClient *> mc_StdIDIndexClients;
+   std::map<stw_types::uint32, std::vector<C_CAN_DispatchClient *> > mc_ExtIDIndex; ///< 29bit ID -> clients
+   std::vector<C_CAN_DispatchClient *> mc_UnindexedClients;
 
+   void m_RebuildFilterIndex(void);
+   void m_DispatchToClients(const T_STWCAN_Msg_RX & orc_Message);
+
+   //mc_CriticalSection protects clients and filter index; it is never held while waiting for the driver
+   //mc_ReadCriticalSection keeps the order of messages read from the driver in DispatchIncoming()
    stw_tgl::C_TGLCriticalSection mc_CriticalSection;
+   stw_tgl::C_TGLCriticalSection mc_ReadCriticalSection;
 
 protected:
    //-----------------------------------------------------------------------------
@@ -121,20 +197,36 @@ protected:
    */
    //-----------------------------------------------------------------------------
    virtual stw_types::sint32 m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message) = 0;
+   virtual stw_types::sint32 m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opt_Messages,
+                                             const stw_types::uint32 ou32_MaxMessages,
+                                             stw_types::uint32 & oru32_NumRead);
+   virtual stw_types::sint32 m_CAN_WaitForMsg(const stw_types::uint32 ou32_MaxWaitTimeMS);
 
 public:
+   ///Type of RX queue to install for a client
+   enum E_QueueType
+   {
+      eQUEUE_DEQUE,     ///< dynamically growing queue; each access is locked by the dispatcher
+      eQUEUE_SPSC_RING  ///< preallocated lock-free ring buffer; client must only read from one thread
+   };
+
    C_CAN_Dispatcher(void);
    C_CAN_Dispatcher(const stw_types::uint8 ou8_CommChannel);
    virtual ~C_CAN_Dispatcher(void);
 
    stw_types::sint32 DispatchIncoming(void);
    stw_types::sint32 RegisterClient(stw_types::uint16 & oru16_Handle, const C_CAN_RXFilter * const opc_RXFilter = NULL,
-                                 const stw_types::uint32 & oru32_BufferSize = mu32_CAN_QUEUE_DEFAULT_MAX_SIZE);
+                                 const stw_types::uint32 & oru32_BufferSize = mu32_CAN_QUEUE_DEFAULT_MAX_SIZE,
+                                 const E_QueueType oe_QueueType = eQUEUE_DEQUE);
    stw_types::sint32 RemoveClient(const stw_types::uint16 ou16_Handle);
    stw_types::sint32 SetRXFilter(const stw_types::uint16 ou16_Handle, const C_CAN_RXFilter & orc_RXFilter);
 
    stw_types::sint32 ReadFromQueue(const stw_types::uint16 ou16_Handle, T_STWCAN_Msg_RX & orc_Message);
+   stw_types::sint32 ReadFromQueue(const stw_types::uint16 ou16_Handle, T_STWCAN_Msg_RX * const opt_Messages,
+                                   const stw_types::uint32 ou32_MaxMessages, stw_types::uint32 & oru32_NumRead);
    stw_types::sint32 ClearQueue(const stw_types::uint16 ou16_Handle);
+   stw_types::sint32 GetQueueOverflowCount(const stw_types::uint16 ou16_Handle, stw_types::uint32 & oru32_Count);
+   stw_types::sint32 WaitForIncoming(const stw_types::uint16 ou16_Handle, const stw_types::uint32 ou32_MaxWaitTimeMS);
 
    //lint -e{1411}  we hide the base class function on purpose here
    stw_types::sint32 CAN_Read_Msg(const stw_types::uint16 ou16_Handle, T_STWCAN_Msg_RX & orc_Message);
@@ -0,0 +1,456 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       CAN replay driver
+
+   CAN dispatcher delivering recorded CAN messages from a C_CAN_ReplaySource instead of reading from a CAN driver.
+   So everything built on top of the dispatcher (e.g. C_OSCComMessageLogger with its interpretation, filters and
+   log files) can be fed with recorded traffic without any CAN hardware.
+
+   Messages can be replayed with their original timing, faster or slower (speed factor) or as fast as they can be
+   processed (speed factor 0).
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h" //pre-compiled headers
+#ifdef __BORLANDC__          //putting the pragmas in the config-header will not work
+#pragma hdrstop
+#pragma package(smart_init)
+#endif
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "CCANReplay.h"
+#include "TGLTime.h"
+
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_can;
+using namespace stw_tgl;
+
+/* -- Defines ------------------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CAN_ReplaySource::~C_CAN_ReplaySource(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   constructor
+
+   Default: no source; replay with original timing; sent messages of recording are replayed too
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CAN_Replay::C_CAN_Replay(void) :
+   C_CAN_Dispatcher(),
+   mpc_Source(NULL),
+   mf64_SpeedFactor(1.0),
+   mq_SkipTxMessages(false),
+   mq_PendingValid(false),
+   mq_TimeBaseValid(false),
+   mq_Finished(false),
+   mu64_FirstMessageTimeStamp(0U),
+   mu64_StartTimeUs(0U),
+   mu32_NumReplayed(0U),
+   mu32_NumSent(0U)
+{
+   mq_XTDAvailable = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   destructor
+
+   The source is not owned and not deleted.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CAN_Replay::~C_CAN_Replay(void)
+{
+   mpc_Source = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set source of recorded messages
+
+   Takes effect with the next call of CAN_Init().
+   The caller keeps ownership and must keep the source alive while the replay is used.
+
+   \param[in]  opc_Source   source of recorded messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN_Replay::SetSource(C_CAN_ReplaySource * const opc_Source)
+{
+   mpc_Source = opc_Source;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set replay speed
+
+   \param[in]  of64_SpeedFactor   1.0: original timing; N: N times faster; <= 0: as fast as possible
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN_Replay::SetSpeedFactor(const float64 of64_SpeedFactor)
+{
+   mf64_SpeedFactor = (of64_SpeedFactor > 0.0) ? of64_SpeedFactor : 0.0;
+   //restart timing based on the next message
+   mq_TimeBaseValid = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get replay speed
+
+   \return
+   speed factor (0.0: as fast as possible)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64 C_CAN_Replay::GetSpeedFactor(void) const
+{
+   return mf64_SpeedFactor;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Configure handling of messages sent by the recording application
+
+   \param[in]  oq_Skip   true: do not replay messages marked as sent; false: replay all messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN_Replay::SetSkipTxMessages(const bool oq_Skip)
+{
+   mq_SkipTxMessages = oq_Skip;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether all recorded messages were replayed
+
+   \return
+   true    all messages replayed
+   false   replay still running or not started
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CAN_Replay::IsFinished(void) const
+{
+   return mq_Finished;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of messages replayed since CAN_Init()
+
+   \return
+   number of replayed messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_CAN_Replay::GetNumReplayedMessages(void) const
+{
+   return mu32_NumReplayed;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of messages sent by the application since CAN_Init()
+
+   \return
+   number of sent (and discarded) messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_CAN_Replay::GetNumSentMessages(void) const
+{
+   return mu32_NumSent;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start replay
+
+   Restarts the source with the first recorded message.
+
+   \return
+   C_NO_ERR   replay started
+   C_CONFIG   no source set
+   else       source could not be restarted
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::CAN_Init(void)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   mu8_CANOpened = 0U;
+   if (mpc_Source != NULL)
+   {
+      s32_Return = mpc_Source->Restart();
+      if (s32_Return == C_NO_ERR)
+      {
+         mq_PendingValid = false;
+         mq_TimeBaseValid = false;
+         mq_Finished = false;
+         mu32_NumReplayed = 0U;
+         mu32_NumSent = 0U;
+         mu8_CANOpened = 1U;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start replay
+
+   The bitrate is ignored; it is defined by the recording.
+
+   \param[in]  os32_BitrateKBitS  ignored
+
+   \return
+   see CAN_Init(void)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::CAN_Init(const sint32 os32_BitrateKBitS)
+{
+   (void)os32_BitrateKBitS;
+   return this->CAN_Init();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stop replay
+
+   \return
+   C_NO_ERR   replay stopped
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::CAN_Exit(void)
+{
+   mu8_CANOpened = 0U;
+   mq_PendingValid = false;
+   return C_NO_ERR;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Restart replay from the beginning
+
+   \return
+   see CAN_Init(void)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::CAN_Reset(void)
+{
+   return this->CAN_Init();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send CAN message
+
+   There is no bus; the message is counted and discarded.
+
+   \param[in]  orc_Message   message to send
+
+   \return
+   C_NO_ERR   message accepted
+   C_CONFIG   replay not started
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   (void)orc_Message;
+   if (mu8_CANOpened == 1U)
+   {
+      mu32_NumSent++;
+      s32_Return = C_NO_ERR;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get system time
+
+   \param[out]  oru64_SystemTimeUs   system time in us
+
+   \return
+   C_NO_ERR   time returned
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::CAN_Get_System_Time(uint64 & oru64_SystemTimeUs) const
+{
+   oru64_SystemTimeUs = TGL_GetTickCountUS();
+   return C_NO_ERR;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Make sure the next message to replay is read from the source
+
+   Skips messages sent by the recording application if configured.
+   The time base of the replay is set with the first pending message.
+   Caller must hold mc_PendingCriticalSection.
+
+   \return
+   C_NO_ERR   pending message available
+   C_NOACT    all messages replayed
+   else       error reported by source
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::m_ReadPendingMessage(void)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   while ((mq_PendingValid == false) && (s32_Return == C_NO_ERR))
+   {
+      bool q_IsTx;
+      s32_Return = mpc_Source->ReadNextMessage(mc_PendingMessage, q_IsTx);
+      if (s32_Return == C_NO_ERR)
+      {
+         mq_PendingValid = ((q_IsTx == false) || (mq_SkipTxMessages == false));
+      }
+      else if (s32_Return == C_NOACT)
+      {
+         mq_Finished = true;
+      }
+      else
+      {
+         //error; report to caller
+      }
+   }
+
+   if ((mq_PendingValid == true) && (mf64_SpeedFactor > 0.0) && (mq_TimeBaseValid == false))
+   {
+      mu64_FirstMessageTimeStamp = mc_PendingMessage.u64_TimeStamp;
+      mu64_StartTimeUs = TGL_GetTickCountUS();
+      mq_TimeBaseValid = true;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get time until the pending message is due
+
+   With a speed factor > 0 a message is due once the time elapsed since the start of the replay
+   (multiplied by the speed factor) reaches its offset to the first replayed message.
+   Caller must hold mc_PendingCriticalSection and make sure a message is pending.
+
+   \return
+   time in us until the pending message is due (0: due now)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_CAN_Replay::m_GetTimeUntilDueUs(void)
+{
+   uint64 u64_Remaining = 0U;
+
+   //time stamps are not strictly ascending; earlier messages are due immediately
+   if ((mf64_SpeedFactor > 0.0) && (mc_PendingMessage.u64_TimeStamp > mu64_FirstMessageTimeStamp))
+   {
+      const float64 f64_Offset = static_cast<float64>(mc_PendingMessage.u64_TimeStamp - mu64_FirstMessageTimeStamp) /
+                                 mf64_SpeedFactor;
+      const float64 f64_Elapsed = static_cast<float64>(TGL_GetTickCountUS() - mu64_StartTimeUs);
+      if (f64_Elapsed < f64_Offset)
+      {
+         u64_Remaining = static_cast<uint64>(f64_Offset - f64_Elapsed) + 1U;
+      }
+   }
+   return u64_Remaining;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read next recorded message if it is due
+
+   See m_GetTimeUntilDueUs() for the timing.
+
+   \param[out]  orc_Message  read message (with original time stamp)
+
+   \return
+   C_NO_ERR   message read
+   C_NOACT    no message due (yet) or all messages replayed
+   C_CONFIG   replay not started
+   else       error reported by source
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   if ((mu8_CANOpened == 1U) && (mpc_Source != NULL))
+   {
+      mc_PendingCriticalSection.Acquire();
+      s32_Return = m_ReadPendingMessage();
+      if (mq_PendingValid == true)
+      {
+         if (m_GetTimeUntilDueUs() == 0U)
+         {
+            orc_Message = mc_PendingMessage;
+            mq_PendingValid = false;
+            mu32_NumReplayed++;
+         }
+         else
+         {
+            s32_Return = C_NOACT;
+         }
+      }
+      mc_PendingCriticalSection.Release();
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait until the next recorded message is due
+
+   Sleeps until the pending message is due according to the replay timing instead of letting the caller poll.
+   If all messages were replayed the full wait time is slept, as nothing will arrive anymore.
+
+   \param[in]   ou32_MaxWaitTimeMS   maximum time to wait
+
+   \return
+   C_NO_ERR   message due
+   C_TIMEOUT  no message due within timeout
+   C_CONFIG   replay not started
+   else       error reported by source
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN_Replay::m_CAN_WaitForMsg(const uint32 ou32_MaxWaitTimeMS)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   if ((mu8_CANOpened == 1U) && (mpc_Source != NULL))
+   {
+      const uint64 u64_MaxWaitTimeUs = static_cast<uint64>(ou32_MaxWaitTimeMS) * 1000U;
+      uint64 u64_WaitTimeUs = u64_MaxWaitTimeUs;
+      bool q_Pending;
+
+      mc_PendingCriticalSection.Acquire();
+      s32_Return = m_ReadPendingMessage();
+      q_Pending = mq_PendingValid;
+      if (q_Pending == true)
+      {
+         u64_WaitTimeUs = m_GetTimeUntilDueUs();
+      }
+      mc_PendingCriticalSection.Release();
+
+      if ((s32_Return == C_NO_ERR) || (s32_Return == C_NOACT))
+      {
+         //do not hold the lock while sleeping: the dispatching thread may read in the meantime
+         if (u64_WaitTimeUs > u64_MaxWaitTimeUs)
+         {
+            TGL_Sleep(ou32_MaxWaitTimeMS);
+            s32_Return = C_TIMEOUT;
+         }
+         else
+         {
+            if (u64_WaitTimeUs > 0U)
+            {
+               //round up so the message is due after waking up
+               TGL_Sleep(static_cast<uint32>((u64_WaitTimeUs + 999U) / 1000U));
+            }
+            s32_Return = (q_Pending == true) ? C_NO_ERR : C_TIMEOUT;
+         }
+      }
+   }
+   return s32_Return;
+}
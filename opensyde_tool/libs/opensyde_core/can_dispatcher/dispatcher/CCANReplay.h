@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       CAN replay driver
+
+   Header for CAN dispatcher fed by recorded CAN traffic instead of a CAN driver.
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef  CCANREPLAYH
+#define  CCANREPLAYH
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.h"
+#include "stw_can.h"
+#include "CCANDispatcher.h"
+#include "TGLTasks.h"
+
+namespace stw_can
+{
+/* -- Defines ------------------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+//----------------------------------------------------------------------------------------------------------------------
+///Interface to a source of recorded CAN messages (e.g. a trace file reader)
+class STWCAN_PACKAGE C_CAN_ReplaySource
+{
+public:
+   virtual ~C_CAN_ReplaySource(void);
+
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Read next recorded CAN message
+
+      \param[out]  orc_Message  recorded message including its original time stamp
+      \param[out]  orq_IsTx     true: message was sent by the recording application
+
+      \return
+      C_NO_ERR   message read
+      C_NOACT    no more messages
+      else       error
+   */
+   //-----------------------------------------------------------------------------
+   virtual stw_types::sint32 ReadNextMessage(T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx) = 0;
+
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Restart reading with the first recorded message
+
+      \return
+      C_NO_ERR   restarted
+      else       error
+   */
+   //-----------------------------------------------------------------------------
+   virtual stw_types::sint32 Restart(void) = 0;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+///CAN dispatcher replaying recorded CAN messages
+//Messages are delivered with their original time stamps.
+//Sent messages are accepted and discarded.
+class STWCAN_PACKAGE C_CAN_Replay :
+   public C_CAN_Dispatcher
+{
+private:
+   C_CAN_Replay(const C_CAN_Replay & orc_Source);               //not implemented -> prevent copying
+   C_CAN_Replay & operator = (const C_CAN_Replay & orc_Source); //not implemented -> prevent assignment
+
+   C_CAN_ReplaySource * mpc_Source;
+   stw_types::float64 mf64_SpeedFactor;
+   bool mq_SkipTxMessages;
+
+   T_STWCAN_Msg_RX mc_PendingMessage; ///< next message; read from source but not delivered yet
+   bool mq_PendingValid;
+   bool mq_TimeBaseValid;
+   bool mq_Finished;
+   stw_types::uint64 mu64_FirstMessageTimeStamp; ///< time stamp of first replayed message
+   stw_types::uint64 mu64_StartTimeUs;           ///< system time the first message was replayed
+   stw_types::uint32 mu32_NumReplayed;
+   stw_types::uint32 mu32_NumSent;
+   stw_tgl::C_TGLCriticalSection mc_PendingCriticalSection; ///< protects pending message and time base
+
+   stw_types::sint32 m_ReadPendingMessage(void);
+   stw_types::uint64 m_GetTimeUntilDueUs(void);
+
+protected:
+   virtual stw_types::sint32 m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message);
+   virtual stw_types::sint32 m_CAN_WaitForMsg(const stw_types::uint32 ou32_MaxWaitTimeMS);
+
+public:
+   C_CAN_Replay(void);
+   virtual ~C_CAN_Replay(void);
+
+   void SetSource(C_CAN_ReplaySource * const opc_Source);
+   void SetSpeedFactor(const stw_types::float64 of64_SpeedFactor);
+   stw_types::float64 GetSpeedFactor(void) const;
+   void SetSkipTxMessages(const bool oq_Skip);
+
+   bool IsFinished(void) const;
+   stw_types::uint32 GetNumReplayedMessages(void) const;
+   stw_types::uint32 GetNumSentMessages(void) const;
+
+   virtual stw_types::sint32 CAN_Init(void);
+   virtual stw_types::sint32 CAN_Init(const stw_types::sint32 os32_BitrateKBitS);
+   virtual stw_types::sint32 CAN_Exit(void);
+   virtual stw_types::sint32 CAN_Reset(void);
+   virtual stw_types::sint32 CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message);
+   virtual stw_types::sint32 CAN_Get_System_Time(stw_types::uint64 & oru64_SystemTimeUs) const;
+};
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Function Prototypes ------------------------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+}
+
+#endif
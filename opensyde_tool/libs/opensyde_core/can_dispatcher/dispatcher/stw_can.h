@@ -38,29 +38,118 @@ struct STW_CAN_EXTMSG
    stw_types::uint8  msg[8];   ///< message data
 };
 
+const stw_types::uint8 STWCAN_MAX_DATA_LENGTH_CLASSIC = 8U;  ///< max. number of data bytes in classic CAN frame
+const stw_types::uint8 STWCAN_MAX_DATA_LENGTH_FD      = 64U; ///< max. number of data bytes in CAN FD frame
+
 ///11bit or 29bit CAN message structure for received messages
+//Note: this structure is not part of the STW CAN DLL binary interface (see CCANDLL.h)
 struct T_STWCAN_Msg_RX
 {
+   T_STWCAN_Msg_RX(void) :
+      u8_FDF(0U),
+      u8_BRS(0U),
+      u8_ESI(0U)
+   {
+   }
+
    stw_types::uint32 u32_ID;         ///< CAN message ID
    stw_types::uint8  u8_XTD;         ///< 0 -> 11bit ID; 1 -> 29bit ID
-   stw_types::uint8  u8_DLC;         ///< data length code (0..8)
+   stw_types::uint8  u8_DLC;         ///< data length code (0..8; CAN FD: 0..15; see STWCAN_DLCToNumBytes)
    stw_types::uint8  u8_RTR;         ///< 0 -> regular frame; 1 -> remote frame
    stw_types::uint8  u8_Align;       ///< alignment dummy
-   stw_types::uint8  au8_Data[8];    ///< message data
+   stw_types::uint8  au8_Data[STWCAN_MAX_DATA_LENGTH_FD]; ///< message data
    stw_types::uint64 u64_TimeStamp;  ///< message reception time in micro-seconds since system start; 0 -> not available
+   stw_types::uint8  u8_FDF;         ///< 0 -> classic CAN frame; 1 -> CAN FD frame
+   stw_types::uint8  u8_BRS;         ///< CAN FD only: 1 -> data phase was transmitted with bit rate switch
+   stw_types::uint8  u8_ESI;         ///< CAN FD only: 1 -> transmitter was error passive
 };
 
 ///11bit or 29bit CAN message structure for sending messages
+//Note: this structure is not part of the STW CAN DLL binary interface (see CCANDLL.h)
 struct T_STWCAN_Msg_TX
 {
+   T_STWCAN_Msg_TX(void) :
+      u8_FDF(0U),
+      u8_BRS(0U)
+   {
+   }
+
    stw_types::uint32 u32_ID;         ///< CAN message ID
    stw_types::uint8  u8_XTD;         ///< 0 -> 11bit ID; 1 -> 29bit ID
-   stw_types::uint8  u8_DLC;         ///< data length code (0..8)
+   stw_types::uint8  u8_DLC;         ///< data length code (0..8; CAN FD: 0..15; see STWCAN_DLCToNumBytes)
    stw_types::uint8  u8_RTR;         ///< 0 -> regular frame; 1 -> remote frame
    stw_types::uint8  u8_Align;       ///< alignment dummy
-   stw_types::uint8  au8_Data[8];    ///< message data
+   stw_types::uint8  au8_Data[STWCAN_MAX_DATA_LENGTH_FD]; ///< message data
+   stw_types::uint8  u8_FDF;         ///< 0 -> classic CAN frame; 1 -> CAN FD frame (RTR not possible)
+   stw_types::uint8  u8_BRS;         ///< CAN FD only: 1 -> transmit data phase with switched bit rate
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of data bytes from data length code
+
+   \param[in]   ou8_DLC   data length code (0..15)
+   \param[in]   ou8_FDF   0: classic CAN frame; 1: CAN FD frame
+
+   \return
+   number of data bytes (classic: 0..8; CAN FD: 0..8,12,16,20,24,32,48,64)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+inline stw_types::uint8 STWCAN_DLCToNumBytes(const stw_types::uint8 ou8_DLC, const stw_types::uint8 ou8_FDF)
+{
+   static const stw_types::uint8 hau8_FD_LENGTHS[16] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U,
+                                                         32U, 48U, 64U };
+   stw_types::uint8 u8_NumBytes;
+
+   if (ou8_FDF == 0U)
+   {
+      u8_NumBytes = (ou8_DLC > STWCAN_MAX_DATA_LENGTH_CLASSIC) ? STWCAN_MAX_DATA_LENGTH_CLASSIC : ou8_DLC;
+   }
+   else
+   {
+      u8_NumBytes = hau8_FD_LENGTHS[ou8_DLC & 0x0FU];
+   }
+   return u8_NumBytes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN FD data length code for number of data bytes
+
+   Rounds up to the next possible CAN FD frame length.
+   The caller is responsible for padding the additional bytes.
+
+   \param[in]   ou8_NumBytes   number of data bytes (0..64)
+
+   \return
+   data length code (0..15)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+inline stw_types::uint8 STWCAN_NumBytesToDLC(const stw_types::uint8 ou8_NumBytes)
+{
+   stw_types::uint8 u8_DLC = 15U;
+
+   if (ou8_NumBytes <= 8U)
+   {
+      u8_DLC = ou8_NumBytes;
+   }
+   else if (ou8_NumBytes <= 24U)
+   {
+      u8_DLC = static_cast<stw_types::uint8>(9U + ((ou8_NumBytes - 9U) / 4U)); //12, 16, 20, 24
+   }
+   else if (ou8_NumBytes <= 32U)
+   {
+      u8_DLC = 13U;
+   }
+   else if (ou8_NumBytes <= 48U)
+   {
+      u8_DLC = 14U;
+   }
+   else
+   {
+      //64 bytes
+   }
+   return u8_DLC;
+}
+
 //const STWTYPES::sint32 STWCAN_STATUS_FUNC_NOT_SUPPORTED = -1;
 const stw_types::sint32 STATUS_FUNCTION_NOT_SUPPORTED = -1; //use old name for compatibility
 
@@ -24,6 +24,9 @@
 #include <linux/can.h>
 #include <linux/can/raw.h>
 #include <poll.h>
+#include <time.h>
+#include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
 
 #include "CSCLString.h"
 #include "TGLTime.h"
@@ -40,6 +43,9 @@ using namespace stw_can;
 using namespace stw_tgl;
 
 /* -- Defines ------------------------------------------------------------------------------------------------------- */
+//space for SO_TIMESTAMPING (three timespecs) or SO_TIMESTAMP (one timeval) control message per frame:
+static const size_t mhun_RX_CONTROL_SIZE = CMSG_SPACE(sizeof(struct scm_timestamping)) +
+                                          CMSG_SPACE(sizeof(struct timeval));
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -57,6 +63,123 @@ void C_CAN::m_InitClass(const uint8 ou8_CommChannel)
    ms32_RxTimeout = 0;
    mu32_RXID = CAN_RX_ID_INVALID;
    mc_CanIfName.PrintFormatted("can%u", (unsigned int)ou8_CommChannel);
+   me_TimeStampSource = eTIMESTAMP_KERNEL;
+   mq_TimeStampingActive = false;
+   mq_HardwareOffsetValid = false;
+   ms64_HardwareOffsetUs = 0;
+   mq_FDFramesActive = false;
+
+   mc_RxHeaders.resize(CAN_RX_BATCH_SIZE);
+   mc_RxIoVecs.resize(CAN_RX_BATCH_SIZE);
+   mc_RxFrames.resize(CAN_RX_BATCH_SIZE);
+   mc_RxControl.resize(CAN_RX_BATCH_SIZE * mhun_RX_CONTROL_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Enable kernel/hardware reception time stamps on the socket
+
+   Tries SO_TIMESTAMPING first; falls back to SO_TIMESTAMP for older kernels.
+   If neither is available the frames are stamped in user space.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN::m_EnableTimeStamps(void)
+{
+   mq_TimeStampingActive = false;
+   mq_HardwareOffsetValid = false;
+
+   if (me_TimeStampSource != eTIMESTAMP_USER_SPACE)
+   {
+      sintn sn_Flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+
+      if (me_TimeStampSource == eTIMESTAMP_HARDWARE)
+      {
+         sn_Flags |= (SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE);
+      }
+      if (setsockopt(msn_Socket, SOL_SOCKET, SO_TIMESTAMPING, &sn_Flags, sizeof(sn_Flags)) == 0)
+      {
+         mq_TimeStampingActive = true;
+      }
+      else
+      {
+         const sintn sn_Enable = 1;
+         (void)setsockopt(msn_Socket, SOL_SOCKET, SO_TIMESTAMP, &sn_Enable, sizeof(sn_Enable));
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get reception time stamp of one received frame
+
+   Evaluates the control messages received with the frame.
+   Kernel time stamps are based on CLOCK_REALTIME and are shifted to the TGL_GetTickCountUS() time base
+   so they are consistent with CAN_Get_System_Time().
+   Hardware time stamps are based on the controller's clock. They are shifted by an offset determined
+   with the first hardware stamped frame.
+
+   \param[in]  orc_Header              header of received frame including control messages
+   \param[in]  os64_RealTimeOffsetUs   offset from CLOCK_REALTIME to TGL_GetTickCountUS() time base
+
+   \return
+   time stamp in micro-seconds (TGL_GetTickCountUS() time base)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_CAN::m_GetTimeStamp(const struct msghdr & orc_Header, const sint64 os64_RealTimeOffsetUs)
+{
+   sint64 s64_TimeStamp = -1;
+   //lint -e{925,929} cast required by CMSG API
+   struct cmsghdr * pt_Cmsg = CMSG_FIRSTHDR(&orc_Header);
+
+   while (pt_Cmsg != NULL)
+   {
+      if ((pt_Cmsg->cmsg_level == SOL_SOCKET) && (pt_Cmsg->cmsg_type == SCM_TIMESTAMPING))
+      {
+         struct scm_timestamping t_Stamps;
+         (void)memcpy(&t_Stamps, CMSG_DATA(pt_Cmsg), sizeof(t_Stamps));
+
+         //index 2: raw hardware time stamp; index 0: software time stamp
+         if ((me_TimeStampSource == eTIMESTAMP_HARDWARE) &&
+             ((t_Stamps.ts[2].tv_sec != 0) || (t_Stamps.ts[2].tv_nsec != 0)))
+         {
+            const sint64 s64_Hardware = (static_cast<sint64>(t_Stamps.ts[2].tv_sec) * 1000000) +
+                                        (static_cast<sint64>(t_Stamps.ts[2].tv_nsec) / 1000);
+            if (mq_HardwareOffsetValid == false)
+            {
+               ms64_HardwareOffsetUs = static_cast<sint64>(TGL_GetTickCountUS()) - s64_Hardware;
+               mq_HardwareOffsetValid = true;
+            }
+            s64_TimeStamp = s64_Hardware + ms64_HardwareOffsetUs;
+         }
+         else if ((t_Stamps.ts[0].tv_sec != 0) || (t_Stamps.ts[0].tv_nsec != 0))
+         {
+            s64_TimeStamp = (static_cast<sint64>(t_Stamps.ts[0].tv_sec) * 1000000) +
+                            (static_cast<sint64>(t_Stamps.ts[0].tv_nsec) / 1000) + os64_RealTimeOffsetUs;
+         }
+         else
+         {
+            //no usable stamp
+         }
+      }
+      else if ((pt_Cmsg->cmsg_level == SOL_SOCKET) && (pt_Cmsg->cmsg_type == SCM_TIMESTAMP))
+      {
+         struct timeval t_Stamp;
+         (void)memcpy(&t_Stamp, CMSG_DATA(pt_Cmsg), sizeof(t_Stamp));
+         s64_TimeStamp = (static_cast<sint64>(t_Stamp.tv_sec) * 1000000) + static_cast<sint64>(t_Stamp.tv_usec) +
+                         os64_RealTimeOffsetUs;
+      }
+      else
+      {
+         //not interested
+      }
+      //lint -e{925,929} cast required by CMSG API
+      pt_Cmsg = CMSG_NXTHDR(const_cast<struct msghdr *>(&orc_Header), pt_Cmsg);
+   }
+
+   if (s64_TimeStamp < 0)
+   {
+      //no (plausible) stamp from kernel
+      s64_TimeStamp = static_cast<sint64>(TGL_GetTickCountUS());
+   }
+   return static_cast<uint64>(s64_TimeStamp);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -96,6 +219,7 @@ sint32 C_CAN::CAN_Exit(void)
    {
       // close previously initialized socket
       (void) close(msn_Socket);
+      mq_FDFramesActive = false;
    }
    else
    {
@@ -201,6 +325,14 @@ sint32 C_CAN::CAN_Init(const stw_scl::C_SCLString & orc_InterfaceName, const sin
                // set return value
                s32_retval = C_CONFIG;
             }
+            else
+            {
+               const sintn sn_Enable = 1;
+               //receive and send CAN FD frames if supported by the kernel; classic frames keep working either way
+               mq_FDFramesActive = (setsockopt(msn_Socket, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &sn_Enable,
+                                               sizeof(sn_Enable)) == 0);
+               m_EnableTimeStamps();
+            }
             ms32_RxTimeout = os32_RxTimeout;
             mc_CanIfName = orc_InterfaceName;
             // TODO: Use SetCommChannel to set cahnnel nmber in CanBase class
@@ -255,23 +387,42 @@ sint32 C_CAN::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
    if (this->msn_Socket >= 0)
    {
       struct pollfd t_PollFd;
-      struct can_frame t_Frame;
+      struct canfd_frame t_Frame;
+      size_t un_FrameSize = CAN_MTU;
+      uint8 u8_NumBytes;
+
+      if ((orc_Message.u8_FDF != 0) && (mq_FDFramesActive == false))
+      {
+         return C_RANGE; //kernel does not support CAN FD
+      }
 
+      (void)memset(&t_Frame, 0, sizeof(t_Frame));
       // prepare CAN frame
       t_Frame.can_id =  CAN_ERR_MASK & orc_Message.u32_ID;
       if (orc_Message.u8_XTD != 0)
       {
          t_Frame.can_id |= CAN_EFF_FLAG;
       }
-      if (orc_Message.u8_RTR != 0)
+      if (orc_Message.u8_FDF != 0)
       {
-         t_Frame.can_id |= CAN_RTR_FLAG;
+         //can_frame and canfd_frame share the layout of the header; only the size written differs
+         un_FrameSize = CANFD_MTU;
+         if (orc_Message.u8_BRS != 0)
+         {
+            t_Frame.flags = CANFD_BRS;
+         }
+         u8_NumBytes = STWCAN_DLCToNumBytes(orc_Message.u8_DLC, 1U);
       }
-      t_Frame.can_dlc = orc_Message.u8_DLC;
-      for (int i = 0; i < 8; ++i)
+      else
       {
-         t_Frame.data[i] = orc_Message.au8_Data[i];
+         if (orc_Message.u8_RTR != 0)
+         {
+            t_Frame.can_id |= CAN_RTR_FLAG;
+         }
+         u8_NumBytes = STWCAN_DLCToNumBytes(orc_Message.u8_DLC, 0U);
       }
+      t_Frame.len = u8_NumBytes;
+      (void)memcpy(&t_Frame.data[0], &orc_Message.au8_Data[0], u8_NumBytes);
 
       // check if socket is ready (sleep max. 50ms)
       t_PollFd.fd = this->msn_Socket;
@@ -281,8 +432,8 @@ sint32 C_CAN::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
       {
          if ((t_PollFd.revents & POLLOUT) != 0)
          {
-            sn_Ret = write(this->msn_Socket, &t_Frame, sizeof(t_Frame));
-            s32_Error = (sn_Ret ==  sizeof(t_Frame)) ? C_NO_ERR : C_COM;
+            sn_Ret = write(this->msn_Socket, &t_Frame, un_FrameSize);
+            s32_Error = (sn_Ret == static_cast<sintn>(un_FrameSize)) ? C_NO_ERR : C_COM;
          }
          else
          {
@@ -316,11 +467,91 @@ sint32 C_CAN::m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
 
 //----------------------------------------------------------------------------------------------------------------------
 
+sint32 C_CAN::m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opt_Messages, const uint32 ou32_MaxMessages,
+                              uint32 & oru32_NumRead)
+{
+   return CAN_Read_Msgs(opt_Messages, ou32_MaxMessages, oru32_NumRead, (uint32)ms32_RxTimeout);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming CAN message
+
+   Waits on the socket without reading from it.
+
+   \param[in]   ou32_MaxWaitTimeMS   maximum time to wait
+
+   \return
+   C_NO_ERR   message available
+   C_TIMEOUT  no message received within timeout
+   C_CONFIG   socket not initialized
+   C_COM      error waiting on socket
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN::m_CAN_WaitForMsg(const uint32 ou32_MaxWaitTimeMS)
+{
+   sint32 s32_Error = C_CONFIG;
+
+   if (this->msn_Socket >= 0)
+   {
+      struct pollfd t_PollFd;
+      sintn sn_Ret;
+
+      t_PollFd.fd = this->msn_Socket;
+      t_PollFd.events = POLLIN;
+      t_PollFd.revents = 0;
+      sn_Ret = poll(&t_PollFd, 1, static_cast<sintn>(ou32_MaxWaitTimeMS));
+      if (sn_Ret > 0)
+      {
+         s32_Error = ((t_PollFd.revents & POLLIN) != 0) ? C_NO_ERR : C_COM;
+      }
+      else if ((sn_Ret == 0) || (errno == EINTR))
+      {
+         s32_Error = C_TIMEOUT;
+      }
+      else
+      {
+         s32_Error = C_COM;
+      }
+   }
+   return s32_Error;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 sint32 C_CAN::CAN_Read_Msg_Timeout(const uint32 ou32_MaxWaitTimeMS, T_STWCAN_Msg_RX & orc_Message)
+{
+   uint32 u32_NumRead;
+
+   return CAN_Read_Msgs(&orc_Message, 1U, u32_NumRead, ou32_MaxWaitTimeMS);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read multiple CAN messages
+
+   Waits up to ou32_MaxWaitTimeMS for the first frame, then fetches all frames available in the socket
+   (up to ou32_MaxMessages) with as few recvmmsg() calls as possible.
+   Frames are stamped with the reception time as configured with SetTimeStampSource().
+   Can be called from multiple threads: fetching from the socket is serialized as the recvmmsg() buffers are shared.
+
+   \param[out]  opt_Messages         buffer for read messages; must have space for ou32_MaxMessages entries
+   \param[in]   ou32_MaxMessages     maximum number of messages to read
+   \param[out]  oru32_NumRead        number of messages placed in opt_Messages
+   \param[in]   ou32_MaxWaitTimeMS   maximum time to wait for the first message
+
+   \return
+   C_NO_ERR   at least one message read
+   C_NOACT    no message received within timeout
+   C_CONFIG   socket not initialized
+   C_COM      error reading from socket
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_CAN::CAN_Read_Msgs(T_STWCAN_Msg_RX * const opt_Messages, const uint32 ou32_MaxMessages,
+                            uint32 & oru32_NumRead, const uint32 ou32_MaxWaitTimeMS)
 {
    sint32 s32_Error;
    sintn sn_Ret;
 
+   oru32_NumRead = 0U;
    if (this->msn_Socket >= 0)
    {
       struct pollfd t_PollFd;
@@ -333,24 +564,90 @@ sint32 C_CAN::CAN_Read_Msg_Timeout(const uint32 ou32_MaxWaitTimeMS, T_STWCAN_Msg
          s32_Error = C_COM; // indicates that an unexpected error occurred, should never happen
          if ((t_PollFd.revents & POLLIN) != 0)
          {
-            struct can_frame t_Frame;
-
-            sn_Ret = read(this->msn_Socket, &t_Frame, sizeof(t_Frame));
-            if (sn_Ret == sizeof(t_Frame))
+            s32_Error = C_NOACT;
+            this->mc_RxLock.Acquire();
+            while (oru32_NumRead < ou32_MaxMessages)
             {
-               // new message received
-               orc_Message.u64_TimeStamp = TGL_GetTickCountUS();                    // better than ioctl(SIOCGSTAMP)
-                                                                                    // since
-                                                                                    // this is synchronous to system
-                                                                                    // time
-               orc_Message.u32_ID = t_Frame.can_id & CAN_ERR_MASK;                  // get received ID
-               orc_Message.u8_XTD = ((t_Frame.can_id & CAN_EFF_FLAG) == 0) ? 0 : 1; // get extended flag
-               orc_Message.u8_RTR = ((t_Frame.can_id & CAN_RTR_FLAG) == 0) ? 0 : 1; // get RTR flag
-               orc_Message.u8_DLC = t_Frame.can_dlc;                                // get data length code
-               for (int i = 0; i < 8; ++i)
+               uint32 u32_Index;
+               uint32 u32_BatchSize = ou32_MaxMessages - oru32_NumRead;
+               struct timespec t_RealTime;
+               sint64 s64_RealTimeOffsetUs;
+
+               if (u32_BatchSize > CAN_RX_BATCH_SIZE)
                {
-                  orc_Message.au8_Data[i] = t_Frame.data[i];
+                  u32_BatchSize = CAN_RX_BATCH_SIZE;
                }
+               for (u32_Index = 0U; u32_Index < u32_BatchSize; u32_Index++)
+               {
+                  mc_RxIoVecs[u32_Index].iov_base = &mc_RxFrames[u32_Index];
+                  mc_RxIoVecs[u32_Index].iov_len = sizeof(struct canfd_frame);
+                  (void)memset(&mc_RxHeaders[u32_Index], 0, sizeof(struct mmsghdr));
+                  mc_RxHeaders[u32_Index].msg_hdr.msg_iov = &mc_RxIoVecs[u32_Index];
+                  mc_RxHeaders[u32_Index].msg_hdr.msg_iovlen = 1;
+                  mc_RxHeaders[u32_Index].msg_hdr.msg_control = &mc_RxControl[u32_Index * mhun_RX_CONTROL_SIZE];
+                  mc_RxHeaders[u32_Index].msg_hdr.msg_controllen = mhun_RX_CONTROL_SIZE;
+               }
+
+               //we already know there is data; do not block for the rest
+               sn_Ret = recvmmsg(this->msn_Socket, &mc_RxHeaders[0], u32_BatchSize, MSG_DONTWAIT, NULL);
+               if (sn_Ret <= 0)
+               {
+                  if ((sn_Ret < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR) &&
+                      (oru32_NumRead == 0U))
+                  {
+                     s32_Error = C_COM;
+                  }
+                  break;
+               }
+
+               //kernel stamps are CLOCK_REALTIME; get offset to our time base once per batch
+               (void)clock_gettime(CLOCK_REALTIME, &t_RealTime);
+               s64_RealTimeOffsetUs = static_cast<sint64>(TGL_GetTickCountUS()) -
+                                      ((static_cast<sint64>(t_RealTime.tv_sec) * 1000000) +
+                                       (static_cast<sint64>(t_RealTime.tv_nsec) / 1000));
+
+               for (u32_Index = 0U; u32_Index < static_cast<uint32>(sn_Ret); u32_Index++)
+               {
+                  const struct canfd_frame & rt_Frame = mc_RxFrames[u32_Index];
+                  const uint32 u32_Length = mc_RxHeaders[u32_Index].msg_len;
+                  if ((u32_Length == CAN_MTU) || (u32_Length == CANFD_MTU))
+                  {
+                     T_STWCAN_Msg_RX & rt_Message = opt_Messages[oru32_NumRead];
+                     const uint8 u8_NumBytes = (rt_Frame.len > CANFD_MAX_DLEN) ? CANFD_MAX_DLEN : rt_Frame.len;
+                     rt_Message.u64_TimeStamp = (me_TimeStampSource == eTIMESTAMP_USER_SPACE) ?
+                                                TGL_GetTickCountUS() :
+                                                m_GetTimeStamp(mc_RxHeaders[u32_Index].msg_hdr,
+                                                               s64_RealTimeOffsetUs);
+                     rt_Message.u32_ID = rt_Frame.can_id & CAN_ERR_MASK;                  // get received ID
+                     rt_Message.u8_XTD = ((rt_Frame.can_id & CAN_EFF_FLAG) == 0) ? 0 : 1; // get extended flag
+                     if (u32_Length == CANFD_MTU)
+                     {
+                        rt_Message.u8_FDF = 1U;
+                        rt_Message.u8_BRS = ((rt_Frame.flags & CANFD_BRS) == 0) ? 0 : 1;
+                        rt_Message.u8_ESI = ((rt_Frame.flags & CANFD_ESI) == 0) ? 0 : 1;
+                        rt_Message.u8_RTR = 0U;                                           // no remote frames in FD
+                        rt_Message.u8_DLC = STWCAN_NumBytesToDLC(u8_NumBytes);
+                     }
+                     else
+                     {
+                        rt_Message.u8_FDF = 0U;
+                        rt_Message.u8_BRS = 0U;
+                        rt_Message.u8_ESI = 0U;
+                        rt_Message.u8_RTR = ((rt_Frame.can_id & CAN_RTR_FLAG) == 0) ? 0 : 1; // get RTR flag
+                        rt_Message.u8_DLC = rt_Frame.len;                                 // get data length code
+                     }
+                     (void)memcpy(&rt_Message.au8_Data[0], &rt_Frame.data[0], u8_NumBytes);
+                     oru32_NumRead++;
+                  }
+               }
+               if (static_cast<uint32>(sn_Ret) < u32_BatchSize)
+               {
+                  break; //socket drained
+               }
+            }
+            this->mc_RxLock.Release();
+            if (oru32_NumRead > 0U)
+            {
                s32_Error = C_NO_ERR;
             }
          }
@@ -393,3 +690,41 @@ uint32 C_CAN::GetLimitRXID(void) const
 {
    return mu32_RXID;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set source of reception time stamps
+
+   Takes effect with the next call to CAN_Init().
+   Default: eTIMESTAMP_KERNEL
+
+   \param[in]  oe_Source   source to use
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CAN::SetTimeStampSource(const E_TimeStampSource oe_Source)
+{
+   me_TimeStampSource = oe_Source;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_CAN::E_TimeStampSource C_CAN::GetTimeStampSource(void) const
+{
+   return me_TimeStampSource;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether CAN FD frames can be sent and received
+
+   Only valid after a successful call to CAN_Init().
+   Whether frames actually go out as CAN FD also depends on the configuration of the network interface
+   (e.g. "ip link set can0 type can ... fd on").
+
+   \return
+   true    CAN_RAW_FD_FRAMES active on socket
+   false   only classic CAN frames possible
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CAN::IsCanFdActive(void) const
+{
+   return mq_FDFramesActive;
+}
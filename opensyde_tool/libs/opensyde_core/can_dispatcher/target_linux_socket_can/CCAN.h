@@ -13,10 +13,14 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <sys/time.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <vector>
 
 #include "stwtypes.h"
 #include "CCANDispatcher.h"
 #include "CSCLString.h"
+#include "TGLTasks.h"
 
 namespace stw_can
 {
@@ -30,6 +34,15 @@ namespace stw_can
 class STWCAN_PACKAGE C_CAN :
    public C_CAN_Dispatcher
 {
+public:
+   ///Source of reception time stamps
+   enum E_TimeStampSource
+   {
+      eTIMESTAMP_USER_SPACE, ///< time of reading the frame from the socket
+      eTIMESTAMP_KERNEL,     ///< time of reception in the kernel (SO_TIMESTAMPING/SO_TIMESTAMP)
+      eTIMESTAMP_HARDWARE    ///< time stamp of the CAN controller if supported; else kernel
+   };
+
 private:
    C_CAN(const C_CAN & orc_Souce);               //not implemented -> prevent copying
    C_CAN & operator = (const C_CAN & orc_Souce); //not implemented -> prevent assignment
@@ -41,12 +54,32 @@ private:
    stw_types::uint32 mu32_RXID;
    stw_scl::C_SCLString mc_CanIfName;
 
+   E_TimeStampSource me_TimeStampSource;
+   bool mq_TimeStampingActive;    ///< true: SO_TIMESTAMPING active; false: SO_TIMESTAMP or none
+   bool mq_HardwareOffsetValid;
+   stw_types::sint64 ms64_HardwareOffsetUs; ///< offset from controller time to TGL_GetTickCountUS() time base
+   bool mq_FDFramesActive;        ///< true: CAN_RAW_FD_FRAMES active on socket
+
+   //preallocated buffers for recvmmsg():
+   //shared by all readers; CAN_Read_Msgs holds mc_RxLock while using them (and the hardware time offset)
+   stw_tgl::C_TGLCriticalSection mc_RxLock;
+   std::vector<struct mmsghdr> mc_RxHeaders;
+   std::vector<struct iovec> mc_RxIoVecs;
+   std::vector<struct canfd_frame> mc_RxFrames; ///< canfd_frame can hold classic and CAN FD frames
+   std::vector<stw_types::uint8> mc_RxControl;
+
    void m_InitClass(const stw_types::uint8 ou8_CommChannel);
+   void m_EnableTimeStamps(void);
+   stw_types::uint64 m_GetTimeStamp(const struct msghdr & orc_Header, const stw_types::sint64 os64_RealTimeOffsetUs);
 
 protected:
    //function from Dispatcher (mandatory to implement)
    //actual reading from CAN driver
    virtual stw_types::sint32 m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message);
+   virtual stw_types::sint32 m_CAN_Read_Msgs(T_STWCAN_Msg_RX * const opt_Messages,
+                                             const stw_types::uint32 ou32_MaxMessages,
+                                             stw_types::uint32 & oru32_NumRead);
+   virtual stw_types::sint32 m_CAN_WaitForMsg(const stw_types::uint32 ou32_MaxWaitTimeMS);
 
 public:
    C_CAN(void);
@@ -65,6 +98,8 @@ public:
    virtual stw_types::sint32 CAN_Get_System_Time(stw_types::uint64 & oru64_SystemTime) const;
 
    stw_types::sint32 CAN_Read_Msg_Timeout(const stw_types::uint32 ou32_MaxWaitTimeMS, T_STWCAN_Msg_RX & orc_Message);
+   stw_types::sint32 CAN_Read_Msgs(T_STWCAN_Msg_RX * const opt_Messages, const stw_types::uint32 ou32_MaxMessages,
+                                   stw_types::uint32 & oru32_NumRead, const stw_types::uint32 ou32_MaxWaitTimeMS);
 
    //setter/getter functions
    void SetDLLName(const stw_scl::C_SCLString & orc_DLLName);
@@ -72,6 +107,11 @@ public:
 
    void SetLimitRXID(const stw_types::uint32 ou32_LimitRXID);
    stw_types::uint32 GetLimitRXID(void) const;
+
+   void SetTimeStampSource(const E_TimeStampSource oe_Source);
+   E_TimeStampSource GetTimeStampSource(void) const;
+
+   bool IsCanFdActive(void) const;
 };
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
@@ -83,6 +123,7 @@ const stw_types::sint32 CAN_COMP_ERR_DLL_INIT             =   -205;
 const stw_types::sint32 CAN_COMP_ERR_DLL_FORMAT           =   -206;
 
 const stw_types::uint32 CAN_RX_ID_INVALID = 0xFFFFFFFFUL;
+const stw_types::uint32 CAN_RX_BATCH_SIZE = 64U; ///< max. number of frames fetched with one recvmmsg() call
 
 /* -- Function Prototypes ------------------------------------------------------------------------------------------- */
 
@@ -450,6 +450,7 @@ sint32 C_CAN::m_ReadMsgFromDLL(T_STWCAN_Msg_RX & orc_Message) const
    -1                                DLL function returns error
    CAN_COMP_ERR_DLL_NOT_OPENED       DLL was not yet loaded
    C_CONFIG                          channel other than 0 configured but not supported by loaded DLL
+   C_RANGE                           CAN FD frame (not supported by STW CAN DLL interface)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_CAN::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
@@ -462,6 +463,10 @@ sint32 C_CAN::CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
    {
       return C_CONFIG;
    }
+   if (orc_Message.u8_FDF != 0U)
+   {
+      return C_RANGE;
+   }
    return m_SendMsgToDLL(orc_Message);
 }
 
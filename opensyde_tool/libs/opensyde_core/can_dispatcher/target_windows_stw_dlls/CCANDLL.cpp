@@ -513,14 +513,28 @@ sint32 C_CAN_DLL::CANext_Bitrate(const uint8 ou8_Channel, const sint32 os32_Bitr
 sint32 C_CAN_DLL::CANext_Read_Msg(const uint8 ou8_Channel, T_STWCAN_Msg_RX & orc_Message)
 {
    sint32 s32_Return;
+   T_STWCAN_DLL_Msg_RX t_Message;
 
    if (mpr_CANext_Read_Msg == NULL)
    {
       return C_NOACT;
    }
    EnterCriticalSection(&mt_Lock);
-   s32_Return = (*mpr_CANext_Read_Msg)(ou8_Channel, &orc_Message);
+   s32_Return = (*mpr_CANext_Read_Msg)(ou8_Channel, &t_Message);
    LeaveCriticalSection(&mt_Lock);
+   if (s32_Return == C_NO_ERR)
+   {
+      orc_Message.u32_ID = t_Message.u32_ID;
+      orc_Message.u8_XTD = t_Message.u8_XTD;
+      orc_Message.u8_DLC = t_Message.u8_DLC;
+      orc_Message.u8_RTR = t_Message.u8_RTR;
+      orc_Message.u8_Align = 0U;
+      (void)memcpy(orc_Message.au8_Data, t_Message.au8_Data, sizeof(t_Message.au8_Data));
+      orc_Message.u64_TimeStamp = t_Message.u64_TimeStamp;
+      orc_Message.u8_FDF = 0U;
+      orc_Message.u8_BRS = 0U;
+      orc_Message.u8_ESI = 0U;
+   }
    return s32_Return;
 }
 
@@ -529,13 +543,24 @@ sint32 C_CAN_DLL::CANext_Read_Msg(const uint8 ou8_Channel, T_STWCAN_Msg_RX & orc
 sint32 C_CAN_DLL::CANext_Send_Msg(const uint8 ou8_Channel, const T_STWCAN_Msg_TX & orc_Message)
 {
    sint32 s32_Return;
+   T_STWCAN_DLL_Msg_TX t_Message;
 
    if (mpr_CANext_Send_Msg == NULL)
    {
       return C_NOACT;
    }
+   if (orc_Message.u8_FDF != 0U)
+   {
+      return C_RANGE; //CAN FD is not supported by the STW CAN DLL interface
+   }
+   t_Message.u32_ID = orc_Message.u32_ID;
+   t_Message.u8_XTD = orc_Message.u8_XTD;
+   t_Message.u8_DLC = orc_Message.u8_DLC;
+   t_Message.u8_RTR = orc_Message.u8_RTR;
+   t_Message.u8_Align = 0U;
+   (void)memcpy(t_Message.au8_Data, orc_Message.au8_Data, sizeof(t_Message.au8_Data));
    EnterCriticalSection(&mt_Lock);
-   s32_Return = (*mpr_CANext_Send_Msg)(ou8_Channel, &orc_Message);
+   s32_Return = (*mpr_CANext_Send_Msg)(ou8_Channel, &t_Message);
    LeaveCriticalSection(&mt_Lock);
    return s32_Return;
 }
@@ -809,6 +834,9 @@ void C_CAN_DLL::STWCANMSG_to_CANMSGRX(T_STWCAN_Msg_RX & orc_Target, const STW_CA
    orc_Target.u8_Align = 0U;
    (void)memcpy(orc_Target.au8_Data, orc_Source.msg, 8U);
    orc_Target.u64_TimeStamp = 0U;
+   orc_Target.u8_FDF = 0U;
+   orc_Target.u8_BRS = 0U;
+   orc_Target.u8_ESI = 0U;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -822,6 +850,9 @@ void C_CAN_DLL::STWCANEXTMSG_to_CANMSGRX(T_STWCAN_Msg_RX & orc_Target, const STW
    orc_Target.u8_Align = 0U;
    (void)memcpy(orc_Target.au8_Data, orc_Source.msg, 8U);
    orc_Target.u64_TimeStamp = 0U;
+   orc_Target.u8_FDF = 0U;
+   orc_Target.u8_BRS = 0U;
+   orc_Target.u8_ESI = 0U;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
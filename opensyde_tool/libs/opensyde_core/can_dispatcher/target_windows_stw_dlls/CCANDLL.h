@@ -31,6 +31,29 @@ namespace stw_can
 #endif
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
+///classic CAN message structure for received messages as defined by the STW CAN DLL binary interface
+struct T_STWCAN_DLL_Msg_RX
+{
+   stw_types::uint32 u32_ID;         ///< CAN message ID
+   stw_types::uint8  u8_XTD;         ///< 0 -> 11bit ID; 1 -> 29bit ID
+   stw_types::uint8  u8_DLC;         ///< data length code (0..8)
+   stw_types::uint8  u8_RTR;         ///< 0 -> regular frame; 1 -> remote frame
+   stw_types::uint8  u8_Align;       ///< alignment dummy
+   stw_types::uint8  au8_Data[8];    ///< message data
+   stw_types::uint64 u64_TimeStamp;  ///< message reception time in micro-seconds since system start; 0 -> not available
+};
+
+///classic CAN message structure for sending messages as defined by the STW CAN DLL binary interface
+struct T_STWCAN_DLL_Msg_TX
+{
+   stw_types::uint32 u32_ID;         ///< CAN message ID
+   stw_types::uint8  u8_XTD;         ///< 0 -> 11bit ID; 1 -> 29bit ID
+   stw_types::uint8  u8_DLC;         ///< data length code (0..8)
+   stw_types::uint8  u8_RTR;         ///< 0 -> regular frame; 1 -> remote frame
+   stw_types::uint8  u8_Align;       ///< alignment dummy
+   stw_types::uint8  au8_Data[8];    ///< message data
+};
+
 //function pointer types:
 typedef stw_types::sint32 (WINAPI *PR_CAN_INIT)(void);
 typedef stw_types::sint32 (WINAPI *PR_CAN_EXIT)(void);
@@ -69,9 +92,9 @@ typedef stw_types::sint32 (WINAPI * PR_CANext_Exit)(const stw_types::uint8 ou8_C
 typedef stw_types::sint32 (WINAPI * PR_CANext_Bitrate)(const stw_types::uint8 ou8_Channel,
                                                        const stw_types::sint32 os32_Bitrate);
 typedef stw_types::sint32 (WINAPI * PR_CANext_Read_Msg)(const stw_types::uint8 ou8_Channel,
-                                                        T_STWCAN_Msg_RX * const opt_Message);
+                                                        T_STWCAN_DLL_Msg_RX * const opt_Message);
 typedef stw_types::sint32 (WINAPI * PR_CANext_Send_Msg)(const stw_types::uint8 ou8_Channel,
-                                                        const T_STWCAN_Msg_TX * const opt_Message);
+                                                        const T_STWCAN_DLL_Msg_TX * const opt_Message);
 typedef stw_types::sint32 (WINAPI * PR_CANext_InterfaceSetup)(const stw_types::uint8 ou8_Channel);
 typedef stw_types::sint32 (WINAPI * PR_CANext_Status)(const stw_types::uint8 ou8_Channel,
                                                       T_STWCAN_Status * const opt_Status);
@@ -17,11 +17,13 @@
 #include "stwerrors.h"
 #include "C_OSCDataDealer.h"
 #include "TGLUtils.h"
+#include "TGLTime.h"
 #include "C_OSCLoggingHandler.h"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw_types;
 using namespace stw_errors;
+using namespace stw_scl;
 using namespace stw_opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
@@ -195,6 +197,105 @@ sint32 C_OSCDataDealer::DataPoolRead(const uint8 ou8_DataPoolIndex, const uint16
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read data of multiple elements from server's data pool
+
+   Read all specified elements one after the other in one call (see DataPoolRead for details on each element).
+   Compared to one call per element this saves the overhead of the caller between the elements
+   (e.g. starting a thread and handling its result for each element).
+
+   An error of one element (e.g. negative response) does not stop reading the other elements.
+   If the communication itself fails (timeout, communication error) the remaining elements are skipped
+   as they would fail with the same error after waiting for the timeout again.
+
+   The number of read elements per second is written to the log.
+
+   \param[in]     orc_ElementIds       elements to read; all must belong to the node of this data dealer
+   \param[out]    opc_Results          if != NULL: result of each element (see DataPoolRead);
+                                       C_NOACT for elements skipped after a communication error
+   \param[out]    opu8_NrCode          if != NULL: negative response code of the first element with an error response
+
+   \return
+   C_NO_ERR    all elements read and placed in data pool
+   else        result of the first failed element (see DataPoolRead)
+               C_RANGE also if an element does not belong to the node of this data dealer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCDataDealer::DataPoolReadMultiple(const std::vector<C_OSCNodeDataPoolListElementId> & orc_ElementIds,
+                                             std::vector<sint32> * const opc_Results, uint8 * const opu8_NrCode)
+{
+   sint32 s32_Return = C_NO_ERR;
+   const uint32 u32_StartTime = stw_tgl::TGL_GetTickCount();
+   uint32 u32_ReadCount = 0U;
+   bool q_NrCodeSet = false;
+
+   if (opc_Results != NULL)
+   {
+      opc_Results->assign(orc_ElementIds.size(), C_NOACT);
+   }
+
+   for (uint32 u32_ItElement = 0U; u32_ItElement < orc_ElementIds.size(); ++u32_ItElement)
+   {
+      const C_OSCNodeDataPoolListElementId & rc_Id = orc_ElementIds[u32_ItElement];
+      sint32 s32_Result;
+      uint8 u8_NrCode = 0U;
+
+      if ((rc_Id.u32_NodeIndex != this->mu32_NodeIndex) || (rc_Id.u32_DataPoolIndex > 0xFFU) ||
+          (rc_Id.u32_ListIndex > 0xFFFFU) || (rc_Id.u32_ElementIndex > 0xFFFFU))
+      {
+         s32_Result = C_RANGE;
+      }
+      else
+      {
+         s32_Result = this->DataPoolRead(static_cast<uint8>(rc_Id.u32_DataPoolIndex),
+                                         static_cast<uint16>(rc_Id.u32_ListIndex),
+                                         static_cast<uint16>(rc_Id.u32_ElementIndex), &u8_NrCode);
+      }
+
+      if (opc_Results != NULL)
+      {
+         (*opc_Results)[u32_ItElement] = s32_Result;
+      }
+
+      if (s32_Result == C_NO_ERR)
+      {
+         ++u32_ReadCount;
+      }
+      else
+      {
+         if (s32_Return == C_NO_ERR)
+         {
+            s32_Return = s32_Result;
+         }
+         if ((s32_Result == C_WARN) && (q_NrCodeSet == false) && (opu8_NrCode != NULL))
+         {
+            (*opu8_NrCode) = u8_NrCode;
+            q_NrCodeSet = true;
+         }
+         if ((s32_Result == C_TIMEOUT) || (s32_Result == C_COM) || (s32_Result == C_CONFIG))
+         {
+            //no chance for the other elements
+            break;
+         }
+      }
+   }
+
+   if (orc_ElementIds.empty() == false)
+   {
+      const uint32 u32_Duration = stw_tgl::TGL_GetTickCount() - u32_StartTime;
+      const uint32 u32_ElementsPerSecond = (u32_Duration > 0U) ? ((u32_ReadCount * 1000U) / u32_Duration) :
+                                           u32_ReadCount;
+      C_SCLString c_Text;
+      c_Text.PrintFormatted("node %u: %u of %u elements read in %u ms (%u elements/s)",
+                            static_cast<uintn>(this->mu32_NodeIndex), static_cast<uintn>(u32_ReadCount),
+                            static_cast<uintn>(orc_ElementIds.size()), static_cast<uintn>(u32_Duration),
+                            static_cast<uintn>(u32_ElementsPerSecond));
+      osc_write_log_info("Read Datapool elements", c_Text);
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Write data to server's data pool
 
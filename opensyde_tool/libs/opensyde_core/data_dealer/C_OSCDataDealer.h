@@ -18,6 +18,7 @@
 
 #include "C_OSCNode.h"
 #include "C_OSCDiagProtocolBase.h"
+#include "C_OSCNodeDataPoolListElementId.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw_opensyde_core
@@ -43,6 +44,9 @@ public:
                                           const stw_types::uint16 ou16_ListIndex,
                                           const stw_types::uint16 ou16_ElementIndex,
                                           stw_types::uint8 * const opu8_NrCode);
+   stw_types::sint32 DataPoolReadMultiple(const std::vector<C_OSCNodeDataPoolListElementId> & orc_ElementIds,
+                                          std::vector<stw_types::sint32> * const opc_Results,
+                                          stw_types::uint8 * const opu8_NrCode);
    stw_types::sint32 DataPoolWrite(const stw_types::uint8 ou8_DataPoolIndex, const stw_types::uint16 ou16_ListIndex,
                                    const stw_types::uint16 ou16_ElementIndex, stw_types::uint8 * const opu8_NrCode);
    virtual stw_types::sint32 NvmRead(const stw_types::uint8 ou8_DataPoolIndex, const stw_types::uint16 ou16_ListIndex,
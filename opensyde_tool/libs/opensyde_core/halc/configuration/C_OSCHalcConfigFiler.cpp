@@ -155,7 +155,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadData(C_OSCHalcConfig & orc_IOData, C_OSCXMLPa
    s32_Retval = mh_LoadIODataBase(orc_IOData, orc_XMLParser, orc_BasePath);
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("ref-content-version") == "ref-content-version")
+      if (orc_XMLParser.SelectNodeChildView("ref-content-version") == "ref-content-version")
       {
          uint32 u32_RefId = 0UL;
          try
@@ -186,7 +186,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadData(C_OSCHalcConfig & orc_IOData, C_OSCXMLPa
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            orc_XMLParser.SelectNodeParent();
+            orc_XMLParser.SelectNodeParentView();
          }
       }
       else
@@ -196,7 +196,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadData(C_OSCHalcConfig & orc_IOData, C_OSCXMLPa
       }
       if (s32_Retval == C_NO_ERR)
       {
-         if (orc_XMLParser.SelectNodeChild("general") == "general")
+         if (orc_XMLParser.SelectNodeChildView("general") == "general")
          {
             if (orc_XMLParser.AttributeExists("is-safe-datablock-set"))
             {
@@ -243,7 +243,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadData(C_OSCHalcConfig & orc_IOData, C_OSCXMLPa
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               orc_XMLParser.SelectNodeParent();
+               orc_XMLParser.SelectNodeParentView();
             }
          }
          else
@@ -283,12 +283,12 @@ sint32 C_OSCHalcConfigFiler::h_SaveData(const C_OSCHalcConfig & orc_IOData, C_OS
    tgl_assert(orc_XMLParser.CreateAndSelectNodeChild("file-version") == "file-version");
    orc_XMLParser.SetNodeContent(stw_scl::C_SCLString::IntToStr(hu16_FILE_VERSION_1));
    //Return
-   orc_XMLParser.SelectNodeParent();
+   orc_XMLParser.SelectNodeParentView();
    //Content version
    tgl_assert(orc_XMLParser.CreateAndSelectNodeChild("ref-content-version") == "ref-content-version");
    orc_XMLParser.SetNodeContent(stw_scl::C_SCLString::IntToStr(orc_IOData.u32_ContentVersion));
    //Return
-   orc_XMLParser.SelectNodeParent();
+   orc_XMLParser.SelectNodeParentView();
    //IO data
    s32_Retval = mh_SaveIODataBase(orc_IOData, orc_XMLParser, orc_BasePath, opc_CreatedFiles);
    if (s32_Retval == C_NO_ERR)
@@ -301,7 +301,7 @@ sint32 C_OSCHalcConfigFiler::h_SaveData(const C_OSCHalcConfig & orc_IOData, C_OS
          orc_XMLParser.SetAttributeBool("is-unsafe-datablock-set", orc_IOData.GetUnsafeDatablockAssigned());
          orc_XMLParser.SetAttributeUint32("unsafe-datablock-index", orc_IOData.GetUnsafeDatablockIndex());
          //Return
-         orc_XMLParser.SelectNodeParent();
+         orc_XMLParser.SelectNodeParentView();
       }
 
       //Domains
@@ -397,13 +397,13 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("config") == "config")
+   if (orc_XMLParser.SelectNodeChildView("config") == "config")
    {
       s32_Retval = mh_LoadIOChannel(orc_IODomain.c_DomainConfig, orc_XMLParser, "config");
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "domain");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "domain");
       }
    }
    else
@@ -411,13 +411,13 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
       osc_write_log_error("Loading IO data", "Could not find \"config\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("channels") == "channels")
+   if (orc_XMLParser.SelectNodeChildView("channels") == "channels")
    {
       if (orc_XMLParser.AttributeExists("length"))
       {
          const uint32 u32_ExpectedCount = orc_XMLParser.GetAttributeUint32("length");
          uint32 u32_ActualCount = 0UL;
-         stw_scl::C_SCLString c_NodeChannel = orc_XMLParser.SelectNodeChild("channel");
+         C_OSCXMLStringView c_NodeChannel = orc_XMLParser.SelectNodeChildView("channel");
          //Clear any existing configuration
          orc_IODomain.c_ChannelConfigs.clear();
          if (c_NodeChannel == "channel")
@@ -432,14 +432,14 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
                   //Count
                   ++u32_ActualCount;
                   //Iterate
-                  c_NodeChannel = orc_XMLParser.SelectNodeNext("channel");
+                  c_NodeChannel = orc_XMLParser.SelectNodeNextView("channel");
                }
             }
             while ((c_NodeChannel == "channel") && (s32_Retval == C_NO_ERR));
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "channels");
+               tgl_assert(orc_XMLParser.SelectNodeParentView() == "channels");
             }
          }
          if (u32_ExpectedCount != u32_ActualCount)
@@ -457,7 +457,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "domain");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "domain");
       }
    }
    else
@@ -524,7 +524,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIODataBase(const C_OSCHalcDefBase & orc_IODa
    //Return
    if (s32_Retval == C_NO_ERR)
    {
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
    return s32_Retval;
 }
@@ -557,7 +557,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIODomains(const C_OSCHalcConfig & orc_IOData
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "domains");
+            tgl_assert(orc_XMLParser.SelectNodeParentView() == "domains");
          }
       }
       else
@@ -571,7 +571,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIODomains(const C_OSCHalcConfig & orc_IOData
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
    return s32_Retval;
 }
@@ -601,7 +601,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOChannels(const std::vector<C_OSCHalcConfig
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "domain");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "domain");
    }
    return s32_Retval;
 }
@@ -635,7 +635,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOChannel(const C_OSCHalcConfigChannel & orc
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeParentName);
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_NodeParentName.c_str());
    }
    return s32_Retval;
 }
@@ -668,13 +668,13 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameterStructs(
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-structs");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameter-structs");
       }
    }
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_NodeName.c_str());
    }
    return s32_Retval;
 }
@@ -706,7 +706,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameterStruct(const C_OSCHalcConfigParam
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameter-struct");
       }
    }
    return s32_Retval;
@@ -738,13 +738,13 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameters(const std::vector<C_OSCHalcConf
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameters");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameters");
       }
    }
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameter-struct");
    }
    return s32_Retval;
 }
@@ -801,7 +801,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameter(const C_OSCHalcConfigParameter &
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "value");
+            tgl_assert(orc_XMLParser.SelectNodeParentView() == "value");
          }
       }
    }
@@ -819,10 +819,10 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameter(const C_OSCHalcConfigParameter &
          orc_XMLParser.SetAttributeString("value", c_Mask.str().c_str());
          orc_XMLParser.CreateNodeChild("comment", rc_BitmaskItem.c_Comment);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "value");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "value");
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == orc_BaseNode);
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_BaseNode.c_str());
       orc_XMLParser.CreateNodeChild("comment", orc_Parameter.c_Comment);
    }
    return s32_Retval;
@@ -845,7 +845,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODataBase(C_OSCHalcDefBase & orc_IOData, C_
 {
    sint32 s32_Retval;
 
-   if (orc_XMLParser.SelectNodeChild("io-base-file") == "io-base-file")
+   if (orc_XMLParser.SelectNodeChildView("io-base-file") == "io-base-file")
    {
       if (orc_BasePath.IsEmpty())
       {
@@ -862,7 +862,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODataBase(C_OSCHalcDefBase & orc_IOData, C_
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         orc_XMLParser.SelectNodeParent();
+         orc_XMLParser.SelectNodeParentView();
       }
       else
       {
@@ -893,13 +893,13 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("domains") == "domains")
+   if (orc_XMLParser.SelectNodeChildView("domains") == "domains")
    {
       if (orc_XMLParser.AttributeExists("length"))
       {
          const uint32 u32_ExpectedCount = orc_XMLParser.GetAttributeUint32("length");
          uint32 u32_ActualCount = 0UL;
-         stw_scl::C_SCLString c_NodeDomain = orc_XMLParser.SelectNodeChild("domain");
+         C_OSCXMLStringView c_NodeDomain = orc_XMLParser.SelectNodeChildView("domain");
          if (c_NodeDomain == "domain")
          {
             do
@@ -915,7 +915,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
                      //Count
                      ++u32_ActualCount;
                      //Iterate
-                     c_NodeDomain = orc_XMLParser.SelectNodeNext("domain");
+                     c_NodeDomain = orc_XMLParser.SelectNodeNextView("domain");
                   }
                }
                else
@@ -928,7 +928,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "domains");
+               tgl_assert(orc_XMLParser.SelectNodeParentView() == "domains");
             }
          }
          if (u32_ExpectedCount != u32_ActualCount)
@@ -946,7 +946,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "opensyde-node-io-config");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "opensyde-node-io-config");
       }
    }
    else
@@ -999,11 +999,11 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOChannel(C_OSCHalcConfigChannel & orc_IOCha
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("name") == "name")
+      if (orc_XMLParser.SelectNodeChildView("name") == "name")
       {
          orc_IOChannel.c_Name = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_NodeName.c_str());
       }
       else
       {
@@ -1013,11 +1013,11 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOChannel(C_OSCHalcConfigChannel & orc_IOCha
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+      if (orc_XMLParser.SelectNodeChildView("comment") == "comment")
       {
          orc_IOChannel.c_Comment = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_NodeName.c_str());
       }
       else
       {
@@ -1050,7 +1050,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("parameter-structs") == "parameter-structs")
+   if (orc_XMLParser.SelectNodeChildView("parameter-structs") == "parameter-structs")
    {
       uint32 u32_ExpectedLength = 0UL;
       //Clean up existing
@@ -1068,7 +1068,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
       }
       if (s32_Retval == C_NO_ERR)
       {
-         stw_scl::C_SCLString c_CurrentParameterNode = orc_XMLParser.SelectNodeChild("parameter-struct");
+         C_OSCXMLStringView c_CurrentParameterNode = orc_XMLParser.SelectNodeChildView("parameter-struct");
          if (c_CurrentParameterNode == "parameter-struct")
          {
             do
@@ -1079,14 +1079,14 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
                {
                   orc_ParameterStructs.push_back(c_Parameter);
                   //Iterate
-                  c_CurrentParameterNode = orc_XMLParser.SelectNodeNext("parameter-struct");
+                  c_CurrentParameterNode = orc_XMLParser.SelectNodeNextView("parameter-struct");
                }
             }
             while ((c_CurrentParameterNode == "parameter-struct") && (s32_Retval == C_NO_ERR));
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-structs");
+               tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameter-structs");
             }
          }
          if (s32_Retval == C_NO_ERR)
@@ -1107,7 +1107,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_NodeName.c_str());
       }
    }
    else
@@ -1136,13 +1136,13 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStruct(C_OSCHalcConfigParameterSt
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("single-value") == "single-value")
+      if (orc_XMLParser.SelectNodeChildView("single-value") == "single-value")
       {
          s32_Retval = mh_LoadIOParameter(orc_ParameterStruct, orc_XMLParser, "single-value");
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+            tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameter-struct");
          }
       }
    }
@@ -1165,7 +1165,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("parameters") == "parameters")
+   if (orc_XMLParser.SelectNodeChildView("parameters") == "parameters")
    {
       uint32 u32_ExpectedLength = 0UL;
       //Reserve
@@ -1181,7 +1181,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
       }
       if (s32_Retval == C_NO_ERR)
       {
-         stw_scl::C_SCLString c_CurrentParameterNode = orc_XMLParser.SelectNodeChild("parameter");
+         C_OSCXMLStringView c_CurrentParameterNode = orc_XMLParser.SelectNodeChildView("parameter");
          if (c_CurrentParameterNode == "parameter")
          {
             do
@@ -1192,14 +1192,14 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
                {
                   orc_Parameters.push_back(c_Parameter);
                   //Iterate
-                  c_CurrentParameterNode = orc_XMLParser.SelectNodeNext("parameter");
+                  c_CurrentParameterNode = orc_XMLParser.SelectNodeNextView("parameter");
                }
             }
             while ((c_CurrentParameterNode == "parameter") && (s32_Retval == C_NO_ERR));
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "parameters");
+               tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameters");
             }
          }
          if (s32_Retval == C_NO_ERR)
@@ -1220,7 +1220,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "parameter-struct");
       }
    }
    return s32_Retval;
@@ -1247,7 +1247,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameter(C_OSCHalcConfigParameter & orc_P
    stw_scl::C_SCLString c_TypeStr;
    stw_scl::C_SCLString c_BaseTypeStr;
 
-   if (orc_XMLParser.SelectNodeChild("value") == "value")
+   if (orc_XMLParser.SelectNodeChildView("value") == "value")
    {
       s32_Retval = C_OSCHalcDefStructFiler::h_SetType(orc_XMLParser, orc_Parameter.c_Value, c_TypeStr,
                                                       c_BaseTypeStr, "value",
@@ -1262,7 +1262,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameter(C_OSCHalcConfigParameter & orc_P
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_BaseName);
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_BaseName.c_str());
       }
    }
    else
@@ -1272,11 +1272,11 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameter(C_OSCHalcConfigParameter & orc_P
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+      if (orc_XMLParser.SelectNodeChildView("comment") == "comment")
       {
          orc_Parameter.c_Comment = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_BaseName);
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_BaseName.c_str());
       }
       else
       {
@@ -23,6 +23,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "stwtypes.h"
+#include "stwerrors.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw_opensyde_core
@@ -251,6 +252,36 @@ public:
                                      const stw_types::uint8 ou8_ServerNodeIdentifier,
                                      std::vector<stw_types::uint8> & orc_Data) = 0;
 
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Wait for incoming data on TCP socket
+
+      Block the calling thread until the TCP receive buffer contains data or the timeout expired.
+      The data is not read.
+      Data which was already placed in the buffer of the dispatcher (see ReadTcpBuffer) is not considered.
+
+      Default implementation: waiting is not supported.
+
+      \param[in]  ou32_Handle          handle obtained by InitTcp()
+      \param[in]  ou32_MaxWaitTimeMs   maximum time to wait
+
+      \return
+      C_NO_ERR   data available (or connection closed by server; reported by next ReadTcp call)
+      C_TIMEOUT  no data received within timeout
+      C_NOACT    waiting is not supported by the implementation
+      C_CONFIG   required socket not initialized
+      C_RD_WR    error waiting for data
+      C_RANGE    invalid handle
+   */
+   //-----------------------------------------------------------------------------
+   virtual stw_types::sint32 WaitForTcpData(const stw_types::uint32 ou32_Handle,
+                                            const stw_types::uint32 ou32_MaxWaitTimeMs)
+   {
+      (void)ou32_Handle;
+      (void)ou32_MaxWaitTimeMs;
+      return stw_errors::C_NOACT;
+   }
+
    //-----------------------------------------------------------------------------
    /*!
       \brief   Read data from TCP buffer of dispatcher
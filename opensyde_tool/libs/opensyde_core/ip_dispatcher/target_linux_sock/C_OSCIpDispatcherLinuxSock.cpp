@@ -1006,6 +1006,66 @@ sint32 C_OSCIpDispatcherLinuxSock::ReadTcp(const uint32 ou32_Handle, const uint8
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming data on TCP socket
+
+   Block the calling thread until the TCP receive buffer contains data or the timeout expired.
+   The data is not read.
+
+   \param[in]  ou32_Handle          handle obtained by InitTcp()
+   \param[in]  ou32_MaxWaitTimeMs   maximum time to wait
+
+   \return
+   C_NO_ERR   data available (or connection closed by server; reported by next ReadTcp call)
+   C_TIMEOUT  no data received within timeout
+   C_CONFIG   required socket not initialized
+   C_RD_WR    error waiting for data
+   C_RANGE    handle invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCIpDispatcherLinuxSock::WaitForTcpData(const uint32 ou32_Handle, const uint32 ou32_MaxWaitTimeMs)
+{
+   sint32 s32_Return;
+
+   if (ou32_Handle >= this->mc_SocketsTcp.size())
+   {
+      osc_write_log_error("openSYDE IP-TP", "WaitForTcpData called with invalid handle.");
+      s32_Return = C_RANGE;
+   }
+   else if (this->mc_SocketsTcp[ou32_Handle].sn_Socket == INVALID_SOCKET)
+   {
+      osc_write_log_error("openSYDE IP-TP", "WaitForTcpData called with invalid socket.");
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      sintn sn_Return;
+      fd_set t_SocketReadSet;
+      timeval t_TimeOut;
+
+      FD_ZERO(&t_SocketReadSet);
+      FD_SET(this->mc_SocketsTcp[ou32_Handle].sn_Socket, &t_SocketReadSet);
+      t_TimeOut.tv_sec = static_cast<time_t>(ou32_MaxWaitTimeMs / 1000U);
+      t_TimeOut.tv_usec = static_cast<suseconds_t>((ou32_MaxWaitTimeMs % 1000U) * 1000U);
+      sn_Return = select(this->mc_SocketsTcp[ou32_Handle].sn_Socket + 1, &t_SocketReadSet, NULL, NULL, &t_TimeOut);
+      if (sn_Return > 0)
+      {
+         s32_Return = C_NO_ERR;
+      }
+      else if ((sn_Return == 0) || (errno == EINTR))
+      {
+         s32_Return = C_TIMEOUT;
+      }
+      else
+      {
+         C_SCLString c_ErrnoStr = strerror(errno);
+         osc_write_log_error("openSYDE IP-TP", "Could not wait for TCP data: select() failed. Error: " + c_ErrnoStr);
+         s32_Return = C_RD_WR;
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read data from TCP buffer of dispatcher
 
@@ -1037,6 +1037,66 @@ sint32 C_OSCIpDispatcherWinSock::ReadTcp(const uint32 ou32_Handle, const uint8 o
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming data on TCP socket
+
+   Block the calling thread until the TCP receive buffer contains data or the timeout expired.
+   The data is not read.
+
+   \param[in]  ou32_Handle          handle obtained by InitTcp()
+   \param[in]  ou32_MaxWaitTimeMs   maximum time to wait
+
+   \return
+   C_NO_ERR   data available (or connection closed by server; reported by next ReadTcp call)
+   C_TIMEOUT  no data received within timeout
+   C_CONFIG   required socket not initialized
+   C_RD_WR    error waiting for data
+   C_RANGE    handle invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCIpDispatcherWinSock::WaitForTcpData(const uint32 ou32_Handle, const uint32 ou32_MaxWaitTimeMs)
+{
+   sint32 s32_Return;
+
+   if (ou32_Handle >= this->mc_SocketsTcp.size())
+   {
+      osc_write_log_error("openSYDE IP-TP", "WaitForTcpData called with invalid handle.");
+      s32_Return = C_RANGE;
+   }
+   else if (this->mc_SocketsTcp[ou32_Handle].un_Socket == m_WsInvalidSocket())
+   {
+      osc_write_log_error("openSYDE IP-TP", "WaitForTcpData called with invalid socket.");
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      sintn sn_Return;
+      fd_set t_SocketReadSet;
+      timeval t_TimeOut;
+
+      t_SocketReadSet.fd_array[0] = this->mc_SocketsTcp[ou32_Handle].un_Socket; //watch this socket ...
+      t_SocketReadSet.fd_count = 1;                                             //only one socket
+      t_TimeOut.tv_sec = static_cast<sintn>(ou32_MaxWaitTimeMs / 1000U);
+      t_TimeOut.tv_usec = static_cast<sintn>((ou32_MaxWaitTimeMs % 1000U) * 1000U);
+      sn_Return = select(0, &t_SocketReadSet, NULL, NULL, &t_TimeOut);
+      if (sn_Return > 0)
+      {
+         s32_Return = C_NO_ERR;
+      }
+      else if (sn_Return == 0)
+      {
+         s32_Return = C_TIMEOUT;
+      }
+      else
+      {
+         osc_write_log_error("openSYDE IP-TP", "Could not wait for TCP data: select() failed. Error: " +
+                             C_SCLString::IntToStr(WSAGetLastError()));
+         s32_Return = C_RD_WR;
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read data from TCP buffer of dispatcher
 
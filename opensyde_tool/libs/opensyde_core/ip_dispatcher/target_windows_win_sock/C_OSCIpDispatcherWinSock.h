@@ -106,6 +106,8 @@ public:
                                      const stw_types::uint8 ou8_ServerBusIdentifier,
                                      const stw_types::uint8 ou8_ServerNodeIdentifier,
                                      std::vector<stw_types::uint8> & orc_Data);
+   virtual stw_types::sint32 WaitForTcpData(const stw_types::uint32 ou32_Handle,
+                                            const stw_types::uint32 ou32_MaxWaitTimeMs);
    virtual stw_types::sint32 ReadTcpBuffer(const stw_types::uint8 ou8_ClientBusIdentifier,
                                            const stw_types::uint8 ou8_ClientNodeIdentifier,
                                            const stw_types::uint8 ou8_ServerBusIdentifier,
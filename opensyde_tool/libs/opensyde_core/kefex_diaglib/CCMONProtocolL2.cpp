@@ -63,7 +63,7 @@ C_SCLString C_CMONProtocolL2::MessageToString(const T_STWCAN_Msg_RX & orc_Msg) c
    cn_XTD = (orc_Msg.u8_XTD == 1U) ? 'x':' ';
    cn_RTR = (orc_Msg.u8_RTR == 1U) ? 'r':' '; //note: displaying RTR correctly will only work if comm driver supplies
                                            // that information
-   u8_Len = (orc_Msg.u8_DLC > 8U) ? static_cast<uint8>(8U) : orc_Msg.u8_DLC;
+   u8_Len = STWCAN_DLCToNumBytes(orc_Msg.u8_DLC, orc_Msg.u8_FDF);
 
    if (mq_Decimal == false)
    {
@@ -315,6 +315,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers) {
 
    SOURCES += $${PWD}/can_dispatcher/dispatcher/CCANBase.cpp \
               $${PWD}/can_dispatcher/dispatcher/CCANDispatcher.cpp \
+              $${PWD}/can_dispatcher/dispatcher/CCANReplay.cpp \
               $${PWD}/can_dispatcher/target_windows_stw_dlls/CCAN.cpp \
               $${PWD}/can_dispatcher/target_windows_stw_dlls/CCANDLL.cpp \
               $${PWD}/data_dealer/C_OSCDataDealer.cpp \
@@ -367,6 +368,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers) {
 
    HEADERS += $${PWD}/can_dispatcher/dispatcher/CCANBase.h \
               $${PWD}/can_dispatcher/dispatcher/CCANDispatcher.h \
+              $${PWD}/can_dispatcher/dispatcher/CCANReplay.h \
               $${PWD}/can_dispatcher/target_windows_stw_dlls/CCAN.h \
               $${PWD}/can_dispatcher/target_windows_stw_dlls/CCANDLL.h \
               $${PWD}/data_dealer/C_OSCDataDealer.h \
@@ -443,8 +445,12 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_logging) {
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLogger.cpp \
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerData.cpp \
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileAsc.cpp \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileAscReader.cpp \
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileBase.cpp \
-              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerOsySysDefConfig.cpp
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileBin.cpp \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileBinReader.cpp \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerOsySysDefConfig.cpp \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerSignalDecoder.cpp
 
    HEADERS += $${PWD}/kefex_diaglib/CCMONProtocol.h \
               $${PWD}/kefex_diaglib/CCMONProtocolBase.h \
@@ -465,6 +471,10 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_logging) {
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLogger.h \
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerData.h \
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileAsc.h \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileAscReader.h \
               $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileBase.h \
-              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerOsySysDefConfig.h
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileBin.h \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerFileBinReader.h \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerOsySysDefConfig.h \
+              $${PWD}/protocol_drivers/communication/C_OSCComMessageLoggerSignalDecoder.h
 }
@@ -66,6 +66,8 @@ void C_OSCDeviceDefinition::Clear(void)
    q_FlashloaderOpenSydeCan = false;
    q_FlashloaderOpenSydeEthernet = false;
    q_FlashloaderOpenSydeIsFileBased = false;
+   q_FlashloaderOpenSydeDeltaFlashing = false;
+   q_FlashloaderOpenSydePipelinedTransferData = false;
    u32_UserEepromSizeBytes = 0U;
    //Special default values
    u32_FlashloaderResetWaitTimeNoChangesCan = 1000U;
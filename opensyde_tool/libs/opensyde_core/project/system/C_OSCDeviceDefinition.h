@@ -67,6 +67,12 @@ public:
    bool q_FlashloaderOpenSydeEthernet;
    ///is the device file based or address based?
    bool q_FlashloaderOpenSydeIsFileBased;
+   ///does the openSYDE flashloader implement the flash sector checksum routine ?
+   ///(then only modified sectors of HEX files are flashed; see C_OSCSuSequences::m_GetModifiedFlashData)
+   bool q_FlashloaderOpenSydeDeltaFlashing;
+   ///may multiple TransferData requests be sent to the openSYDE flashloader before it responds ?
+   ///(used if the flashloader also reports it in its list of features)
+   bool q_FlashloaderOpenSydePipelinedTransferData;
 
    ///minimal times in ms to reset from the application to the Flashloader or reset the Flashloader itself.
    ///possible scenario: Reset from Application to Flashloader or from Flashloader to Flashloader
@@ -69,12 +69,16 @@ void C_OSCDeviceDefinitionFiler::mh_ParseOpenSydeAvailability(const C_OSCXMLPars
    \param[out]  oru32_RequestDownloadTimeout    Parameter for Request Download Timeout
    \param[out]  oru32_TransferDataTimeout       Parameter for Transfer Data Timeout
    \param[out]  orq_IsFileBased                 Flag if file based
+   \param[out]  orq_DeltaFlashing               Flag if only modified flash sectors may be flashed
+   \param[out]  orq_PipelinedTransferData       Flag if multiple TransferData requests may be in flight
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCDeviceDefinitionFiler::mh_ParseOpenSydeFlashloaderParameter(const C_OSCXMLParser & orc_Parser,
                                                                       uint32 & oru32_RequestDownloadTimeout,
                                                                       uint32 & oru32_TransferDataTimeout,
-                                                                      bool & orq_IsFileBased)
+                                                                      bool & orq_IsFileBased,
+                                                                      bool & orq_DeltaFlashing,
+                                                                      bool & orq_PipelinedTransferData)
 {
    if (orc_Parser.AttributeExists("requestdownloadtimeout") == true)
    {
@@ -100,6 +104,23 @@ void C_OSCDeviceDefinitionFiler::mh_ParseOpenSydeFlashloaderParameter(const C_OS
    {
       orq_IsFileBased = false;
    }
+   //optional; older device definitions do not know them
+   if (orc_Parser.AttributeExists("delta-flashing") == true)
+   {
+      orq_DeltaFlashing = orc_Parser.GetAttributeBool("delta-flashing");
+   }
+   else
+   {
+      orq_DeltaFlashing = false;
+   }
+   if (orc_Parser.AttributeExists("pipelined-transferdata") == true)
+   {
+      orq_PipelinedTransferData = orc_Parser.GetAttributeBool("pipelined-transferdata");
+   }
+   else
+   {
+      orq_PipelinedTransferData = false;
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -575,7 +596,9 @@ sint32 C_OSCDeviceDefinitionFiler::h_Load(C_OSCDeviceDefinition & orc_DeviceDefi
                   mh_ParseOpenSydeFlashloaderParameter(c_XML,
                                                        orc_DeviceDefinition.u32_FlashloaderOpenSydeRequestDownloadTimeout,
                                                        orc_DeviceDefinition.u32_FlashloaderOpenSydeTransferDataTimeout,
-                                                       orc_DeviceDefinition.q_FlashloaderOpenSydeIsFileBased);
+                                                       orc_DeviceDefinition.q_FlashloaderOpenSydeIsFileBased,
+                                                       orc_DeviceDefinition.q_FlashloaderOpenSydeDeltaFlashing,
+                                                       orc_DeviceDefinition.q_FlashloaderOpenSydePipelinedTransferData);
 
                   c_Text = c_XML.SelectNodeParent(); //back to parent ...
                   tgl_assert(c_Text == "protocols-flashloader");
@@ -724,6 +747,9 @@ sint32 C_OSCDeviceDefinitionFiler::h_Save(const C_OSCDeviceDefinition & orc_Devi
       c_XML.SetAttributeUint32("transferdatatimeout",
                                orc_DeviceDefinition.u32_FlashloaderOpenSydeTransferDataTimeout);
       c_XML.SetAttributeBool("is-file-based", orc_DeviceDefinition.q_FlashloaderOpenSydeIsFileBased);
+      c_XML.SetAttributeBool("delta-flashing", orc_DeviceDefinition.q_FlashloaderOpenSydeDeltaFlashing);
+      c_XML.SetAttributeBool("pipelined-transferdata",
+                             orc_DeviceDefinition.q_FlashloaderOpenSydePipelinedTransferData);
       c_XML.SelectNodeParent();
       c_XML.SelectNodeParent();
       c_XML.CreateAndSelectNodeChild("memory");
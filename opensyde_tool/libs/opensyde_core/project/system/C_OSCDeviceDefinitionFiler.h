@@ -34,7 +34,8 @@ private:
    static void mh_ParseOpenSydeFlashloaderParameter(const C_OSCXMLParser & orc_Parser,
                                                     stw_types::uint32 & oru32_RequestDownloadTimeout,
                                                     stw_types::uint32 & oru32_TransferDataTimeout,
-                                                    bool & orq_IsFileBased);
+                                                    bool & orq_IsFileBased, bool & orq_DeltaFlashing,
+                                                    bool & orq_PipelinedTransferData);
    static void mh_ParseSTWFlashloaderAvailability(const C_OSCXMLParser & orc_Parser, bool & orq_ProtocolSupportedCan);
 
 public:
@@ -43,7 +43,8 @@ C_OSCSystemBus::C_OSCSystemBus(void) :
    c_Comment(""),
    u64_BitRate(125000ULL),
    u8_BusID(0),
-   u16_RxTimeoutOffsetMs(0)
+   u16_RxTimeoutOffsetMs(0),
+   q_CanFd(false)
 {
 }
 
@@ -74,6 +75,11 @@ void C_OSCSystemBus::CalcHash(uint32 & oru32_HashValue) const
    C_SCLChecksums::CalcCRC32(&this->u64_BitRate, sizeof(this->u64_BitRate), oru32_HashValue);
    C_SCLChecksums::CalcCRC32(&this->u8_BusID, sizeof(this->u8_BusID), oru32_HashValue);
    C_SCLChecksums::CalcCRC32(&this->u16_RxTimeoutOffsetMs, sizeof(this->u16_RxTimeoutOffsetMs), oru32_HashValue);
+   //only hashed if set so the hash of existing classic CAN buses does not change
+   if (this->q_CanFd == true)
+   {
+      C_SCLChecksums::CalcCRC32(&this->q_CanFd, sizeof(this->q_CanFd), oru32_HashValue);
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
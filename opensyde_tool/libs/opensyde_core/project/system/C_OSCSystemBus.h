@@ -47,6 +47,7 @@ public:
    stw_types::uint64 u64_BitRate;           ///< bitrate of bus in bits / second
    stw_types::uint8 u8_BusID;               ///< unique bus id
    stw_types::uint16 u16_RxTimeoutOffsetMs; ///< Delta time to wait for receive before timeout in ms
+   bool q_CanFd;                            ///< CAN only: true: bus is operated in CAN FD mode
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -168,6 +168,20 @@ sint32 C_OSCSystemBusFiler::h_LoadBus(C_OSCSystemBus & orc_Bus, C_OSCXMLParserBa
          s32_Retval = C_CONFIG;
       }
    }
+   //CAN FD (optional; not present in files created by older versions)
+   if (s32_Retval == C_NO_ERR)
+   {
+      if (orc_XMLParser.SelectNodeChild("can-fd") == "can-fd")
+      {
+         orc_Bus.q_CanFd = orc_XMLParser.GetAttributeBool("active");
+         //Return
+         tgl_assert(orc_XMLParser.SelectNodeParent() == "bus");
+      }
+      else
+      {
+         orc_Bus.q_CanFd = false;
+      }
+   }
    return s32_Retval;
 }
 
@@ -214,4 +228,12 @@ void C_OSCSystemBusFiler::h_SaveBus(const C_OSCSystemBus & orc_Bus, C_OSCXMLPars
    orc_XMLParser.SetAttributeString("number", c_RxTimeout);
    //Return
    tgl_assert(orc_XMLParser.SelectNodeParent() == "bus");
+   //CAN FD (only written if active so files of classic CAN buses do not change)
+   if (orc_Bus.q_CanFd == true)
+   {
+      tgl_assert(orc_XMLParser.CreateAndSelectNodeChild("can-fd") == "can-fd");
+      orc_XMLParser.SetAttributeBool("active", orc_Bus.q_CanFd);
+      //Return
+      tgl_assert(orc_XMLParser.SelectNodeParent() == "bus");
+   }
 }
@@ -13,6 +13,8 @@
 #include "precomp_headers.h"
 
 #include <cstdio>
+#include <algorithm>
+#include <thread>
 #include "stwtypes.h"
 #include "stwerrors.h"
 #include "C_OSCSystemFilerUtil.h"
@@ -174,6 +176,8 @@ sint32 C_OSCSystemDefinitionFiler::h_SaveSystemDefinitionFile(const C_OSCSystemD
    * load node data and add to system definition
    * for each node set a pointer to the used device definition
 
+   With the multiple file interface the node files are loaded in parallel (see mh_LoadNodeFiles).
+
     The caller is responsible to provide a static life-time of orc_DeviceDefinitions.
     Otherwise the "device definition" pointers in C_OSCNode will point to invalid data.
 
@@ -217,28 +221,36 @@ sint32 C_OSCSystemDefinitionFiler::h_LoadNodes(std::vector<C_OSCNode> & orc_Node
 
    if (c_SelectedNode == "node")
    {
-      do
+      if (oq_UseFileInterface)
       {
-         C_OSCNode c_Item;
-         if (oq_UseFileInterface)
+         std::vector<C_SCLString> c_FilePaths;
+         //collect all file names first; the files are independent of each other
+         do
          {
-            const C_SCLString c_FileName = C_OSCSystemFilerUtil::h_CombinePaths(orc_BasePath,
-                                                                                orc_XMLParser.GetNodeContent());
-            s32_Retval = C_OSCNodeFiler::h_LoadNodeFile(c_Item, c_FileName);
+            c_FilePaths.push_back(C_OSCSystemFilerUtil::h_CombinePaths(orc_BasePath,
+                                                                       orc_XMLParser.GetNodeContent()));
+            //Next
+            c_SelectedNode = orc_XMLParser.SelectNodeNext("node");
          }
-         else
+         while (c_SelectedNode == "node");
+         s32_Retval = mh_LoadNodeFiles(orc_Nodes, c_FilePaths);
+      }
+      else
+      {
+         do
          {
+            C_OSCNode c_Item;
             s32_Retval = C_OSCNodeFiler::h_LoadNode(c_Item, orc_XMLParser, "");
+            if (s32_Retval != C_NO_ERR)
+            {
+               break;
+            }
+            orc_Nodes.push_back(c_Item);
+            //Next
+            c_SelectedNode = orc_XMLParser.SelectNodeNext("node");
          }
-         if (s32_Retval != C_NO_ERR)
-         {
-            break;
-         }
-         orc_Nodes.push_back(c_Item);
-         //Next
-         c_SelectedNode = orc_XMLParser.SelectNodeNext("node");
+         while (c_SelectedNode == "node");
       }
-      while (c_SelectedNode == "node");
       if (s32_Retval == C_NO_ERR)
       {
          //Return (no check to allow reuse)
@@ -650,3 +662,128 @@ sint32 C_OSCSystemDefinitionFiler::h_SaveSystemDefinition(const C_OSCSystemDefin
    }
    return s32_Return;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node files in parallel
+
+   Each node file (including the referenced datapool, HALC and communication files) is loaded by one of up to
+   hardware_concurrency worker threads into its own C_OSCNode instance.
+   The nodes are placed in orc_Nodes in order of orc_FilePaths.
+
+   Error reporting is the same as for loading the files one after another: the result of the first node (in order of
+   orc_FilePaths) that could not be loaded is returned and orc_Nodes contains the nodes before that one.
+   Only the order of the log entries of nodes loaded at the same time is not deterministic.
+   TGL has no thread abstraction and the Core must not depend on Qt, so the workers are standard threads.
+
+   \param[out]    orc_Nodes       loaded nodes
+   \param[in]     orc_FilePaths   paths of node files to load
+
+   \return
+   C_NO_ERR    no error
+   C_CONFIG    content of at least one node file is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCSystemDefinitionFiler::mh_LoadNodeFiles(std::vector<C_OSCNode> & orc_Nodes,
+                                                    const std::vector<C_SCLString> & orc_FilePaths)
+{
+   sint32 s32_Retval = C_NO_ERR;
+   const uint32 u32_NumNodes = static_cast<uint32>(orc_FilePaths.size());
+   const uint32 u32_NumThreads = std::max(std::min(static_cast<uint32>(std::thread::hardware_concurrency()),
+                                                   u32_NumNodes), static_cast<uint32>(1U));
+
+   std::vector<sint32> c_Results(u32_NumNodes, C_NO_ERR);
+   uint32 u32_NextNode = 0U;
+   C_TGLCriticalSection c_NextNodeCriticalSection;
+   std::vector<std::thread> c_Threads;
+
+   //each worker loads directly into its nodes; no reallocation after this point
+   orc_Nodes.resize(u32_NumNodes);
+
+   c_Threads.reserve(u32_NumThreads);
+   for (uint32 u32_Thread = 1U; u32_Thread < u32_NumThreads; u32_Thread++)
+   {
+      try
+      {
+         c_Threads.push_back(std::thread(&C_OSCSystemDefinitionFiler::mh_LoadNodeFilesWorker, &orc_Nodes,
+                                         &orc_FilePaths, &c_Results, &u32_NextNode,
+                                         &c_NextNodeCriticalSection));
+      }
+      catch (...)
+      {
+         //could not start thread: the other workers will take over its nodes
+      }
+   }
+   mh_LoadNodeFilesWorker(&orc_Nodes, &orc_FilePaths, &c_Results, &u32_NextNode, &c_NextNodeCriticalSection);
+   for (uint32 u32_Thread = 0U; u32_Thread < c_Threads.size(); u32_Thread++)
+   {
+      c_Threads[u32_Thread].join();
+   }
+
+   //report the first failed node
+   for (uint32 u32_Node = 0U; u32_Node < u32_NumNodes; u32_Node++)
+   {
+      if (c_Results[u32_Node] != C_NO_ERR)
+      {
+         s32_Retval = c_Results[u32_Node];
+         orc_Nodes.resize(u32_Node);
+         break;
+      }
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node files until there are no more nodes to load
+
+   Executed in parallel by multiple threads.
+   Each call takes the next node not yet taken by any worker.
+   After a node failed to load no further nodes are taken. All nodes before the failed one were already taken, so
+   they are loaded completely.
+
+   \param[in,out] opc_Nodes       storage for nodes (already with final size)
+   \param[in]     opc_FilePaths   paths of node files to load
+   \param[out]    opc_Results     result of h_LoadNodeFile per node (initialized to C_NO_ERR)
+   \param[in,out] opu32_NextNode                index of next node to load; shared by all workers
+   \param[in,out] opc_NextNodeCriticalSection   protects opu32_NextNode
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCSystemDefinitionFiler::mh_LoadNodeFilesWorker(std::vector<C_OSCNode> * const opc_Nodes,
+                                                        const std::vector<C_SCLString> * const opc_FilePaths,
+                                                        std::vector<sint32> * const opc_Results,
+                                                        uint32 * const opu32_NextNode,
+                                                        C_TGLCriticalSection * const opc_NextNodeCriticalSection)
+{
+   const uint32 u32_NumNodes = static_cast<uint32>(opc_FilePaths->size());
+   bool q_Continue = true;
+
+   while (q_Continue == true)
+   {
+      uint32 u32_Node;
+
+      opc_NextNodeCriticalSection->Acquire();
+      u32_Node = *opu32_NextNode;
+      if (u32_Node < u32_NumNodes)
+      {
+         (*opu32_NextNode)++;
+      }
+      opc_NextNodeCriticalSection->Release();
+
+      if (u32_Node < u32_NumNodes)
+      {
+         (*opc_Results)[u32_Node] = C_OSCNodeFiler::h_LoadNodeFile((*opc_Nodes)[u32_Node],
+                                                                   (*opc_FilePaths)[u32_Node]);
+         if ((*opc_Results)[u32_Node] != C_NO_ERR)
+         {
+            //stop all workers
+            opc_NextNodeCriticalSection->Acquire();
+            *opu32_NextNode = u32_NumNodes;
+            opc_NextNodeCriticalSection->Release();
+         }
+      }
+      else
+      {
+         q_Continue = false;
+      }
+   }
+}
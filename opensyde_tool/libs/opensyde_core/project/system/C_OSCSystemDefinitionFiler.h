@@ -12,8 +12,10 @@
 #define C_OSCSYSTEMDEFINITIONFILER_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
 #include "stwtypes.h"
 #include "CSCLString.h"
+#include "TGLTasks.h"
 #include "C_OSCNode.h"
 #include "C_OSCNodeFiler.h"
 #include "C_OSCSystemBus.h"
@@ -65,6 +67,15 @@ public:
    static const stw_types::uint16 hu16_FILE_VERSION_2 = 2U;
    static const stw_types::uint16 hu16_FILE_VERSION_3 = 3U;
    static const stw_types::uint16 hu16_FILE_VERSION_LATEST = hu16_FILE_VERSION_3;
+
+private:
+   static stw_types::sint32 mh_LoadNodeFiles(std::vector<C_OSCNode> & orc_Nodes,
+                                             const std::vector<stw_scl::C_SCLString> & orc_FilePaths);
+   static void mh_LoadNodeFilesWorker(std::vector<C_OSCNode> * const opc_Nodes,
+                                      const std::vector<stw_scl::C_SCLString> * const opc_FilePaths,
+                                      std::vector<stw_types::sint32> * const opc_Results,
+                                      stw_types::uint32 * const opu32_NextNode,
+                                      stw_tgl::C_TGLCriticalSection * const opc_NextNodeCriticalSection);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
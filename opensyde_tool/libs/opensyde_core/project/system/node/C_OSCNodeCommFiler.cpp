@@ -58,7 +58,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComProtocolFile(C_OSCCanProtocol & orc_Node
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (c_XMLParser.SelectNodeChild("com-protocol") == "com-protocol")
+      if (c_XMLParser.SelectNodeChildView("com-protocol") == "com-protocol")
       {
          s32_Retval = C_OSCNodeCommFiler::h_LoadNodeComProtocol(orc_NodeComProtocol, c_XMLParser, orc_NodeDataPools);
       }
@@ -126,12 +126,12 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComProtocol(C_OSCCanProtocol & orc_NodeComP
       s32_Retval = C_CONFIG;
    }
 
-   if ((orc_XMLParser.SelectNodeChild("communication-protocol") == "communication-protocol") &&
+   if ((orc_XMLParser.SelectNodeChildView("communication-protocol") == "communication-protocol") &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_StringToCommunicationProtocol(orc_XMLParser.GetNodeContent(), orc_NodeComProtocol.e_Type);
       //Return (don't check to allow reuse)
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
    else
    {
@@ -139,12 +139,12 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComProtocol(C_OSCCanProtocol & orc_NodeComP
       s32_Retval = C_CONFIG;
    }
 
-   if ((orc_XMLParser.SelectNodeChild("com-message-containers") == "com-message-containers") &&
+   if ((orc_XMLParser.SelectNodeChildView("com-message-containers") == "com-message-containers") &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadNodeComMessageContainers(orc_NodeComProtocol.c_ComMessages, orc_XMLParser);
       //Return (don't check to allow reuse)
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
    else
    {
@@ -220,7 +220,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComProtocol(const C_OSCCanProtocol & orc_Node
    orc_XMLParser.CreateAndSelectNodeChild("com-message-containers");
    h_SaveNodeComMessageContainers(orc_NodeComProtocol.c_ComMessages, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-protocol");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-protocol");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -243,7 +243,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainers(
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   C_SCLString c_CurNodeComMessageContainer;
+   C_OSCXMLStringView c_CurNodeComMessageContainer;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -254,7 +254,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainers(
       orc_NodeComMessageContainers.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeComMessageContainer = orc_XMLParser.SelectNodeChild("com-message-container");
+   c_CurNodeComMessageContainer = orc_XMLParser.SelectNodeChildView("com-message-container");
 
    //Clear
    orc_NodeComMessageContainers.clear();
@@ -272,11 +272,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainers(
          orc_NodeComMessageContainers.push_back(c_CurComMessageContainer);
 
          //Next
-         c_CurNodeComMessageContainer = orc_XMLParser.SelectNodeNext("com-message-container");
+         c_CurNodeComMessageContainer = orc_XMLParser.SelectNodeNextView("com-message-container");
       }
       while (c_CurNodeComMessageContainer == "com-message-container");
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-containers");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message-containers");
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -313,7 +313,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComMessageContainers(
       orc_XMLParser.CreateAndSelectNodeChild("com-message-container");
       h_SaveNodeComMessageContainer(orc_NodeComMessageContainers[u32_ItComMessageContainer], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-containers");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message-containers");
    }
 }
 
@@ -340,13 +340,13 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainer(C_OSCCanMessageContaine
    orc_NodeComMessageContainer.q_IsComProtocolUsedByInterface =
       orc_XMLParser.GetAttributeBool("com-protocol-usage-flag");
 
-   if (orc_XMLParser.SelectNodeChild("tx-messages") == "tx-messages")
+   if (orc_XMLParser.SelectNodeChildView("tx-messages") == "tx-messages")
    {
       s32_Retval = h_LoadNodeComMessages(orc_NodeComMessageContainer.c_TxMessages, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message-container");
       }
    }
    else
@@ -355,13 +355,13 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainer(C_OSCCanMessageContaine
       s32_Retval = C_CONFIG;
    }
 
-   if ((orc_XMLParser.SelectNodeChild("rx-messages") == "rx-messages") && (s32_Retval == C_NO_ERR))
+   if ((orc_XMLParser.SelectNodeChildView("rx-messages") == "rx-messages") && (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadNodeComMessages(orc_NodeComMessageContainer.c_RxMessages, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message-container");
       }
    }
    else
@@ -392,12 +392,12 @@ void C_OSCNodeCommFiler::h_SaveNodeComMessageContainer(const C_OSCCanMessageCont
    orc_XMLParser.CreateAndSelectNodeChild("tx-messages");
    h_SaveNodeComMessages(orc_NodeComMessageContainer.c_TxMessages, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message-container");
    //Rx messages
    orc_XMLParser.CreateAndSelectNodeChild("rx-messages");
    h_SaveNodeComMessages(orc_NodeComMessageContainer.c_RxMessages, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message-container");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -420,7 +420,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessages(std::vector<C_OSCCanMessage> &
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   C_SCLString c_CurNodeComMessage;
+   C_OSCXMLStringView c_CurNodeComMessage;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -431,7 +431,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessages(std::vector<C_OSCCanMessage> &
       orc_NodeComMessages.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeComMessage = orc_XMLParser.SelectNodeChild("com-message");
+   c_CurNodeComMessage = orc_XMLParser.SelectNodeChildView("com-message");
 
    //Clear
    orc_NodeComMessages.clear();
@@ -450,11 +450,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessages(std::vector<C_OSCCanMessage> &
          orc_NodeComMessages.push_back(c_CurComMessage);
 
          //Next
-         c_CurNodeComMessage = orc_XMLParser.SelectNodeNext("com-message");
+         c_CurNodeComMessage = orc_XMLParser.SelectNodeNextView("com-message");
       }
       while (c_CurNodeComMessage == "com-message");
       //Return
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -490,7 +490,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComMessages(const std::vector<C_OSCCanMessage
       orc_XMLParser.CreateAndSelectNodeChild("com-message");
       h_SaveNodeComMessage(orc_NodeComMessages[u32_ItComMessage], orc_XMLParser);
       //Return
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
 }
 
@@ -531,43 +531,43 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessage(C_OSCCanMessage & orc_NodeComMes
       orc_NodeComMessage.u32_TimeoutMs = (3UL * orc_NodeComMessage.u32_CycleTimeMs) + 10UL;
    }
 
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.SelectNodeChildView("name") == "name")
    {
       orc_NodeComMessage.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message");
    }
    else
    {
       osc_write_log_error("Loading node definition", "Could not find \"com-message\".\"name\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+   if (orc_XMLParser.SelectNodeChildView("comment") == "comment")
    {
       orc_NodeComMessage.c_Comment = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message");
    }
-   if ((orc_XMLParser.SelectNodeChild("tx-method") == "tx-method") &&
+   if ((orc_XMLParser.SelectNodeChildView("tx-method") == "tx-method") &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = mh_StringToNodeComMessageTxMethod(orc_XMLParser.GetNodeContent(), orc_NodeComMessage.e_TxMethod);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message");
    }
    else
    {
       osc_write_log_error("Loading node definition", "Could not find \"com-message\".\"tx-method\" node.");
       s32_Retval = C_CONFIG;
    }
-   if ((orc_XMLParser.SelectNodeChild("com-signals") == "com-signals") &&
+   if ((orc_XMLParser.SelectNodeChildView("com-signals") == "com-signals") &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadNodeComSignals(orc_NodeComMessage.c_Signals, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message");
       }
    }
    else
@@ -604,7 +604,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComMessage(const C_OSCCanMessage & orc_NodeCo
    orc_XMLParser.CreateAndSelectNodeChild("com-signals");
    h_SaveNodeComSignals(orc_NodeComMessage.c_Signals, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-message");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -627,7 +627,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignals(std::vector<C_OSCCanSignal> & or
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   C_SCLString c_CurNodeComSignal;
+   C_OSCXMLStringView c_CurNodeComSignal;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -638,7 +638,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignals(std::vector<C_OSCCanSignal> & or
       orc_NodeComSignals.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeComSignal = orc_XMLParser.SelectNodeChild("com-signal");
+   c_CurNodeComSignal = orc_XMLParser.SelectNodeChildView("com-signal");
 
    //Clear
    orc_NodeComSignals.clear();
@@ -657,11 +657,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignals(std::vector<C_OSCCanSignal> & or
          orc_NodeComSignals.push_back(c_CurComSignal);
 
          //Next
-         c_CurNodeComSignal = orc_XMLParser.SelectNodeNext("com-signal");
+         c_CurNodeComSignal = orc_XMLParser.SelectNodeNextView("com-signal");
       }
       while (c_CurNodeComSignal == "com-signal");
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signals");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-signals");
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -697,7 +697,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComSignals(const std::vector<C_OSCCanSignal>
       orc_XMLParser.CreateAndSelectNodeChild("com-signal");
       h_SaveNodeComSignal(orc_NodeComSignals[u32_ItComSignal], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signals");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-signals");
    }
 }
 
@@ -724,11 +724,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignal(C_OSCCanSignal & orc_NodeComSigna
    orc_NodeComSignal.u16_ComBitStart = static_cast<uint16>(orc_XMLParser.GetAttributeUint32("bit-start"));
    orc_NodeComSignal.u16_ComBitLength = static_cast<uint16>(orc_XMLParser.GetAttributeUint32("bit-length"));
 
-   if (orc_XMLParser.SelectNodeChild("byte-order") == "byte-order")
+   if (orc_XMLParser.SelectNodeChildView("byte-order") == "byte-order")
    {
       s32_Retval = mh_StringToCommunicationByteOrder(orc_XMLParser.GetNodeContent(), orc_NodeComSignal.e_ComByteOrder);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signal");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-signal");
    }
    else
    {
@@ -736,11 +736,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignal(C_OSCCanSignal & orc_NodeComSigna
                           "Could not find \"com-message\".\"com-signals\".\nbyte-order\" node.");
       s32_Retval = C_CONFIG;
    }
-   if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("multiplexer-type") == "multiplexer-type"))
+   if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChildView("multiplexer-type") == "multiplexer-type"))
    {
       s32_Retval = mh_StringToCommunicationMuxType(orc_XMLParser.GetNodeContent(), orc_NodeComSignal.e_MultiplexerType);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signal");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "com-signal");
    }
    else
    {
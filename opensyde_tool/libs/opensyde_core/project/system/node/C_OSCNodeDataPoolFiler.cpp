@@ -68,7 +68,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolFile(C_OSCNodeDataPool & orc_NodeDa
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (c_XMLParser.SelectNodeChild("data-pool") == "data-pool")
+      if (c_XMLParser.SelectNodeChildView("data-pool") == "data-pool")
       {
          s32_Retval = C_OSCNodeDataPoolFiler::h_LoadDataPool(orc_NodeDataPool, c_XMLParser);
       }
@@ -125,13 +125,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPool(C_OSCNodeDataPool & orc_NodeDataPo
    }
    orc_NodeDataPool.u32_NvMStartAddress = orc_XMLParser.GetAttributeUint32("nvm-start-address");
    orc_NodeDataPool.u32_NvMSize = orc_XMLParser.GetAttributeUint32("nvm-size");
-   if (orc_XMLParser.SelectNodeChild("type") == "type")
+   if (orc_XMLParser.SelectNodeChildView("type") == "type")
    {
       s32_Retval = h_StringToDataPool(orc_XMLParser.GetNodeContent(), orc_NodeDataPool.e_Type);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-pool");
       }
    }
    else
@@ -139,49 +139,49 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPool(C_OSCNodeDataPool & orc_NodeDataPo
       osc_write_log_error("Loading Datapool", "Could not find \"type\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.SelectNodeChildView("name") == "name")
    {
       orc_NodeDataPool.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-pool");
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"name\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("version") == "version")
+   if (orc_XMLParser.SelectNodeChildView("version") == "version")
    {
       orc_NodeDataPool.au8_Version[0] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("major"));
       orc_NodeDataPool.au8_Version[1] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("minor"));
       orc_NodeDataPool.au8_Version[2] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("release"));
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-pool");
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"version\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+   if (orc_XMLParser.SelectNodeChildView("comment") == "comment")
    {
       orc_NodeDataPool.c_Comment = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-pool");
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"comment\" node.");
       s32_Retval = C_CONFIG;
    }
-   if ((orc_XMLParser.SelectNodeChild("lists") == "lists") && (s32_Retval == C_NO_ERR))
+   if ((orc_XMLParser.SelectNodeChildView("lists") == "lists") && (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadDataPoolLists(orc_NodeDataPool.c_Lists, orc_XMLParser);
 
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-pool");
       }
    }
    else
@@ -219,14 +219,14 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPool(const C_OSCNodeDataPool & orc_NodeDa
    orc_XMLParser.SetAttributeUint32("minor", orc_NodeDataPool.au8_Version[1]);
    orc_XMLParser.SetAttributeUint32("release", orc_NodeDataPool.au8_Version[2]);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-pool");
 
    orc_XMLParser.CreateNodeChild("comment", orc_NodeDataPool.c_Comment);
    //Lists
    orc_XMLParser.CreateAndSelectNodeChild("lists");
    h_SaveDataPoolLists(orc_NodeDataPool.c_Lists, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-pool");
    orc_XMLParser.CreateNodeChild("export-settings", "");
 }
 
@@ -254,22 +254,22 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolList(C_OSCNodeDataPoolList & orc_No
    orc_NodeDataPoolList.u32_NvMCRC = orc_XMLParser.GetAttributeUint32("nvm-crc");
    orc_NodeDataPoolList.u32_NvMStartAddress = orc_XMLParser.GetAttributeUint32("nvm-start-address");
    orc_NodeDataPoolList.u32_NvMSize = orc_XMLParser.GetAttributeUint32("nvm-size");
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.SelectNodeChildView("name") == "name")
    {
       orc_NodeDataPoolList.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "list");
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"lists\".\"list\".\"name\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+   if (orc_XMLParser.SelectNodeChildView("comment") == "comment")
    {
       orc_NodeDataPoolList.c_Comment = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "list");
    }
    else
    {
@@ -279,13 +279,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolList(C_OSCNodeDataPoolList & orc_No
    //Data elements
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("data-elements") == "data-elements")
+      if (orc_XMLParser.SelectNodeChildView("data-elements") == "data-elements")
       {
          s32_Retval = h_LoadDataPoolListElements(orc_NodeDataPoolList.c_Elements, orc_XMLParser);
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+            tgl_assert(orc_XMLParser.SelectNodeParentView() == "list");
          }
       }
       else
@@ -295,13 +295,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolList(C_OSCNodeDataPoolList & orc_No
       }
    }
    //Data sets
-   if ((orc_XMLParser.SelectNodeChild("data-sets") == "data-sets") && (s32_Retval == C_NO_ERR))
+   if ((orc_XMLParser.SelectNodeChildView("data-sets") == "data-sets") && (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadDataPoolListDataSets(orc_NodeDataPoolList.c_DataSets, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "list");
       }
    }
    else
@@ -336,12 +336,12 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolList(const C_OSCNodeDataPoolList & or
    orc_XMLParser.CreateAndSelectNodeChild("data-elements");
    h_SaveDataPoolListElements(orc_NodeDataPoolList.c_Elements, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "list");
    //Data sets
    orc_XMLParser.CreateAndSelectNodeChild("data-sets");
    h_SaveDataPoolListDataSets(orc_NodeDataPoolList.c_DataSets, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "list");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -368,11 +368,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
    orc_NodeDataPoolListElement.f64_Offset = orc_XMLParser.GetAttributeFloat64("offset");
    orc_NodeDataPoolListElement.q_DiagEventCall = orc_XMLParser.GetAttributeBool("diag-event-call");
    orc_NodeDataPoolListElement.u32_NvMStartAddress = orc_XMLParser.GetAttributeUint32("nvm-start-address");
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.SelectNodeChildView("name") == "name")
    {
       orc_NodeDataPoolListElement.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
    }
    else
    {
@@ -385,7 +385,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("min-value") == "min-value")
+      if (orc_XMLParser.SelectNodeChildView("min-value") == "min-value")
       {
          //copy over value so we have the correct type:
          orc_NodeDataPoolListElement.c_MinValue = orc_NodeDataPoolListElement.c_Value;
@@ -395,7 +395,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
          orc_NodeDataPoolListElement.c_NvmValue = orc_NodeDataPoolListElement.c_MinValue;
          orc_NodeDataPoolListElement.c_Value = orc_NodeDataPoolListElement.c_MinValue;
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
       }
       else
       {
@@ -406,14 +406,14 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("max-value") == "max-value")
+      if (orc_XMLParser.SelectNodeChildView("max-value") == "max-value")
       {
          //copy over value so we have the correct type:
          orc_NodeDataPoolListElement.c_MaxValue = orc_NodeDataPoolListElement.c_Value;
 
          s32_Retval = h_LoadDataPoolElementValue(orc_NodeDataPoolListElement.c_MaxValue, orc_XMLParser, false);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
       }
       else
       {
@@ -424,11 +424,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+      if (orc_XMLParser.SelectNodeChildView("comment") == "comment")
       {
          orc_NodeDataPoolListElement.c_Comment = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
       }
       else
       {
@@ -439,11 +439,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("unit") == "unit")
+      if (orc_XMLParser.SelectNodeChildView("unit") == "unit")
       {
          orc_NodeDataPoolListElement.c_Unit = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
       }
       else
       {
@@ -454,12 +454,12 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("access") == "access")
+      if (orc_XMLParser.SelectNodeChildView("access") == "access")
       {
          s32_Retval =
             mh_StringToNodeDataPoolElementAccess(orc_XMLParser.GetNodeContent(), orc_NodeDataPoolListElement.e_Access);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
       }
       else
       {
@@ -470,13 +470,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("data-set-values") == "data-set-values")
+      if (orc_XMLParser.SelectNodeChildView("data-set-values") == "data-set-values")
       {
          s32_Retval = h_LoadDataPoolListElementDataSetValues(orc_NodeDataPoolListElement.c_Value,
                                                              orc_NodeDataPoolListElement.c_DataSetValues,
                                                              orc_XMLParser);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
       }
       else
       {
@@ -516,7 +516,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolElement(const C_OSCNodeDataPoolListEl
    orc_XMLParser.CreateAndSelectNodeChild("data-set-values");
    h_SaveDataPoolListElementDataSetValues(orc_NodeDataPoolListElement.c_DataSetValues, orc_XMLParser);
    //Return to parent
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+   tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-element");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -538,7 +538,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolLists(std::vector<C_OSCNodeDataPool
                                                    C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeList;
+   C_OSCXMLStringView c_CurNodeList;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -549,7 +549,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolLists(std::vector<C_OSCNodeDataPool
       orc_NodeDataPoolLists.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeList = orc_XMLParser.SelectNodeChild("list");
+   c_CurNodeList = orc_XMLParser.SelectNodeChildView("list");
 
    //Clear
    orc_NodeDataPoolLists.clear();
@@ -566,14 +566,14 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolLists(std::vector<C_OSCNodeDataPool
 
          orc_NodeDataPoolLists.push_back(c_CurList);
          //Next
-         c_CurNodeList = orc_XMLParser.SelectNodeNext("list");
+         c_CurNodeList = orc_XMLParser.SelectNodeNextView("list");
       }
       while (c_CurNodeList == "list");
 
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "lists");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "lists");
       }
    }
    //Compare length
@@ -610,7 +610,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolLists(const std::vector<C_OSCNodeData
       orc_XMLParser.CreateAndSelectNodeChild("list");
       h_SaveDataPoolList(orc_NodeDataPoolLists[u32_ItList], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "lists");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "lists");
    }
 }
 
@@ -633,7 +633,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElements(
    std::vector<C_OSCNodeDataPoolListElement> & orc_NodeDataPoolListElements, C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeDataElement;
+   C_OSCXMLStringView c_CurNodeDataElement;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -644,7 +644,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElements(
       orc_NodeDataPoolListElements.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeDataElement = orc_XMLParser.SelectNodeChild("data-element");
+   c_CurNodeDataElement = orc_XMLParser.SelectNodeChildView("data-element");
 
    //Clear
    orc_NodeDataPoolListElements.clear();
@@ -663,11 +663,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElements(
          orc_NodeDataPoolListElements.push_back(c_CurDataElement);
 
          //Next
-         c_CurNodeDataElement = orc_XMLParser.SelectNodeNext("data-element");
+         c_CurNodeDataElement = orc_XMLParser.SelectNodeNextView("data-element");
       }
       while (c_CurNodeDataElement == "data-element");
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-elements");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-elements");
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -704,7 +704,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolListElements(
       orc_XMLParser.CreateAndSelectNodeChild("data-element");
       h_SaveDataPoolElement(orc_NodeDataPoolListElements[u32_ItDataElement], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-elements");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-elements");
    }
 }
 
@@ -731,7 +731,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElementDataSetValues(const C_OS
                                                                       C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeDataSetValue = orc_XMLParser.SelectNodeChild("data-set-value");
+   C_OSCXMLStringView c_CurNodeDataSetValue = orc_XMLParser.SelectNodeChildView("data-set-value");
 
    if (c_CurNodeDataSetValue == "data-set-value")
    {
@@ -748,11 +748,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElementDataSetValues(const C_OS
          orc_NodeDataPoolListElementDataSetValues.push_back(c_CurDataSetValue);
 
          //Next
-         c_CurNodeDataSetValue = orc_XMLParser.SelectNodeNext("data-set-value");
+         c_CurNodeDataSetValue = orc_XMLParser.SelectNodeNextView("data-set-value");
       }
       while (c_CurNodeDataSetValue == "data-set-value");
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-set-values");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-set-values");
    }
    return s32_Retval;
 }
@@ -800,7 +800,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListDataSets(
    std::vector<C_OSCNodeDataPoolDataSet> & orc_NodeDataPoolListDataSets, C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeDataSet = orc_XMLParser.SelectNodeChild("data-set");
+   C_OSCXMLStringView c_CurNodeDataSet = orc_XMLParser.SelectNodeChildView("data-set");
 
    orc_NodeDataPoolListDataSets.clear();
    if (c_CurNodeDataSet == "data-set")
@@ -809,22 +809,22 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListDataSets(
       {
          C_OSCNodeDataPoolDataSet c_CurDataSet;
 
-         if (orc_XMLParser.SelectNodeChild("name") == "name")
+         if (orc_XMLParser.SelectNodeChildView("name") == "name")
          {
             c_CurDataSet.c_Name = orc_XMLParser.GetNodeContent();
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "data-set");
+            tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-set");
          }
          else
          {
             s32_Retval = C_CONFIG;
          }
 
-         if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+         if (orc_XMLParser.SelectNodeChildView("comment") == "comment")
          {
             c_CurDataSet.c_Comment = orc_XMLParser.GetNodeContent();
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "data-set");
+            tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-set");
          }
          else
          {
@@ -835,11 +835,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListDataSets(
          orc_NodeDataPoolListDataSets.push_back(c_CurDataSet);
 
          //Next
-         c_CurNodeDataSet = orc_XMLParser.SelectNodeNext("data-set");
+         c_CurNodeDataSet = orc_XMLParser.SelectNodeNextView("data-set");
       }
       while (c_CurNodeDataSet == "data-set");
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-sets");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-sets");
    }
    return s32_Retval;
 }
@@ -866,7 +866,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolListDataSets(
       orc_XMLParser.CreateNodeChild("name", rc_DataSet.c_Name);
       orc_XMLParser.CreateNodeChild("comment", rc_DataSet.c_Comment);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-sets");
+      tgl_assert(orc_XMLParser.SelectNodeParentView() == "data-sets");
    }
 }
 
@@ -965,7 +965,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementType(C_OSCNodeDataPoolConten
 {
    sint32 s32_Retval = C_CONFIG;
 
-   if (orc_XMLParser.SelectNodeChild("type") == "type")
+   if (orc_XMLParser.SelectNodeChildView("type") == "type")
    {
       C_OSCNodeDataPoolContent::E_Type e_Type;
       s32_Retval = mh_StringToNodeDataPoolContent(orc_XMLParser.GetAttributeString("base-type"), e_Type);
@@ -979,7 +979,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementType(C_OSCNodeDataPoolConten
          }
       }
       //Return
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
    else
    {
@@ -1010,7 +1010,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolElementType(const C_OSCNodeDataPoolCo
       orc_XMLParser.SetAttributeUint32("array-size", orc_NodeDataPoolContent.GetArraySize());
    }
 
-   orc_XMLParser.SelectNodeParent();
+   orc_XMLParser.SelectNodeParentView();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1061,7 +1061,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OSCNodeDataPoolConte
             orc_NodeDataPoolContent.SetValueU32(orc_XMLParser.GetAttributeUint32("value"));
             break;
          case C_OSCNodeDataPoolContent::eUINT64:
-            orc_NodeDataPoolContent.SetValueU64(mh_GetAttributeUint64(orc_XMLParser, "value"));
+            orc_NodeDataPoolContent.SetValueU64(orc_XMLParser.GetAttributeUint64("value"));
             break;
          case C_OSCNodeDataPoolContent::eSINT8:
             orc_NodeDataPoolContent.SetValueS8(static_cast<sint8>(orc_XMLParser.GetAttributeSint64("value")));
@@ -1087,7 +1087,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OSCNodeDataPoolConte
    else
    {
       //Array
-      C_SCLString c_CurNode = orc_XMLParser.SelectNodeChild("element");
+      C_OSCXMLStringView c_CurNode = orc_XMLParser.SelectNodeChildView("element");
       if (c_CurNode == "element")
       {
          uint32 u32_CurIndex = 0U;
@@ -1118,8 +1118,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OSCNodeDataPoolConte
                                                            u32_CurIndex);
                break;
             case C_OSCNodeDataPoolContent::eUINT64:
-               orc_NodeDataPoolContent.SetValueAU64Element(mh_GetAttributeUint64(orc_XMLParser,
-                                                                                 "value"), u32_CurIndex);
+               orc_NodeDataPoolContent.SetValueAU64Element(orc_XMLParser.GetAttributeUint64("value"), u32_CurIndex);
                break;
             case C_OSCNodeDataPoolContent::eSINT8:
                orc_NodeDataPoolContent.SetValueAS8Element(static_cast<sint8>(orc_XMLParser.GetAttributeSint64(
@@ -1147,7 +1146,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OSCNodeDataPoolConte
                break;
             }
             u32_CurIndex++; //next element
-            c_CurNode = orc_XMLParser.SelectNodeNext("element");
+            c_CurNode = orc_XMLParser.SelectNodeNextView("element");
          }
          while ((c_CurNode == "element") && (s32_Retval == C_NO_ERR));
 
@@ -1159,7 +1158,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OSCNodeDataPoolConte
          }
       }
       //Return
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
 
    return s32_Retval;
@@ -1267,11 +1266,11 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolElementValue(const stw_scl::C_SCLStri
             break;
          }
          //Return to parent
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == orc_NodeName.c_str());
       }
    }
    //Return to parent
-   orc_XMLParser.SelectNodeParent();
+   orc_XMLParser.SelectNodeParentView();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1379,10 +1378,10 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolContentV1(const C_OSCNodeDataPoolCont
             break;
          }
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "array");
+         tgl_assert(orc_XMLParser.SelectNodeParentView() == "array");
       }
       //Return
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
 }
 
@@ -1419,7 +1418,7 @@ sint32 C_OSCNodeDataPoolFiler::h_CheckDataPoolElementValueType(const C_OSCNodeDa
    sint32 s32_Retval = C_CONFIG;
 
    //Load value
-   const uint64 u64_Val = mh_GetAttributeUint64(orc_XMLParser, "value");
+   const uint64 u64_Val = orc_XMLParser.GetAttributeUint64("value");
    const sint64 s64_Val = orc_XMLParser.GetAttributeSint64("value");
    const float64 f64_Val = orc_XMLParser.GetAttributeFloat64("value");
 
@@ -1567,13 +1566,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolContentV1(C_OSCNodeDataPoolContent
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("type") == "type")
+   if (orc_XMLParser.SelectNodeChildView("type") == "type")
    {
       C_OSCNodeDataPoolContent::E_Type e_Type;
       s32_Retval = mh_StringToNodeDataPoolContent(orc_XMLParser.GetNodeContent(), e_Type);
       orc_NodeDataPoolContent.SetType(e_Type);
       //Return
-      orc_XMLParser.SelectNodeParent();
+      orc_XMLParser.SelectNodeParentView();
    }
    else
    {
@@ -1589,9 +1588,9 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolContentV1(C_OSCNodeDataPoolContent
    else
    {
       //Array
-      if (orc_XMLParser.SelectNodeChild("array") == "array")
+      if (orc_XMLParser.SelectNodeChildView("array") == "array")
       {
-         C_SCLString c_CurNode = orc_XMLParser.SelectNodeChild("element");
+         C_OSCXMLStringView c_CurNode = orc_XMLParser.SelectNodeChildView("element");
          if (c_CurNode == "element")
          {
             uint32 u32_CurIndex;
@@ -1617,8 +1616,8 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolContentV1(C_OSCNodeDataPoolContent
                                                               u32_CurIndex);
                   break;
                case C_OSCNodeDataPoolContent::eUINT64:
-                  orc_NodeDataPoolContent.SetValueAU64Element(mh_GetAttributeUint64(orc_XMLParser,
-                                                                                    "content"), u32_CurIndex);
+                  orc_NodeDataPoolContent.SetValueAU64Element(orc_XMLParser.GetAttributeUint64("content"),
+                                                              u32_CurIndex);
                   break;
                case C_OSCNodeDataPoolContent::eSINT8:
                   orc_NodeDataPoolContent.SetValueAS8Element(static_cast<sint8>(orc_XMLParser.GetAttributeSint64(
@@ -1645,14 +1644,14 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolContentV1(C_OSCNodeDataPoolContent
                                                               u32_CurIndex);
                   break;
                }
-               c_CurNode = orc_XMLParser.SelectNodeNext("element");
+               c_CurNode = orc_XMLParser.SelectNodeNextView("element");
             }
             while (c_CurNode == "element");
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "array");
+            tgl_assert(orc_XMLParser.SelectNodeParentView() == "array");
          }
          //Return
-         orc_XMLParser.SelectNodeParent();
+         orc_XMLParser.SelectNodeParentView();
       }
       else
       {
@@ -1902,25 +1901,3 @@ void C_OSCNodeDataPoolFiler::mh_SetAttributeUint64(C_OSCXMLParserBase & orc_XMLP
 
    orc_XMLParser.SetAttributeString(orc_String, std::string(c_Stream.str()).c_str());
 }
-
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Get unit64 attribute
-
-   \param[in]  orc_XMLParser  XML
-   \param[in]  orc_String     Attribute
-
-   \return
-   Value
-*/
-//----------------------------------------------------------------------------------------------------------------------
-uint64 C_OSCNodeDataPoolFiler::mh_GetAttributeUint64(const C_OSCXMLParserBase & orc_XMLParser,
-                                                     const C_SCLString & orc_String)
-{
-   uint64 u64_Retval = 0;
-
-   std::stringstream c_Stream;
-   c_Stream << orc_XMLParser.GetAttributeString(orc_String).c_str();
-
-   c_Stream >> u64_Retval;
-   return u64_Retval;
-}
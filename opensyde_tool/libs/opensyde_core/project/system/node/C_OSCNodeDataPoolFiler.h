@@ -99,8 +99,6 @@ private:
                                                                  C_OSCNodeDataPoolListElement::E_Access & ore_Type);
    static void mh_SetAttributeUint64(C_OSCXMLParserBase & orc_XMLParser, const stw_scl::C_SCLString & orc_String,
                                      const stw_types::uint64 ou64_Input);
-   static stw_types::uint64 mh_GetAttributeUint64(const C_OSCXMLParserBase & orc_XMLParser,
-                                                  const stw_scl::C_SCLString & orc_String);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
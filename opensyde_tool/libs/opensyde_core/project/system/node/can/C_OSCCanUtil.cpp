@@ -74,7 +74,8 @@ bool C_OSCCanUtil::h_IsSignalInMessage(const uint8 ou8_Dlc, const C_OSCCanSignal
    \param[in]      oe_ContentType      Content type
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCCanUtil::h_GetSignalValue(const uint8 (&orau8_CanDb)[8], const C_OSCCanSignal & orc_Signal,
+void C_OSCCanUtil::h_GetSignalValue(const uint8 (&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
+                                    const C_OSCCanSignal & orc_Signal,
                                     std::vector<uint8> & orc_DataPoolData,
                                     const C_OSCNodeDataPoolContent::E_Type oe_ContentType)
 {
@@ -106,7 +107,7 @@ void C_OSCCanUtil::h_GetSignalValue(const uint8 (&orau8_CanDb)[8], const C_OSCCa
             const uint16 u16_MessageIndex = u16_StartByte + u16_CurByte;
             // This is the MSB part of the byte, right shifting to get it byte aligned
             orc_DataPoolData[u16_CurByte] = orau8_CanDb[u16_MessageIndex] >> u16_LsbBitOffset;
-            if ((u16_MessageIndex + 1U) < 8U)
+            if ((u16_MessageIndex + 1U) < stw_can::STWCAN_MAX_DATA_LENGTH_FD)
             {
                // If the byte is spread over two bytes of the message bytes
                // This is the MSB 'part' of the byte, left shifting over the LSB 'part'
@@ -215,7 +216,8 @@ void C_OSCCanUtil::h_GetSignalValue(const uint8 (&orau8_CanDb)[8], const C_OSCCa
    \param[in,out]  orc_Value     Extracted value and source for size of value
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCCanUtil::h_GetSignalValue(const uint8 (&orau8_CanDb)[8], const C_OSCCanSignal & orc_Signal,
+void C_OSCCanUtil::h_GetSignalValue(const uint8 (&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
+                                    const C_OSCCanSignal & orc_Signal,
                                     C_OSCNodeDataPoolContent & orc_Value)
 {
    std::vector<uint8> c_Data;
@@ -237,7 +239,8 @@ void C_OSCCanUtil::h_GetSignalValue(const uint8 (&orau8_CanDb)[8], const C_OSCCa
    \param[in]      orc_Value     Data from data pool to write into the message
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCCanUtil::h_SetSignalValue(uint8 (&orau8_CanDb)[8], const C_OSCCanSignal & orc_Signal,
+void C_OSCCanUtil::h_SetSignalValue(uint8 (&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
+                                    const C_OSCCanSignal & orc_Signal,
                                     const C_OSCNodeDataPoolContent & orc_Value)
 {
    const uint8 u8_StartByte = static_cast<uint8>(orc_Signal.u16_ComBitStart / 8U);
@@ -331,7 +334,7 @@ void C_OSCCanUtil::h_SetSignalValue(uint8 (&orau8_CanDb)[8], const C_OSCCanSigna
             // This is the MSB part of the byte, left shifting to get it to the correct position
             //lint -e{701} no signed value here
             orau8_CanDb[u8_MessageIndex] |= static_cast<uint8>(c_ValueData[u8_CurByte] << u8_LsbBitOffset);
-            if ((u8_MessageIndex + 1U) < 8U)
+            if ((u8_MessageIndex + 1U) < stw_can::STWCAN_MAX_DATA_LENGTH_FD)
             {
                // If the byte is spread over two bytes of the message bytes
                // This is the MSB 'part' of the byte, left shifting over the LSB 'part'
@@ -14,6 +14,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "C_OSCNodeDataPoolContent.h"
 #include "C_OSCCanSignal.h"
+#include "stw_can.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw_opensyde_core
@@ -30,16 +31,16 @@ public:
    static bool h_IsSignalInMessage(const stw_types::uint8 ou8_Dlc,
                                    const stw_opensyde_core::C_OSCCanSignal & orc_Signal);
 
-   static void h_GetSignalValue(const stw_types::uint8(&orau8_CanDb)[8],
+   static void h_GetSignalValue(const stw_types::uint8(&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
                                 const stw_opensyde_core::C_OSCCanSignal & orc_Signal,
                                 std::vector<stw_types::uint8> & orc_DataPoolData,
                                 const C_OSCNodeDataPoolContent::E_Type oe_ContentType);
 
-   static void h_GetSignalValue(const stw_types::uint8(&orau8_CanDb)[8],
+   static void h_GetSignalValue(const stw_types::uint8(&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
                                 const stw_opensyde_core::C_OSCCanSignal & orc_Signal,
                                 C_OSCNodeDataPoolContent & orc_Value);
 
-   static void h_SetSignalValue(stw_types::uint8(&orau8_CanDb)[8],
+   static void h_SetSignalValue(stw_types::uint8(&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
                                 const stw_opensyde_core::C_OSCCanSignal & orc_Signal,
                                 const C_OSCNodeDataPoolContent &orc_Value);
 };
@@ -216,6 +216,46 @@ sint32 C_OSCProtocolDriverOsy::Disconnect(void)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Put TransferData request into Tx queue
+
+   \param[in]  ou8_BlockSequenceCounter   sequence counter 0-255; first block starts with 1
+   \param[in]  orc_Data                   data to be programmed to flash memory
+
+   \return
+   C_NO_ERR   request put in Tx queue
+   C_NOACT    could not put request in Tx queue ...
+   C_CONFIG   no transport protocol installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsy::m_SendTransferDataRequest(const uint8 ou8_BlockSequenceCounter,
+                                                         const std::vector<uint8> & orc_Data)
+{
+   sint32 s32_Return;
+
+   if (mpc_TransportProtocol == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      const uint16 u16_NumberOfBytes = static_cast<uint16>(orc_Data.size());
+      C_OSCProtocolDriverOsyService c_Request;
+      c_Request.c_Data.resize(static_cast<uintn>(u16_NumberOfBytes) + 2U);
+      c_Request.c_Data[0] = mhu8_OSY_SI_TRANSFER_DATA;
+      c_Request.c_Data[1] = ou8_BlockSequenceCounter;
+      (void)std::memcpy(&c_Request.c_Data[2], &orc_Data[0], u16_NumberOfBytes);
+
+      s32_Return = mpc_TransportProtocol->SendRequest(c_Request);
+      if (s32_Return != C_NO_ERR)
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add log entry for common protocol problems
 
@@ -354,8 +394,11 @@ sint32 C_OSCProtocolDriverOsy::m_Cycle(const bool oq_CheckForSpecificServiceId,
    Event-driven responses will be reported asynchronously (see ::Cycle).
    Non event-driven responses not matching the expected service will be dumped.
 
-   The function will not actively wait and poll but use a platform specific mechanism the put the calling
-    thread to sleep between individual polling calls.
+   The function will not actively wait and poll.
+   If the transport protocol supports it, the calling thread is blocked until new data arrives
+    (see C_OSCProtocolDriverOsyTpBase::WaitForResponse).
+   Each wait is limited to a short slice as the data might also be picked up by other clients of the same driver.
+   Otherwise a platform specific mechanism is used to put the calling thread to sleep between individual polling calls.
 
    \param[in]  ou8_ExpectedServiceId   ID of service the response is expected for
    \param[in]  ou16_ExpectedSize       expected size of response service
@@ -396,6 +439,8 @@ sint32 C_OSCProtocolDriverOsy::m_PollForSpecificServiceResponse(const uint8 ou8_
 
    while (((stw_tgl::TGL_GetTickCount() - mu32_TimeoutPollingMs) < u32_StartTime) && (q_Finished == false))
    {
+      bool q_WaitForData = false;
+
       //trigger handling of Rx and Tx communication
       s32_Return = this->m_Cycle(true, ou8_ExpectedServiceId, &orc_Service);
       if (s32_Return == C_NO_ERR)
@@ -519,6 +564,9 @@ sint32 C_OSCProtocolDriverOsy::m_PollForSpecificServiceResponse(const uint8 ou8_
       }
       else
       {
+         //nothing received yet
+         q_WaitForData = true;
+
          // Handle long waiting time by registered function
          if (this->mpr_OnOsyWaitTime != NULL)
          {
@@ -533,7 +581,28 @@ sint32 C_OSCProtocolDriverOsy::m_PollForSpecificServiceResponse(const uint8 ou8_
 
       if (q_Finished == false)
       {
-         stw_tgl::TGL_Sleep(0U); //rescind CPU time to other threads ...
+         bool q_Waited = false;
+
+         if ((q_WaitForData == true) && (mpc_TransportProtocol != NULL))
+         {
+            const uint32 u32_ElapsedTime = stw_tgl::TGL_GetTickCount() - u32_StartTime;
+            if (u32_ElapsedTime < mu32_TimeoutPollingMs)
+            {
+               sint32 s32_WaitResult;
+               uint32 u32_WaitTime = mu32_TimeoutPollingMs - u32_ElapsedTime;
+               if (u32_WaitTime > mhu32_MAX_RESPONSE_WAIT_SLICE_MS)
+               {
+                  u32_WaitTime = mhu32_MAX_RESPONSE_WAIT_SLICE_MS;
+               }
+               //block until new data arrives; errors will be reported by the next cycle
+               s32_WaitResult = mpc_TransportProtocol->WaitForResponse(u32_WaitTime);
+               q_Waited = ((s32_WaitResult == C_NO_ERR) || (s32_WaitResult == C_TIMEOUT));
+            }
+         }
+         if (q_Waited == false)
+         {
+            stw_tgl::TGL_Sleep(0U); //rescind CPU time to other threads ...
+         }
       }
    }
    mc_LockReception.Release();
@@ -941,6 +1010,8 @@ sint32 C_OSCProtocolDriverOsy::OsyReadListOfFeatures(C_ListOfFeatures & orc_List
       orc_ListOfFeatures.q_FlashloaderCanWriteToNvm        = ((c_Data[7] & 0x01U) == 0x01U) ? true : false;
       orc_ListOfFeatures.q_MaxNumberOfBlockLengthAvailable = ((c_Data[7] & 0x02U) == 0x02U) ? true : false;
       orc_ListOfFeatures.q_EthernetToEthernetRoutingSupported = ((c_Data[7] & 0x04U) == 0x04U) ? true : false;
+      orc_ListOfFeatures.q_PipelinedTransferDataSupported = ((c_Data[7] & 0x08U) == 0x08U) ? true : false;
+      orc_ListOfFeatures.q_FlashSectorChecksumsAvailable = ((c_Data[7] & 0x10U) == 0x10U) ? true : false;
       //we don't know anything about the meaning of the rest of the bits as we have no crystal ball
    }
    if (opu8_NrCode != NULL)
@@ -3051,6 +3122,98 @@ sint32 C_OSCProtocolDriverOsy::OsyCheckFlashMemoryAvailable(const uint32 ou32_St
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   ReadFlashSectorChecksums service implementation
+
+   Send request and wait for response.
+   See class description for general handling of "polled" services.
+
+   Read the checksums of all flash sectors (erase units) overlapping the specified memory range.
+   The checksum of each sector is a CRC32 (as C_SCLChecksums::CalcCRC32 with start value 0xFFFFFFFF and final
+   inversion) over the whole sector, including unused (erased) bytes.
+
+   Send format: 4 bytes start address, 4 bytes number of bytes
+   Response format: for each sector: 4 bytes start address, 4 bytes size, 4 bytes checksum
+
+   \param[in]  ou32_StartAddress     start address of memory range
+   \param[in]  ou32_Size             size of memory range
+   \param[out] orc_Checksums         checksums of sectors (in the order reported by the server)
+   \param[out] opu8_NrCode           if != NULL: negative response code in case of an error response
+
+   \return
+   C_NO_ERR   request sent, positive response received
+   C_TIMEOUT  expected response not received within timeout
+   C_NOACT    could not put request in Tx queue ...
+   C_CONFIG   no transport protocol installed
+   C_WARN     error response (negative response code placed in *opu8_NrCode)
+   C_RD_WR    unexpected content in response (here: wrong routine ID or size not a multiple of one sector entry)
+   C_COM      communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsy::OsyReadFlashSectorChecksums(const uint32 ou32_StartAddress, const uint32 ou32_Size,
+                                                           std::vector<C_FlashSectorChecksum> & orc_Checksums,
+                                                           uint8 * const opu8_NrCode)
+{
+   sint32 s32_Return;
+
+   std::vector<uint8> c_ReceiveData;
+   std::vector<uint8> c_SendData;
+   uint8 u8_NrErrorCode = 0U;
+
+   orc_Checksums.clear();
+
+   c_SendData.resize(8);
+   c_SendData[0] = static_cast<uint8>(ou32_StartAddress >> 24U);
+   c_SendData[1] = static_cast<uint8>(ou32_StartAddress >> 16U);
+   c_SendData[2] = static_cast<uint8>(ou32_StartAddress >> 8U);
+   c_SendData[3] = static_cast<uint8>(ou32_StartAddress & 0xFFU);
+   c_SendData[4] = static_cast<uint8>(ou32_Size >> 24U);
+   c_SendData[5] = static_cast<uint8>(ou32_Size >> 16U);
+   c_SendData[6] = static_cast<uint8>(ou32_Size >> 8U);
+   c_SendData[7] = static_cast<uint8>(ou32_Size & 0xFFU);
+   s32_Return = m_RoutineControl(mhu16_OSY_RC_SID_READ_FLASH_SECTOR_CHECKSUMS,
+                                 mhu8_OSY_RC_SUB_FUNCTION_START_ROUTINE, c_SendData, 12U, false, c_ReceiveData,
+                                 u8_NrErrorCode);
+   if ((s32_Return == C_NO_ERR) && ((c_ReceiveData.size() % 12U) != 0U))
+   {
+      s32_Return = C_RD_WR;
+   }
+   if (s32_Return == C_NO_ERR)
+   {
+      orc_Checksums.resize(c_ReceiveData.size() / 12U);
+      for (uint32 u32_Sector = 0U; u32_Sector < orc_Checksums.size(); u32_Sector++)
+      {
+         const uint8 * const pu8_Entry = &c_ReceiveData[static_cast<uintn>(u32_Sector) * 12U];
+         C_FlashSectorChecksum & rc_Sector = orc_Checksums[u32_Sector];
+         rc_Sector.u32_StartAddress = (static_cast<uint32>(pu8_Entry[0]) << 24U) +
+                                      (static_cast<uint32>(pu8_Entry[1]) << 16U) +
+                                      (static_cast<uint32>(pu8_Entry[2]) << 8U) +
+                                      static_cast<uint32>(pu8_Entry[3]);
+         rc_Sector.u32_Size = (static_cast<uint32>(pu8_Entry[4]) << 24U) +
+                              (static_cast<uint32>(pu8_Entry[5]) << 16U) +
+                              (static_cast<uint32>(pu8_Entry[6]) << 8U) +
+                              static_cast<uint32>(pu8_Entry[7]);
+         rc_Sector.u32_Checksum = (static_cast<uint32>(pu8_Entry[8]) << 24U) +
+                                  (static_cast<uint32>(pu8_Entry[9]) << 16U) +
+                                  (static_cast<uint32>(pu8_Entry[10]) << 8U) +
+                                  static_cast<uint32>(pu8_Entry[11]);
+      }
+   }
+   if (opu8_NrCode != NULL)
+   {
+      (*opu8_NrCode) = u8_NrErrorCode;
+   }
+   if (s32_Return != C_NO_ERR)
+   {
+      C_SCLString c_ErrorText;
+      c_ErrorText.PrintFormatted("RoutineControl::ReadFlashSectorChecksums(Address:%d Size:%d)",
+                                 ou32_StartAddress, ou32_Size);
+      m_LogServiceError(c_ErrorText, s32_Return, u8_NrErrorCode);
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   RoutineControl utility wrapper
 
@@ -3891,46 +4054,28 @@ sint32 C_OSCProtocolDriverOsy::OsyTransferData(const uint8 ou8_BlockSequenceCoun
    sint32 s32_Return;
    uint8 u8_NrErrorCode = 0U;
 
-   if (mpc_TransportProtocol == NULL)
-   {
-      s32_Return = C_CONFIG;
-   }
-   else
+   s32_Return = m_SendTransferDataRequest(ou8_BlockSequenceCounter, orc_Data);
+   if (s32_Return == C_NO_ERR)
    {
-      const uint16 u16_NumberOfBytes = static_cast<uint16>(orc_Data.size());
-      C_OSCProtocolDriverOsyService c_Request;
-      c_Request.c_Data.resize(static_cast<uintn>(u16_NumberOfBytes) + 2U);
-      c_Request.c_Data[0] = mhu8_OSY_SI_TRANSFER_DATA;
-      c_Request.c_Data[1] = ou8_BlockSequenceCounter;
-      (void)std::memcpy(&c_Request.c_Data[2], &orc_Data[0], u16_NumberOfBytes);
-
-      s32_Return = mpc_TransportProtocol->SendRequest(c_Request);
-      if (s32_Return != C_NO_ERR)
-      {
-         s32_Return = C_NOACT;
-      }
-      else
+      C_OSCProtocolDriverOsyService c_Response;
+      s32_Return = m_PollForSpecificServiceResponse(mhu8_OSY_SI_TRANSFER_DATA, 2U, c_Response, u8_NrErrorCode, true);
+      switch (s32_Return)
       {
-         C_OSCProtocolDriverOsyService c_Response;
-         s32_Return = m_PollForSpecificServiceResponse(mhu8_OSY_SI_TRANSFER_DATA, 2U, c_Response, u8_NrErrorCode, true);
-         switch (s32_Return)
+      case C_NO_ERR:
+         //check response:
+         if (c_Response.c_Data[1] != ou8_BlockSequenceCounter)
          {
-         case C_NO_ERR:
-            //check response:
-            if (c_Response.c_Data[1] != ou8_BlockSequenceCounter)
-            {
-               s32_Return = C_RD_WR;
-            }
-            break;
-         case C_WARN:
-            if (opu8_NrCode != NULL)
-            {
-               (*opu8_NrCode) = u8_NrErrorCode;
-            }
-            break;
-         default:
-            break;
+            s32_Return = C_RD_WR;
          }
+         break;
+      case C_WARN:
+         if (opu8_NrCode != NULL)
+         {
+            (*opu8_NrCode) = u8_NrErrorCode;
+         }
+         break;
+      default:
+         break;
       }
    }
    if (s32_Return != C_NO_ERR)
@@ -3943,6 +4088,97 @@ sint32 C_OSCProtocolDriverOsy::OsyTransferData(const uint8 ou8_BlockSequenceCoun
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Transfer Data service implementation: send request only
+
+   Only puts the request into the Tx queue of the transport protocol and returns.
+   The response must be read with OsyTransferDataReadResponse.
+
+   Intended for pipelined transfers: with servers reporting "q_PipelinedTransferDataSupported" in their list of
+   features multiple blocks can be sent before the responses to the preceding blocks are read.
+   The responses are sent by the server in the order of the requests.
+
+   \param[in]  ou8_BlockSequenceCounter   sequence counter 0-255; first block starts with 1
+   \param[in]  orc_Data                   data to be programmed to flash memory
+
+   \return
+   C_NO_ERR   request put in Tx queue
+   C_NOACT    could not put request in Tx queue ...
+   C_CONFIG   no transport protocol installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsy::OsyTransferDataSendRequest(const uint8 ou8_BlockSequenceCounter,
+                                                          const std::vector<uint8> & orc_Data)
+{
+   const sint32 s32_Return = m_SendTransferDataRequest(ou8_BlockSequenceCounter, orc_Data);
+
+   if (s32_Return != C_NO_ERR)
+   {
+      C_SCLString c_ErrorText;
+      c_ErrorText.PrintFormatted("TransferData::SendRequest(Sequence:%d, Size:%d)", ou8_BlockSequenceCounter,
+                                 orc_Data.size());
+      m_LogServiceError(c_ErrorText, s32_Return, 0U);
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Transfer Data service implementation: wait for response
+
+   Wait for the response to the oldest TransferData request sent with OsyTransferDataSendRequest.
+   See class description for general handling of "polled" services.
+
+   A negative response does not contain the block sequence counter.
+   As the server responds in the order of the requests it refers to the oldest outstanding request.
+
+   \param[out] oru8_BlockSequenceCounter  sequence counter reported by positive response
+   \param[out] opu8_NrCode                if != NULL: negative response code in case of an error response
+
+   \return
+   C_NO_ERR   positive response received
+   C_TIMEOUT  expected response not received within timeout
+   C_CONFIG   no transport protocol installed
+   C_WARN     error response (negative response code placed in *opu8_NrCode)
+   C_RD_WR    unexpected content in response
+   C_COM      communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsy::OsyTransferDataReadResponse(uint8 & oru8_BlockSequenceCounter,
+                                                           uint8 * const opu8_NrCode)
+{
+   sint32 s32_Return;
+   uint8 u8_NrErrorCode = 0U;
+
+   if (mpc_TransportProtocol == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      C_OSCProtocolDriverOsyService c_Response;
+      s32_Return = m_PollForSpecificServiceResponse(mhu8_OSY_SI_TRANSFER_DATA, 2U, c_Response, u8_NrErrorCode, true);
+      switch (s32_Return)
+      {
+      case C_NO_ERR:
+         oru8_BlockSequenceCounter = c_Response.c_Data[1];
+         break;
+      case C_WARN:
+         if (opu8_NrCode != NULL)
+         {
+            (*opu8_NrCode) = u8_NrErrorCode;
+         }
+         break;
+      default:
+         break;
+      }
+   }
+
+   m_LogServiceError("TransferData::ReadResponse", s32_Return, u8_NrErrorCode);
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Request Transfer Exit service implementation based on address
 
@@ -5123,6 +5359,9 @@ C_SCLString C_OSCProtocolDriverOsy::h_GetOpenSydeServiceErrorDetails(const sint3
       case (C_OSCProtocolDriverOsy::hu8_NR_CODE_RESPONSE_TOO_LONG):
          c_Text += "responseTooLong";
          break;
+      case (C_OSCProtocolDriverOsy::hu8_NR_CODE_BUSY_REPEAT_REQUEST):
+         c_Text += "busyRepeatRequest";
+         break;
       case (C_OSCProtocolDriverOsy::hu8_NR_CODE_CONDITIONS_NOT_CORRECT):
          c_Text += "conditionsNotCorrect";
          break;
@@ -5144,6 +5383,9 @@ C_SCLString C_OSCProtocolDriverOsy::h_GetOpenSydeServiceErrorDetails(const sint3
       case (C_OSCProtocolDriverOsy::hu8_NR_CODE_GENERAL_PROGRAMMING_FAILURE):
          c_Text += "generalProgrammingFailure";
          break;
+      case (C_OSCProtocolDriverOsy::hu8_NR_CODE_WRONG_BLOCK_SEQUENCE_COUNTER):
+         c_Text += "wrongBlockSequenceCounter";
+         break;
       case (C_OSCProtocolDriverOsy::hu8_NR_CODE_SERVICE_NOT_SUPPORTED_IN_ACTIVE_SESSION):
          c_Text += "serviceNotSupportedInActiveSession";
          break;
@@ -58,6 +58,9 @@ private:
    //maximum service size including header (used in WriteMemoryByAddress):
    stw_types::uint16 mu16_MaxServiceSize;
 
+   stw_types::sint32 m_SendTransferDataRequest(const stw_types::uint8 ou8_BlockSequenceCounter,
+                                               const std::vector<stw_types::uint8> & orc_Data);
+
    void m_LogServiceError(const stw_scl::C_SCLString & orc_Service, const stw_types::sint32 os32_ReturnCode,
                           const stw_types::uint8 ou8_NrCode) const;
 
@@ -108,6 +111,9 @@ private:
    static void mh_ConvertVariableToNecessaryBytes(const stw_types::uint32 ou32_Variable,
                                                   std::vector<stw_types::uint8> & orc_Bytes);
 
+   //maximum time to block in one wait for incoming data in m_PollForSpecificServiceResponse:
+   static const stw_types::uint32 mhu32_MAX_RESPONSE_WAIT_SLICE_MS = 10U;
+
    //service IDs:
    static const stw_types::uint8 mhu8_OSY_SI_DIAGNOSTIC_SESSION_CONTROL = 0x10U;
    static const stw_types::uint8 mhu8_OSY_SI_ECU_RESET                  = 0x11U;
@@ -169,6 +175,7 @@ private:
    static const stw_types::uint16 mhu16_OSY_RC_SID_SET_NODEID_BY_SERIALNUMBER_PART1  = 0x0216U;
    static const stw_types::uint16 mhu16_OSY_RC_SID_SET_NODEID_BY_SERIALNUMBER_PART2  = 0x0217U;
    static const stw_types::uint16 mhu16_OSY_RC_SID_SET_NODEID_BY_SERIALNUMBER_PART3  = 0x0218U;
+   static const stw_types::uint16 mhu16_OSY_RC_SID_READ_FLASH_SECTOR_CHECKSUMS       = 0x0219U;
 
    //routine sub-functions
    static const stw_types::uint8 mhu8_OSY_RC_SUB_FUNCTION_START_ROUTINE           = 0x01U;
@@ -240,6 +247,18 @@ public:
                                                  // supported
       bool q_MaxNumberOfBlockLengthAvailable;    ///< true: MaxNumberOfBlockLength can be read
       bool q_EthernetToEthernetRoutingSupported; ///< true: E2E routing supported
+      bool q_PipelinedTransferDataSupported;     ///< true: TransferData requests may be sent before the responses
+                                                 // to the preceding blocks were received
+      bool q_FlashSectorChecksumsAvailable;      ///< true: checksums of flash sectors can be read
+   };
+
+   ///checksum of one flash sector (erase unit)
+   class C_FlashSectorChecksum
+   {
+   public:
+      stw_types::uint32 u32_StartAddress; ///< first address of sector
+      stw_types::uint32 u32_Size;         ///< size of sector in bytes
+      stw_types::uint32 u32_Checksum;     ///< CRC32 over the current content of the whole sector
    };
 
    C_OSCProtocolDriverOsy(void);
@@ -404,6 +423,10 @@ public:
                                                   stw_types::uint8 * const opu8_NrCode = NULL);
    stw_types::sint32 OsyReadFlashBlockData(const stw_types::uint8 ou8_FlashBlock, C_FlashBlockInfo & orc_BlockInfo,
                                            stw_types::uint8 * const opu8_NrCode = NULL);
+   stw_types::sint32 OsyReadFlashSectorChecksums(const stw_types::uint32 ou32_StartAddress,
+                                                 const stw_types::uint32 ou32_Size,
+                                                 std::vector<C_FlashSectorChecksum> & orc_Checksums,
+                                                 stw_types::uint8 * const opu8_NrCode = NULL);
    stw_types::sint32 OsySecurityAccessRequestSeed(const stw_types::uint8 ou8_SecurityLevel,
                                                   stw_types::uint32 & oru32_Seed,
                                                   stw_types::uint8 * const opu8_NrCode = NULL);
@@ -420,6 +443,10 @@ public:
    stw_types::sint32 OsyTransferData(const stw_types::uint8 ou8_BlockSequenceCounter,
                                      std::vector<stw_types::uint8> & orc_Data,
                                      stw_types::uint8 * const opu8_NrCode = NULL);
+   stw_types::sint32 OsyTransferDataSendRequest(const stw_types::uint8 ou8_BlockSequenceCounter,
+                                                const std::vector<stw_types::uint8> & orc_Data);
+   stw_types::sint32 OsyTransferDataReadResponse(stw_types::uint8 & oru8_BlockSequenceCounter,
+                                                 stw_types::uint8 * const opu8_NrCode = NULL);
    stw_types::sint32 OsyRequestTransferExitAddressBased(const bool oq_SendSignatureBlockAddress,
                                                         const stw_types::uint32 ou32_SignatureBlockAddress,
                                                         stw_types::uint8 * const opu8_NrCode = NULL);
@@ -451,6 +478,7 @@ public:
    static const stw_types::uint8 hu8_NR_CODE_SUB_FUNCTION_NOT_SUPPORTED  = 0x12U;
    static const stw_types::uint8 hu8_NR_CODE_INCORRECT_MESSAGE_LENGTH_OR_FORMAT = 0x13U;
    static const stw_types::uint8 hu8_NR_CODE_RESPONSE_TOO_LONG           = 0x14U;
+   static const stw_types::uint8 hu8_NR_CODE_BUSY_REPEAT_REQUEST         = 0x21U;
    static const stw_types::uint8 hu8_NR_CODE_CONDITIONS_NOT_CORRECT      = 0x22U;
    static const stw_types::uint8 hu8_NR_CODE_REQUEST_SEQUENCE_ERROR      = 0x24U;
    static const stw_types::uint8 hu8_NR_CODE_REQUEST_OUT_OF_RANGE        = 0x31U;
@@ -458,6 +486,7 @@ public:
    static const stw_types::uint8 hu8_NR_CODE_INVALID_KEY                 = 0x35U;
    static const stw_types::uint8 hu8_NR_CODE_UPLOAD_DOWNLOAD_NOT_ACCEPTED = 0x70U;
    static const stw_types::uint8 hu8_NR_CODE_GENERAL_PROGRAMMING_FAILURE = 0x72U;
+   static const stw_types::uint8 hu8_NR_CODE_WRONG_BLOCK_SEQUENCE_COUNTER = 0x73U;
    static const stw_types::uint8 hu8_NR_CODE_RESPONSE_PENDING            = 0x78U;
    static const stw_types::uint8 hu8_NR_CODE_SERVICE_NOT_SUPPORTED_IN_ACTIVE_SESSION = 0x7FU;
 
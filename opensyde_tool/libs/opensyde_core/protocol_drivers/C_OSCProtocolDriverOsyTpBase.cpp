@@ -150,7 +150,7 @@ bool C_OSCProtocolDriverOsyNode::operator <(const C_OSCProtocolDriverOsyNode & o
 
    \return
    C_NO_ERR    service added
-   C_RANGE     service size out of range (maximum: 4095 bytes)
+   C_RANGE     service size out of range (maximum: 4095 bytes; 65535 bytes for CAN FD)
    C_OVERFLOW  Tx queue is already full
    C_NOACT     could not add to queue (out of memory; should not happen in real life)
 */
@@ -159,7 +159,7 @@ sint32 C_OSCProtocolDriverOsyTpBase::m_AddToTxQueue(const C_OSCProtocolDriverOsy
 {
    sint32 s32_Return = C_NO_ERR;
 
-   if (orc_Service.c_Data.size() > hu16_OSY_MAXIMUM_SERVICE_SIZE)
+   if (orc_Service.c_Data.size() > mu16_MaxServiceSize)
    {
       s32_Return = C_RANGE;
    }
@@ -205,7 +205,7 @@ sint32 C_OSCProtocolDriverOsyTpBase::m_AddToRxQueue(const C_OSCProtocolDriverOsy
 {
    sint32 s32_Return = C_NO_ERR;
 
-   if (orc_Service.c_Data.size() > hu16_OSY_MAXIMUM_SERVICE_SIZE)
+   if (orc_Service.c_Data.size() > mu16_MaxServiceSize)
    {
       s32_Return = C_RANGE;
    }
@@ -334,7 +334,8 @@ void C_OSCProtocolDriverOsyTpBase::SetBroadcastTimeout(const uint32 ou32_Timeout
 //----------------------------------------------------------------------------------------------------------------------
 C_OSCProtocolDriverOsyTpBase::C_OSCProtocolDriverOsyTpBase(const uint16 ou16_MaxServiceQueueSize) :
    mu16_MaxServiceQueueSize(ou16_MaxServiceQueueSize),
-   mu32_BroadcastTimeoutMs(1000U)
+   mu32_BroadcastTimeoutMs(1000U),
+   mu16_MaxServiceSize(hu16_OSY_MAXIMUM_SERVICE_SIZE)
 {
 }
 
@@ -429,6 +430,35 @@ sint32 C_OSCProtocolDriverOsyTpBase::ReadResponse(C_OSCProtocolDriverOsyService
    return m_GetFromRxQueue(orc_Response);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming data
+
+   Block the calling thread until new incoming data might be available or the timeout expired.
+   Intended for callers waiting for a response: instead of calling Cycle() in a tight loop they can wait here
+    between the Cycle() calls.
+   Nothing is read or placed in the Rx queue; this is up to the next Cycle() call.
+   The function may return earlier than new data arrives (e.g. if another client of the same driver read the data),
+    so callers must always check the result of the next Cycle() call.
+
+   Default implementation: waiting is not supported.
+   Transport protocols which can wait for an event of the underlying driver shall overload this function.
+
+   \param[in]     ou32_MaxWaitTimeMs   maximum time to wait
+
+   \return
+   C_NO_ERR    new data might be available
+   C_TIMEOUT   no new data within timeout
+   C_NOACT     waiting is not supported (or not possible in the current state); caller has to poll
+   C_CONFIG    no dispatcher installed
+   C_COM       communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsyTpBase::WaitForResponse(const uint32 ou32_MaxWaitTimeMs)
+{
+   (void)ou32_MaxWaitTimeMs;
+   return C_NOACT;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Make server and client identifiers known to TP.
 
@@ -84,6 +84,7 @@ protected:
    C_OSCProtocolDriverOsyNode mc_ClientId;    ///< our own client ID
    C_OSCProtocolDriverOsyNode mc_ServerId;    ///< ID of server node to communicate with
    stw_types::uint32 mu32_BroadcastTimeoutMs; ///< timeout for collecting responses to broadcasts
+   stw_types::uint16 mu16_MaxServiceSize;     ///< maximum size of one service accepted by the queues
 
    stw_types::sint32 m_AddToTxQueue(const C_OSCProtocolDriverOsyService & orc_Service);
    stw_types::sint32 m_AddToRxQueue(const C_OSCProtocolDriverOsyService & orc_Service);
@@ -95,6 +96,7 @@ public:
    static const stw_types::uint8 hu8_OSY_RESET_TYPE_KEY_OFF_ON           = 0x02U;
    static const stw_types::uint8 hu8_OSY_RESET_TYPE_RESET_TO_FLASHLOADER = 0x60U;
    static const stw_types::uint16 hu16_OSY_MAXIMUM_SERVICE_SIZE          = 4095U;
+   static const stw_types::uint16 hu16_OSY_MAXIMUM_SERVICE_SIZE_CAN_FD   = 0xFFFFU; ///< escaped FF_DL; CAN FD only
 
    C_OSCProtocolDriverOsyTpBase(const stw_types::uint16 ou16_MaxServiceQueueSize);
    virtual ~C_OSCProtocolDriverOsyTpBase(void);
@@ -127,6 +129,7 @@ public:
    */
    //-----------------------------------------------------------------------------
    virtual stw_types::sint32 Cycle(void) = 0;
+   virtual stw_types::sint32 WaitForResponse(const stw_types::uint32 ou32_MaxWaitTimeMs);
    virtual stw_types::sint32 SetNodeIdentifiers(const C_OSCProtocolDriverOsyNode & orc_ClientIdentifier,
                                                 const C_OSCProtocolDriverOsyNode & orc_ServerIdentifier);
    virtual void GetNodeIdentifiers(C_OSCProtocolDriverOsyNode & orc_ClientIdentifier,
@@ -47,11 +47,12 @@ using namespace stw_tgl;
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OSCProtocolDriverOsyTpCan::C_ServiceState::C_ServiceState(void) :
-   u16_TransmissionIndex(0U),
+   u32_TransmissionIndex(0U),
    u8_SequenceNumber(0U),
    e_Status(eIDLE),
    u32_StartTimeMs(0U),
-   u32_SendCfTimeout(0U)
+   u32_SendCfTimeout(0U),
+   u8_FrameDataLength(stw_can::STWCAN_MAX_DATA_LENGTH_CLASSIC)
 {
 }
 
@@ -66,7 +67,8 @@ C_OSCProtocolDriverOsyTpCan::C_ServiceState::C_ServiceState(void) :
 C_OSCProtocolDriverOsyTpCan::C_OSCProtocolDriverOsyTpCan(const uint16 ou16_MaxServiceQueueSize) :
    C_OSCProtocolDriverOsyTpBase(ou16_MaxServiceQueueSize),
    mpc_CanDispatcher(NULL),
-   mu16_DispatcherClientHandle(0U)
+   mu16_DispatcherClientHandle(0U),
+   mq_CanFdMode(false)
 {
 }
 
@@ -96,6 +98,8 @@ C_OSCProtocolDriverOsyTpCan::~C_OSCProtocolDriverOsyTpCan(void)
    * the CAN message is addressed to us
    * the type of frame
 
+   For CAN FD frames with more than 8 bytes the escaped format (SF_DL in second byte) is expected.
+
    Invalid frames will be ignored.
 
    \param[in]  orc_CanMessage   incoming CAN message
@@ -110,15 +114,24 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingSingleFrame(const T_STWCAN_M
 {
    C_OSCProtocolDriverOsyService c_Service;
    sint32 s32_Return = C_NO_ERR;
-   const uint8 u8_Size = orc_CanMessage.au8_Data[0] & 0x0FU;
+   const uint8 u8_NumBytes = STWCAN_DLCToNumBytes(orc_CanMessage.u8_DLC, orc_CanMessage.u8_FDF);
+   uint8 u8_Size = orc_CanMessage.au8_Data[0] & 0x0FU;
+   uint8 u8_PciSize = 1U;
+
+   if (u8_NumBytes > STWCAN_MAX_DATA_LENGTH_CLASSIC)
+   {
+      //CAN FD escape sequence: SF_DL in byte 1
+      u8_Size = (u8_Size == 0U) ? orc_CanMessage.au8_Data[1] : 0xFFU; //nibble must be zero; else force error
+      u8_PciSize = 2U;
+   }
 
-   c_Service.c_Data.resize(u8_Size);
-   if (orc_CanMessage.u8_DLC >= (c_Service.c_Data.size() + 1))
+   if (u8_NumBytes >= (static_cast<uint16>(u8_Size) + u8_PciSize))
    {
+      c_Service.c_Data.resize(u8_Size);
       //extract data:
       if (c_Service.c_Data.size() > 0)
       {
-         (void)std::memcpy(&c_Service.c_Data[0], &orc_CanMessage.au8_Data[1], c_Service.c_Data.size());
+         (void)std::memcpy(&c_Service.c_Data[0], &orc_CanMessage.au8_Data[u8_PciSize], c_Service.c_Data.size());
       }
       //add to queue:
       s32_Return = m_AddToRxQueue(c_Service);
@@ -160,7 +173,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingOsySpecificSingleFrame(const
 {
    C_OSCProtocolDriverOsyService c_Service;
    sint32 s32_Return = C_NO_ERR;
-   const uint8 u8_Size = orc_CanMessage.u8_DLC;
+   const uint8 u8_Size = STWCAN_DLCToNumBytes(orc_CanMessage.u8_DLC, orc_CanMessage.u8_FDF);
 
    // message without request SID 0xFA
    if ((orc_CanMessage.au8_Data[0] & 0x0FU) == mhu8_OSY_OSF_TYPE_EVENT_DRIVEN_DP_SINGLE_FRAME)
@@ -202,15 +215,20 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingOsySpecificSingleFrame(const
 
    \param[in]  orc_CanMessage   incoming CAN message
 
+   The data length of the first frame defines RX_DL for the following consecutive frames
+   (classic CAN: 8; CAN FD: 8..64).
+
    \return
    C_NO_ERR     no problems
-   C_CONFIG     frame invalid (DLC is not 8)
+   C_CONFIG     frame invalid (DLC is not 8 (classic CAN) resp. less than 8 (CAN FD))
+   C_RANGE      first frame with service size not supported by this implementation
    C_COM        could not send out flow control
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingFirstFrame(const T_STWCAN_Msg_RX & orc_CanMessage)
 {
    sint32 s32_Return = C_NO_ERR;
+   const uint8 u8_NumBytes = STWCAN_DLCToNumBytes(orc_CanMessage.u8_DLC, orc_CanMessage.u8_FDF);
 
    if (mc_RxService.e_Status != C_ServiceState::eIDLE)
    {
@@ -218,37 +236,60 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingFirstFrame(const T_STWCAN_Ms
       mc_RxService.e_Status = C_ServiceState::eIDLE;
    }
 
-   if (orc_CanMessage.u8_DLC == 8U)
+   if ((orc_CanMessage.u8_FDF == 0U) ? (u8_NumBytes == STWCAN_MAX_DATA_LENGTH_CLASSIC) :
+       (u8_NumBytes >= STWCAN_MAX_DATA_LENGTH_CLASSIC))
    {
-      T_STWCAN_Msg_TX t_TxMsg;
       //get total size:
       const uint8 u8_Size = orc_CanMessage.au8_Data[0] & 0x0FU;
-      const uint16 u16_ServiceSize = static_cast<uint16>(static_cast<uint16>(u8_Size) << 8U) +
-                                     orc_CanMessage.au8_Data[1];
-      mc_RxService.c_ServiceData.c_Data.resize(u16_ServiceSize);
-      //lint -e{419} //std::vector reference returned by [] is guaranteed to have linear data in memory
-      (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[0], &orc_CanMessage.au8_Data[2], 6U);
-      mc_RxService.u16_TransmissionIndex = 6U;
-      mc_RxService.u8_SequenceNumber = 1U;
-
-      //send flow control:
-      t_TxMsg.u32_ID = m_GetTxIdentifier();
-      t_TxMsg.u8_XTD = 1U;
-      t_TxMsg.u8_RTR = 0U;
-      t_TxMsg.u8_DLC = 3U;
-      t_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_FC;
-      t_TxMsg.au8_Data[1] = 0U; //no block limits (BS)
-      t_TxMsg.au8_Data[2] = 0U; //no separation time (STmin)
+      uint32 u32_ServiceSize = (static_cast<uint32>(u8_Size) << 8U) + orc_CanMessage.au8_Data[1];
+      uint8 u8_PciSize = 2U;
 
-      s32_Return = mpc_CanDispatcher->CAN_Send_Msg(t_TxMsg); //lint !e613  //caller is responsible for valid dispatcher
-      if (s32_Return != C_NO_ERR)
+      if (u32_ServiceSize == 0U)
       {
-         m_LogWarningWithHeader("Could not send flow control CAN message.", TGL_UTIL_FUNC_ID);
-         s32_Return = C_COM;
+         //escaped first frame: FF_DL in bytes 2..5
+         u32_ServiceSize = (static_cast<uint32>(orc_CanMessage.au8_Data[2]) << 24U) +
+                           (static_cast<uint32>(orc_CanMessage.au8_Data[3]) << 16U) +
+                           (static_cast<uint32>(orc_CanMessage.au8_Data[4]) << 8U) +
+                           orc_CanMessage.au8_Data[5];
+         u8_PciSize = 6U;
+      }
+      //services are limited to 65535 bytes (see SetCanFdMode()); FF must contain less than the full service
+      if ((u32_ServiceSize > 0xFFFFU) || (u32_ServiceSize <= (static_cast<uint32>(u8_NumBytes) - u8_PciSize)))
+      {
+         m_LogWarningWithHeader("First frame with unsupported size received. Ignoring.", TGL_UTIL_FUNC_ID);
+         s32_Return = C_RANGE;
       }
       else
       {
-         mc_RxService.e_Status = C_ServiceState::eWAITING_FOR_CONSECUTIVE_FRAME;
+         T_STWCAN_Msg_TX t_TxMsg;
+         mc_RxService.c_ServiceData.c_Data.resize(u32_ServiceSize);
+         //lint -e{419} //std::vector reference returned by [] is guaranteed to have linear data in memory
+         (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[0], &orc_CanMessage.au8_Data[u8_PciSize],
+                           static_cast<uintn>(u8_NumBytes) - u8_PciSize);
+         mc_RxService.u32_TransmissionIndex = static_cast<uint32>(u8_NumBytes) - u8_PciSize;
+         mc_RxService.u8_SequenceNumber = 1U;
+         mc_RxService.u8_FrameDataLength = u8_NumBytes;
+
+         //send flow control:
+         t_TxMsg.u32_ID = m_GetTxIdentifier();
+         t_TxMsg.u8_XTD = 1U;
+         t_TxMsg.u8_RTR = 0U;
+         t_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_FC;
+         t_TxMsg.au8_Data[1] = 0U; //no block limits (BS)
+         t_TxMsg.au8_Data[2] = 0U; //no separation time (STmin)
+         mh_SetFrameLength(t_TxMsg, 3U, (orc_CanMessage.u8_FDF != 0U));
+
+         //lint -e{613}  //caller is responsible for valid dispatcher
+         s32_Return = mpc_CanDispatcher->CAN_Send_Msg(t_TxMsg);
+         if (s32_Return != C_NO_ERR)
+         {
+            m_LogWarningWithHeader("Could not send flow control CAN message.", TGL_UTIL_FUNC_ID);
+            s32_Return = C_COM;
+         }
+         else
+         {
+            mc_RxService.e_Status = C_ServiceState::eWAITING_FOR_CONSECUTIVE_FRAME;
+         }
       }
    }
    else
@@ -279,24 +320,26 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
 {
    uint8 u8_NumBytesToSend;
    sint32 s32_Return = C_NO_ERR;
+   const uint8 u8_MaxPayload = mc_TxService.u8_FrameDataLength - 1U;
 
    //continue where we left:
-   for (; mc_TxService.u16_TransmissionIndex < mc_TxService.c_ServiceData.c_Data.size();
-        mc_TxService.u16_TransmissionIndex += 7)
+   for (; mc_TxService.u32_TransmissionIndex < mc_TxService.c_ServiceData.c_Data.size();
+        mc_TxService.u32_TransmissionIndex += u8_MaxPayload)
    {
       T_STWCAN_Msg_TX t_TxMsg;
       u8_NumBytesToSend = static_cast<uint8>
-                          (((mc_TxService.c_ServiceData.c_Data.size() - mc_TxService.u16_TransmissionIndex) > 7U) ? 7U :
-                           (mc_TxService.c_ServiceData.c_Data.size() - mc_TxService.u16_TransmissionIndex));
+                          (((mc_TxService.c_ServiceData.c_Data.size() - mc_TxService.u32_TransmissionIndex) >
+                            u8_MaxPayload) ? u8_MaxPayload :
+                           (mc_TxService.c_ServiceData.c_Data.size() - mc_TxService.u32_TransmissionIndex));
       t_TxMsg.u32_ID = m_GetTxIdentifier();
       t_TxMsg.u8_XTD = 1U;
       t_TxMsg.u8_RTR = 0U;
-      t_TxMsg.u8_DLC = 1U + u8_NumBytesToSend;
       t_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_CF + mc_TxService.u8_SequenceNumber;
       //lint -e{670} //std::vector reference returned by [] is guaranteed to have linear data in memory
       (void)std::memcpy(&t_TxMsg.au8_Data[1],
-                        &mc_TxService.c_ServiceData.c_Data[mc_TxService.u16_TransmissionIndex],
+                        &mc_TxService.c_ServiceData.c_Data[mc_TxService.u32_TransmissionIndex],
                         u8_NumBytesToSend);
+      mh_SetFrameLength(t_TxMsg, 1U + u8_NumBytesToSend, mq_CanFdMode);
 
       //send message:
       //lint -e{613}  //caller is responsible for valid dispatcher
@@ -340,7 +383,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
    \return
    C_NO_ERR     no problems
    C_NOACT      unexpected flow control
-   C_CONFIG     frame invalid (DLC is not 3)
+   C_CONFIG     frame invalid (DLC is not 3 (classic CAN) resp. less than 3 (CAN FD))
    C_OVERFLOW   invalid STmin or BS (only 0 supported for each)
    C_COM        could not send out following consecutive frames
 */
@@ -353,7 +396,8 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingFlowControl(const T_STWCAN_M
    if (mc_TxService.e_Status == C_ServiceState::eWAITING_FOR_FLOW_CONTROL)
    {
       //only accept STmin=0 and BS=0
-      if (orc_CanMessage.u8_DLC == 3U)
+      //CAN FD flow controls might be padded by the server
+      if ((orc_CanMessage.u8_FDF == 0U) ? (orc_CanMessage.u8_DLC == 3U) : (orc_CanMessage.u8_DLC >= 3U))
       {
          if ((orc_CanMessage.au8_Data[1] == 0U) && (orc_CanMessage.au8_Data[2] == 0U))
          {
@@ -363,7 +407,8 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingFlowControl(const T_STWCAN_M
             // in openSYDE (100 kbit/s) and an alien busload of 50%
             //So we'll have around 2 ms/message
             //But we'll add a lower limit of 100ms to compensate for client side timing constraints
-            mc_TxService.u32_SendCfTimeout = static_cast<uint32>((mc_TxService.c_ServiceData.c_Data.size() / 7U) * 2U);
+            mc_TxService.u32_SendCfTimeout = static_cast<uint32>((mc_TxService.c_ServiceData.c_Data.size() /
+                                                                  (mc_TxService.u8_FrameDataLength - 1U)) * 2U);
             if (mc_TxService.u32_SendCfTimeout < 100U)
             {
                mc_TxService.u32_SendCfTimeout = 100U;
@@ -429,13 +474,14 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingConsecutiveFrame(const T_STW
       if (mc_RxService.u8_SequenceNumber == (orc_CanMessage.au8_Data[0] & 0x0FU))
       {
          //correct sequence; copy data.
-         const uint8 u8_NumBytes = (orc_CanMessage.u8_DLC - 1);
-         if (u8_NumBytes >= (mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u16_TransmissionIndex))
+         const uint8 u8_FrameLength = STWCAN_DLCToNumBytes(orc_CanMessage.u8_DLC, orc_CanMessage.u8_FDF);
+         const uint8 u8_NumBytes = (u8_FrameLength - 1);
+         if (u8_NumBytes >= (mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u32_TransmissionIndex))
          {
             //enough data received to fill our buffer:
-            (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u16_TransmissionIndex],
+            (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u32_TransmissionIndex],
                               &orc_CanMessage.au8_Data[1],
-                              mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u16_TransmissionIndex);
+                              mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u32_TransmissionIndex);
             //add to Rx queue:
             s32_Return = m_AddToRxQueue(mc_RxService.c_ServiceData);
             if (s32_Return != C_NO_ERR)
@@ -445,12 +491,12 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingConsecutiveFrame(const T_STW
             }
             mc_RxService.e_Status = C_ServiceState::eIDLE;
          }
-         else if (orc_CanMessage.u8_DLC == 8U)
+         else if (u8_FrameLength == mc_RxService.u8_FrameDataLength)
          {
             //lint -e{419} //std::vector reference returned by [] is guaranteed to have linear data in memory
-            (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u16_TransmissionIndex],
-                              &orc_CanMessage.au8_Data[1], 7U);
-            mc_RxService.u16_TransmissionIndex += 7U;
+            (void)std::memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u32_TransmissionIndex],
+                              &orc_CanMessage.au8_Data[1], u8_NumBytes);
+            mc_RxService.u32_TransmissionIndex += u8_NumBytes;
             //set next expected sequence number:
             mc_RxService.u8_SequenceNumber++;
             if (mc_RxService.u8_SequenceNumber == 16U)
@@ -461,7 +507,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingConsecutiveFrame(const T_STW
          }
          else
          {
-            //not all data available but DLC < 8; this is messed up: abort
+            //not all data available but DLC < RX_DL; this is messed up: abort
             mc_RxService.e_Status = C_ServiceState::eIDLE;
             m_LogWarningWithHeader("Consecutive frame with incorrect DLC received.", TGL_UTIL_FUNC_ID);
             s32_Return = C_CONFIG;
@@ -529,7 +575,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingOsySpecificMultiFrame(const
          mc_RxService.c_ServiceData.c_Data.resize(u16_ServiceSize);
          //lint -e{419} //std::vector reference returned by [] is guaranteed to have linear data in memory
          (void)memcpy(&mc_RxService.c_ServiceData.c_Data[0], &orc_CanMessage.au8_Data[2], 6U);
-         mc_RxService.u16_TransmissionIndex = 6U;
+         mc_RxService.u32_TransmissionIndex = 6U;
          mc_RxService.u8_SequenceNumber = 1U;
       }
       else
@@ -546,12 +592,12 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingOsySpecificMultiFrame(const
       {
          //correct sequence; copy data.
          const uint8 u8_NumBytes = (orc_CanMessage.u8_DLC - 1);
-         if (u8_NumBytes >= (mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u16_TransmissionIndex))
+         if (u8_NumBytes >= (mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u32_TransmissionIndex))
          {
             //enough data received to fill our buffer:
-            (void)memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u16_TransmissionIndex],
+            (void)memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u32_TransmissionIndex],
                          &orc_CanMessage.au8_Data[1],
-                         mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u16_TransmissionIndex);
+                         mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u32_TransmissionIndex);
             //add to Rx queue:
             s32_Return = m_AddToRxQueue(mc_RxService.c_ServiceData);
             if (s32_Return != C_NO_ERR)
@@ -565,9 +611,9 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingOsySpecificMultiFrame(const
          else if (orc_CanMessage.u8_DLC == 8U)
          {
             //lint -e{419} //std::vector reference returned by [] is guaranteed to have linear data in memory
-            (void)memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u16_TransmissionIndex],
+            (void)memcpy(&mc_RxService.c_ServiceData.c_Data[mc_RxService.u32_TransmissionIndex],
                          &orc_CanMessage.au8_Data[1], 7U);
-            mc_RxService.u16_TransmissionIndex += 7U;
+            mc_RxService.u32_TransmissionIndex += 7U;
             //set next expected sequence number:
             mc_RxService.u8_SequenceNumber++;
             if (mc_RxService.u8_SequenceNumber == 16U)
@@ -648,25 +694,74 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_BroadcastSendDiagnosticSessionControl(cons
    Function does not check for validity of parameters (e.g. valid service size).
    Caller is responsible.
 
-   \param[in]  orc_Service       service to put into frame
+   For CAN FD services with more than 7 bytes the escaped format (SF_DL in second byte) is used.
+
+   \param[in]  orc_Service       service to put into frame (max. 7 bytes; CAN FD: max. 62 bytes)
    \param[in]  ou32_Identifier   CAN identifier to use
    \param[out] orc_CanMessage    resulting CAN message
+   \param[in]  oq_CanFd          true: compose CAN FD frame; false: compose classic CAN frame
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCProtocolDriverOsyTpCan::m_ComposeSingleFrame(const C_OSCProtocolDriverOsyService & orc_Service,
                                                        const uint32 ou32_Identifier,
-                                                       T_STWCAN_Msg_TX & orc_CanMessage) const
+                                                       T_STWCAN_Msg_TX & orc_CanMessage, const bool oq_CanFd) const
 {
+   uint8 u8_PciSize = 1U;
+
    orc_CanMessage.u32_ID = ou32_Identifier;
    orc_CanMessage.u8_XTD = 1U;
    orc_CanMessage.u8_RTR = 0U;
-   orc_CanMessage.u8_DLC = static_cast<uint8>(orc_Service.c_Data.size() + 1U);
 
    //set PCI:
-   orc_CanMessage.au8_Data[0] = static_cast<uint8>(mhu8_ISO15765_N_PCI_SF + (orc_Service.c_Data.size()));
+   if (orc_Service.c_Data.size() < STWCAN_MAX_DATA_LENGTH_CLASSIC)
+   {
+      orc_CanMessage.au8_Data[0] = static_cast<uint8>(mhu8_ISO15765_N_PCI_SF + (orc_Service.c_Data.size()));
+   }
+   else
+   {
+      orc_CanMessage.au8_Data[0] = mhu8_ISO15765_N_PCI_SF;
+      orc_CanMessage.au8_Data[1] = static_cast<uint8>(orc_Service.c_Data.size());
+      u8_PciSize = 2U;
+   }
    if (orc_Service.c_Data.size() > 0)
    {
-      (void)std::memcpy(&orc_CanMessage.au8_Data[1], &orc_Service.c_Data[0], orc_Service.c_Data.size());
+      (void)std::memcpy(&orc_CanMessage.au8_Data[u8_PciSize], &orc_Service.c_Data[0], orc_Service.c_Data.size());
+   }
+   mh_SetFrameLength(orc_CanMessage, static_cast<uint8>(orc_Service.c_Data.size() + u8_PciSize), oq_CanFd);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: set data length of frame to send
+
+   Classic CAN: the DLC is set to the number of bytes.
+   CAN FD: the frame is marked as FD frame with bit rate switch; the DLC is rounded up to the next valid
+   CAN FD length and the additional bytes are padded.
+
+   \param[in,out] orc_CanMessage   CAN message to finalize (data must already be in place)
+   \param[in]     ou8_NumBytes     number of used data bytes
+   \param[in]     oq_CanFd         true: CAN FD frame; false: classic CAN frame
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCProtocolDriverOsyTpCan::mh_SetFrameLength(T_STWCAN_Msg_TX & orc_CanMessage, const uint8 ou8_NumBytes,
+                                                    const bool oq_CanFd)
+{
+   if (oq_CanFd == true)
+   {
+      const uint8 u8_FrameLength = STWCAN_DLCToNumBytes(STWCAN_NumBytesToDLC(ou8_NumBytes), 1U);
+      orc_CanMessage.u8_FDF = 1U;
+      orc_CanMessage.u8_BRS = 1U;
+      orc_CanMessage.u8_DLC = STWCAN_NumBytesToDLC(ou8_NumBytes);
+      if (u8_FrameLength > ou8_NumBytes)
+      {
+         (void)std::memset(&orc_CanMessage.au8_Data[ou8_NumBytes], mhu8_CAN_FD_PADDING,
+                           static_cast<uintn>(u8_FrameLength) - ou8_NumBytes);
+      }
+   }
+   else
+   {
+      orc_CanMessage.u8_FDF = 0U;
+      orc_CanMessage.u8_BRS = 0U;
+      orc_CanMessage.u8_DLC = ou8_NumBytes;
    }
 }
 
@@ -708,11 +803,13 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
             s32_Return = this->m_GetFromTxQueue(mc_TxService.c_ServiceData);
             if (s32_Return == C_NO_ERR)
             {
-               if (mc_TxService.c_ServiceData.c_Data.size() <= 7)
+               //max. single frame payload: classic: 7 bytes; CAN FD: TX_DL - 2 (escaped SF_DL)
+               if (mc_TxService.c_ServiceData.c_Data.size() <=
+                   ((mq_CanFdMode == true) ? (mhu8_CAN_FD_TX_DL - 2U) : 7U))
                {
                   //simple single frame:
                   T_STWCAN_Msg_TX t_Msg;
-                  m_ComposeSingleFrame(mc_TxService.c_ServiceData, m_GetTxIdentifier(), t_Msg);
+                  m_ComposeSingleFrame(mc_TxService.c_ServiceData, m_GetTxIdentifier(), t_Msg, mq_CanFdMode);
 
                   s32_Return = mpc_CanDispatcher->CAN_Send_Msg(t_Msg);
                   if (s32_Return != C_NO_ERR)
@@ -725,6 +822,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
                else if (mc_TxService.c_ServiceData.q_CanTransferWithoutFlowControl == true)
                {
                   // openSYDE specific multi frame without flow control
+                  // (always classic CAN; only used for small services)
                   T_STWCAN_Msg_TX t_TxMsg;
                   const uintn un_CountBytes = mc_TxService.c_ServiceData.c_Data.size();
 
@@ -736,7 +834,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
                   // First frame
                   mc_TxService.u8_SequenceNumber = 0U;
                   // The number of bytes in the first frame. Start with this byte in the following frames
-                  mc_TxService.u16_TransmissionIndex = 6U;
+                  mc_TxService.u32_TransmissionIndex = 6U;
 
                   t_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_OMF;
                   t_TxMsg.au8_Data[1] = static_cast<uint8>(un_CountBytes & 0xFFU);
@@ -754,7 +852,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
                      do
                      {
                         uint32 u32_BytesForNextMessage =
-                           static_cast<uint32>(un_CountBytes - mc_TxService.u16_TransmissionIndex);
+                           static_cast<uint32>(un_CountBytes - mc_TxService.u32_TransmissionIndex);
 
                         // Maximum are 7 bytes payload for each message
                         if (u32_BytesForNextMessage > 7U)
@@ -769,7 +867,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
                         //std::vector reference returned by [] is guaranteed to have linear data in memory:
                         //lint -e{670}
                         (void)std::memcpy(&t_TxMsg.au8_Data[1],
-                                          &mc_TxService.c_ServiceData.c_Data[mc_TxService.u16_TransmissionIndex],
+                                          &mc_TxService.c_ServiceData.c_Data[mc_TxService.u32_TransmissionIndex],
                                           u32_BytesForNextMessage);
 
                         t_TxMsg.u8_DLC = static_cast<uint8>(u32_BytesForNextMessage + 1U);
@@ -784,26 +882,45 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
                            break;
                         }
 
-                        mc_TxService.u16_TransmissionIndex += static_cast<uint16>(u32_BytesForNextMessage);
+                        mc_TxService.u32_TransmissionIndex += u32_BytesForNextMessage;
                      }
-                     while (mc_TxService.u16_TransmissionIndex < un_CountBytes);
+                     while (mc_TxService.u32_TransmissionIndex < un_CountBytes);
                   }
                }
                else
                {
                   //multi-frame; compose first frame:
                   T_STWCAN_Msg_TX t_TxMsg;
+                  const uint32 u32_Size = static_cast<uint32>(mc_TxService.c_ServiceData.c_Data.size());
+                  uint8 u8_PciSize = 2U;
+                  mc_TxService.u8_FrameDataLength = (mq_CanFdMode == true) ? mhu8_CAN_FD_TX_DL :
+                                                    STWCAN_MAX_DATA_LENGTH_CLASSIC;
                   t_TxMsg.u32_ID = m_GetTxIdentifier();
                   t_TxMsg.u8_XTD = 1U;
                   t_TxMsg.u8_RTR = 0U;
-                  t_TxMsg.u8_DLC = 8U;
+                  mh_SetFrameLength(t_TxMsg, mc_TxService.u8_FrameDataLength, mq_CanFdMode);
 
-                  t_TxMsg.au8_Data[0] = static_cast<uint8>(mhu8_ISO15765_N_PCI_FF +
-                                                           ((mc_TxService.c_ServiceData.c_Data.size() >> 8) & 0x0FU));
-                  t_TxMsg.au8_Data[1] = static_cast<uint8>(mc_TxService.c_ServiceData.c_Data.size() & 0xFFU);
+                  if (u32_Size > 0xFFFU)
+                  {
+                     //escaped first frame: FF_DL 0 followed by 32bit length (15765-2:2016)
+                     u8_PciSize = 6U;
+                     t_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_FF;
+                     t_TxMsg.au8_Data[1] = 0U;
+                     t_TxMsg.au8_Data[2] = static_cast<uint8>(u32_Size >> 24U);
+                     t_TxMsg.au8_Data[3] = static_cast<uint8>((u32_Size >> 16U) & 0xFFU);
+                     t_TxMsg.au8_Data[4] = static_cast<uint8>((u32_Size >> 8U) & 0xFFU);
+                     t_TxMsg.au8_Data[5] = static_cast<uint8>(u32_Size & 0xFFU);
+                  }
+                  else
+                  {
+                     t_TxMsg.au8_Data[0] = static_cast<uint8>(mhu8_ISO15765_N_PCI_FF + ((u32_Size >> 8U) & 0x0FU));
+                     t_TxMsg.au8_Data[1] = static_cast<uint8>(u32_Size & 0xFFU);
+                  }
                   //lint -e{420} //std::vector reference returned by [] is guaranteed to have linear data in memory
-                  (void)std::memcpy(&t_TxMsg.au8_Data[2], &mc_TxService.c_ServiceData.c_Data[0], 6U);
-                  mc_TxService.u16_TransmissionIndex = 6U;
+                  (void)std::memcpy(&t_TxMsg.au8_Data[u8_PciSize], &mc_TxService.c_ServiceData.c_Data[0],
+                                    static_cast<uintn>(mc_TxService.u8_FrameDataLength) - u8_PciSize);
+                  mc_TxService.u32_TransmissionIndex =
+                     static_cast<uint32>(mc_TxService.u8_FrameDataLength) - u8_PciSize;
                   mc_TxService.u8_SequenceNumber = 1U;
                   s32_Return = mpc_CanDispatcher->CAN_Send_Msg(t_TxMsg);
                   if (s32_Return != C_NO_ERR)
@@ -901,6 +1018,46 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
    return s32_ReturnFunc;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming CAN messages
+
+   Block the calling thread until there might be new CAN messages for us or the timeout expired.
+   While there are consecutive frames left to send no waiting is possible as sending them is done by Cycle().
+
+   \param[in]     ou32_MaxWaitTimeMs   maximum time to wait
+
+   \return
+   C_NO_ERR    new data might be available
+   C_TIMEOUT   no new data within timeout
+   C_NOACT     waiting is not supported by CAN driver or we still have frames to send; caller has to poll
+   C_CONFIG    no dispatcher installed
+   C_COM       communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsyTpCan::WaitForResponse(const uint32 ou32_MaxWaitTimeMs)
+{
+   sint32 s32_Return;
+
+   if (mpc_CanDispatcher == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else if (mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND)
+   {
+      s32_Return = C_NOACT;
+   }
+   else
+   {
+      s32_Return = mpc_CanDispatcher->WaitForIncoming(mu16_DispatcherClientHandle, ou32_MaxWaitTimeMs);
+      if ((s32_Return != C_NO_ERR) && (s32_Return != C_TIMEOUT) && (s32_Return != C_NOACT))
+      {
+         //e.g. handle not registered
+         s32_Return = C_COM;
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Make server and client identifiers known to TP.
 
@@ -1151,6 +1308,40 @@ sint32 C_OSCProtocolDriverOsyTpCan::SetDispatcher(C_CAN_Dispatcher * const opc_D
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Activate CAN FD mode
+
+   In CAN FD mode single frames, first frames, consecutive frames and flow controls are sent as CAN FD frames with
+   bit rate switch using a TX_DL of 64 bytes (15765-2:2016).
+   Incoming frames are always handled in the format they were received in (classic or FD).
+   Broadcasts and openSYDE specific multi frames are always sent as classic CAN frames.
+   In CAN FD mode services of up to 65535 bytes are accepted; services larger than 4095 bytes are sent with an
+   escaped first frame (FF_DL 0 followed by the 32bit length).
+
+   The used CAN dispatcher must support sending CAN FD frames.
+
+   \param[in]  oq_Active   true: send as CAN FD frames; false: send as classic CAN frames (default)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCProtocolDriverOsyTpCan::SetCanFdMode(const bool oq_Active)
+{
+   mq_CanFdMode = oq_Active;
+   mu16_MaxServiceSize = (oq_Active == true) ? hu16_OSY_MAXIMUM_SERVICE_SIZE_CAN_FD : hu16_OSY_MAXIMUM_SERVICE_SIZE;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CAN FD mode
+
+   \return
+   true    CAN FD mode active
+   false   classic CAN mode active
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCProtocolDriverOsyTpCan::GetCanFdMode(void) const
+{
+   return mq_CanFdMode;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read serial number of all devices on local bus
 
@@ -46,18 +46,19 @@ private:
       };
 
       C_OSCProtocolDriverOsyService c_ServiceData;
-      stw_types::uint16 u16_TransmissionIndex; ///< read resp. write index in service data
+      stw_types::uint32 u32_TransmissionIndex; ///< read resp. write index in service data
       stw_types::uint8 u8_SequenceNumber;      ///< next sequence number to send or expect
       E_ServiceStatus e_Status;                ///< status of service
       stw_types::uint32 u32_StartTimeMs;       ///< Tx: time the transmission was started; used for checking for "N_Bs"
                                                // timeout
       stw_types::uint32 u32_SendCfTimeout;     ///< Tx:time at which sending all CFs should have been finished; set upon
       ///< reception of FC
+      stw_types::uint8 u8_FrameDataLength;     ///< Tx: TX_DL; Rx: RX_DL (max. bytes per frame; 8 for classic CAN)
    };
 
    ///CAN-TP PCI types:
-   static const stw_types::uint8 mhu8_ISO15765_N_PCI_SF  = 0x00U; // single frame <=8bytes
-   static const stw_types::uint8 mhu8_ISO15765_N_PCI_FF  = 0x10U; // first frame <=4095bytes
+   static const stw_types::uint8 mhu8_ISO15765_N_PCI_SF  = 0x00U; // single frame <=8bytes (CAN FD: escaped <=64)
+   static const stw_types::uint8 mhu8_ISO15765_N_PCI_FF  = 0x10U; // first frame (FF_DL 0 + 32bit length: >4095bytes)
    static const stw_types::uint8 mhu8_ISO15765_N_PCI_CF  = 0x20U; // consecutive frame
    static const stw_types::uint8 mhu8_ISO15765_N_PCI_FC  = 0x30U; // flow control
    static const stw_types::uint8 mhu8_ISO15765_N_PCI_OSF = 0xF0U; // openSYDE single frame (special handling of message
@@ -81,6 +82,10 @@ private:
    static const stw_types::uint16 mhu16_OSY_BC_RC_SID_SET_NODEID_BY_SERIALNUMBER_PART3  = 0x0218U;
    static const stw_types::uint8 mhu8_BC_OSY_NR_SI = 0x7FU;
 
+   ///CAN FD frame parameters (15765-2:2016)
+   static const stw_types::uint8 mhu8_CAN_FD_TX_DL = 64U;      ///< data length used for FD TP frames we send
+   static const stw_types::uint8 mhu8_CAN_FD_PADDING = 0xCCU;  ///< padding value for unused bytes of FD frames
+
    ///timeout when waiting for flow control; lower but more realistic than the 1s specified in 15765
    static const stw_types::uint16 mhu16_NBsTimeoutMs = 100U;
 
@@ -89,6 +94,7 @@ private:
 
    C_ServiceState mc_TxService; ///< status of Tx service currently ongoing
    C_ServiceState mc_RxService; ///< status of Rx service currently ongoing
+   bool mq_CanFdMode;           ///< true: send segmented and single frames as CAN FD frames
 
    stw_types::sint32 m_SetRxFilter(const bool oq_ForBroadcast);
    stw_types::uint32 m_GetTxIdentifier(void) const;
@@ -105,7 +111,9 @@ private:
    stw_types::sint32 m_SendNextConsecutiveFrames(void);
 
    void m_ComposeSingleFrame(const C_OSCProtocolDriverOsyService & orc_Service, const stw_types::uint32 ou32_Identifier,
-                             stw_can::T_STWCAN_Msg_TX & orc_CanMessage) const;
+                             stw_can::T_STWCAN_Msg_TX & orc_CanMessage, const bool oq_CanFd = false) const;
+   static void mh_SetFrameLength(stw_can::T_STWCAN_Msg_TX & orc_CanMessage, const stw_types::uint8 ou8_NumBytes,
+                                 const bool oq_CanFd);
 
 protected:
    void m_LogWarningWithHeader(const stw_scl::C_SCLString & orc_Information,
@@ -132,11 +140,14 @@ public:
    virtual ~C_OSCProtocolDriverOsyTpCan(void);
 
    virtual stw_types::sint32 Cycle(void);
+   virtual stw_types::sint32 WaitForResponse(const stw_types::uint32 ou32_MaxWaitTimeMs);
    virtual stw_types::sint32 SetNodeIdentifiers(const C_OSCProtocolDriverOsyNode & orc_ClientIdentifier,
                                                 const C_OSCProtocolDriverOsyNode & orc_ServerIdentifier);
    stw_types::sint32 SetNodeIdentifiersForBroadcasts(const C_OSCProtocolDriverOsyNode & orc_ClientIdentifier);
 
    stw_types::sint32 SetDispatcher(stw_can::C_CAN_Dispatcher * const opc_Dispatcher);
+   void SetCanFdMode(const bool oq_Active);
+   bool GetCanFdMode(void) const;
 
    //Tp-specific broadcast services:
    stw_types::sint32 BroadcastReadSerialNumber(
@@ -950,6 +950,40 @@ sint32 C_OSCProtocolDriverOsyTpIp::Cycle(void)
    return s32_ReturnFunc;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for incoming TCP data
+
+   Block the calling thread until there is new data on our TCP connection or the timeout expired.
+
+   \param[in]     ou32_MaxWaitTimeMs   maximum time to wait
+
+   \return
+   C_NO_ERR    new data might be available
+   C_TIMEOUT   no new data within timeout
+   C_NOACT     waiting is not supported by dispatcher; caller has to poll
+   C_CONFIG    no dispatcher installed
+   C_COM       communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsyTpIp::WaitForResponse(const uint32 ou32_MaxWaitTimeMs)
+{
+   sint32 s32_Return;
+
+   if (mpc_Dispatcher == NULL)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      s32_Return = mpc_Dispatcher->WaitForTcpData(this->mu32_DispatcherHandle, ou32_MaxWaitTimeMs);
+      if ((s32_Return != C_NO_ERR) && (s32_Return != C_TIMEOUT) && (s32_Return != C_NOACT))
+      {
+         s32_Return = C_COM;
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Print logging text
 
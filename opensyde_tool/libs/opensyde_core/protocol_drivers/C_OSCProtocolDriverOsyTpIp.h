@@ -118,6 +118,7 @@ public:
    virtual ~C_OSCProtocolDriverOsyTpIp(void);
 
    virtual stw_types::sint32 Cycle(void);
+   virtual stw_types::sint32 WaitForResponse(const stw_types::uint32 ou32_MaxWaitTimeMs);
 
    //Tp-specific functions:
    stw_types::sint32 SetDispatcher(C_OSCIpDispatcher * const opc_Dispatcher,
@@ -30,6 +30,7 @@ using namespace stw_can;
 using namespace stw_opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_DISTRIBUTE_BATCH_SIZE = 64U; ///< number of messages fetched from the dispatcher per call
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -142,7 +143,10 @@ sint32 C_OSCComDriverBase::InitBase(C_CAN_Dispatcher * const opc_CanDispatcher)
 
    if (this->mpc_CanDispatcher != NULL)
    {
-      s32_Return = this->mpc_CanDispatcher->RegisterClient(this->mu16_DispatcherClientHandle);
+      //we are the only reader of our queue (see DistributeMessages): use the lock-free ring buffer
+      s32_Return = this->mpc_CanDispatcher->RegisterClient(this->mu16_DispatcherClientHandle, NULL,
+                                                           mu32_CAN_QUEUE_DEFAULT_MAX_SIZE,
+                                                           C_CAN_Dispatcher::eQUEUE_SPSC_RING);
 
       if (s32_Return != C_NO_ERR)
       {
@@ -298,7 +302,9 @@ void C_OSCComDriverBase::DistributeMessages(void)
        (this->mq_Started == true))
    {
       sint32 s32_Return;
-      T_STWCAN_Msg_RX t_Msg;
+      T_STWCAN_Msg_RX at_Msg[mu32_DISTRIBUTE_BATCH_SIZE];
+      uint32 u32_NumRead;
+      uint32 u32_Counter;
       static uint32 hu32_BusLoadTimeRefresh = 0U;
       uint32 u32_BusLoadTimeDiff;
       uintn un_LoggerCounter;
@@ -313,11 +319,12 @@ void C_OSCComDriverBase::DistributeMessages(void)
       do
       {
          // Get the messages even if paused to clean the queue. The messages in the pause phase are not relevant
-         s32_Return = this->mpc_CanDispatcher->ReadFromQueue(this->mu16_DispatcherClientHandle, t_Msg);
+         s32_Return = this->mpc_CanDispatcher->ReadFromQueue(this->mu16_DispatcherClientHandle, &at_Msg[0],
+                                                             mu32_DISTRIBUTE_BATCH_SIZE, u32_NumRead);
 
-         if (s32_Return == C_NO_ERR)
+         for (u32_Counter = 0U; u32_Counter < u32_NumRead; ++u32_Counter)
          {
-            this->m_HandleCanMessage(t_Msg, false);
+            this->m_HandleCanMessage(at_Msg[u32_Counter], false);
          }
       }
       while (s32_Return == C_NO_ERR);
@@ -403,8 +410,10 @@ sint32 C_OSCComDriverBase::SendCanMessageDirect(const T_STWCAN_Msg_TX & orc_Msg)
          // Inform the logger about the sent message
          T_STWCAN_Msg_RX c_Msg;
 
-         (void)std::memcpy(c_Msg.au8_Data, orc_Msg.au8_Data, 8U);
+         (void)std::memcpy(c_Msg.au8_Data, orc_Msg.au8_Data, sizeof(c_Msg.au8_Data));
          c_Msg.u8_Align = orc_Msg.u8_Align;
+         c_Msg.u8_FDF = orc_Msg.u8_FDF;
+         c_Msg.u8_BRS = orc_Msg.u8_BRS;
          c_Msg.u8_DLC = orc_Msg.u8_DLC;
          c_Msg.u8_RTR = orc_Msg.u8_RTR;
          c_Msg.u8_XTD = orc_Msg.u8_XTD;
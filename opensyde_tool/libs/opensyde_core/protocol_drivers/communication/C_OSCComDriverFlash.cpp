@@ -917,6 +917,42 @@ sint32 C_OSCComDriverFlash::SendOsyCheckFlashMemoryAvailable(const C_OSCProtocol
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Execute ReadFlashSectorChecksums service
+
+   \param[in]     orc_ServerId        Server id for communication
+   \param[in]     ou32_StartAddress   Start address of memory range
+   \param[in]     ou32_Size           Size of memory range
+   \param[out]    orc_Checksums       Checksums of all flash sectors overlapping the memory range
+   \param[out]    opu8_NrCode         if != NULL and error response: negative response code
+
+   \return
+   C_NO_ERR    service finished without problems
+   C_RANGE     openSYDE protocol not found
+   C_CONFIG    Init function was not called or not successful or protocol was not initialized properly.
+   C_NOACT     Could not put request in Tx queue
+   C_WARN      Error response received
+   C_TIMEOUT   Expected response not received within timeout
+   C_RD_WR     unexpected content in response
+   C_COM       communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComDriverFlash::SendOsyReadFlashSectorChecksums(const C_OSCProtocolDriverOsyNode & orc_ServerId,
+                                                            const uint32 ou32_StartAddress, const uint32 ou32_Size,
+                                                            std::vector<C_OSCProtocolDriverOsy::C_FlashSectorChecksum> &
+                                                            orc_Checksums, uint8 * const opu8_NrCode) const
+{
+   sint32 s32_Return = C_RANGE;
+   C_OSCProtocolDriverOsy * const pc_ExistingProtocol = this->m_GetOsyProtocol(orc_ServerId);
+
+   if (pc_ExistingProtocol != NULL)
+   {
+      s32_Return = pc_ExistingProtocol->OsyReadFlashSectorChecksums(ou32_StartAddress, ou32_Size, orc_Checksums,
+                                                                     opu8_NrCode);
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Execute WriteApplicationSoftwareFingerprint service
 
@@ -1055,6 +1091,67 @@ sint32 C_OSCComDriverFlash::SendOsyTransferData(const C_OSCProtocolDriverOsyNode
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send TransferData request without waiting for the response
+
+   For pipelined transfers. The response must be read with ReceiveOsyTransferDataResponse.
+
+   \param[in]  orc_ServerId               Server id for communication
+   \param[in]  ou8_BlockSequenceCounter   sequence counter 0-255; first block starts with 1
+   \param[in]  orc_Data                   data to be programmed to flash memory
+
+   \return
+   C_NO_ERR    request put in Tx queue
+   C_RANGE     openSYDE protocol not found
+   C_CONFIG    Init function was not called or not successful or protocol was not initialized properly.
+   C_NOACT     Could not put request in Tx queue
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComDriverFlash::SendOsyTransferDataRequest(const C_OSCProtocolDriverOsyNode & orc_ServerId,
+                                                       const uint8 ou8_BlockSequenceCounter,
+                                                       const std::vector<uint8> & orc_Data) const
+{
+   sint32 s32_Return = C_RANGE;
+   C_OSCProtocolDriverOsy * const pc_ExistingProtocol = this->m_GetOsyProtocol(orc_ServerId);
+
+   if (pc_ExistingProtocol != NULL)
+   {
+      s32_Return = pc_ExistingProtocol->OsyTransferDataSendRequest(ou8_BlockSequenceCounter, orc_Data);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for the response to the oldest outstanding TransferData request
+
+   \param[in]     orc_ServerId               Server id for communication
+   \param[out]    oru8_BlockSequenceCounter  sequence counter reported by positive response
+   \param[out]    opu8_NrCode                if != NULL and error response: negative response code
+
+   \return
+   C_NO_ERR    positive response received
+   C_RANGE     openSYDE protocol not found
+   C_CONFIG    Init function was not called or not successful or protocol was not initialized properly.
+   C_WARN      Error response received
+   C_TIMEOUT   Expected response not received within timeout
+   C_RD_WR     Unexpected content in response
+   C_COM       communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComDriverFlash::ReceiveOsyTransferDataResponse(const C_OSCProtocolDriverOsyNode & orc_ServerId,
+                                                           uint8 & oru8_BlockSequenceCounter,
+                                                           uint8 * const opu8_NrCode) const
+{
+   sint32 s32_Return = C_RANGE;
+   C_OSCProtocolDriverOsy * const pc_ExistingProtocol = this->m_GetOsyProtocol(orc_ServerId);
+
+   if (pc_ExistingProtocol != NULL)
+   {
+      s32_Return = pc_ExistingProtocol->OsyTransferDataReadResponse(oru8_BlockSequenceCounter, opu8_NrCode);
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Execute TransferExitAddressBased service
 
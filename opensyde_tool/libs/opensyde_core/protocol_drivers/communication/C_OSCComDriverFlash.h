@@ -127,6 +127,11 @@ public:
                                                       const stw_types::uint32 ou32_StartAddress,
                                                       const stw_types::uint32 ou32_Size,
                                                       stw_types::uint8 * const opu8_NrCode = NULL) const;
+   stw_types::sint32 SendOsyReadFlashSectorChecksums(const C_OSCProtocolDriverOsyNode & orc_ServerId,
+                                                     const stw_types::uint32 ou32_StartAddress,
+                                                     const stw_types::uint32 ou32_Size,
+                                                     std::vector<C_OSCProtocolDriverOsy::C_FlashSectorChecksum> &
+                                                     orc_Checksums, stw_types::uint8 * const opu8_NrCode = NULL) const;
    stw_types::sint32 SendOsyWriteApplicationSoftwareFingerprint(const C_OSCProtocolDriverOsyNode & orc_ServerId,
                                                                 const stw_types::uint8 (&orau8_Date)[3],
                                                                 const stw_types::uint8 (&orau8_Time)[3],
@@ -146,6 +151,12 @@ public:
                                          const stw_types::uint8 ou8_BlockSequenceCounter,
                                          std::vector<stw_types::uint8> & orc_Data,
                                          stw_types::uint8 * const opu8_NrCode = NULL) const;
+   stw_types::sint32 SendOsyTransferDataRequest(const C_OSCProtocolDriverOsyNode & orc_ServerId,
+                                                const stw_types::uint8 ou8_BlockSequenceCounter,
+                                                const std::vector<stw_types::uint8> & orc_Data) const;
+   stw_types::sint32 ReceiveOsyTransferDataResponse(const C_OSCProtocolDriverOsyNode & orc_ServerId,
+                                                    stw_types::uint8 & oru8_BlockSequenceCounter,
+                                                    stw_types::uint8 * const opu8_NrCode = NULL) const;
    stw_types::sint32 SendOsyRequestTransferExitAddressBased(const C_OSCProtocolDriverOsyNode & orc_ServerId,
                                                             const bool oq_SendSignatureBlockAddress,
                                                             const stw_types::uint32 ou32_SignatureBlockAddress,
@@ -2582,11 +2582,16 @@ sint32 C_OSCComDriverProtocol::m_InitForCAN(void)
          //Transport protocols
          this->mc_TransportProtocols.resize(static_cast<uintn>(this->mu32_ActiveNodeCount), NULL);
          this->mc_LegacyRouterDispatchers.resize(static_cast<uintn>(this->mu32_ActiveNodeCount), NULL);
+         //CAN FD mode is a property of the bus we are connected to
+         const bool q_CanFd = ((this->mpc_SysDef != NULL) &&
+                               (this->mu32_ActiveBusIndex < this->mpc_SysDef->c_Buses.size())) ?
+                              this->mpc_SysDef->c_Buses[this->mu32_ActiveBusIndex].q_CanFd : false;
          for (uint32 u32_ItActiveNode = 0;
               (u32_ItActiveNode < this->mu32_ActiveNodeCount) && (s32_Retval == C_NO_ERR);
               ++u32_ItActiveNode)
          {
             pc_TransportProtocol = new C_OSCProtocolDriverOsyTpCan();
+            pc_TransportProtocol->SetCanFdMode(q_CanFd);
             s32_Retval = pc_TransportProtocol->SetNodeIdentifiers(this->mc_ClientID,
                                                                   this->mc_ServerIDs[u32_ItActiveNode]);
             if (s32_Retval == C_NO_ERR)
@@ -23,8 +23,8 @@
 #include "C_OSCComMessageLogger.h"
 #include "C_OSCSystemDefinitionFiler.h"
 #include "CCMONProtocol.h"
-#include "C_OSCCanUtil.h"
 #include "C_OSCComMessageLoggerFileAsc.h"
+#include "C_OSCComMessageLoggerFileBin.h"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw_types;
@@ -97,10 +97,13 @@ C_OSCComMessageLogger::C_OSCComMessageLogger(void) :
    mu64_FirstTimeStampStart(0U),
    mu64_FirstTimeStampDayOfTime(0U),
    mu64_LastTimeStamp(0U),
-   mu32_FilteredMessages(0U)
+   mpc_OsySysDefSignalDecoders(NULL),
+   mu32_FilteredMessages(0U),
+   mu32_LogFileFlushIntervalMs(C_OSCComMessageLoggerFileAsc::hu32_DEFAULT_FLUSH_INTERVAL_MS)
 {
-   // Resize the vector for all potential CAN standard ids
+   // Resize the vectors for all potential CAN standard ids
    this->mc_MsgCounterStandardId.resize(0x800U, 0U);
+   this->mc_OsySysDefIndexStandardId.resize(0x800U);
 
    this->mc_ProtocolHex.SetDecimalMode(false);
    this->mc_ProtocolDec.SetDecimalMode(true);
@@ -114,7 +117,18 @@ C_OSCComMessageLogger::~C_OSCComMessageLogger(void)
 {
    this->RemoveAllLogFiles();
 
-   //lint -e{1579} Never took ownership of mpc_OsySysDefMessage and mpc_OsySysDefDataPoolList
+   //lint -e{1579} Never took ownership of mpc_OsySysDefMessage, mpc_OsySysDefDataPoolList and
+   // mpc_OsySysDefSignalDecoders
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLogger::C_OsySysDefMessageIndexEntry::C_OsySysDefMessageIndexEntry(void) :
+   pc_Message(NULL),
+   pc_DataPoolList(NULL)
+{
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -205,10 +219,12 @@ void C_OSCComMessageLogger::SetProtocol(const e_CMONL7Protocols oe_Protocol)
 
    // Update the protocol names of all log files
    this->mc_ProtocolDec.GetProtocolName(this->me_Protocol, c_ProtocolName);
+   this->mc_CriticalSectionFiles.Acquire();
    for (c_ItFile = this->mc_LoggingFiles.begin(); c_ItFile != this->mc_LoggingFiles.end(); ++c_ItFile)
    {
       c_ItFile->second->SetProtocolName(c_ProtocolName);
    }
+   this->mc_CriticalSectionFiles.Release();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -359,6 +375,7 @@ sint32 C_OSCComMessageLogger::SetOsySysDefBus(const C_SCLString & orc_PathSystem
           (c_ItSysDef->second.c_OsySysDef.c_Buses[ou32_BusIndex].e_Type == C_OSCSystemBus::eCAN))
       {
          c_ItSysDef->second.u32_BusIndex = ou32_BusIndex;
+         this->m_UpdateOsySysDefIndex();
          s32_Return = C_NO_ERR;
       }
       else
@@ -423,6 +440,7 @@ sint32 C_OSCComMessageLogger::RemoveDatabase(const C_SCLString & orc_Path)
 
       // Remove the entry
       this->mc_OsySysDefs.erase(c_ItSysDef);
+      this->m_UpdateOsySysDefIndex();
 
       s32_Return = C_NO_ERR;
    }
@@ -469,6 +487,7 @@ sint32 C_OSCComMessageLogger::ActivateDatabase(const C_SCLString & orc_Path, con
             this->mc_ProtocolDec.RemoveOsySysDef(&(c_ItSysDef->second));
             this->mc_ProtocolHex.RemoveOsySysDef(&(c_ItSysDef->second));
          }
+         this->m_UpdateOsySysDefIndex();
       }
    }
 
@@ -495,10 +514,45 @@ sint32 C_OSCComMessageLogger::AddLogFileAsc(const C_SCLString & orc_FilePath, co
 
    this->mc_ProtocolDec.GetProtocolName(this->me_Protocol, c_ProtocolName);
    pc_File = new C_OSCComMessageLoggerFileAsc(orc_FilePath, c_ProtocolName, oq_HexActive, oq_RelativeTimeStampActive);
+   pc_File->SetFlushInterval(this->mu32_LogFileFlushIntervalMs);
+   s32_Return = pc_File->OpenFile();
+
+   this->mc_CriticalSectionFiles.Acquire();
+   this->mc_LoggingFiles.insert(std::pair<C_SCLString,
+                                          C_OSCComMessageLoggerFileBase * const>(orc_FilePath, pc_File));
+   this->mc_CriticalSectionFiles.Release();
+
+   //lint -e{429}  no memory leak of pc_File because of handling of instance in map mc_LoggingFiles
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Adds a log file in the compact openSYDE binary trace format
+
+   Only raw CAN messages are logged. The file can be read with C_OSCComMessageLoggerFileBinReader.
+
+   \param[in] orc_FilePath Path with file name. File extension must be .osyt
+
+   \return
+   C_NO_ERR    File added successfully
+   C_RD_WR     Error on creating file, folders or deleting old file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLogger::AddLogFileBin(const C_SCLString & orc_FilePath)
+{
+   sint32 s32_Return;
+   C_OSCComMessageLoggerFileBin * pc_File;
+   C_SCLString c_ProtocolName;
+
+   this->mc_ProtocolDec.GetProtocolName(this->me_Protocol, c_ProtocolName);
+   pc_File = new C_OSCComMessageLoggerFileBin(orc_FilePath, c_ProtocolName);
+   pc_File->SetFlushInterval(this->mu32_LogFileFlushIntervalMs);
    s32_Return = pc_File->OpenFile();
 
+   this->mc_CriticalSectionFiles.Acquire();
    this->mc_LoggingFiles.insert(std::pair<C_SCLString,
                                           C_OSCComMessageLoggerFileBase * const>(orc_FilePath, pc_File));
+   this->mc_CriticalSectionFiles.Release();
 
    //lint -e{429}  no memory leak of pc_File because of handling of instance in map mc_LoggingFiles
    return s32_Return;
@@ -522,6 +576,7 @@ sint32 C_OSCComMessageLogger::RemoveLogFile(const C_SCLString & orc_FilePath)
 
    std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerFileBase * const>::iterator c_ItFile;
 
+   this->mc_CriticalSectionFiles.Acquire();
    c_ItFile = this->mc_LoggingFiles.find(orc_FilePath);
 
    if (c_ItFile != this->mc_LoggingFiles.end())
@@ -531,6 +586,7 @@ sint32 C_OSCComMessageLogger::RemoveLogFile(const C_SCLString & orc_FilePath)
       delete c_ItFile->second;
       this->mc_LoggingFiles.erase(c_ItFile);
    }
+   this->mc_CriticalSectionFiles.Release();
 
    return s32_Return;
 }
@@ -545,11 +601,52 @@ void C_OSCComMessageLogger::RemoveAllLogFiles(void)
 {
    std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerFileBase * const>::iterator c_ItFile;
 
+   this->mc_CriticalSectionFiles.Acquire();
    for (c_ItFile = this->mc_LoggingFiles.begin(); c_ItFile != this->mc_LoggingFiles.end(); ++c_ItFile)
    {
       delete c_ItFile->second;
    }
    this->mc_LoggingFiles.clear();
+   this->mc_CriticalSectionFiles.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Sets the flush interval for ASC and binary log files
+
+   Only affects log files added afterwards.
+
+   \param[in] ou32_IntervalMs Interval in ms after which logged data is written to the file at the latest
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLogger::SetLogFileFlushInterval(const uint32 ou32_IntervalMs)
+{
+   this->mu32_LogFileFlushIntervalMs = ou32_IntervalMs;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Returns the number of CAN messages which could not be written to the log files
+
+   Sum of all active log files. Messages are dropped if a log file writer can not keep up with the bus traffic.
+   This function is thread safe.
+
+   \return
+   Number of dropped messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLogger::GetLogFileDroppedMessages(void) const
+{
+   uint32 u32_Dropped = 0U;
+
+   std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerFileBase * const>::const_iterator c_ItFile;
+
+   this->mc_CriticalSectionFiles.Acquire();
+   for (c_ItFile = this->mc_LoggingFiles.begin(); c_ItFile != this->mc_LoggingFiles.end(); ++c_ItFile)
+   {
+      u32_Dropped += c_ItFile->second->GetDroppedMessages();
+   }
+   this->mc_CriticalSectionFiles.Release();
+
+   return u32_Dropped;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -661,11 +758,13 @@ sint32 C_OSCComMessageLogger::HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
          }
 
          // File logging
+         this->mc_CriticalSectionFiles.Acquire();
          for (c_ItFileLogger = this->mc_LoggingFiles.begin(); c_ItFileLogger != this->mc_LoggingFiles.end();
               ++c_ItFileLogger)
          {
             c_ItFileLogger->second->AddMessageToFile(this->mc_HandledCanMessage);
          }
+         this->mc_CriticalSectionFiles.Release();
 
          s32_Return = C_NO_ERR;
       }
@@ -897,6 +996,8 @@ void C_OSCComMessageLogger::m_InsertOsySysDef(const C_SCLString & orc_PathSystem
 
    this->mc_ProtocolDec.AddOsySysDef(&(c_ItNewConfig->second));
    this->mc_ProtocolHex.AddOsySysDef(&(c_ItNewConfig->second));
+
+   this->m_UpdateOsySysDefIndex();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -904,6 +1005,7 @@ void C_OSCComMessageLogger::m_InsertOsySysDef(const C_SCLString & orc_PathSystem
 
    The result will be saved to mpc_OsySysDefMessage and mpc_OsySysDefDataPoolList.
    If mpc_OsySysDefMessage and mpc_OsySysDefDataPoolList is NULL, no CAN message found in any system definition.
+   The message is looked up in the index of all active system definitions (see m_UpdateOsySysDefIndex).
 
    \param[in] orc_Msg CAN message for analyzing
 
@@ -915,104 +1017,38 @@ void C_OSCComMessageLogger::m_InsertOsySysDef(const C_SCLString & orc_PathSystem
 bool C_OSCComMessageLogger::m_CheckSysDef(const T_STWCAN_Msg_RX & orc_Msg)
 {
    bool q_Return = false;
-
-   std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerOsySysDefConfig>::const_iterator c_ItSysDef;
+   const C_OsySysDefMessageIndexEntry * pc_Entry = NULL;
 
    this->mpc_OsySysDefMessage = NULL;
    this->mpc_OsySysDefDataPoolList = NULL;
+   this->mpc_OsySysDefSignalDecoders = NULL;
 
-   for (c_ItSysDef = this->mc_OsySysDefs.begin(); c_ItSysDef != this->mc_OsySysDefs.end(); ++c_ItSysDef)
+   if (orc_Msg.u8_XTD == 0U)
    {
-      // Check if the database is active
-      if (this->mc_DatabaseActiveFlags[c_ItSysDef->first] == true)
+      if (orc_Msg.u32_ID < this->mc_OsySysDefIndexStandardId.size())
       {
-         const C_OSCSystemDefinition & rc_OsySysDef = c_ItSysDef->second.c_OsySysDef;
-         uint32 u32_NodeCounter;
-
-         // Search all nodes which are connected to to the CAN bus
-         for (u32_NodeCounter = 0U; u32_NodeCounter < rc_OsySysDef.c_Nodes.size(); ++u32_NodeCounter)
-         {
-            const C_OSCNode & rc_Node = rc_OsySysDef.c_Nodes[u32_NodeCounter];
-            uint32 u32_IntfCounter;
-            bool q_IntfFound = false;
-
-            // Search an interface which is connected to the bus
-            for (u32_IntfCounter = 0U; u32_IntfCounter < rc_Node.c_Properties.c_ComInterfaces.size(); ++u32_IntfCounter)
-            {
-               if ((rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].q_IsBusConnected == true) &&
-                   (rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].u32_BusIndex ==
-                    c_ItSysDef->second.u32_BusIndex))
-               {
-                  // Com Interface found
-                  q_IntfFound = true;
-                  break;
-               }
-            }
-
-            if (q_IntfFound == true)
-            {
-               // Check all messages of the node for this interface on this bus
-               uint32 u32_ProtCounter;
-
-               for (u32_ProtCounter = 0U; u32_ProtCounter < rc_Node.c_ComProtocols.size(); ++u32_ProtCounter)
-               {
-                  const C_OSCCanProtocol & rc_CanProt = rc_Node.c_ComProtocols[u32_ProtCounter];
-
-                  tgl_assert(u32_IntfCounter < rc_CanProt.c_ComMessages.size());
-                  if (u32_IntfCounter < rc_CanProt.c_ComMessages.size())
-                  {
-                     const std::vector<C_OSCCanMessage> & rc_CanMsgContainerTx =
-                        rc_CanProt.c_ComMessages[u32_IntfCounter].c_TxMessages;
-                     uint32 u32_CanMsgCounter;
-
-                     for (u32_CanMsgCounter = 0U; u32_CanMsgCounter < rc_CanMsgContainerTx.size(); ++u32_CanMsgCounter)
-                     {
-                        const C_OSCCanMessage & rc_OscMsg = rc_CanMsgContainerTx[u32_CanMsgCounter];
-
-                        // No check of dlc here, it will be checked for each signal
-                        if ((orc_Msg.u32_ID == rc_OscMsg.u32_CanId) &&
-                            ((orc_Msg.u8_XTD == 1U) == rc_OscMsg.q_IsExtended))
-                        {
-                           // Message matches
-                           this->mpc_OsySysDefMessage = &rc_OscMsg;
-
-                           // Get the associated list
-                           tgl_assert(rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size());
-                           if (rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size())
-                           {
-                              this->mpc_OsySysDefDataPoolList =
-                                 C_OSCCanProtocol::h_GetComListConst(rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
-                                                                     u32_IntfCounter, true);
-                              tgl_assert(this->mpc_OsySysDefDataPoolList != NULL);
-
-                              q_Return = true;
-                           }
-
-                           break;
-                        }
-                     }
-                  }
-
-                  if (this->mpc_OsySysDefMessage != NULL)
-                  {
-                     break;
-                  }
-               }
-            }
-
-            if (this->mpc_OsySysDefMessage != NULL)
-            {
-               break;
-            }
-         }
-
-         if (this->mpc_OsySysDefMessage != NULL)
-         {
-            break;
-         }
+         pc_Entry = &this->mc_OsySysDefIndexStandardId[orc_Msg.u32_ID];
+      }
+   }
+   else
+   {
+      const std::map<uint32, C_OsySysDefMessageIndexEntry>::const_iterator c_ItEntry =
+         this->mc_OsySysDefIndexExtendedId.find(orc_Msg.u32_ID);
+      if (c_ItEntry != this->mc_OsySysDefIndexExtendedId.end())
+      {
+         pc_Entry = &c_ItEntry->second;
       }
    }
 
+   if ((pc_Entry != NULL) && (pc_Entry->pc_Message != NULL))
+   {
+      // Message matches
+      this->mpc_OsySysDefMessage = pc_Entry->pc_Message;
+      this->mpc_OsySysDefDataPoolList = pc_Entry->pc_DataPoolList;
+      this->mpc_OsySysDefSignalDecoders = &pc_Entry->c_SignalDecoders;
+      q_Return = (this->mpc_OsySysDefDataPoolList != NULL);
+   }
+
    return q_Return;
 }
 
@@ -1031,7 +1067,9 @@ bool C_OSCComMessageLogger::m_InterpretSysDef(C_OSCComMessageLoggerData & orc_Me
    bool q_Return = false;
 
    if ((this->mpc_OsySysDefMessage != NULL) &&
-       (this->mpc_OsySysDefDataPoolList != NULL))
+       (this->mpc_OsySysDefDataPoolList != NULL) &&
+       (this->mpc_OsySysDefSignalDecoders != NULL) &&
+       (this->mpc_OsySysDefSignalDecoders->size() == this->mpc_OsySysDefMessage->c_Signals.size()))
    {
       uint32 u32_Counter;
       bool q_MultiplexerFound = false;
@@ -1047,7 +1085,8 @@ bool C_OSCComMessageLogger::m_InterpretSysDef(C_OSCComMessageLoggerData & orc_Me
 
          if (rc_OscSignal.e_MultiplexerType == C_OSCCanSignal::eMUX_MULTIPLEXER_SIGNAL)
          {
-            this->m_InterpretSysDefCanSignal(orc_MessageData, rc_OscSignal);
+            this->m_InterpretSysDefCanSignal(orc_MessageData, rc_OscSignal,
+                                             (*this->mpc_OsySysDefSignalDecoders)[u32_Counter]);
 
             if (orc_MessageData.c_Signals.size() > 0)
             {
@@ -1086,7 +1125,8 @@ bool C_OSCComMessageLogger::m_InterpretSysDef(C_OSCComMessageLoggerData & orc_Me
                 ((q_MultiplexerFound == true) &&
                  (u16_MultiplexValue == rc_OscSignal.u16_MultiplexValue)))
             {
-               this->m_InterpretSysDefCanSignal(orc_MessageData, rc_OscSignal);
+               this->m_InterpretSysDefCanSignal(orc_MessageData, rc_OscSignal,
+                                                (*this->mpc_OsySysDefSignalDecoders)[u32_Counter]);
             }
          }
       }
@@ -1181,61 +1221,22 @@ bool C_OSCComMessageLogger::m_CheckInterpretation(stw_opensyde_core::C_OSCComMes
 
    \param[in,out]     orc_Signal        Signal interpretation
    \param[in]         orau8_CanDb       RAW CAN message data
-   \param[in]         ou8_CanDlc        DLC of CAN message
+   \param[in]         ou8_CanDlc        Number of data bytes of CAN message
    \param[in]         orc_OscSignal     openSYDE CAN signal configuration
-   \param[in]         orc_OscValue      Datapool element content for type configuration
-   \param[in]         of64_Factor       Factor for resulting value
-   \param[in]         of64_Offset       Offset for resulting value
+   \param[in]         orc_Decoder       Decoder compiled for orc_OscSignal and the type and scaling of its value
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCComMessageLogger::mh_InterpretCanSignalValue(C_OSCComMessageLoggerDataSignal & orc_Signal,
-                                                       const uint8(&orau8_CanDb)[8], const uint8 ou8_CanDlc,
+                                                       const uint8(&orau8_CanDb)[STWCAN_MAX_DATA_LENGTH_FD],
+                                                       const uint8 ou8_CanDlc,
                                                        const C_OSCCanSignal & orc_OscSignal,
-                                                       const C_OSCNodeDataPoolContent & orc_OscValue,
-                                                       const float64 of64_Factor, const float64 of64_Offset)
+                                                       const C_OSCComMessageLoggerSignalDecoder & orc_Decoder)
 {
-   const bool q_SignalFits = C_OSCCanUtil::h_IsSignalInMessage(ou8_CanDlc, orc_OscSignal);
+   uint64 u64_RawValue;
 
-   if (q_SignalFits == true)
+   if (orc_Decoder.Decode(orau8_CanDb, ou8_CanDlc, u64_RawValue) == true)
    {
-      uint8 u8_RawDataCounter;
-      std::vector<uint8> c_SignalRawData;
-      std::string c_StringValue;
-      C_OSCNodeDataPoolContent c_OscValue = orc_OscValue;
-      uint64 u64_Value = 0U;
-
-      // Get the signal as raw value in the first step
-      c_SignalRawData.resize(c_OscValue.GetSizeByte());
-      C_OSCCanUtil::h_GetSignalValue(orau8_CanDb, orc_OscSignal, c_SignalRawData, orc_OscValue.GetType());
-      // And the interpreted value
-      c_OscValue.SetValueFromLittleEndianBlob(c_SignalRawData);
-
-      // Raw values
-      // Signal data is converted to little endian by h_GetSignalValue
-      for (u8_RawDataCounter = 0U; u8_RawDataCounter < c_SignalRawData.size(); ++u8_RawDataCounter)
-      {
-         const uint64 u64_ShiftValue = static_cast<uint64>(u8_RawDataCounter) * 8U;
-         u64_Value += static_cast<uint64>(c_SignalRawData[u8_RawDataCounter]) << u64_ShiftValue;
-      }
-
-      if ((orc_OscValue.GetType() == C_OSCNodeDataPoolContent::eFLOAT32) ||
-          (orc_OscValue.GetType() == C_OSCNodeDataPoolContent::eFLOAT64))
-      {
-         // In case of a float value, the raw value does not make any sense in byte form.
-         // Use the value without scaling as raw value.
-         c_OscValue.GetValueAsScaledString(1.0, 0.0, c_StringValue, 0U);
-         orc_Signal.c_RawValueDec = c_StringValue.c_str();
-         orc_Signal.c_RawValueHex = c_StringValue.c_str();
-      }
-      else
-      {
-         orc_Signal.c_RawValueDec = C_SCLString::IntToStr(u64_Value);
-         orc_Signal.c_RawValueHex = C_SCLString::IntToHex(static_cast<sint64>(u64_Value), 1).UpperCase();
-      }
-
-      // Interpreted value
-      c_OscValue.GetValueAsScaledString(of64_Factor, of64_Offset, c_StringValue, 0U);
-      orc_Signal.c_Value = c_StringValue.c_str();
+      orc_Decoder.FormatValue(u64_RawValue, orc_Signal);
    }
    else
    {
@@ -1290,6 +1291,7 @@ C_SCLString C_OSCComMessageLogger::m_GetProtocolStringDecHook(void) const
 void C_OSCComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx)
 {
    uint8 u8_DbCounter;
+   const uint8 u8_NumBytes = STWCAN_DLCToNumBytes(orc_Msg.u8_DLC, orc_Msg.u8_FDF);
 
    // Clear not handled data in this function
    this->mc_HandledCanMessage.c_Name = "";
@@ -1315,7 +1317,7 @@ void C_OSCComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
 
    this->mc_HandledCanMessage.c_CanDataDec = "";
    this->mc_HandledCanMessage.c_CanDataHex = "";
-   for (u8_DbCounter = 0U; u8_DbCounter < orc_Msg.u8_DLC; ++u8_DbCounter)
+   for (u8_DbCounter = 0U; u8_DbCounter < u8_NumBytes; ++u8_DbCounter)
    {
       if (orc_Msg.au8_Data[u8_DbCounter] < 100)
       {
@@ -1328,7 +1330,7 @@ void C_OSCComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
       this->mc_HandledCanMessage.c_CanDataDec += C_SCLString::IntToStr(orc_Msg.au8_Data[u8_DbCounter]);
       this->mc_HandledCanMessage.c_CanDataHex += C_SCLString::IntToHex(orc_Msg.au8_Data[u8_DbCounter], 2).UpperCase();
 
-      if (u8_DbCounter < (orc_Msg.u8_DLC - 1U))
+      if (u8_DbCounter < (u8_NumBytes - 1U))
       {
          this->mc_HandledCanMessage.c_CanDataDec += " ";
          this->mc_HandledCanMessage.c_CanDataHex += " ";
@@ -1416,10 +1418,12 @@ void C_OSCComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
 
    \param[in,out] orc_MessageData Message data target for the interpretation
    \param[in]     orc_OscSignal   CAN signal of system definition
+   \param[in]     orc_Decoder     Decoder of CAN signal
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCComMessageLogger::m_InterpretSysDefCanSignal(C_OSCComMessageLoggerData & orc_MessageData,
-                                                       const C_OSCCanSignal & orc_OscSignal) const
+                                                       const C_OSCCanSignal & orc_OscSignal,
+                                                       const C_OSCComMessageLoggerSignalDecoder & orc_Decoder) const
 {
    if ((this->mpc_OsySysDefDataPoolList != NULL) &&
        (orc_OscSignal.u32_ComDataElementIndex < this->mpc_OsySysDefDataPoolList->c_Elements.size()))
@@ -1432,10 +1436,10 @@ void C_OSCComMessageLogger::m_InterpretSysDefCanSignal(C_OSCComMessageLoggerData
       c_Signal.c_Unit = rc_OscElement.c_Unit.c_str();
       c_Signal.c_Comment = rc_OscElement.c_Comment.c_str();
 
-      // Get the current value for the correct type configuration
-      mh_InterpretCanSignalValue(c_Signal, orc_MessageData.c_CanMsg.au8_Data, orc_MessageData.c_CanMsg.u8_DLC,
-                                 orc_OscSignal, rc_OscElement.c_Value, rc_OscElement.f64_Factor,
-                                 rc_OscElement.f64_Offset);
+      mh_InterpretCanSignalValue(c_Signal, orc_MessageData.c_CanMsg.au8_Data,
+                                 STWCAN_DLCToNumBytes(orc_MessageData.c_CanMsg.u8_DLC,
+                                                      orc_MessageData.c_CanMsg.u8_FDF),
+                                 orc_OscSignal, orc_Decoder);
 
       orc_MessageData.c_Signals.push_back(c_Signal);
    }
@@ -1450,3 +1454,151 @@ void C_OSCComMessageLogger::m_ResetCounter(void)
    std::fill(this->mc_MsgCounterStandardId.begin(), this->mc_MsgCounterStandardId.end(), 0U);
    this->mc_MsgCounterExtendedId.clear();
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Rebuilds the CAN message index of all active openSYDE system definitions
+
+   Has to be called after each change of the registered system definitions, their bus index or activation.
+   The index contains all Tx messages of all nodes connected to the configured bus.
+   If a CAN ID is defined more than once, the first definition is used (system definitions in order of their path).
+
+   The previous result of m_CheckSysDef is reset as it could point to a removed system definition.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLogger::m_UpdateOsySysDefIndex(void)
+{
+   std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerOsySysDefConfig>::const_iterator c_ItSysDef;
+
+   this->mpc_OsySysDefMessage = NULL;
+   this->mpc_OsySysDefDataPoolList = NULL;
+   this->mpc_OsySysDefSignalDecoders = NULL;
+
+   this->mc_OsySysDefIndexStandardId.assign(0x800U, C_OsySysDefMessageIndexEntry());
+   this->mc_OsySysDefIndexExtendedId.clear();
+
+   for (c_ItSysDef = this->mc_OsySysDefs.begin(); c_ItSysDef != this->mc_OsySysDefs.end(); ++c_ItSysDef)
+   {
+      const std::map<stw_scl::C_SCLString, bool>::const_iterator c_ItFlag =
+         this->mc_DatabaseActiveFlags.find(c_ItSysDef->first);
+
+      // Check if the database is active
+      if ((c_ItFlag != this->mc_DatabaseActiveFlags.end()) && (c_ItFlag->second == true))
+      {
+         const C_OSCSystemDefinition & rc_OsySysDef = c_ItSysDef->second.c_OsySysDef;
+         uint32 u32_NodeCounter;
+
+         // Search all nodes which are connected to to the CAN bus
+         for (u32_NodeCounter = 0U; u32_NodeCounter < rc_OsySysDef.c_Nodes.size(); ++u32_NodeCounter)
+         {
+            const C_OSCNode & rc_Node = rc_OsySysDef.c_Nodes[u32_NodeCounter];
+            uint32 u32_IntfCounter;
+            bool q_IntfFound = false;
+
+            // Search an interface which is connected to the bus
+            for (u32_IntfCounter = 0U; u32_IntfCounter < rc_Node.c_Properties.c_ComInterfaces.size(); ++u32_IntfCounter)
+            {
+               if ((rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].q_IsBusConnected == true) &&
+                   (rc_Node.c_Properties.c_ComInterfaces[u32_IntfCounter].u32_BusIndex ==
+                    c_ItSysDef->second.u32_BusIndex))
+               {
+                  // Com Interface found
+                  q_IntfFound = true;
+                  break;
+               }
+            }
+
+            if (q_IntfFound == true)
+            {
+               // Register all messages of the node for this interface on this bus
+               uint32 u32_ProtCounter;
+
+               for (u32_ProtCounter = 0U; u32_ProtCounter < rc_Node.c_ComProtocols.size(); ++u32_ProtCounter)
+               {
+                  const C_OSCCanProtocol & rc_CanProt = rc_Node.c_ComProtocols[u32_ProtCounter];
+
+                  tgl_assert(u32_IntfCounter < rc_CanProt.c_ComMessages.size());
+                  if (u32_IntfCounter < rc_CanProt.c_ComMessages.size())
+                  {
+                     const std::vector<C_OSCCanMessage> & rc_CanMsgContainerTx =
+                        rc_CanProt.c_ComMessages[u32_IntfCounter].c_TxMessages;
+                     C_OsySysDefMessageIndexEntry c_Entry;
+                     uint32 u32_CanMsgCounter;
+
+                     // Get the associated list
+                     tgl_assert(rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size());
+                     if (rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size())
+                     {
+                        c_Entry.pc_DataPoolList =
+                           C_OSCCanProtocol::h_GetComListConst(rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
+                                                               u32_IntfCounter, true);
+                        tgl_assert(c_Entry.pc_DataPoolList != NULL);
+                     }
+
+                     for (u32_CanMsgCounter = 0U; u32_CanMsgCounter < rc_CanMsgContainerTx.size(); ++u32_CanMsgCounter)
+                     {
+                        const C_OSCCanMessage & rc_OscMsg = rc_CanMsgContainerTx[u32_CanMsgCounter];
+                        C_OsySysDefMessageIndexEntry * pc_Slot = NULL;
+
+                        if (rc_OscMsg.q_IsExtended == false)
+                        {
+                           if (rc_OscMsg.u32_CanId < this->mc_OsySysDefIndexStandardId.size())
+                           {
+                              pc_Slot = &this->mc_OsySysDefIndexStandardId[rc_OscMsg.u32_CanId];
+                           }
+                        }
+                        else
+                        {
+                           // Inserts an empty entry if not registered yet
+                           pc_Slot = &this->mc_OsySysDefIndexExtendedId[rc_OscMsg.u32_CanId];
+                        }
+
+                        // The first definition of a CAN ID is used
+                        if ((pc_Slot != NULL) && (pc_Slot->pc_Message == NULL))
+                        {
+                           c_Entry.pc_Message = &rc_OscMsg;
+                           *pc_Slot = c_Entry;
+                           mh_CompileSignalDecoders(*pc_Slot);
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Compiles the decoders for all signals of an index entry
+
+   The type and the scaling of each signal are taken from the associated element of the COM list.
+   Signals without valid element get a decoder which never matches.
+
+   \param[in,out]  orc_Entry  Index entry with set message and list
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLogger::mh_CompileSignalDecoders(C_OsySysDefMessageIndexEntry & orc_Entry)
+{
+   orc_Entry.c_SignalDecoders.clear();
+
+   if ((orc_Entry.pc_Message != NULL) && (orc_Entry.pc_DataPoolList != NULL))
+   {
+      uint32 u32_SignalCounter;
+
+      orc_Entry.c_SignalDecoders.resize(orc_Entry.pc_Message->c_Signals.size());
+      for (u32_SignalCounter = 0U; u32_SignalCounter < orc_Entry.pc_Message->c_Signals.size(); ++u32_SignalCounter)
+      {
+         const C_OSCCanSignal & rc_OscSignal = orc_Entry.pc_Message->c_Signals[u32_SignalCounter];
+
+         if (rc_OscSignal.u32_ComDataElementIndex < orc_Entry.pc_DataPoolList->c_Elements.size())
+         {
+            const C_OSCNodeDataPoolListElement & rc_OscElement =
+               orc_Entry.pc_DataPoolList->c_Elements[rc_OscSignal.u32_ComDataElementIndex];
+
+            orc_Entry.c_SignalDecoders[u32_SignalCounter].Compile(rc_OscSignal, rc_OscElement.c_Value.GetType(),
+                                                                   rc_OscElement.f64_Factor,
+                                                                   rc_OscElement.f64_Offset);
+         }
+      }
+   }
+}
@@ -18,12 +18,14 @@
 #include "stwtypes.h"
 #include "CSCLString.h"
 #include "stw_can.h"
+#include "TGLTasks.h"
 
 #include "C_OSCComLoggerProtocols.h"
 #include "C_OSCSystemDefinition.h"
 #include "C_OSCComMessageLoggerOsySysDefConfig.h"
 #include "C_OSCComMessageLoggerData.h"
 #include "C_OSCComMessageLoggerFileBase.h"
+#include "C_OSCComMessageLoggerSignalDecoder.h"
 #include "C_OSCCanSignal.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -75,8 +77,11 @@ public:
    // Logging handling
    virtual stw_types::sint32 AddLogFileAsc(const stw_scl::C_SCLString & orc_FilePath, const bool oq_HexActive,
                                            const bool oq_RelativeTimeStampActive);
+   virtual stw_types::sint32 AddLogFileBin(const stw_scl::C_SCLString & orc_FilePath);
    virtual stw_types::sint32 RemoveLogFile(const stw_scl::C_SCLString & orc_FilePath);
    virtual void RemoveAllLogFiles(void);
+   void SetLogFileFlushInterval(const stw_types::uint32 ou32_IntervalMs);
+   stw_types::uint32 GetLogFileDroppedMessages(void) const;
 
    // Filter handling
    virtual void AddFilter(const C_OSCComMessageLoggerFilter & orc_Filter);
@@ -112,10 +117,10 @@ protected:
    virtual bool m_CheckInterpretation(C_OSCComMessageLoggerData & orc_MessageData);
 
    static void mh_InterpretCanSignalValue(stw_opensyde_core::C_OSCComMessageLoggerDataSignal & orc_Signal,
-                                          const stw_types::uint8(&orau8_CanDb)[8], const stw_types::uint8 ou8_CanDlc,
+                                          const stw_types::uint8(&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
+                                          const stw_types::uint8 ou8_CanDlc,
                                           const stw_opensyde_core::C_OSCCanSignal & orc_OscSignal,
-                                          const stw_opensyde_core::C_OSCNodeDataPoolContent & orc_OscValue,
-                                          const stw_types::float64 of64_Factor, const stw_types::float64 of64_Offset);
+                                          const stw_opensyde_core::C_OSCComMessageLoggerSignalDecoder & orc_Decoder);
 
    virtual stw_scl::C_SCLString m_GetProtocolStringHexHook(void) const;
    virtual stw_scl::C_SCLString m_GetProtocolStringDecHook(void) const;
@@ -131,16 +136,31 @@ protected:
 
    // Logging
    std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerFileBase * const> mc_LoggingFiles;
+   mutable stw_tgl::C_TGLCriticalSection mc_CriticalSectionFiles; ///< protects mc_LoggingFiles
 
 private:
    //Avoid call
    C_OSCComMessageLogger(const C_OSCComMessageLogger &);
    C_OSCComMessageLogger & operator =(const C_OSCComMessageLogger &);
 
+   ///Location of a CAN message in a registered openSYDE system definition
+   class C_OsySysDefMessageIndexEntry
+   {
+   public:
+      C_OsySysDefMessageIndexEntry(void);
+
+      const C_OSCCanMessage * pc_Message;            ///< NULL: CAN ID not defined
+      const C_OSCNodeDataPoolList * pc_DataPoolList; ///< associated COM list
+      std::vector<C_OSCComMessageLoggerSignalDecoder> c_SignalDecoders; ///< decoder for each signal of pc_Message
+   };
+
    void m_ConvertCanMessage(const stw_can::T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx);
    void m_InterpretSysDefCanSignal(C_OSCComMessageLoggerData & orc_MessageData,
-                                   const C_OSCCanSignal & orc_OscSignal) const;
+                                   const C_OSCCanSignal & orc_OscSignal,
+                                   const C_OSCComMessageLoggerSignalDecoder & orc_Decoder) const;
    void m_ResetCounter(void);
+   void m_UpdateOsySysDefIndex(void);
+   static void mh_CompileSignalDecoders(C_OsySysDefMessageIndexEntry & orc_Entry);
 
    C_OSCComMessageLoggerData mc_HandledCanMessage;
    stw_types::uint64 mu64_FirstTimeStampStart;
@@ -154,6 +174,10 @@ private:
 
    // Database interpretation
    std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerOsySysDefConfig> mc_OsySysDefs;
+   // Lookup of CAN messages of all active system definitions (see m_UpdateOsySysDefIndex)
+   std::vector<C_OsySysDefMessageIndexEntry> mc_OsySysDefIndexStandardId;                ///< index is 11bit CAN ID
+   std::map<stw_types::uint32, C_OsySysDefMessageIndexEntry> mc_OsySysDefIndexExtendedId; ///< key is 29bit CAN ID
+   const std::vector<C_OSCComMessageLoggerSignalDecoder> * mpc_OsySysDefSignalDecoders; ///< of last checked message
 
    // Filtering
    std::vector<C_OSCComMessageLoggerFilter> mc_CanFilterConfig;
@@ -162,6 +186,9 @@ private:
    // Message counting
    std::vector<stw_types::uint32> mc_MsgCounterStandardId;
    std::map<stw_types::uint32, stw_types::uint32> mc_MsgCounterExtendedId;
+
+   // Logging
+   stw_types::uint32 mu32_LogFileFlushIntervalMs;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -12,6 +12,7 @@
 
 #include <ctime> //lint !e829 //this module is specifically for Windows targets; no trouble with unspecified
 // behavior expected
+#include <cstring>
 
 #include "stwtypes.h"
 #include "stwerrors.h"
@@ -38,6 +39,40 @@ using namespace stw_opensyde_core;
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerFileAsc::C_QueuedMessage::C_QueuedMessage(void) :
+   u64_TimeStamp(0U),
+   q_IsTx(false),
+   q_CanDlcError(false),
+   u32_NumSignals(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Preallocate the texts of the slot
+
+   Copying texts up to the reserved length into the slot does not allocate memory.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::C_QueuedMessage::Reserve(void)
+{
+   uint32 u32_SignalCounter;
+
+   this->c_ProtocolName.AsStdString()->reserve(mhu32_RESERVED_NAME_LENGTH);
+   this->c_ProtocolText.AsStdString()->reserve(mhu32_RESERVED_TEXT_LENGTH);
+   this->c_Name.AsStdString()->reserve(mhu32_RESERVED_NAME_LENGTH);
+   this->c_Signals.resize(mhu32_RESERVED_SIGNALS);
+   for (u32_SignalCounter = 0U; u32_SignalCounter < mhu32_RESERVED_SIGNALS; u32_SignalCounter++)
+   {
+      this->c_Signals[u32_SignalCounter].c_Name.AsStdString()->reserve(mhu32_RESERVED_NAME_LENGTH);
+      this->c_Signals[u32_SignalCounter].c_Value.AsStdString()->reserve(mhu32_RESERVED_NAME_LENGTH);
+      this->c_Signals[u32_SignalCounter].c_Unit.AsStdString()->reserve(mhu32_RESERVED_NAME_LENGTH);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default constructor
 
@@ -53,18 +88,37 @@ C_OSCComMessageLoggerFileAsc::C_OSCComMessageLoggerFileAsc(const C_SCLString & o
                                                            const bool oq_RelativeTimeStampActive) :
    C_OSCComMessageLoggerFileBase(orc_FilePath, orc_ProtocolName),
    mq_HexActive(oq_HexActive),
-   mq_RelativeTimeStampActive(oq_RelativeTimeStampActive)
+   mq_RelativeTimeStampActive(oq_RelativeTimeStampActive),
+   mu32_QueueWriteIndex(0U),
+   mu32_QueueReadIndex(0U),
+   mu32_DroppedMessages(0U),
+   mu32_FlushIntervalMs(hu32_DEFAULT_FLUSH_INTERVAL_MS),
+   mq_StopWriter(false),
+   mq_WriterRunning(false),
+   mu32_WriteBlockUsed(0U)
 {
+   uint32 u32_Slot;
+
+   // Allocate the queue up front. The bus thread only allocates memory for texts longer than the reserved length
+   // and for messages with more than mhu32_RESERVED_SIGNALS signals (slots keep the grown capacity afterwards).
+   this->mc_Queue.resize(mhu32_QUEUE_SIZE);
+   for (u32_Slot = 0U; u32_Slot < mhu32_QUEUE_SIZE; u32_Slot++)
+   {
+      this->mc_Queue[u32_Slot].Reserve();
+   }
+   this->mc_WriteBlock.resize(mhu32_WRITE_BLOCK_SIZE);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default destructor
 
-   Writes the end line and closes the open file
+   Writes all pending messages and the end line and closes the open file
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OSCComMessageLoggerFileAsc::~C_OSCComMessageLoggerFileAsc(void)
 {
+   this->m_StopWriter();
+
    if (this->mc_File.is_open() == true)
    {
       C_SCLString c_EndLine = "End TriggerBlock";
@@ -77,6 +131,7 @@ C_OSCComMessageLoggerFileAsc::~C_OSCComMessageLoggerFileAsc(void)
 /*! \brief   Creates, if necessary, and opens file and adds the default header of the file.
 
    An already opened file will be closed and deleted.
+   After opening the file the writer thread is started.
 
    \return
    C_NO_ERR    File successfully opened and created
@@ -87,6 +142,8 @@ sint32 C_OSCComMessageLoggerFileAsc::OpenFile(void)
 {
    sint32 s32_Return;
 
+   this->m_StopWriter();
+
    if (this->mc_File.is_open() == true)
    {
       // Close the file if it is open. The previous file will be deleted
@@ -114,6 +171,10 @@ sint32 C_OSCComMessageLoggerFileAsc::OpenFile(void)
          // File was not created
          s32_Return = C_RD_WR;
       }
+      else
+      {
+         this->m_StartWriter();
+      }
    }
 
    return s32_Return;
@@ -122,116 +183,600 @@ sint32 C_OSCComMessageLoggerFileAsc::OpenFile(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Adding of a concrete CAN message to the log file
 
+   Called in the context of the thread handling the CAN messages.
+   The message is only copied into a queue slot (see constructor for preallocation); formatting and writing is done
+   by the writer thread.
+   If the queue is full the message is dropped and counted (see GetDroppedMessages).
+
    \param[in]     orc_MessageData      Current CAN message
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCComMessageLoggerFileAsc::AddMessageToFile(const C_OSCComMessageLoggerData & orc_MessageData)
 {
-   if (this->mc_File.is_open() == true)
-   {
-      uint32 u32_SignalCounter;
-      C_SCLString c_LogEntry = "   ";
-      C_SCLString c_Temp;
+   uint32 u32_WriteIndex;
+   bool q_SlotFree = false;
 
-      // Timestamp
-      if (this->mq_RelativeTimeStampActive == true)
+   this->mc_CriticalSection.Acquire();
+   u32_WriteIndex = this->mu32_QueueWriteIndex;
+   if (this->mq_WriterRunning == true)
+   {
+      if ((u32_WriteIndex - this->mu32_QueueReadIndex) < mhu32_QUEUE_SIZE)
       {
-         c_LogEntry += mh_AdaptTimeStamp(orc_MessageData.u64_TimeStampRelative);
+         q_SlotFree = true;
       }
       else
       {
-         c_LogEntry += mh_AdaptTimeStamp(orc_MessageData.u64_TimeStampAbsoluteStart);
+         // Writer can not keep up; do not block the bus thread
+         this->mu32_DroppedMessages++;
       }
+   }
+   this->mc_CriticalSection.Release();
 
-      // Channel
-      c_LogEntry += " 1 ";
+   if (q_SlotFree == true)
+   {
+      uint32 u32_SignalCounter;
+      // The slot is owned by the producer until the write index is updated
+      C_QueuedMessage & rc_Slot = this->mc_Queue[u32_WriteIndex & (mhu32_QUEUE_SIZE - 1U)];
 
-      // CAN Id
-      // ASC specification defines a width of fixed 15 chars for CAN Id. Plus one for the space to the direction
-      if (this->mq_HexActive == true)
+      rc_Slot.c_CanMsg = orc_MessageData.c_CanMsg;
+      rc_Slot.u64_TimeStamp = (this->mq_RelativeTimeStampActive == true) ?
+                              orc_MessageData.u64_TimeStampRelative : orc_MessageData.u64_TimeStampAbsoluteStart;
+      rc_Slot.q_IsTx = orc_MessageData.q_IsTx;
+      rc_Slot.q_CanDlcError = orc_MessageData.q_CanDlcError;
+      rc_Slot.c_Name = orc_MessageData.c_Name;
+
+      // Protocol interpretation
+      if (orc_MessageData.c_ProtocolTextDec != "")
       {
-         c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdHex.c_str());
+         rc_Slot.c_ProtocolName = this->mc_ProtocolName;
+         rc_Slot.c_ProtocolText = (this->mq_HexActive == true) ?
+                                  orc_MessageData.c_ProtocolTextHex : orc_MessageData.c_ProtocolTextDec;
       }
       else
       {
-         c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdDec.c_str());
+         rc_Slot.c_ProtocolText = "";
       }
-      c_LogEntry += c_Temp;
 
-      // Direction
-      // ASC specification defines a width of fixed 4 chars for direction. Plus one for the space to the next section
-      if (orc_MessageData.q_IsTx == false)
+      // Detected signals; the vector only grows so the slot strings can be reused
+      if (rc_Slot.c_Signals.size() < orc_MessageData.c_Signals.size())
       {
-         c_LogEntry += "Rx   ";
+         rc_Slot.c_Signals.resize(orc_MessageData.c_Signals.size());
       }
-      else
+      for (u32_SignalCounter = 0U; u32_SignalCounter < orc_MessageData.c_Signals.size(); u32_SignalCounter++)
+      {
+         const C_OSCComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_SignalCounter];
+         C_QueuedSignal & rc_SlotSignal = rc_Slot.c_Signals[u32_SignalCounter];
+         rc_SlotSignal.c_Name = rc_Signal.c_Name;
+         rc_SlotSignal.c_Value = rc_Signal.c_Value;
+         rc_SlotSignal.c_Unit = rc_Signal.c_Unit;
+      }
+      rc_Slot.u32_NumSignals = static_cast<uint32>(orc_MessageData.c_Signals.size());
+
+      this->mc_CriticalSection.Acquire();
+      this->mu32_QueueWriteIndex = u32_WriteIndex + 1U;
+      this->mc_CriticalSection.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the number of messages which could not be logged
+
+   Messages are dropped if the writer thread can not keep up with the CAN traffic and the queue is full.
+   This function is thread safe.
+
+   \return
+   Number of dropped messages since opening the file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileAsc::GetDroppedMessages(void) const
+{
+   uint32 u32_Return;
+
+   this->mc_CriticalSection.Acquire();
+   u32_Return = this->mu32_DroppedMessages;
+   this->mc_CriticalSection.Release();
+   return u32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Sets the interval for flushing the written data to the file
+
+   Data is written at the latest after this interval; if the block buffer is full it is written earlier.
+   This function is thread safe.
+
+   \param[in]     ou32_IntervalMs      Flush interval in ms (0: write after each processed chunk of messages)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::SetFlushInterval(const uint32 ou32_IntervalMs)
+{
+   this->mc_CriticalSection.Acquire();
+   this->mu32_FlushIntervalMs = ou32_IntervalMs;
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the interval for flushing the written data to the file
+
+   \return
+   Flush interval in ms
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileAsc::GetFlushInterval(void) const
+{
+   uint32 u32_Return;
+
+   this->mc_CriticalSection.Acquire();
+   u32_Return = this->mu32_FlushIntervalMs;
+   this->mc_CriticalSection.Release();
+   return u32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Starts the writer thread
+
+   Resets the queue and the dropped messages counter.
+   Must not be called while messages are added.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_StartWriter(void)
+{
+   this->mu32_WriteBlockUsed = 0U;
+
+   this->mc_CriticalSection.Acquire();
+   this->mu32_QueueWriteIndex = 0U;
+   this->mu32_QueueReadIndex = 0U;
+   this->mu32_DroppedMessages = 0U;
+   this->mq_StopWriter = false;
+   this->mq_WriterRunning = true;
+   this->mc_CriticalSection.Release();
+
+   this->mc_WriterThread = std::thread(&C_OSCComMessageLoggerFileAsc::m_WriterThread, this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stops the writer thread
+
+   The writer thread writes all pending messages before finishing.
+   Must not be called while messages are added.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_StopWriter(void)
+{
+   if (this->mc_WriterThread.joinable() == true)
+   {
+      this->mc_CriticalSection.Acquire();
+      this->mq_StopWriter = true;
+      this->mc_CriticalSection.Release();
+
+      this->mc_WriterThread.join();
+
+      this->mc_CriticalSection.Acquire();
+      this->mq_WriterRunning = false;
+      this->mc_CriticalSection.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Writer thread function
+
+   Formats the queued messages and writes them to the file in large blocks.
+   If the queue was empty the thread sleeps for mhu32_WRITER_WAIT_TIME_MS; the queue is large enough to hold the
+   messages of a fully loaded bus for this time.
+   The data is flushed to the file at least after the configured flush interval.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_WriterThread(void)
+{
+   uint32 u32_LastFlush = TGL_GetTickCount();
+   bool q_Stop = false;
+
+   while (q_Stop == false)
+   {
+      uint32 u32_FlushIntervalMs;
+      const uint32 u32_NumWritten = this->m_WriteQueuedMessages();
+
+      this->mc_CriticalSection.Acquire();
+      u32_FlushIntervalMs = this->mu32_FlushIntervalMs;
+      q_Stop = this->mq_StopWriter;
+      this->mc_CriticalSection.Release();
+
+      if ((TGL_GetTickCount() - u32_LastFlush) >= u32_FlushIntervalMs)
       {
-         c_LogEntry += "Tx   ";
+         this->m_WriteBlock();
+         this->mc_File.flush();
+         u32_LastFlush = TGL_GetTickCount();
       }
 
+      if ((q_Stop == false) && (u32_NumWritten == 0U))
+      {
+         TGL_Sleep(mhu32_WRITER_WAIT_TIME_MS);
+      }
+   }
+
+   // Write remaining messages
+   (void)this->m_WriteQueuedMessages();
+   this->m_WriteBlock();
+   this->mc_File.flush();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Formats all currently queued messages into the block buffer
+
+   Only called by the writer thread.
+
+   \return
+   Number of formatted messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileAsc::m_WriteQueuedMessages(void)
+{
+   uint32 u32_ReadIndex;
+   uint32 u32_WriteIndex;
+
+   this->mc_CriticalSection.Acquire();
+   u32_ReadIndex = this->mu32_QueueReadIndex;
+   u32_WriteIndex = this->mu32_QueueWriteIndex;
+   this->mc_CriticalSection.Release();
+
+   const uint32 u32_NumMessages = u32_WriteIndex - u32_ReadIndex;
+
+   while (u32_ReadIndex != u32_WriteIndex)
+   {
+      this->m_FormatMessage(this->mc_Queue[u32_ReadIndex & (mhu32_QUEUE_SIZE - 1U)]);
+      ++u32_ReadIndex;
+      // Release the slot for the producer
+      this->mc_CriticalSection.Acquire();
+      this->mu32_QueueReadIndex = u32_ReadIndex;
+      this->mc_CriticalSection.Release();
+   }
+   return u32_NumMessages;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Formats one message as ASC entry into the block buffer
+
+   \param[in]     orc_Message      Queued message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_FormatMessage(const C_QueuedMessage & orc_Message)
+{
+   uint32 u32_SignalCounter;
+
+   this->m_AppendChars("   ", 3U);
+
+   // Timestamp
+   this->m_AppendTimeStamp(orc_Message.u64_TimeStamp);
+
+   if (orc_Message.c_CanMsg.u8_FDF != 0U)
+   {
+      // CAN FD event: CANFD <channel> <dir> <id> <name> <BRS> <ESI> <DLC> <length> <data> <duration> <bits>
+      //  <flags> <CRC> <bit timing configurations>
+      this->m_AppendChars(" CANFD   1 ", 11U);
+      this->m_AppendChars((orc_Message.q_IsTx == false) ? "Rx " : "Tx ", 3U);
+      this->m_AppendCanId(orc_Message.c_CanMsg);
+      // no symbolic name; BRS; ESI; DLC (hex); data length
+      this->m_AppendSpaces(33U);
+      this->m_AppendDec(orc_Message.c_CanMsg.u8_BRS, 1U);
+      this->m_AppendChars(" ", 1U);
+      this->m_AppendDec(orc_Message.c_CanMsg.u8_ESI, 1U);
+      this->m_AppendChars(" ", 1U);
+      this->m_AppendHex(orc_Message.c_CanMsg.u8_DLC, 1U);
+      this->m_AppendChars(" ", 1U);
+      this->m_AppendDec(stw_can::STWCAN_DLCToNumBytes(orc_Message.c_CanMsg.u8_DLC, 1U), 2U);
+      this->m_AppendChars(" ", 1U);
+      this->m_AppendCanData(orc_Message.c_CanMsg);
+      // timing information is not known here; flags: EDL (+BRS, ESI)
+      this->m_AppendChars("   0 0 ", 7U);
+      this->m_AppendHex(0x1000U | ((orc_Message.c_CanMsg.u8_BRS != 0U) ? 0x2000U : 0U) |
+                        ((orc_Message.c_CanMsg.u8_ESI != 0U) ? 0x4000U : 0U), 1U);
+      this->m_AppendChars(" 0 0 0 0 0", 10U);
+   }
+   else
+   {
+      // Channel
+      this->m_AppendChars(" 1 ", 3U);
+
+      // CAN Id
+      // ASC specification defines a width of fixed 15 chars for CAN Id. Plus one for the space to the direction
+      this->m_AppendCanId(orc_Message.c_CanMsg);
+
+      // Direction
+      // ASC specification defines a width of fixed 4 chars for direction. Plus one for the space to the next
+      // section
+      this->m_AppendChars((orc_Message.q_IsTx == false) ? "Rx   " : "Tx   ", 5U);
+
       // Special case RTR
-      if (orc_MessageData.c_CanMsg.u8_RTR > 0U)
+      if (orc_Message.c_CanMsg.u8_RTR > 0U)
       {
-         c_LogEntry += "r";
+         this->m_AppendChars("r", 1U);
       }
       else
       {
          // DLC and data
-         c_LogEntry += "d " + orc_MessageData.c_CanDlc + " ";
-         if (this->mq_HexActive == true)
-         {
-            c_LogEntry += orc_MessageData.c_CanDataHex;
-         }
-         else
-         {
-            c_LogEntry += orc_MessageData.c_CanDataDec;
-         }
+         this->m_AppendChars("d ", 2U);
+         this->m_AppendDec(orc_Message.c_CanMsg.u8_DLC, 1U);
+         this->m_AppendChars(" ", 1U);
+         this->m_AppendCanData(orc_Message.c_CanMsg);
       }
+   }
 
-      // State for specified message flags are not known here
-      c_LogEntry += "\n";
+   // State for specified message flags are not known here
+   this->m_AppendChars("\n", 1U);
 
-      // Protocol interpretation
-      if (orc_MessageData.c_ProtocolTextDec != "")
+   // Protocol interpretation
+   if (orc_Message.c_ProtocolText != "")
+   {
+      this->m_AppendChars("   //", 5U);
+      this->m_AppendString(orc_Message.c_ProtocolName);
+      this->m_AppendChars(" ", 1U);
+      this->m_AppendString(orc_Message.c_ProtocolText);
+      this->m_AppendChars("\n", 1U);
+   }
+
+   // Message information
+   if (orc_Message.c_Name != "")
+   {
+      this->m_AppendChars("   //Message  ", 14U);
+      this->m_AppendString(orc_Message.c_Name);
+
+      if (orc_Message.q_CanDlcError == true)
       {
-         c_LogEntry += "   //" + this->mc_ProtocolName + " ";
-         if (this->mq_HexActive == true)
-         {
-            c_LogEntry += orc_MessageData.c_ProtocolTextHex;
-         }
-         else
-         {
-            c_LogEntry += orc_MessageData.c_ProtocolTextDec;
-         }
-         c_LogEntry += "\n";
+         this->m_AppendChars(" (DLC error)", 12U);
       }
+      this->m_AppendChars("\n", 1U);
+   }
 
-      // Message information
-      if (orc_MessageData.c_Name != "")
+   // Detected signals
+   for (u32_SignalCounter = 0U; u32_SignalCounter < orc_Message.u32_NumSignals; u32_SignalCounter++)
+   {
+      const C_QueuedSignal & rc_Signal = orc_Message.c_Signals[u32_SignalCounter];
+      this->m_AppendChars("   //Signal   ", 14U);
+      this->m_AppendString(rc_Signal.c_Name);
+      this->m_AppendChars(" = ", 3U);
+      this->m_AppendString(rc_Signal.c_Value);
+      if (rc_Signal.c_Unit != "")
       {
-         c_LogEntry += "   //Message  " + orc_MessageData.c_Name;
-
-         if (orc_MessageData.q_CanDlcError == true)
-         {
-            c_LogEntry += " (DLC error)";
-         }
-         c_LogEntry += "\n";
+         this->m_AppendChars(" ", 1U);
+         this->m_AppendString(rc_Signal.c_Unit);
       }
+      this->m_AppendChars("\n", 1U);
+   }
+}
 
-      // Detected signals
-      for (u32_SignalCounter = 0U; u32_SignalCounter < orc_MessageData.c_Signals.size(); u32_SignalCounter++)
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Writes the content of the block buffer to the file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_WriteBlock(void)
+{
+   if (this->mu32_WriteBlockUsed > 0U)
+   {
+      this->mc_File.write(&this->mc_WriteBlock[0], this->mu32_WriteBlockUsed);
+      this->mu32_WriteBlockUsed = 0U;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends text to the block buffer
+
+   If the buffer is full it is written to the file first.
+   Text not fitting into an empty buffer is written directly.
+
+   \param[in]     opcn_Text        Text to append (no termination required)
+   \param[in]     ou32_Length      Number of characters to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendChars(const charn * const opcn_Text, const uint32 ou32_Length)
+{
+   if ((this->mu32_WriteBlockUsed + ou32_Length) > mhu32_WRITE_BLOCK_SIZE)
+   {
+      this->m_WriteBlock();
+   }
+
+   if (ou32_Length > mhu32_WRITE_BLOCK_SIZE)
+   {
+      this->mc_File.write(opcn_Text, ou32_Length);
+   }
+   else
+   {
+      (void)std::memcpy(&this->mc_WriteBlock[this->mu32_WriteBlockUsed], opcn_Text, ou32_Length);
+      this->mu32_WriteBlockUsed += ou32_Length;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends string to the block buffer
+
+   \param[in]     orc_Text         Text to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendString(const C_SCLString & orc_Text)
+{
+   this->m_AppendChars(orc_Text.c_str(), orc_Text.Length());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends spaces to the block buffer
+
+   \param[in]     ou32_Count       Number of spaces
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendSpaces(const uint32 ou32_Count)
+{
+   static const charn hacn_SPACES[] = "                                        ";
+   const uint32 u32_MaxChunk = static_cast<uint32>(sizeof(hacn_SPACES) - 1U);
+   uint32 u32_Remaining = ou32_Count;
+
+   while (u32_Remaining > 0U)
+   {
+      const uint32 u32_Chunk = (u32_Remaining > u32_MaxChunk) ? u32_MaxChunk : u32_Remaining;
+      this->m_AppendChars(&hacn_SPACES[0], u32_Chunk);
+      u32_Remaining -= u32_Chunk;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends unsigned value as decimal text right aligned (padded with spaces)
+
+   \param[in]     ou64_Value       Value to append
+   \param[in]     ou32_MinWidth    Minimum number of characters
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendDec(const uint64 ou64_Value, const uint32 ou32_MinWidth)
+{
+   charn acn_Text[24];
+   const uint32 u32_Length = mh_UnsignedToText(ou64_Value, 10U, acn_Text);
+
+   if (u32_Length < ou32_MinWidth)
+   {
+      this->m_AppendSpaces(ou32_MinWidth - u32_Length);
+   }
+   this->m_AppendChars(&acn_Text[0], u32_Length);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends unsigned value as upper case hexadecimal text (padded with leading zeros)
+
+   \param[in]     ou32_Value       Value to append
+   \param[in]     ou32_MinDigits   Minimum number of digits
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendHex(const uint32 ou32_Value, const uint32 ou32_MinDigits)
+{
+   charn acn_Text[24];
+   const uint32 u32_Length = mh_UnsignedToText(ou32_Value, 16U, acn_Text);
+   uint32 u32_Counter;
+
+   for (u32_Counter = u32_Length; u32_Counter < ou32_MinDigits; u32_Counter++)
+   {
+      this->m_AppendChars("0", 1U);
+   }
+   this->m_AppendChars(&acn_Text[0], u32_Length);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends CAN identifier in configured format with fixed width of 16 characters
+
+   \param[in]     orc_CanMsg       CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendCanId(const stw_can::T_STWCAN_Msg_RX & orc_CanMsg)
+{
+   charn acn_Text[24];
+   uint32 u32_Length = mh_UnsignedToText(orc_CanMsg.u32_ID, (this->mq_HexActive == true) ? 16U : 10U, acn_Text);
+
+   if (orc_CanMsg.u8_XTD > 0U)
+   {
+      // Extended Id
+      acn_Text[u32_Length] = 'x';
+      ++u32_Length;
+   }
+   this->m_AppendChars(&acn_Text[0], u32_Length);
+   if (u32_Length < 16U)
+   {
+      this->m_AppendSpaces(16U - u32_Length);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends CAN data bytes in configured format
+
+   Hexadecimal: two digits per byte; decimal: three characters per byte; bytes separated by one space
+
+   \param[in]     orc_CanMsg       CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendCanData(const stw_can::T_STWCAN_Msg_RX & orc_CanMsg)
+{
+   const uint8 u8_NumBytes = stw_can::STWCAN_DLCToNumBytes(orc_CanMsg.u8_DLC, orc_CanMsg.u8_FDF);
+   uint8 u8_DbCounter;
+
+   for (u8_DbCounter = 0U; u8_DbCounter < u8_NumBytes; ++u8_DbCounter)
+   {
+      if (u8_DbCounter > 0U)
       {
-         const C_OSCComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_SignalCounter];
-         c_LogEntry += "   //Signal   " + rc_Signal.c_Name + " = " + rc_Signal.c_Value;
-         if (rc_Signal.c_Unit != "")
-         {
-            c_LogEntry += " " + rc_Signal.c_Unit;
-         }
-         c_LogEntry += "\n";
+         this->m_AppendChars(" ", 1U);
       }
+      if (this->mq_HexActive == true)
+      {
+         this->m_AppendHex(orc_CanMsg.au8_Data[u8_DbCounter], 2U);
+      }
+      else
+      {
+         this->m_AppendDec(orc_CanMsg.au8_Data[u8_DbCounter], 3U);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends a timestamp in a format based on seconds
+
+   Examples for format:
+   " 0.000001"
+   "10.000000"
+   "1000.001230"
+
+   \param[in]  ou64_TimeStamp     Timestamp in us
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAsc::m_AppendTimeStamp(const uint64 ou64_TimeStamp)
+{
+   charn acn_Text[24];
+   const uint32 u32_Length = mh_UnsignedToText(ou64_TimeStamp / 1000000ULL, 10U, acn_Text);
+   uint32 u32_Micro = static_cast<uint32>(ou64_TimeStamp % 1000000ULL);
+   uint32 u32_Digit;
 
-      this->mc_File.write(c_LogEntry.c_str(), c_LogEntry.Length());
+   // Total width of at least 9 characters: seconds, dot and 6 digits of microseconds
+   if ((u32_Length + 7U) < 9U)
+   {
+      this->m_AppendSpaces(9U - (u32_Length + 7U));
    }
+   this->m_AppendChars(&acn_Text[0], u32_Length);
+
+   acn_Text[0] = '.';
+   for (u32_Digit = 6U; u32_Digit > 0U; u32_Digit--)
+   {
+      acn_Text[u32_Digit] = static_cast<charn>('0' + static_cast<charn>(u32_Micro % 10U));
+      u32_Micro /= 10U;
+   }
+   this->m_AppendChars(&acn_Text[0], 7U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Converts unsigned value to text without allocating memory
+
+   Hexadecimal digits are upper case. The text is not zero terminated.
+
+   \param[in]     ou64_Value       Value to convert
+   \param[in]     ou32_Base        Base (10 or 16)
+   \param[out]    oracn_Text       Resulting text
+
+   \return
+   Number of characters in oracn_Text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileAsc::mh_UnsignedToText(uint64 ou64_Value, const uint32 ou32_Base,
+                                                       charn (&oracn_Text)[24])
+{
+   static const charn hacn_DIGITS[] = "0123456789ABCDEF";
+   charn acn_Reverse[24];
+   uint32 u32_Length = 0U;
+   uint32 u32_Counter;
+
+   do
+   {
+      acn_Reverse[u32_Length] = hacn_DIGITS[ou64_Value % ou32_Base];
+      ou64_Value /= ou32_Base;
+      ++u32_Length;
+   }
+   while (ou64_Value > 0U);
+
+   for (u32_Counter = 0U; u32_Counter < u32_Length; u32_Counter++)
+   {
+      oracn_Text[u32_Counter] = acn_Reverse[(u32_Length - 1U) - u32_Counter];
+   }
+
+   return u32_Length;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -427,28 +972,3 @@ C_SCLString C_OSCComMessageLoggerFileAsc::mh_GetMonth(const sintn osn_Month)
 
    return c_Month;
 }
-
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Adapts a timestamp in a string in a format based on seconds
-
-   Examples for format:
-   " 0.000001"
-   "10.000000"
-   "1000.00123"
-
-   \param[in]  ou64_TimeStamp     Timestamp in us
-
-   \return
-   Adapted string
-*/
-//----------------------------------------------------------------------------------------------------------------------
-C_SCLString C_OSCComMessageLoggerFileAsc::mh_AdaptTimeStamp(const uint64 ou64_TimeStamp)
-{
-   C_SCLString c_TimeStamp;
-
-   c_TimeStamp.PrintFormatted("%d.%.6d", static_cast<sintn>(ou64_TimeStamp / 1000000ULL),
-                              static_cast<sintn>(ou64_TimeStamp % 1000000ULL));
-   c_TimeStamp.PrintFormatted("%9s", c_TimeStamp.c_str());
-
-   return c_TimeStamp;
-}
@@ -13,8 +13,11 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <fstream>
+#include <vector>
+#include <thread>
 
 #include "CSCLString.h"
+#include "TGLTasks.h"
 
 #include "C_OSCComMessageLoggerFileBase.h"
 
@@ -36,21 +39,99 @@ public:
 
    virtual stw_types::sint32 OpenFile(void);
    virtual void AddMessageToFile(const C_OSCComMessageLoggerData & orc_MessageData);
+   virtual stw_types::uint32 GetDroppedMessages(void) const;
+
+   void SetFlushInterval(const stw_types::uint32 ou32_IntervalMs);
+   stw_types::uint32 GetFlushInterval(void) const;
+
+   static const stw_types::uint32 hu32_DEFAULT_FLUSH_INTERVAL_MS = 1000U;
 
 private:
+   ///Signal texts of one queued message
+   class C_QueuedSignal
+   {
+   public:
+      stw_scl::C_SCLString c_Name;
+      stw_scl::C_SCLString c_Value;
+      stw_scl::C_SCLString c_Unit;
+   };
+
+   ///One queued message; slots are reused so the strings keep their capacity
+   class C_QueuedMessage
+   {
+   public:
+      C_QueuedMessage(void);
+
+      void Reserve(void);
+
+      stw_can::T_STWCAN_Msg_RX c_CanMsg;
+      stw_types::uint64 u64_TimeStamp; ///< relative or absolute time stamp depending on configuration
+      bool q_IsTx;
+      bool q_CanDlcError;
+      stw_scl::C_SCLString c_ProtocolName; ///< only valid if c_ProtocolText is not empty
+      stw_scl::C_SCLString c_ProtocolText;
+      stw_scl::C_SCLString c_Name;
+      std::vector<C_QueuedSignal> c_Signals; ///< not shrunk; only the first u32_NumSignals entries are valid
+      stw_types::uint32 u32_NumSignals;
+   };
+
    //Avoid call
    C_OSCComMessageLoggerFileAsc(const C_OSCComMessageLoggerFileAsc &);
    C_OSCComMessageLoggerFileAsc & operator =(const C_OSCComMessageLoggerFileAsc &);
 
+   static const stw_types::uint32 mhu32_QUEUE_SIZE = 4096U;          ///< must be a power of two
+   static const stw_types::uint32 mhu32_WRITE_BLOCK_SIZE = 262144U;  ///< size of block written to file at once
+   static const stw_types::uint32 mhu32_WRITER_WAIT_TIME_MS = 20U;   ///< time the writer sleeps if idle
+   static const stw_types::uint32 mhu32_RESERVED_NAME_LENGTH = 64U;  ///< preallocated chars of names and units
+   static const stw_types::uint32 mhu32_RESERVED_TEXT_LENGTH = 128U; ///< preallocated chars of protocol texts
+   static const stw_types::uint32 mhu32_RESERVED_SIGNALS = 8U;       ///< preallocated signals per slot
+
+   void m_StartWriter(void);
+   void m_StopWriter(void);
+   void m_WriterThread(void);
+   stw_types::uint32 m_WriteQueuedMessages(void);
+   void m_FormatMessage(const C_QueuedMessage & orc_Message);
+   void m_WriteBlock(void);
+
+   void m_AppendChars(const stw_types::charn * const opcn_Text, const stw_types::uint32 ou32_Length);
+   void m_AppendString(const stw_scl::C_SCLString & orc_Text);
+   void m_AppendSpaces(const stw_types::uint32 ou32_Count);
+   void m_AppendDec(const stw_types::uint64 ou64_Value, const stw_types::uint32 ou32_MinWidth);
+   void m_AppendHex(const stw_types::uint32 ou32_Value, const stw_types::uint32 ou32_MinDigits);
+   void m_AppendCanId(const stw_can::T_STWCAN_Msg_RX & orc_CanMsg);
+   void m_AppendCanData(const stw_can::T_STWCAN_Msg_RX & orc_CanMsg);
+   void m_AppendTimeStamp(const stw_types::uint64 ou64_TimeStamp);
+   static stw_types::uint32 mh_UnsignedToText(stw_types::uint64 ou64_Value, const stw_types::uint32 ou32_Base,
+                                              stw_types::charn (&oracn_Text)[24]);
+
    void m_WriteHeader(void);
    static stw_scl::C_SCLString mh_GetAscTimeString(void);
    static stw_scl::C_SCLString mh_GetDay(const stw_types::sintn osn_Day);
    static stw_scl::C_SCLString mh_GetMonth(const stw_types::sintn osn_Month);
-   static stw_scl::C_SCLString mh_AdaptTimeStamp(const stw_types::uint64 ou64_TimeStamp);
 
    const bool mq_HexActive;
    const bool mq_RelativeTimeStampActive;
    std::ofstream mc_File;
+
+   //single producer (bus thread) / single consumer (writer thread) message queue
+   //the slots are filled and formatted outside of mc_CriticalSection; it only protects the members below, so
+   // neither thread waits for the other one longer than an index update
+   std::vector<C_QueuedMessage> mc_Queue;
+   mutable stw_tgl::C_TGLCriticalSection mc_CriticalSection;
+   stw_types::uint32 mu32_QueueWriteIndex; ///< next slot to write; only modified by producer
+   stw_types::uint32 mu32_QueueReadIndex;  ///< next slot to read; only modified by writer thread
+   stw_types::uint32 mu32_DroppedMessages; ///< messages not logged because the queue was full
+   stw_types::uint32 mu32_FlushIntervalMs;
+   bool mq_StopWriter;
+   bool mq_WriterRunning; ///< only modified while no messages are added
+
+   //writer thread
+   //TGL has no thread abstraction and the core library must not depend on Qt, so the standard thread is used
+   std::thread mc_WriterThread;
+
+   //block buffer; only used by the writer thread while it is running
+   std::vector<stw_types::charn> mc_WriteBlock;
+   stw_types::uint32 mu32_WriteBlockUsed;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -0,0 +1,554 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to read CAN messages from an ASC log file (implementation)
+
+   Reads the CAN and CAN FD message events of a Vector ASC file as written by C_OSCComMessageLoggerFileAsc.
+   All other events (error frames, statistics, comments, interpretation lines, ...) are skipped.
+   Intended as replay source for C_CAN_Replay.
+
+   Supported lines:
+   <time> <channel> <id>[x] <Rx|Tx> d <dlc> <data bytes>
+   <time> <channel> <id>[x] <Rx|Tx> r
+   <time> CANFD <channel> <Rx|Tx> <id>[x] [<name>] <BRS> <ESI> <dlc> <data length> <data bytes> ...
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "C_OSCComMessageLoggerFileAscReader.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_can;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerFileAscReader::C_OSCComMessageLoggerFileAscReader(void) :
+   mq_HexActive(true),
+   mq_RelativeTimeStamps(false),
+   mu64_LastTimeStamp(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerFileAscReader::~C_OSCComMessageLoggerFileAscReader(void)
+{
+   this->Close();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Open ASC file
+
+   An already opened file will be closed.
+
+   \param[in]     orc_FilePath     Path of ASC file
+
+   \return
+   C_NO_ERR    File opened
+   C_RD_WR     File could not be opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileAscReader::Open(const C_SCLString & orc_FilePath)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   this->Close();
+   this->mc_File.open(orc_FilePath.c_str(), std::ios::in | std::ios::binary);
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      s32_Return = this->Restart();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Close file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAscReader::Close(void)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      this->mc_File.close();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if a file is opened
+
+   \return
+   true     file opened
+   false    no file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::IsOpen(void) const
+{
+   return this->mc_File.is_open();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read next CAN message from file
+
+   Lines which are no CAN message events are skipped.
+
+   \param[out]    orc_Message      CAN message with time stamp of file (absolute; in us)
+   \param[out]    orq_IsTx         true: message was sent by the logging application
+
+   \return
+   C_NO_ERR    message read
+   C_NOACT     no more messages
+   C_CONFIG    no file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileAscReader::ReadNextMessage(T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   if (this->mc_File.is_open() == true)
+   {
+      s32_Return = C_NOACT;
+      while ((s32_Return == C_NOACT) && (std::getline(this->mc_File, this->mc_Line)))
+      {
+         this->m_SplitLine();
+         //a message event has at least 5 tokens; the first one is the time stamp
+         if ((this->mc_Tokens.size() >= 5U) &&
+             (mh_ParseTimeStamp(this->mc_Tokens[0], orc_Message.u64_TimeStamp) == true))
+         {
+            bool q_Valid;
+            if (std::strcmp(this->mc_Tokens[1], "CANFD") == 0)
+            {
+               q_Valid = this->m_ParseCanFdLine(orc_Message, orq_IsTx);
+            }
+            else
+            {
+               q_Valid = this->m_ParseCanLine(orc_Message, orq_IsTx);
+            }
+
+            //all events are relevant for relative time stamps
+            if (this->mq_RelativeTimeStamps == true)
+            {
+               orc_Message.u64_TimeStamp += this->mu64_LastTimeStamp;
+            }
+            this->mu64_LastTimeStamp = orc_Message.u64_TimeStamp;
+
+            if (q_Valid == true)
+            {
+               s32_Return = C_NO_ERR;
+            }
+         }
+         else
+         {
+            (void)this->m_ParseHeaderLine();
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Restart reading at the beginning of the file
+
+   \return
+   C_NO_ERR    restarted
+   C_CONFIG    no file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileAscReader::Restart(void)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   if (this->mc_File.is_open() == true)
+   {
+      this->mc_File.clear();
+      this->mc_File.seekg(0, std::ios::beg);
+      //defaults of ASC format; overwritten by "base" line
+      this->mq_HexActive = true;
+      this->mq_RelativeTimeStamps = false;
+      this->mu64_LastTimeStamp = 0U;
+      s32_Return = C_NO_ERR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Split current line into tokens
+
+   The separators in mc_Line are replaced by zero termination; mc_Tokens points to the tokens.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileAscReader::m_SplitLine(void)
+{
+   uint32 u32_Pos = 0U;
+   const uint32 u32_Length = static_cast<uint32>(this->mc_Line.size());
+
+   this->mc_Tokens.clear();
+   while (u32_Pos < u32_Length)
+   {
+      //skip separators (also '\r' of files with Windows line endings)
+      while ((u32_Pos < u32_Length) && (std::isspace(static_cast<uint8>(this->mc_Line[u32_Pos])) != 0))
+      {
+         this->mc_Line[u32_Pos] = '\0';
+         ++u32_Pos;
+      }
+      if (u32_Pos < u32_Length)
+      {
+         this->mc_Tokens.push_back(&this->mc_Line[u32_Pos]);
+         while ((u32_Pos < u32_Length) && (std::isspace(static_cast<uint8>(this->mc_Line[u32_Pos])) == 0))
+         {
+            ++u32_Pos;
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Evaluate header line "base <hex|dec> timestamps <absolute|relative>"
+
+   \return
+   true     line was a base line
+   false    line ignored
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::m_ParseHeaderLine(void)
+{
+   bool q_Return = false;
+
+   if ((this->mc_Tokens.size() >= 2U) && (std::strcmp(this->mc_Tokens[0], "base") == 0))
+   {
+      this->mq_HexActive = (std::strcmp(this->mc_Tokens[1], "dec") != 0);
+      if ((this->mc_Tokens.size() >= 4U) && (std::strcmp(this->mc_Tokens[2], "timestamps") == 0))
+      {
+         this->mq_RelativeTimeStamps = (std::strcmp(this->mc_Tokens[3], "relative") == 0);
+      }
+      q_Return = true;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse classic CAN message line
+
+   Format: <time> <channel> <id>[x] <Rx|Tx> <d <dlc> <data bytes>|r>
+
+   \param[out]    orc_Message      CAN message (time stamp not touched)
+   \param[out]    orq_IsTx         true: message was sent
+
+   \return
+   true     line is a valid CAN message event
+   false    other event
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::m_ParseCanLine(T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx) const
+{
+   uint32 u32_Channel;
+   bool q_Return = false;
+
+   if ((mh_ParseUnsigned(this->mc_Tokens[1], 10, u32_Channel) == true) &&
+       (this->m_ParseId(this->mc_Tokens[2], orc_Message) == true) &&
+       (mh_ParseDirection(this->mc_Tokens[3], orq_IsTx) == true))
+   {
+      orc_Message.u8_FDF = 0U;
+      orc_Message.u8_BRS = 0U;
+      orc_Message.u8_ESI = 0U;
+      if (std::strcmp(this->mc_Tokens[4], "r") == 0)
+      {
+         uint32 u32_Dlc = 0U;
+         //optional DLC of remote frame
+         if (this->mc_Tokens.size() >= 6U)
+         {
+            (void)mh_ParseUnsigned(this->mc_Tokens[5], 10, u32_Dlc);
+         }
+         orc_Message.u8_RTR = 1U;
+         orc_Message.u8_DLC = static_cast<uint8>(u32_Dlc & 0x0FU);
+         q_Return = true;
+      }
+      else if ((std::strcmp(this->mc_Tokens[4], "d") == 0) && (this->mc_Tokens.size() >= 6U))
+      {
+         uint32 u32_Dlc;
+         //the DLC of classic CAN messages is always decimal
+         if ((mh_ParseUnsigned(this->mc_Tokens[5], 10, u32_Dlc) == true) && (u32_Dlc <= 0x0FU))
+         {
+            orc_Message.u8_RTR = 0U;
+            orc_Message.u8_DLC = static_cast<uint8>(u32_Dlc);
+            q_Return = this->m_ParseData(6U, STWCAN_DLCToNumBytes(orc_Message.u8_DLC, 0U), orc_Message);
+         }
+      }
+      else
+      {
+         // Nothing to do
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse CAN FD message line
+
+   Format: <time> CANFD <channel> <Rx|Tx> <id>[x] [<name>] <BRS> <ESI> <dlc> <data length> <data bytes> ...
+
+   \param[out]    orc_Message      CAN message (time stamp not touched)
+   \param[out]    orq_IsTx         true: message was sent
+
+   \return
+   true     line is a valid CAN FD message event
+   false    other event
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::m_ParseCanFdLine(T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx) const
+{
+   uint32 u32_Channel;
+   bool q_Return = false;
+
+   if ((this->mc_Tokens.size() >= 9U) &&
+       (mh_ParseUnsigned(this->mc_Tokens[2], 10, u32_Channel) == true) &&
+       (mh_ParseDirection(this->mc_Tokens[3], orq_IsTx) == true) &&
+       (this->m_ParseId(this->mc_Tokens[4], orc_Message) == true))
+   {
+      uint32 u32_Token = 5U;
+      uint32 u32_Brs;
+      uint32 u32_Esi;
+      uint32 u32_Dlc;
+      uint32 u32_Length;
+
+      //optional symbolic name
+      if (mh_ParseUnsigned(this->mc_Tokens[u32_Token], 10, u32_Brs) == false)
+      {
+         ++u32_Token;
+      }
+      if (((u32_Token + 4U) <= this->mc_Tokens.size()) &&
+          (mh_ParseUnsigned(this->mc_Tokens[u32_Token], 10, u32_Brs) == true) &&
+          (mh_ParseUnsigned(this->mc_Tokens[u32_Token + 1U], 10, u32_Esi) == true) &&
+          (mh_ParseUnsigned(this->mc_Tokens[u32_Token + 2U], 16, u32_Dlc) == true) &&
+          (mh_ParseUnsigned(this->mc_Tokens[u32_Token + 3U], 10, u32_Length) == true) &&
+          (u32_Dlc <= 0x0FU))
+      {
+         orc_Message.u8_FDF = 1U;
+         orc_Message.u8_BRS = (u32_Brs != 0U) ? 1U : 0U;
+         orc_Message.u8_ESI = (u32_Esi != 0U) ? 1U : 0U;
+         orc_Message.u8_RTR = 0U;
+         orc_Message.u8_DLC = static_cast<uint8>(u32_Dlc);
+         q_Return = this->m_ParseData(u32_Token + 4U, STWCAN_DLCToNumBytes(orc_Message.u8_DLC, 1U), orc_Message);
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse CAN identifier in configured base
+
+   Extended identifiers have a trailing 'x'.
+
+   \param[in]     opcn_Token       token to parse
+   \param[out]    orc_Message      CAN message (ID and XTD flag set)
+
+   \return
+   true     valid identifier
+   false    no identifier
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::m_ParseId(const charn * const opcn_Token, T_STWCAN_Msg_RX & orc_Message) const
+{
+   charn * pcn_End = NULL;
+   bool q_Return = false;
+   const uint32 u32_Id =
+      static_cast<uint32>(std::strtoul(opcn_Token, &pcn_End, (this->mq_HexActive == true) ? 16 : 10));
+
+   if (pcn_End != opcn_Token)
+   {
+      if (*pcn_End == '\0')
+      {
+         orc_Message.u8_XTD = 0U;
+         q_Return = (u32_Id <= 0x7FFU);
+      }
+      else if (((*pcn_End == 'x') || (*pcn_End == 'X')) && (pcn_End[1] == '\0'))
+      {
+         orc_Message.u8_XTD = 1U;
+         q_Return = (u32_Id <= 0x1FFFFFFFU);
+      }
+      else
+      {
+         // Nothing to do
+      }
+      orc_Message.u32_ID = u32_Id;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse data bytes in configured base
+
+   Bytes not present in the line are set to zero.
+
+   \param[in]     ou32_FirstToken  index of token with first data byte
+   \param[in]     ou8_NumBytes     number of data bytes
+   \param[out]    orc_Message      CAN message (data set)
+
+   \return
+   true     all bytes parsed
+   false    missing or invalid bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::m_ParseData(const uint32 ou32_FirstToken, const uint8 ou8_NumBytes,
+                                                     T_STWCAN_Msg_RX & orc_Message) const
+{
+   const sintn sn_Base = (this->mq_HexActive == true) ? 16 : 10;
+   bool q_Return = ((ou32_FirstToken + ou8_NumBytes) <= this->mc_Tokens.size());
+   uint8 u8_Byte;
+
+   (void)std::memset(&orc_Message.au8_Data[0], 0, sizeof(orc_Message.au8_Data));
+   for (u8_Byte = 0U; (u8_Byte < ou8_NumBytes) && (q_Return == true); ++u8_Byte)
+   {
+      uint32 u32_Value;
+      q_Return = ((mh_ParseUnsigned(this->mc_Tokens[ou32_FirstToken + u8_Byte], sn_Base, u32_Value) == true) &&
+                  (u32_Value <= 0xFFU));
+      orc_Message.au8_Data[u8_Byte] = static_cast<uint8>(u32_Value);
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse time stamp in seconds with up to 9 decimal places
+
+   \param[in]     opcn_Token       token to parse (e.g. "12.345678")
+   \param[out]    oru64_TimeStamp  time stamp in us
+
+   \return
+   true     valid time stamp
+   false    no time stamp
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::mh_ParseTimeStamp(const charn * const opcn_Token, uint64 & oru64_TimeStamp)
+{
+   const charn * pcn_Char = opcn_Token;
+   uint64 u64_Seconds = 0U;
+   uint64 u64_Micro = 0U;
+   uint32 u32_NumDigits = 0U;
+   bool q_Return = false;
+
+   while ((*pcn_Char >= '0') && (*pcn_Char <= '9'))
+   {
+      u64_Seconds = (u64_Seconds * 10U) + static_cast<uint64>(*pcn_Char - '0');
+      ++pcn_Char;
+      ++u32_NumDigits;
+   }
+   if ((u32_NumDigits > 0U) && (*pcn_Char == '.'))
+   {
+      uint32 u32_Decimals = 0U;
+      ++pcn_Char;
+      while ((*pcn_Char >= '0') && (*pcn_Char <= '9'))
+      {
+         //resolution of time stamp is 1us; further decimal places are ignored
+         if (u32_Decimals < 6U)
+         {
+            u64_Micro = (u64_Micro * 10U) + static_cast<uint64>(*pcn_Char - '0');
+         }
+         ++u32_Decimals;
+         ++pcn_Char;
+      }
+      for (; u32_Decimals < 6U; ++u32_Decimals)
+      {
+         u64_Micro *= 10U;
+      }
+      if (*pcn_Char == '\0')
+      {
+         oru64_TimeStamp = (u64_Seconds * 1000000ULL) + u64_Micro;
+         q_Return = true;
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse complete token as unsigned value
+
+   \param[in]     opcn_Token       token to parse
+   \param[in]     osn_Base         base (10 or 16)
+   \param[out]    oru32_Value      value
+
+   \return
+   true     valid number
+   false    no number
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::mh_ParseUnsigned(const charn * const opcn_Token, const sintn osn_Base,
+                                                          uint32 & oru32_Value)
+{
+   charn * pcn_End = NULL;
+
+   oru32_Value = static_cast<uint32>(std::strtoul(opcn_Token, &pcn_End, osn_Base));
+   return ((pcn_End != opcn_Token) && (*pcn_End == '\0'));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse direction token
+
+   \param[in]     opcn_Token       token to parse
+   \param[out]    orq_IsTx         true: "Tx"; false: "Rx"
+
+   \return
+   true     valid direction
+   false    no direction
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileAscReader::mh_ParseDirection(const charn * const opcn_Token, bool & orq_IsTx)
+{
+   bool q_Return = true;
+
+   if (std::strcmp(opcn_Token, "Rx") == 0)
+   {
+      orq_IsTx = false;
+   }
+   else if (std::strcmp(opcn_Token, "Tx") == 0)
+   {
+      orq_IsTx = true;
+   }
+   else
+   {
+      q_Return = false;
+   }
+
+   return q_Return;
+}
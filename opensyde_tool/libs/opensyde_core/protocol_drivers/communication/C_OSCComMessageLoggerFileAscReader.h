@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to read CAN messages from an ASC log file (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMMESSAGELOGGERFILEASCREADER_H
+#define C_OSCCOMMESSAGELOGGERFILEASCREADER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "stwtypes.h"
+#include "stw_can.h"
+#include "CSCLString.h"
+#include "CCANReplay.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OSCComMessageLoggerFileAscReader :
+   public stw_can::C_CAN_ReplaySource
+{
+public:
+   C_OSCComMessageLoggerFileAscReader(void);
+   virtual ~C_OSCComMessageLoggerFileAscReader(void);
+
+   stw_types::sint32 Open(const stw_scl::C_SCLString & orc_FilePath);
+   void Close(void);
+   bool IsOpen(void) const;
+
+   virtual stw_types::sint32 ReadNextMessage(stw_can::T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx);
+   virtual stw_types::sint32 Restart(void);
+
+private:
+   //Avoid call
+   C_OSCComMessageLoggerFileAscReader(const C_OSCComMessageLoggerFileAscReader &);
+   C_OSCComMessageLoggerFileAscReader & operator =(const C_OSCComMessageLoggerFileAscReader &);
+
+   void m_SplitLine(void);
+   bool m_ParseHeaderLine(void);
+   bool m_ParseCanLine(stw_can::T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx) const;
+   bool m_ParseCanFdLine(stw_can::T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx) const;
+   bool m_ParseId(const stw_types::charn * const opcn_Token, stw_can::T_STWCAN_Msg_RX & orc_Message) const;
+   bool m_ParseData(const stw_types::uint32 ou32_FirstToken, const stw_types::uint8 ou8_NumBytes,
+                    stw_can::T_STWCAN_Msg_RX & orc_Message) const;
+
+   static bool mh_ParseTimeStamp(const stw_types::charn * const opcn_Token, stw_types::uint64 & oru64_TimeStamp);
+   static bool mh_ParseUnsigned(const stw_types::charn * const opcn_Token, const stw_types::sintn osn_Base,
+                                stw_types::uint32 & oru32_Value);
+   static bool mh_ParseDirection(const stw_types::charn * const opcn_Token, bool & orq_IsTx);
+
+   std::ifstream mc_File;
+   std::string mc_Line;                             ///< current line; reused to avoid allocations
+   std::vector<const stw_types::charn *> mc_Tokens; ///< tokens of current line (pointing into mc_Line)
+   bool mq_HexActive;                               ///< CAN ID and data are hexadecimal
+   bool mq_RelativeTimeStamps;                      ///< time stamps are relative to the previous event
+   stw_types::uint64 mu64_LastTimeStamp;            ///< absolute time stamp of previous event
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
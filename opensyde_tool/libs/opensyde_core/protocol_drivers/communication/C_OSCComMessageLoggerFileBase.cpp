@@ -100,6 +100,20 @@ sint32 C_OSCComMessageLoggerFileBase::OpenFile(void)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the number of messages which could not be logged
+
+   Base implementation for writers without message queue: no messages are dropped
+
+   \return
+   Number of dropped messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileBase::GetDroppedMessages(void) const
+{
+   return 0U;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Sets the current protocol name
 
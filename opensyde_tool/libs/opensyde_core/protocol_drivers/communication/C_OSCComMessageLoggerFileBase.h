@@ -31,6 +31,7 @@ public:
 
    virtual stw_types::sint32 OpenFile(void);
    virtual void AddMessageToFile(const C_OSCComMessageLoggerData & orc_MessageData) = 0;
+   virtual stw_types::uint32 GetDroppedMessages(void) const;
 
    void SetProtocolName(const stw_scl::C_SCLString & orc_ProtocolName);
 
@@ -0,0 +1,382 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to write a CAN log file in the compact openSYDE binary trace format (implementation)
+
+   Append-only format with fixed-size records grouped in chunks.
+   Each chunk header contains the number of records, the time range and a bitmap of the contained CAN IDs.
+   So a reader can seek by time and skip chunks not containing a requested ID without touching the records
+   (see C_OSCComMessageLoggerFileBinReader).
+
+   Records are collected in a preallocated chunk buffer and written to the file when the chunk is full, when the
+   flush interval elapsed since the first record of the chunk was added or when the file is closed.
+   No memory is allocated per message.
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cstring>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "C_OSCComMessageLoggerFileBin.h"
+#include "TGLFile.h"
+#include "TGLTime.h"
+#include "C_OSCComMessageLoggerFileAsc.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_tgl;
+using namespace stw_can;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint8 C_OSCComMessageLoggerFileBin::hau8_FILE_MAGIC[8] =
+{
+   static_cast<uint8>('O'), static_cast<uint8>('S'), static_cast<uint8>('Y'), static_cast<uint8>('T'),
+   static_cast<uint8>('R'), static_cast<uint8>('A'), static_cast<uint8>('C'), static_cast<uint8>('E')
+};
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   \param[in]  orc_FilePath       Path for file
+   \param[in]  orc_ProtocolName   Name of current set protocol (not stored in binary trace)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerFileBin::C_OSCComMessageLoggerFileBin(const C_SCLString & orc_FilePath,
+                                                           const C_SCLString & orc_ProtocolName) :
+   C_OSCComMessageLoggerFileBase(orc_FilePath, orc_ProtocolName),
+   mu32_NumRecordsInChunk(0U),
+   mu64_ChunkMinTimeStamp(0U),
+   mu64_ChunkMaxTimeStamp(0U),
+   mu32_ChunkStartTimeMs(0U),
+   mu32_FlushIntervalMs(C_OSCComMessageLoggerFileAsc::hu32_DEFAULT_FLUSH_INTERVAL_MS)
+{
+   this->mc_Chunk.resize(hu32_CHUNK_HEADER_SIZE + (hu32_RECORDS_PER_CHUNK * hu32_RECORD_SIZE), 0U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+
+   Writes the last chunk and closes the open file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerFileBin::~C_OSCComMessageLoggerFileBin(void)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      this->m_WriteChunk();
+      this->mc_File.close();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Creates, if necessary, and opens file and adds the file header.
+
+   An already opened file will be closed and deleted.
+
+   \return
+   C_NO_ERR    File successfully opened and created
+   C_RD_WR     Error on creating file, folders or deleting old file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBin::OpenFile(void)
+{
+   sint32 s32_Return;
+
+   if (this->mc_File.is_open() == true)
+   {
+      // Close the file if it is open. The previous file will be deleted
+      this->mc_File.close();
+   }
+   this->mu32_NumRecordsInChunk = 0U;
+
+   if (this->mc_FilePath.SubString(this->mc_FilePath.Length() - 4U, 5U).LowerCase() != ".osyt")
+   {
+      // Missing file extension
+      this->mc_FilePath += ".osyt";
+   }
+
+   s32_Return = C_OSCComMessageLoggerFileBase::OpenFile();
+
+   if (s32_Return == C_NO_ERR)
+   {
+      this->mc_File.open(this->mc_FilePath.c_str(), std::ios::binary | std::ios::trunc);
+
+      if ((this->mc_File.is_open() == false) || (TGL_FileExists(this->mc_FilePath) == false))
+      {
+         // File was not created
+         s32_Return = C_RD_WR;
+      }
+      else
+      {
+         uint8 au8_Header[hu32_FILE_HEADER_SIZE];
+
+         (void)std::memset(&au8_Header[0], 0, sizeof(au8_Header));
+         (void)std::memcpy(&au8_Header[0], &hau8_FILE_MAGIC[0], sizeof(hau8_FILE_MAGIC));
+         h_SetU16(&au8_Header[8], hu16_FILE_VERSION);
+         h_SetU16(&au8_Header[10], static_cast<uint16>(hu32_RECORD_SIZE));
+         h_SetU32(&au8_Header[12], hu32_CHUNK_HEADER_SIZE);
+         h_SetU32(&au8_Header[16], hu32_RECORDS_PER_CHUNK);
+         this->mc_File.write(reinterpret_cast<const charn *>(&au8_Header[0]), sizeof(au8_Header));
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Adding of a concrete CAN message to the log file
+
+   Only the raw CAN message is stored; interpretations are not part of the binary trace.
+
+   \param[in]     orc_MessageData      Current CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::AddMessageToFile(const C_OSCComMessageLoggerData & orc_MessageData)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      const uint32 u32_BitIndex = h_GetIdBitmapIndex(orc_MessageData.c_CanMsg.u32_ID);
+      uint8 * const pu8_Record = &this->mc_Chunk[hu32_CHUNK_HEADER_SIZE +
+                                                 (this->mu32_NumRecordsInChunk * hu32_RECORD_SIZE)];
+
+      // Time stamps of sent and received messages are not strictly ascending; so keep the range of the chunk
+      if (this->mu32_NumRecordsInChunk == 0U)
+      {
+         this->mu32_ChunkStartTimeMs = TGL_GetTickCount();
+         this->mu64_ChunkMinTimeStamp = orc_MessageData.c_CanMsg.u64_TimeStamp;
+         this->mu64_ChunkMaxTimeStamp = orc_MessageData.c_CanMsg.u64_TimeStamp;
+         (void)std::memset(&this->mc_Chunk[hu32_CHUNK_ID_BITMAP_OFFSET], 0, hu32_CHUNK_ID_BITMAP_BITS / 8U);
+      }
+      else if (orc_MessageData.c_CanMsg.u64_TimeStamp < this->mu64_ChunkMinTimeStamp)
+      {
+         this->mu64_ChunkMinTimeStamp = orc_MessageData.c_CanMsg.u64_TimeStamp;
+      }
+      else if (orc_MessageData.c_CanMsg.u64_TimeStamp > this->mu64_ChunkMaxTimeStamp)
+      {
+         this->mu64_ChunkMaxTimeStamp = orc_MessageData.c_CanMsg.u64_TimeStamp;
+      }
+      else
+      {
+         // Nothing to do
+      }
+      this->mc_Chunk[hu32_CHUNK_ID_BITMAP_OFFSET + (u32_BitIndex / 8U)] |=
+         static_cast<uint8>(1U << (u32_BitIndex % 8U));
+
+      h_EncodeRecord(orc_MessageData.c_CanMsg, orc_MessageData.q_IsTx, pu8_Record);
+      ++this->mu32_NumRecordsInChunk;
+
+      if ((this->mu32_NumRecordsInChunk >= hu32_RECORDS_PER_CHUNK) ||
+          ((TGL_GetTickCount() - this->mu32_ChunkStartTimeMs) >= this->mu32_FlushIntervalMs))
+      {
+         this->m_WriteChunk();
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Sets the interval for flushing the written data to the file
+
+   The current chunk is written when a message is added and the interval elapsed since the first record of the
+   chunk was added. If the chunk is full it is written earlier.
+
+   \param[in]     ou32_IntervalMs      Flush interval in ms (0: write after each message)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::SetFlushInterval(const uint32 ou32_IntervalMs)
+{
+   this->mu32_FlushIntervalMs = ou32_IntervalMs;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Encode CAN message to binary trace record
+
+   \param[in]     orc_CanMsg       CAN message
+   \param[in]     oq_IsTx          true: message was sent by this application
+   \param[out]    opu8_Record      record (hu32_RECORD_SIZE bytes)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::h_EncodeRecord(const T_STWCAN_Msg_RX & orc_CanMsg, const bool oq_IsTx,
+                                                  uint8 * const opu8_Record)
+{
+   uint8 u8_Flags = 0U;
+
+   u8_Flags |= (orc_CanMsg.u8_XTD != 0U) ? hu8_RECORD_FLAG_XTD : 0U;
+   u8_Flags |= (orc_CanMsg.u8_RTR != 0U) ? hu8_RECORD_FLAG_RTR : 0U;
+   u8_Flags |= (oq_IsTx == true) ? hu8_RECORD_FLAG_TX : 0U;
+   u8_Flags |= (orc_CanMsg.u8_FDF != 0U) ? hu8_RECORD_FLAG_FDF : 0U;
+   u8_Flags |= (orc_CanMsg.u8_BRS != 0U) ? hu8_RECORD_FLAG_BRS : 0U;
+   u8_Flags |= (orc_CanMsg.u8_ESI != 0U) ? hu8_RECORD_FLAG_ESI : 0U;
+
+   h_SetU64(&opu8_Record[0], orc_CanMsg.u64_TimeStamp);
+   h_SetU32(&opu8_Record[8], orc_CanMsg.u32_ID);
+   opu8_Record[12] = u8_Flags;
+   opu8_Record[13] = orc_CanMsg.u8_DLC;
+   opu8_Record[14] = 0U;
+   opu8_Record[15] = 0U;
+   (void)std::memcpy(&opu8_Record[16], &orc_CanMsg.au8_Data[0], STWCAN_MAX_DATA_LENGTH_FD);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decode binary trace record to CAN message
+
+   \param[in]     opu8_Record      record (hu32_RECORD_SIZE bytes)
+   \param[out]    orc_CanMsg       CAN message
+   \param[out]    orq_IsTx         true: message was sent by the logging application
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::h_DecodeRecord(const uint8 * const opu8_Record, T_STWCAN_Msg_RX & orc_CanMsg,
+                                                  bool & orq_IsTx)
+{
+   const uint8 u8_Flags = opu8_Record[12];
+
+   orc_CanMsg.u64_TimeStamp = h_GetU64(&opu8_Record[0]);
+   orc_CanMsg.u32_ID = h_GetU32(&opu8_Record[8]);
+   orc_CanMsg.u8_XTD = ((u8_Flags & hu8_RECORD_FLAG_XTD) != 0U) ? 1U : 0U;
+   orc_CanMsg.u8_RTR = ((u8_Flags & hu8_RECORD_FLAG_RTR) != 0U) ? 1U : 0U;
+   orc_CanMsg.u8_FDF = ((u8_Flags & hu8_RECORD_FLAG_FDF) != 0U) ? 1U : 0U;
+   orc_CanMsg.u8_BRS = ((u8_Flags & hu8_RECORD_FLAG_BRS) != 0U) ? 1U : 0U;
+   orc_CanMsg.u8_ESI = ((u8_Flags & hu8_RECORD_FLAG_ESI) != 0U) ? 1U : 0U;
+   orc_CanMsg.u8_DLC = opu8_Record[13];
+   (void)std::memcpy(&orc_CanMsg.au8_Data[0], &opu8_Record[16], STWCAN_MAX_DATA_LENGTH_FD);
+   orq_IsTx = ((u8_Flags & hu8_RECORD_FLAG_TX) != 0U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get bit of chunk ID bitmap representing a CAN ID
+
+   11bit IDs are mapped one to one; 29bit IDs share bits (a set bit only means "might be contained").
+
+   \param[in]     ou32_Id          CAN ID
+
+   \return
+   Bit index in ID bitmap
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileBin::h_GetIdBitmapIndex(const uint32 ou32_Id)
+{
+   return (ou32_Id ^ (ou32_Id >> 11U) ^ (ou32_Id >> 22U)) % hu32_CHUNK_ID_BITMAP_BITS;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store 16bit value little endian
+
+   \param[out]    opu8_Target      target (2 bytes)
+   \param[in]     ou16_Value       value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::h_SetU16(uint8 * const opu8_Target, const uint16 ou16_Value)
+{
+   opu8_Target[0] = static_cast<uint8>(ou16_Value);
+   opu8_Target[1] = static_cast<uint8>(ou16_Value >> 8U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store 32bit value little endian
+
+   \param[out]    opu8_Target      target (4 bytes)
+   \param[in]     ou32_Value       value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::h_SetU32(uint8 * const opu8_Target, const uint32 ou32_Value)
+{
+   h_SetU16(&opu8_Target[0], static_cast<uint16>(ou32_Value));
+   h_SetU16(&opu8_Target[2], static_cast<uint16>(ou32_Value >> 16U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store 64bit value little endian
+
+   \param[out]    opu8_Target      target (8 bytes)
+   \param[in]     ou64_Value       value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::h_SetU64(uint8 * const opu8_Target, const uint64 ou64_Value)
+{
+   h_SetU32(&opu8_Target[0], static_cast<uint32>(ou64_Value));
+   h_SetU32(&opu8_Target[4], static_cast<uint32>(ou64_Value >> 32U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 16bit little endian value
+
+   \param[in]     opu8_Source      source (2 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint16 C_OSCComMessageLoggerFileBin::h_GetU16(const uint8 * const opu8_Source)
+{
+   return static_cast<uint16>(static_cast<uint16>(opu8_Source[0]) | static_cast<uint16>(opu8_Source[1] << 8U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 32bit little endian value
+
+   \param[in]     opu8_Source      source (4 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileBin::h_GetU32(const uint8 * const opu8_Source)
+{
+   return static_cast<uint32>(h_GetU16(&opu8_Source[0])) | (static_cast<uint32>(h_GetU16(&opu8_Source[2])) << 16U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 64bit little endian value
+
+   \param[in]     opu8_Source      source (8 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_OSCComMessageLoggerFileBin::h_GetU64(const uint8 * const opu8_Source)
+{
+   return static_cast<uint64>(h_GetU32(&opu8_Source[0])) | (static_cast<uint64>(h_GetU32(&opu8_Source[4])) << 32U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write the currently filled chunk to the file
+
+   Nothing is written if the chunk is empty.
+   The file stream is flushed, so the chunk is visible to readers of the file.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBin::m_WriteChunk(void)
+{
+   if (this->mu32_NumRecordsInChunk > 0U)
+   {
+      h_SetU32(&this->mc_Chunk[0], hu32_CHUNK_MAGIC);
+      h_SetU32(&this->mc_Chunk[4], this->mu32_NumRecordsInChunk);
+      h_SetU64(&this->mc_Chunk[8], this->mu64_ChunkMinTimeStamp);
+      h_SetU64(&this->mc_Chunk[16], this->mu64_ChunkMaxTimeStamp);
+
+      this->mc_File.write(reinterpret_cast<const charn *>(&this->mc_Chunk[0]),
+                          static_cast<std::streamsize>(hu32_CHUNK_HEADER_SIZE +
+                                                       (this->mu32_NumRecordsInChunk * hu32_RECORD_SIZE)));
+      this->mc_File.flush();
+      this->mu32_NumRecordsInChunk = 0U;
+   }
+}
@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to write a CAN log file in the compact openSYDE binary trace format (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMMESSAGELOGGERFILEBIN_H
+#define C_OSCCOMMESSAGELOGGERFILEBIN_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <fstream>
+#include <vector>
+
+#include "stwtypes.h"
+#include "stw_can.h"
+#include "CSCLString.h"
+
+#include "C_OSCComMessageLoggerFileBase.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OSCComMessageLoggerFileBin :
+   public C_OSCComMessageLoggerFileBase
+{
+public:
+   C_OSCComMessageLoggerFileBin(const stw_scl::C_SCLString & orc_FilePath,
+                                const stw_scl::C_SCLString & orc_ProtocolName);
+   virtual ~C_OSCComMessageLoggerFileBin(void);
+
+   virtual stw_types::sint32 OpenFile(void);
+   virtual void AddMessageToFile(const C_OSCComMessageLoggerData & orc_MessageData);
+
+   void SetFlushInterval(const stw_types::uint32 ou32_IntervalMs);
+
+   static void h_EncodeRecord(const stw_can::T_STWCAN_Msg_RX & orc_CanMsg, const bool oq_IsTx,
+                              stw_types::uint8 * const opu8_Record);
+   static void h_DecodeRecord(const stw_types::uint8 * const opu8_Record, stw_can::T_STWCAN_Msg_RX & orc_CanMsg,
+                              bool & orq_IsTx);
+   static stw_types::uint32 h_GetIdBitmapIndex(const stw_types::uint32 ou32_Id);
+
+   static void h_SetU16(stw_types::uint8 * const opu8_Target, const stw_types::uint16 ou16_Value);
+   static void h_SetU32(stw_types::uint8 * const opu8_Target, const stw_types::uint32 ou32_Value);
+   static void h_SetU64(stw_types::uint8 * const opu8_Target, const stw_types::uint64 ou64_Value);
+   static stw_types::uint16 h_GetU16(const stw_types::uint8 * const opu8_Source);
+   static stw_types::uint32 h_GetU32(const stw_types::uint8 * const opu8_Source);
+   static stw_types::uint64 h_GetU64(const stw_types::uint8 * const opu8_Source);
+
+   ///file layout (all values little endian):
+   ///file header | chunk header | records | chunk header | records | ...
+   static const stw_types::uint8 hau8_FILE_MAGIC[8];
+   static const stw_types::uint16 hu16_FILE_VERSION = 1U;
+   static const stw_types::uint32 hu32_FILE_HEADER_SIZE = 32U;
+
+   ///chunk header: magic (4), number of records (4), lowest time stamp (8), highest time stamp (8), ID bitmap
+   static const stw_types::uint32 hu32_CHUNK_MAGIC = 0x4B4E4843UL; // "CHNK"
+   static const stw_types::uint32 hu32_CHUNK_ID_BITMAP_BITS = 2048U;
+   static const stw_types::uint32 hu32_CHUNK_ID_BITMAP_OFFSET = 24U;
+   static const stw_types::uint32 hu32_CHUNK_HEADER_SIZE = 24U + (2048U / 8U);
+   static const stw_types::uint32 hu32_RECORDS_PER_CHUNK = 4096U;
+
+   ///record: time stamp (8), ID (4), flags (1), DLC (1), reserved (2), data (64)
+   static const stw_types::uint32 hu32_RECORD_SIZE = 80U;
+   static const stw_types::uint8 hu8_RECORD_FLAG_XTD = 0x01U;
+   static const stw_types::uint8 hu8_RECORD_FLAG_RTR = 0x02U;
+   static const stw_types::uint8 hu8_RECORD_FLAG_TX  = 0x04U;
+   static const stw_types::uint8 hu8_RECORD_FLAG_FDF = 0x08U;
+   static const stw_types::uint8 hu8_RECORD_FLAG_BRS = 0x10U;
+   static const stw_types::uint8 hu8_RECORD_FLAG_ESI = 0x20U;
+
+private:
+   //Avoid call
+   C_OSCComMessageLoggerFileBin(const C_OSCComMessageLoggerFileBin &);
+   C_OSCComMessageLoggerFileBin & operator =(const C_OSCComMessageLoggerFileBin &);
+
+   void m_WriteChunk(void);
+
+   std::ofstream mc_File;
+   std::vector<stw_types::uint8> mc_Chunk; ///< chunk header and records of currently filled chunk
+   stw_types::uint32 mu32_NumRecordsInChunk;
+   stw_types::uint64 mu64_ChunkMinTimeStamp;
+   stw_types::uint64 mu64_ChunkMaxTimeStamp;
+   stw_types::uint32 mu32_ChunkStartTimeMs; ///< tick count when the first record of the current chunk was added
+   stw_types::uint32 mu32_FlushIntervalMs;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
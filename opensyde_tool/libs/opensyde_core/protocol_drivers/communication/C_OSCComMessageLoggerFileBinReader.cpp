@@ -0,0 +1,611 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to read a CAN log file in the compact openSYDE binary trace format (implementation)
+
+   The file is mapped into memory instead of being loaded. Opening only walks the chunk headers to build a small
+   index (one entry per chunk). Records are decoded on access, so also traces of several GB can be searched and
+   seeked without reading them completely.
+   As replay source the reader can feed a recorded trace into a C_CAN_Replay dispatcher.
+
+   Note: the complete file is mapped; for very large traces a 64bit application is required.
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cstring>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "C_OSCComMessageLoggerFileBin.h"
+#include "C_OSCComMessageLoggerFileBinReader.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_can;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerFileBinReader::C_OSCComMessageLoggerFileBinReader(void) :
+   mpu8_Data(NULL),
+   mu64_FileSize(0U),
+#ifdef _WIN32
+   mpv_FileHandle(INVALID_HANDLE_VALUE),
+   mpv_MappingHandle(NULL),
+#else
+   msn_FileDescriptor(-1),
+#endif
+   mu64_NumRecords(0U),
+   mu64_ReplayStartIndex(0U),
+   mu32_ReplayChunk(0U),
+   mu32_ReplayRecordInChunk(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+
+   Unmaps and closes the file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerFileBinReader::~C_OSCComMessageLoggerFileBinReader(void)
+{
+   this->Close();
+   this->mpu8_Data = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Open binary trace file
+
+   An already opened file will be closed.
+   An incomplete last chunk (e.g. after the logging application was terminated) is ignored.
+
+   \param[in]     orc_FilePath     Path of trace file
+
+   \return
+   C_NO_ERR    File opened
+   C_RD_WR     File could not be opened or mapped
+   C_CONFIG    File is no binary trace file or has an unsupported version
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBinReader::Open(const C_SCLString & orc_FilePath)
+{
+   sint32 s32_Return;
+
+   this->Close();
+
+   s32_Return = this->m_MapFile(orc_FilePath);
+   if (s32_Return == C_NO_ERR)
+   {
+      s32_Return = this->m_BuildChunkIndex();
+      if (s32_Return != C_NO_ERR)
+      {
+         this->Close();
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Close file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBinReader::Close(void)
+{
+   this->m_UnmapFile();
+   this->mc_Chunks.clear();
+   this->mu64_NumRecords = 0U;
+   this->mu64_ReplayStartIndex = 0U;
+   this->mu32_ReplayChunk = 0U;
+   this->mu32_ReplayRecordInChunk = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if a file is opened
+
+   \return
+   true     file opened
+   false    no file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerFileBinReader::IsOpen(void) const
+{
+   return (this->mpu8_Data != NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of records in file
+
+   \return
+   Number of records
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_OSCComMessageLoggerFileBinReader::GetNumRecords(void) const
+{
+   return this->mu64_NumRecords;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get lowest and highest time stamp of all records
+
+   Both values are 0 if the file is empty.
+
+   \param[out]    oru64_Lowest     lowest time stamp in us
+   \param[out]    oru64_Highest    highest time stamp in us
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBinReader::GetTimeRange(uint64 & oru64_Lowest, uint64 & oru64_Highest) const
+{
+   uint32 u32_Chunk;
+
+   oru64_Lowest = 0U;
+   oru64_Highest = 0U;
+   for (u32_Chunk = 0U; u32_Chunk < this->mc_Chunks.size(); u32_Chunk++)
+   {
+      const C_ChunkInfo & rc_Chunk = this->mc_Chunks[u32_Chunk];
+      if ((u32_Chunk == 0U) || (rc_Chunk.u64_LowestTimeStamp < oru64_Lowest))
+      {
+         oru64_Lowest = rc_Chunk.u64_LowestTimeStamp;
+      }
+      if (rc_Chunk.u64_HighestTimeStamp > oru64_Highest)
+      {
+         oru64_Highest = rc_Chunk.u64_HighestTimeStamp;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get one record
+
+   \param[in]     ou64_Index       index of record (0 .. GetNumRecords() - 1)
+   \param[out]    orc_CanMsg       CAN message
+   \param[out]    orq_IsTx         true: message was sent by the logging application
+
+   \return
+   C_NO_ERR    record read
+   C_RANGE     index out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBinReader::GetRecord(const uint64 ou64_Index, T_STWCAN_Msg_RX & orc_CanMsg,
+                                                     bool & orq_IsTx) const
+{
+   sint32 s32_Return = C_RANGE;
+
+   if (ou64_Index < this->mu64_NumRecords)
+   {
+      const uint32 u32_Chunk = this->m_GetChunkOfRecord(ou64_Index);
+      const uint32 u32_RecordInChunk =
+         static_cast<uint32>(ou64_Index - this->mc_Chunks[u32_Chunk].u64_FirstRecordIndex);
+
+      C_OSCComMessageLoggerFileBin::h_DecodeRecord(this->m_GetRecordData(u32_Chunk, u32_RecordInChunk), orc_CanMsg,
+                                                   orq_IsTx);
+      s32_Return = C_NO_ERR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set first record to replay
+
+   Takes effect with the next call of Restart().
+   Can be combined with FindFirstRecordAtTime() to replay only a part of the file.
+
+   \param[in]     ou64_Index       index of first record to replay
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBinReader::SetReplayStart(const uint64 ou64_Index)
+{
+   this->mu64_ReplayStartIndex = ou64_Index;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read next record for replay
+
+   Records are read sequentially starting with the record set by SetReplayStart().
+
+   \param[out]    orc_Message      CAN message
+   \param[out]    orq_IsTx         true: message was sent by the logging application
+
+   \return
+   C_NO_ERR    record read
+   C_NOACT     no more records
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBinReader::ReadNextMessage(T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx)
+{
+   sint32 s32_Return = C_NOACT;
+
+   //skip chunks without (further) records
+   while ((this->mu32_ReplayChunk < this->mc_Chunks.size()) &&
+          (this->mu32_ReplayRecordInChunk >= this->mc_Chunks[this->mu32_ReplayChunk].u32_NumRecords))
+   {
+      this->mu32_ReplayChunk++;
+      this->mu32_ReplayRecordInChunk = 0U;
+   }
+
+   if (this->mu32_ReplayChunk < this->mc_Chunks.size())
+   {
+      C_OSCComMessageLoggerFileBin::h_DecodeRecord(this->m_GetRecordData(this->mu32_ReplayChunk,
+                                                                         this->mu32_ReplayRecordInChunk),
+                                                   orc_Message, orq_IsTx);
+      this->mu32_ReplayRecordInChunk++;
+      s32_Return = C_NO_ERR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Restart replay with the record set by SetReplayStart()
+
+   \return
+   C_NO_ERR    restarted
+   C_CONFIG    no file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBinReader::Restart(void)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   if (this->IsOpen() == true)
+   {
+      if (this->mu64_ReplayStartIndex < this->mu64_NumRecords)
+      {
+         this->mu32_ReplayChunk = this->m_GetChunkOfRecord(this->mu64_ReplayStartIndex);
+         this->mu32_ReplayRecordInChunk =
+            static_cast<uint32>(this->mu64_ReplayStartIndex -
+                                this->mc_Chunks[this->mu32_ReplayChunk].u64_FirstRecordIndex);
+      }
+      else
+      {
+         //nothing to replay
+         this->mu32_ReplayChunk = static_cast<uint32>(this->mc_Chunks.size());
+         this->mu32_ReplayRecordInChunk = 0U;
+      }
+      s32_Return = C_NO_ERR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find first record with a time stamp not lower than the specified one
+
+   Chunks ending before the time stamp are skipped using the chunk index.
+
+   \param[in]     ou64_TimeStamp   time stamp in us
+
+   \return
+   Index of record
+   GetNumRecords() if there is no such record
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_OSCComMessageLoggerFileBinReader::FindFirstRecordAtTime(const uint64 ou64_TimeStamp) const
+{
+   uint64 u64_Result = this->mu64_NumRecords;
+   uint32 u32_Chunk;
+
+   for (u32_Chunk = 0U; (u32_Chunk < this->mc_Chunks.size()) && (u64_Result == this->mu64_NumRecords); u32_Chunk++)
+   {
+      const C_ChunkInfo & rc_Chunk = this->mc_Chunks[u32_Chunk];
+      if (rc_Chunk.u64_HighestTimeStamp >= ou64_TimeStamp)
+      {
+         uint32 u32_Record;
+         for (u32_Record = 0U; u32_Record < rc_Chunk.u32_NumRecords; u32_Record++)
+         {
+            if (C_OSCComMessageLoggerFileBin::h_GetU64(this->m_GetRecordData(u32_Chunk, u32_Record)) >=
+                ou64_TimeStamp)
+            {
+               u64_Result = rc_Chunk.u64_FirstRecordIndex + u32_Record;
+               break;
+            }
+         }
+      }
+   }
+
+   return u64_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find next record with a specific CAN ID
+
+   Chunks not containing the ID according to their ID bitmap are skipped without touching their records.
+
+   \param[in]     ou64_StartIndex  index of first record to check
+   \param[in]     ou32_Id          CAN ID
+   \param[in]     oq_Extended      true: 29bit ID; false: 11bit ID
+   \param[out]    oru64_Index      index of found record
+
+   \return
+   C_NO_ERR    record found
+   C_NOACT     no more record with this ID
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBinReader::FindNextRecordWithId(const uint64 ou64_StartIndex, const uint32 ou32_Id,
+                                                                const bool oq_Extended, uint64 & oru64_Index) const
+{
+   sint32 s32_Return = C_NOACT;
+
+   if (ou64_StartIndex < this->mu64_NumRecords)
+   {
+      const uint32 u32_BitIndex = C_OSCComMessageLoggerFileBin::h_GetIdBitmapIndex(ou32_Id);
+      const uint8 u8_BitMask = static_cast<uint8>(1U << (u32_BitIndex % 8U));
+      const uint8 u8_XtdFlag = (oq_Extended == true) ? C_OSCComMessageLoggerFileBin::hu8_RECORD_FLAG_XTD : 0U;
+      uint32 u32_Chunk;
+
+      for (u32_Chunk = this->m_GetChunkOfRecord(ou64_StartIndex);
+           (u32_Chunk < this->mc_Chunks.size()) && (s32_Return != C_NO_ERR); u32_Chunk++)
+      {
+         const C_ChunkInfo & rc_Chunk = this->mc_Chunks[u32_Chunk];
+         const uint8 * const pu8_Bitmap = &rc_Chunk.pu8_Header[C_OSCComMessageLoggerFileBin::
+                                                               hu32_CHUNK_ID_BITMAP_OFFSET];
+         if ((pu8_Bitmap[u32_BitIndex / 8U] & u8_BitMask) != 0U)
+         {
+            uint32 u32_Record = 0U;
+            if (ou64_StartIndex > rc_Chunk.u64_FirstRecordIndex)
+            {
+               u32_Record = static_cast<uint32>(ou64_StartIndex - rc_Chunk.u64_FirstRecordIndex);
+            }
+            for (; u32_Record < rc_Chunk.u32_NumRecords; u32_Record++)
+            {
+               const uint8 * const pu8_Record = this->m_GetRecordData(u32_Chunk, u32_Record);
+               if ((C_OSCComMessageLoggerFileBin::h_GetU32(&pu8_Record[8]) == ou32_Id) &&
+                   ((pu8_Record[12] & C_OSCComMessageLoggerFileBin::hu8_RECORD_FLAG_XTD) == u8_XtdFlag))
+               {
+                  oru64_Index = rc_Chunk.u64_FirstRecordIndex + u32_Record;
+                  s32_Return = C_NO_ERR;
+                  break;
+               }
+            }
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Open file and map it into memory
+
+   \param[in]     orc_FilePath     Path of trace file
+
+   \return
+   C_NO_ERR    File mapped
+   C_RD_WR     File could not be opened or mapped
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBinReader::m_MapFile(const C_SCLString & orc_FilePath)
+{
+   sint32 s32_Return = C_RD_WR;
+
+#ifdef _WIN32
+   this->mpv_FileHandle = CreateFileA(orc_FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if (this->mpv_FileHandle != INVALID_HANDLE_VALUE)
+   {
+      LARGE_INTEGER t_Size;
+      if ((GetFileSizeEx(this->mpv_FileHandle, &t_Size) != FALSE) && (t_Size.QuadPart > 0))
+      {
+         this->mu64_FileSize = static_cast<uint64>(t_Size.QuadPart);
+         this->mpv_MappingHandle = CreateFileMappingA(this->mpv_FileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+         if (this->mpv_MappingHandle != NULL)
+         {
+            this->mpu8_Data = static_cast<const uint8 *>(MapViewOfFile(this->mpv_MappingHandle, FILE_MAP_READ, 0, 0,
+                                                                       0));
+            if (this->mpu8_Data != NULL)
+            {
+               s32_Return = C_NO_ERR;
+            }
+         }
+      }
+   }
+#else
+   this->msn_FileDescriptor = open(orc_FilePath.c_str(), O_RDONLY);
+   if (this->msn_FileDescriptor >= 0)
+   {
+      struct stat c_Stat;
+      if ((fstat(this->msn_FileDescriptor, &c_Stat) == 0) && (c_Stat.st_size > 0))
+      {
+         void * pv_Data;
+         this->mu64_FileSize = static_cast<uint64>(c_Stat.st_size);
+         pv_Data = mmap(NULL, static_cast<size_t>(this->mu64_FileSize), PROT_READ, MAP_SHARED,
+                        this->msn_FileDescriptor, 0);
+         if (pv_Data != MAP_FAILED)
+         {
+            //records are mostly accessed in ascending order:
+            (void)madvise(pv_Data, static_cast<size_t>(this->mu64_FileSize), MADV_SEQUENTIAL);
+            this->mpu8_Data = static_cast<const uint8 *>(pv_Data);
+            s32_Return = C_NO_ERR;
+         }
+      }
+   }
+#endif
+
+   if (s32_Return != C_NO_ERR)
+   {
+      this->m_UnmapFile();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Unmap and close file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerFileBinReader::m_UnmapFile(void)
+{
+#ifdef _WIN32
+   if (this->mpu8_Data != NULL)
+   {
+      (void)UnmapViewOfFile(this->mpu8_Data);
+   }
+   if (this->mpv_MappingHandle != NULL)
+   {
+      (void)CloseHandle(this->mpv_MappingHandle);
+      this->mpv_MappingHandle = NULL;
+   }
+   if (this->mpv_FileHandle != INVALID_HANDLE_VALUE)
+   {
+      (void)CloseHandle(this->mpv_FileHandle);
+      this->mpv_FileHandle = INVALID_HANDLE_VALUE;
+   }
+#else
+   if (this->mpu8_Data != NULL)
+   {
+      (void)munmap(const_cast<uint8 *>(this->mpu8_Data), static_cast<size_t>(this->mu64_FileSize));
+   }
+   if (this->msn_FileDescriptor >= 0)
+   {
+      (void)close(this->msn_FileDescriptor);
+      this->msn_FileDescriptor = -1;
+   }
+#endif
+   this->mpu8_Data = NULL;
+   this->mu64_FileSize = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check file header and build index of all complete chunks
+
+   \return
+   C_NO_ERR    index built
+   C_CONFIG    File is no binary trace file or has an unsupported version
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCComMessageLoggerFileBinReader::m_BuildChunkIndex(void)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   if ((this->mu64_FileSize >= C_OSCComMessageLoggerFileBin::hu32_FILE_HEADER_SIZE) &&
+       (std::memcmp(this->mpu8_Data, &C_OSCComMessageLoggerFileBin::hau8_FILE_MAGIC[0],
+                    sizeof(C_OSCComMessageLoggerFileBin::hau8_FILE_MAGIC)) == 0) &&
+       (C_OSCComMessageLoggerFileBin::h_GetU16(&this->mpu8_Data[8]) ==
+        C_OSCComMessageLoggerFileBin::hu16_FILE_VERSION) &&
+       (C_OSCComMessageLoggerFileBin::h_GetU16(&this->mpu8_Data[10]) ==
+        C_OSCComMessageLoggerFileBin::hu32_RECORD_SIZE) &&
+       (C_OSCComMessageLoggerFileBin::h_GetU32(&this->mpu8_Data[12]) ==
+        C_OSCComMessageLoggerFileBin::hu32_CHUNK_HEADER_SIZE))
+   {
+      uint64 u64_Offset = C_OSCComMessageLoggerFileBin::hu32_FILE_HEADER_SIZE;
+      bool q_Continue = true;
+
+      s32_Return = C_NO_ERR;
+      this->mu64_NumRecords = 0U;
+
+      while ((q_Continue == true) &&
+             ((u64_Offset + C_OSCComMessageLoggerFileBin::hu32_CHUNK_HEADER_SIZE) <= this->mu64_FileSize))
+      {
+         const uint8 * const pu8_Header = &this->mpu8_Data[u64_Offset];
+         const uint32 u32_NumRecords = C_OSCComMessageLoggerFileBin::h_GetU32(&pu8_Header[4]);
+         const uint64 u64_ChunkSize = C_OSCComMessageLoggerFileBin::hu32_CHUNK_HEADER_SIZE +
+                                      (static_cast<uint64>(u32_NumRecords) *
+                                       C_OSCComMessageLoggerFileBin::hu32_RECORD_SIZE);
+
+         if ((C_OSCComMessageLoggerFileBin::h_GetU32(&pu8_Header[0]) !=
+              C_OSCComMessageLoggerFileBin::hu32_CHUNK_MAGIC) ||
+             (u32_NumRecords == 0U) || ((u64_Offset + u64_ChunkSize) > this->mu64_FileSize))
+         {
+            // Incomplete or corrupt chunk; use what we have so far
+            q_Continue = false;
+         }
+         else
+         {
+            C_ChunkInfo c_Chunk;
+            c_Chunk.pu8_Header = pu8_Header;
+            c_Chunk.u64_FirstRecordIndex = this->mu64_NumRecords;
+            c_Chunk.u32_NumRecords = u32_NumRecords;
+            c_Chunk.u64_LowestTimeStamp = C_OSCComMessageLoggerFileBin::h_GetU64(&pu8_Header[8]);
+            c_Chunk.u64_HighestTimeStamp = C_OSCComMessageLoggerFileBin::h_GetU64(&pu8_Header[16]);
+            this->mc_Chunks.push_back(c_Chunk);
+
+            this->mu64_NumRecords += u32_NumRecords;
+            u64_Offset += u64_ChunkSize;
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get index of chunk containing a record
+
+   Binary search in chunk index.
+
+   \param[in]     ou64_Index       index of record (must be valid)
+
+   \return
+   Index of chunk
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLoggerFileBinReader::m_GetChunkOfRecord(const uint64 ou64_Index) const
+{
+   uint32 u32_Low = 0U;
+   uint32 u32_High = static_cast<uint32>(this->mc_Chunks.size());
+
+   //find last chunk with first record index <= ou64_Index
+   while ((u32_High - u32_Low) > 1U)
+   {
+      const uint32 u32_Mid = u32_Low + ((u32_High - u32_Low) / 2U);
+      if (this->mc_Chunks[u32_Mid].u64_FirstRecordIndex <= ou64_Index)
+      {
+         u32_Low = u32_Mid;
+      }
+      else
+      {
+         u32_High = u32_Mid;
+      }
+   }
+
+   return u32_Low;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pointer to record in mapped file
+
+   \param[in]     ou32_Chunk           index of chunk (must be valid)
+   \param[in]     ou32_RecordInChunk   index of record within chunk (must be valid)
+
+   \return
+   Pointer to record data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8 * C_OSCComMessageLoggerFileBinReader::m_GetRecordData(const uint32 ou32_Chunk,
+                                                                  const uint32 ou32_RecordInChunk) const
+{
+   return &this->mc_Chunks[ou32_Chunk].pu8_Header[C_OSCComMessageLoggerFileBin::hu32_CHUNK_HEADER_SIZE +
+                                                  (static_cast<uintn>(ou32_RecordInChunk) *
+                                                   C_OSCComMessageLoggerFileBin::hu32_RECORD_SIZE)];
+}
@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to read a CAN log file in the compact openSYDE binary trace format (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMMESSAGELOGGERFILEBINREADER_H
+#define C_OSCCOMMESSAGELOGGERFILEBINREADER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.h"
+#include "stw_can.h"
+#include "CSCLString.h"
+#include "CCANReplay.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OSCComMessageLoggerFileBinReader :
+   public stw_can::C_CAN_ReplaySource
+{
+public:
+   C_OSCComMessageLoggerFileBinReader(void);
+   virtual ~C_OSCComMessageLoggerFileBinReader(void);
+
+   stw_types::sint32 Open(const stw_scl::C_SCLString & orc_FilePath);
+   void Close(void);
+   bool IsOpen(void) const;
+
+   stw_types::uint64 GetNumRecords(void) const;
+   void GetTimeRange(stw_types::uint64 & oru64_Lowest, stw_types::uint64 & oru64_Highest) const;
+   stw_types::sint32 GetRecord(const stw_types::uint64 ou64_Index, stw_can::T_STWCAN_Msg_RX & orc_CanMsg,
+                               bool & orq_IsTx) const;
+
+   stw_types::uint64 FindFirstRecordAtTime(const stw_types::uint64 ou64_TimeStamp) const;
+   stw_types::sint32 FindNextRecordWithId(const stw_types::uint64 ou64_StartIndex, const stw_types::uint32 ou32_Id,
+                                          const bool oq_Extended, stw_types::uint64 & oru64_Index) const;
+
+   void SetReplayStart(const stw_types::uint64 ou64_Index);
+   virtual stw_types::sint32 ReadNextMessage(stw_can::T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx);
+   virtual stw_types::sint32 Restart(void);
+
+private:
+   ///index information about one chunk in the mapped file
+   class C_ChunkInfo
+   {
+   public:
+      const stw_types::uint8 * pu8_Header; ///< chunk header in mapped file; records follow directly
+      stw_types::uint64 u64_FirstRecordIndex;
+      stw_types::uint32 u32_NumRecords;
+      stw_types::uint64 u64_LowestTimeStamp;
+      stw_types::uint64 u64_HighestTimeStamp;
+   };
+
+   //Avoid call
+   C_OSCComMessageLoggerFileBinReader(const C_OSCComMessageLoggerFileBinReader &);
+   C_OSCComMessageLoggerFileBinReader & operator =(const C_OSCComMessageLoggerFileBinReader &);
+
+   stw_types::sint32 m_MapFile(const stw_scl::C_SCLString & orc_FilePath);
+   void m_UnmapFile(void);
+   stw_types::sint32 m_BuildChunkIndex(void);
+   stw_types::uint32 m_GetChunkOfRecord(const stw_types::uint64 ou64_Index) const;
+   const stw_types::uint8 * m_GetRecordData(const stw_types::uint32 ou32_Chunk,
+                                            const stw_types::uint32 ou32_RecordInChunk) const;
+
+   const stw_types::uint8 * mpu8_Data; ///< mapped file content
+   stw_types::uint64 mu64_FileSize;
+#ifdef _WIN32
+   void * mpv_FileHandle;
+   void * mpv_MappingHandle;
+#else
+   stw_types::sintn msn_FileDescriptor;
+#endif
+
+   std::vector<C_ChunkInfo> mc_Chunks;
+   stw_types::uint64 mu64_NumRecords;
+
+   stw_types::uint64 mu64_ReplayStartIndex; ///< first record to replay after Restart()
+   stw_types::uint32 mu32_ReplayChunk;      ///< chunk of next record to replay
+   stw_types::uint32 mu32_ReplayRecordInChunk;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
@@ -0,0 +1,414 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled decoder for CAN signals of logged CAN messages (implementation)
+
+   The position, byte order and type of a CAN signal are translated once into a start byte, a shift and masks.
+   Decoding a signal of a received CAN message is then reduced to reading the touched message bytes into an
+   integer, shifting and masking. Byte aligned Intel signals are read without any shifting.
+
+   The resulting raw value has the same representation as the little endian blob of C_OSCCanUtil::h_GetSignalValue
+   (including the relocation of the sign bit of signed signals with a length which is no multiple of 8).
+   So the strings created by FormatValue are identical to the interpretation via C_OSCNodeDataPoolContent.
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cstring>
+
+#include "stwtypes.h"
+#include "C_OSCUtils.h"
+#include "C_OSCNodeDataPoolContentUtil.h"
+#include "C_OSCComMessageLoggerSignalDecoder.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_scl;
+using namespace stw_can;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   The decoder does not match any message until Compile was called.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCComMessageLoggerSignalDecoder::C_OSCComMessageLoggerSignalDecoder(void) :
+   mq_Intel(true),
+   mq_ByteAligned(true),
+   mu8_NumBytes(0U),
+   mu8_Shift(0U),
+   mu16_StartByte(0U),
+   mu16_NeededBytes(0xFFFFU),
+   mu64_SignalMask(0U),
+   mu64_SignalSignBit(0U),
+   mu64_TypeSignBit(0U),
+   me_Type(C_OSCNodeDataPoolContent::eUINT8),
+   mq_ScalingActive(false),
+   mf64_Factor(1.0),
+   mf64_Offset(0.0)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Prepare decoding of a signal
+
+   \param[in]  orc_Signal     Signal configuration (position and byte order)
+   \param[in]  oe_Type        Type of the associated Datapool element
+   \param[in]  of64_Factor    Factor for resulting value
+   \param[in]  of64_Offset    Offset for resulting value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerSignalDecoder::Compile(const C_OSCCanSignal & orc_Signal,
+                                                 const C_OSCNodeDataPoolContent::E_Type oe_Type,
+                                                 const float64 of64_Factor, const float64 of64_Offset)
+{
+   const uint32 u32_TypeBits = C_OSCNodeDataPoolContentUtil::h_GetDataTypeSizeInByte(oe_Type) * 8U;
+   const uint32 u32_BitLength = (orc_Signal.u16_ComBitLength > 64U) ? 64U : orc_Signal.u16_ComBitLength;
+   const uint32 u32_BitInStartByte = orc_Signal.u16_ComBitStart % 8U;
+   uint32 u32_LeadingBits;
+
+   this->mq_Intel = (orc_Signal.e_ComByteOrder == C_OSCCanSignal::eBYTE_ORDER_INTEL);
+   this->mu16_StartByte = orc_Signal.u16_ComBitStart / 8U;
+   this->me_Type = oe_Type;
+   this->mf64_Factor = of64_Factor;
+   this->mf64_Offset = of64_Offset;
+   this->mq_ScalingActive = C_OSCUtils::h_IsScalingActive(of64_Factor, of64_Offset);
+
+   if (this->mq_Intel == true)
+   {
+      // The start bit is the LSB; unused bits in front of the signal are the low bits of the start byte
+      u32_LeadingBits = u32_BitInStartByte;
+   }
+   else
+   {
+      // The start bit is the MSB; unused bits in front of the signal are the high bits of the start byte
+      u32_LeadingBits = 7U - u32_BitInStartByte;
+   }
+   this->mu8_NumBytes = static_cast<uint8>(((u32_LeadingBits + u32_BitLength) + 7U) / 8U);
+
+   if (this->mq_Intel == true)
+   {
+      this->mu8_Shift = static_cast<uint8>(u32_LeadingBits);
+   }
+   else
+   {
+      // Shift of the LSB relative to the end of the read bytes (at most 8 bytes read into the integer)
+      const uint32 u32_ReadBytes = (this->mu8_NumBytes > 8U) ? 9U : this->mu8_NumBytes;
+      this->mu8_Shift = static_cast<uint8>((u32_ReadBytes * 8U) - (u32_LeadingBits + u32_BitLength));
+   }
+   this->mq_ByteAligned = (this->mu8_Shift == 0U) && (this->mu8_NumBytes <= 8U);
+
+   if ((u32_BitLength == 0U) ||
+       ((static_cast<uint32>(this->mu16_StartByte) + this->mu8_NumBytes) > STWCAN_MAX_DATA_LENGTH_FD))
+   {
+      // Signal can never be contained in a message
+      this->mu16_NeededBytes = 0xFFFFU;
+   }
+   else
+   {
+      this->mu16_NeededBytes = static_cast<uint16>(this->mu16_StartByte + this->mu8_NumBytes);
+   }
+
+   // The value can not exceed the size of the Datapool element type
+   this->mu64_SignalMask = (u32_BitLength >= 64U) ? 0xFFFFFFFFFFFFFFFFULL : ((1ULL << u32_BitLength) - 1ULL);
+   if (u32_TypeBits < 64U)
+   {
+      this->mu64_SignalMask &= ((1ULL << u32_TypeBits) - 1ULL);
+   }
+
+   // Same handling of signed values as C_OSCCanUtil::h_GetSignalValue
+   this->mu64_SignalSignBit = 0U;
+   this->mu64_TypeSignBit = 0U;
+   if (((oe_Type == C_OSCNodeDataPoolContent::eSINT8) ||
+        (oe_Type == C_OSCNodeDataPoolContent::eSINT16) ||
+        (oe_Type == C_OSCNodeDataPoolContent::eSINT32) ||
+        (oe_Type == C_OSCNodeDataPoolContent::eSINT64)) &&
+       ((u32_BitLength % 8U) != 0U) && (u32_BitLength < u32_TypeBits))
+   {
+      this->mu64_SignalSignBit = 1ULL << (u32_BitLength - 1U);
+      this->mu64_TypeSignBit = 1ULL << (u32_TypeBits - 1U);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get raw value of the signal out of CAN message data bytes
+
+   \param[in]   orau8_CanDb      Data bytes of CAN message
+   \param[in]   ou8_CanDlc       Number of data bytes of CAN message
+   \param[out]  oru64_RawValue   Raw value in the representation of the Datapool element type
+
+   \return
+   true     Signal is contained in message; raw value valid
+   false    Signal is outside of the set data bytes (DLC is not big enough)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCComMessageLoggerSignalDecoder::Decode(const uint8(&orau8_CanDb)[STWCAN_MAX_DATA_LENGTH_FD],
+                                                const uint8 ou8_CanDlc, uint64 & oru64_RawValue) const
+{
+   bool q_Return = false;
+
+   if (this->mu16_NeededBytes <= ou8_CanDlc)
+   {
+      uint64 u64_Value;
+
+      if (this->mq_Intel == true)
+      {
+         u64_Value = this->m_ExtractIntel(orau8_CanDb);
+      }
+      else
+      {
+         u64_Value = this->m_ExtractMotorola(orau8_CanDb);
+      }
+      u64_Value &= this->mu64_SignalMask;
+
+      if ((u64_Value & this->mu64_SignalSignBit) != 0U)
+      {
+         // Move the sign bit of the signal to the sign bit of the type
+         u64_Value ^= this->mu64_SignalSignBit;
+         u64_Value |= this->mu64_TypeSignBit;
+      }
+
+      oru64_RawValue = u64_Value;
+      q_Return = true;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Fill value strings of signal interpretation
+
+   \param[in]      ou64_RawValue    Raw value as returned by Decode
+   \param[in,out]  orc_Signal       Signal interpretation (raw values and value are set)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLoggerSignalDecoder::FormatValue(const uint64 ou64_RawValue,
+                                                     C_OSCComMessageLoggerDataSignal & orc_Signal) const
+{
+   const C_SCLString c_UnscaledValue = this->m_GetUnscaledValueAsString(ou64_RawValue);
+
+   if ((this->me_Type == C_OSCNodeDataPoolContent::eFLOAT32) ||
+       (this->me_Type == C_OSCNodeDataPoolContent::eFLOAT64))
+   {
+      // In case of a float value, the raw value does not make any sense in byte form.
+      // Use the value without scaling as raw value.
+      orc_Signal.c_RawValueDec = c_UnscaledValue;
+      orc_Signal.c_RawValueHex = c_UnscaledValue;
+   }
+   else
+   {
+      orc_Signal.c_RawValueDec = C_SCLString::IntToStr(ou64_RawValue);
+      orc_Signal.c_RawValueHex = C_SCLString::IntToHex(static_cast<sint64>(ou64_RawValue), 1U).UpperCase();
+   }
+
+   if (this->mq_ScalingActive == true)
+   {
+      orc_Signal.c_Value =
+         mh_GetFloatAsString(C_OSCUtils::h_GetValueScaled(this->m_GetValueAsFloat64(ou64_RawValue),
+                                                          this->mf64_Factor, this->mf64_Offset));
+   }
+   else
+   {
+      orc_Signal.c_Value = c_UnscaledValue;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read Intel signal out of CAN message data bytes
+
+   \param[in]  orau8_CanDb   Data bytes of CAN message (size of message checked by caller)
+
+   \return
+   signal bits (not masked)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_OSCComMessageLoggerSignalDecoder::m_ExtractIntel(const uint8(&orau8_CanDb)[STWCAN_MAX_DATA_LENGTH_FD]) const
+{
+   const uint8 * const pu8_Data = &orau8_CanDb[this->mu16_StartByte];
+   const uint8 u8_ReadBytes = (this->mu8_NumBytes > 8U) ? 8U : this->mu8_NumBytes;
+   uint64 u64_Value = 0U;
+   uint8 u8_Byte;
+
+   for (u8_Byte = 0U; u8_Byte < u8_ReadBytes; ++u8_Byte)
+   {
+      u64_Value |= static_cast<uint64>(pu8_Data[u8_Byte]) << (static_cast<uint32>(u8_Byte) * 8U);
+   }
+
+   if (this->mq_ByteAligned == false)
+   {
+      u64_Value >>= this->mu8_Shift;
+      if (this->mu8_NumBytes > 8U)
+      {
+         // 64 bit signal spread over 9 bytes
+         u64_Value |= static_cast<uint64>(pu8_Data[8]) << (64U - this->mu8_Shift);
+      }
+   }
+
+   return u64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read Motorola signal out of CAN message data bytes
+
+   \param[in]  orau8_CanDb   Data bytes of CAN message (size of message checked by caller)
+
+   \return
+   signal bits (not masked)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_OSCComMessageLoggerSignalDecoder::m_ExtractMotorola(const uint8(&orau8_CanDb)[STWCAN_MAX_DATA_LENGTH_FD])
+const
+{
+   const uint8 * const pu8_Data = &orau8_CanDb[this->mu16_StartByte];
+   const uint8 u8_ReadBytes = (this->mu8_NumBytes > 8U) ? 8U : this->mu8_NumBytes;
+   uint64 u64_Value = 0U;
+   uint8 u8_Byte;
+
+   for (u8_Byte = 0U; u8_Byte < u8_ReadBytes; ++u8_Byte)
+   {
+      u64_Value = (u64_Value << 8U) | pu8_Data[u8_Byte];
+   }
+
+   if (this->mu8_NumBytes > 8U)
+   {
+      // 64 bit signal spread over 9 bytes; the shift is relative to the end of the ninth byte
+      u64_Value = (u64_Value << (8U - this->mu8_Shift)) | (static_cast<uint64>(pu8_Data[8]) >> this->mu8_Shift);
+   }
+   else
+   {
+      u64_Value >>= this->mu8_Shift;
+   }
+
+   return u64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert raw value to float64 according to the Datapool element type
+
+   \param[in]  ou64_RawValue   Raw value as returned by Decode
+
+   \return
+   unscaled value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64 C_OSCComMessageLoggerSignalDecoder::m_GetValueAsFloat64(const uint64 ou64_RawValue) const
+{
+   float64 f64_Value;
+
+   switch (this->me_Type)
+   {
+   case C_OSCNodeDataPoolContent::eSINT8:
+      f64_Value = static_cast<float64>(static_cast<sint8>(static_cast<uint8>(ou64_RawValue)));
+      break;
+   case C_OSCNodeDataPoolContent::eSINT16:
+      f64_Value = static_cast<float64>(static_cast<sint16>(static_cast<uint16>(ou64_RawValue)));
+      break;
+   case C_OSCNodeDataPoolContent::eSINT32:
+      f64_Value = static_cast<float64>(static_cast<sint32>(static_cast<uint32>(ou64_RawValue)));
+      break;
+   case C_OSCNodeDataPoolContent::eSINT64:
+      f64_Value = static_cast<float64>(static_cast<sint64>(ou64_RawValue));
+      break;
+   case C_OSCNodeDataPoolContent::eFLOAT32:
+      {
+         const uint32 u32_Bits = static_cast<uint32>(ou64_RawValue);
+         float32 f32_Value;
+         (void)std::memcpy(&f32_Value, &u32_Bits, sizeof(f32_Value));
+         f64_Value = static_cast<float64>(f32_Value);
+      }
+      break;
+   case C_OSCNodeDataPoolContent::eFLOAT64:
+      (void)std::memcpy(&f64_Value, &ou64_RawValue, sizeof(f64_Value));
+      break;
+   case C_OSCNodeDataPoolContent::eUINT8:
+   case C_OSCNodeDataPoolContent::eUINT16:
+   case C_OSCNodeDataPoolContent::eUINT32:
+   case C_OSCNodeDataPoolContent::eUINT64:
+   default:
+      f64_Value = static_cast<float64>(ou64_RawValue);
+      break;
+   }
+
+   return f64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get unscaled value as string
+
+   Same format as C_OSCNodeDataPoolContent::GetValueAsScaledString without scaling.
+
+   \param[in]  ou64_RawValue   Raw value as returned by Decode
+
+   \return
+   unscaled value as string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCComMessageLoggerSignalDecoder::m_GetUnscaledValueAsString(const uint64 ou64_RawValue) const
+{
+   C_SCLString c_Value;
+
+   switch (this->me_Type)
+   {
+   case C_OSCNodeDataPoolContent::eSINT8:
+      c_Value = C_SCLString::IntToStr(static_cast<sint32>(static_cast<sint8>(static_cast<uint8>(ou64_RawValue))));
+      break;
+   case C_OSCNodeDataPoolContent::eSINT16:
+      c_Value = C_SCLString::IntToStr(static_cast<sint32>(static_cast<sint16>(static_cast<uint16>(ou64_RawValue))));
+      break;
+   case C_OSCNodeDataPoolContent::eSINT32:
+      c_Value = C_SCLString::IntToStr(static_cast<sint32>(static_cast<uint32>(ou64_RawValue)));
+      break;
+   case C_OSCNodeDataPoolContent::eSINT64:
+      c_Value = C_SCLString::IntToStr(static_cast<sint64>(ou64_RawValue));
+      break;
+   case C_OSCNodeDataPoolContent::eFLOAT32:
+   case C_OSCNodeDataPoolContent::eFLOAT64:
+      c_Value = mh_GetFloatAsString(this->m_GetValueAsFloat64(ou64_RawValue));
+      break;
+   case C_OSCNodeDataPoolContent::eUINT8:
+   case C_OSCNodeDataPoolContent::eUINT16:
+   case C_OSCNodeDataPoolContent::eUINT32:
+   case C_OSCNodeDataPoolContent::eUINT64:
+   default:
+      c_Value = C_SCLString::IntToStr(ou64_RawValue);
+      break;
+   }
+
+   return c_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get floating point value as string
+
+   Same format as the default formatting of std::stringstream (6 significant digits).
+
+   \param[in]  of64_Value   Value
+
+   \return
+   value as string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCComMessageLoggerSignalDecoder::mh_GetFloatAsString(const float64 of64_Value)
+{
+   C_SCLString c_Value;
+
+   c_Value.StringPrintFormatted("%g", of64_Value);
+   return c_Value;
+}
@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled decoder for CAN signals of logged CAN messages (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMMESSAGELOGGERSIGNALDECODER_H
+#define C_OSCCOMMESSAGELOGGERSIGNALDECODER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.h"
+#include "stw_can.h"
+
+#include "C_OSCCanSignal.h"
+#include "C_OSCNodeDataPoolContent.h"
+#include "C_OSCComMessageLoggerData.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OSCComMessageLoggerSignalDecoder
+{
+public:
+   C_OSCComMessageLoggerSignalDecoder(void);
+
+   void Compile(const C_OSCCanSignal & orc_Signal, const C_OSCNodeDataPoolContent::E_Type oe_Type,
+                const stw_types::float64 of64_Factor, const stw_types::float64 of64_Offset);
+
+   bool Decode(const stw_types::uint8(&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD],
+               const stw_types::uint8 ou8_CanDlc, stw_types::uint64 & oru64_RawValue) const;
+   void FormatValue(const stw_types::uint64 ou64_RawValue, C_OSCComMessageLoggerDataSignal & orc_Signal) const;
+
+private:
+   stw_types::uint64 m_ExtractIntel(const stw_types::uint8(&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD]) const;
+   stw_types::uint64 m_ExtractMotorola(const stw_types::uint8(&orau8_CanDb)[stw_can::STWCAN_MAX_DATA_LENGTH_FD])
+   const;
+   stw_types::float64 m_GetValueAsFloat64(const stw_types::uint64 ou64_RawValue) const;
+   stw_scl::C_SCLString m_GetUnscaledValueAsString(const stw_types::uint64 ou64_RawValue) const;
+
+   static stw_scl::C_SCLString mh_GetFloatAsString(const stw_types::float64 of64_Value);
+
+   bool mq_Intel;                        ///< true: Intel byte order; false: Motorola byte order
+   bool mq_ByteAligned;                  ///< signal starts and ends on a byte boundary (no shifting necessary)
+   stw_types::uint8 mu8_NumBytes;        ///< number of message bytes touched by the signal (1..9)
+   stw_types::uint8 mu8_Shift;           ///< right shift of the signal LSB within the read message bytes
+   stw_types::uint16 mu16_StartByte;     ///< first message byte touched by the signal
+   stw_types::uint16 mu16_NeededBytes;   ///< minimum number of message bytes containing the complete signal
+   stw_types::uint64 mu64_SignalMask;    ///< mask of all signal bits after shifting
+   stw_types::uint64 mu64_SignalSignBit; ///< sign bit of signal; 0 if no relocation of the sign bit is necessary
+   stw_types::uint64 mu64_TypeSignBit;   ///< sign bit of the Datapool element type
+   C_OSCNodeDataPoolContent::E_Type me_Type;
+   bool mq_ScalingActive;
+   stw_types::float64 mf64_Factor;
+   stw_types::float64 mf64_Offset;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
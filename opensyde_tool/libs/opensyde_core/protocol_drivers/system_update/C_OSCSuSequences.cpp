@@ -12,8 +12,10 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h"
 
+#include <deque>
 #include <fstream>
 #include <iterator>
+#include <map>
 #include <set>
 #include "stwtypes.h"
 #include "stwerrors.h"
@@ -27,6 +29,7 @@
 #include "C_OsyHexFile.h"
 #include "C_OSCLoggingHandler.h"
 #include "C_OSCUtils.h"
+#include "C_OSCZipFile.h"
 #include "C_OSCDataDealerNvmSafe.h"
 #include "C_OSCDiagProtocolOsy.h"
 
@@ -267,6 +270,10 @@ sint32 C_OSCSuSequences::m_XflReportProgress(const uint8 ou8_Progress, const C_S
    \param[in]  orc_OtherAcceptedDeviceNames  Other accepted device names
    \param[in]  ou32_RequestDownloadTimeout   Maximum time in ms it can take to erase one continuous area in flash
    \param[in]  ou32_TransferDataTimeout      Maximum time in ms it can take to write up to 4kB of data to flash
+   \param[in]  oq_DeltaFlashing              true: only flash modified sectors if the server supports it
+                                             (device definition: q_FlashloaderOpenSydeDeltaFlashing)
+   \param[in]  oq_PipelinedTransferData      true: keep multiple TransferData blocks in flight if the server supports it
+                                             (device definition: q_FlashloaderOpenSydePipelinedTransferData)
 
    \return
    C_NO_ERR    flashed all files
@@ -282,12 +289,14 @@ sint32 C_OSCSuSequences::m_XflReportProgress(const uint8 ou8_Progress, const C_S
 sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> & orc_FilesToFlash,
                                                 const std::vector<C_SCLString> & orc_OtherAcceptedDeviceNames,
                                                 const uint32 ou32_RequestDownloadTimeout,
-                                                const uint32 ou32_TransferDataTimeout)
+                                                const uint32 ou32_TransferDataTimeout, const bool oq_DeltaFlashing,
+                                                const bool oq_PipelinedTransferData)
 {
    sint32 s32_Return = C_NO_ERR;
    uint32 u32_Return;
 
    std::vector<uint32> c_SignatureAddresses(orc_FilesToFlash.size()); ///< addresses of signatures within hex files
+   C_SCLString c_PackageFileName;
 
    //C_OsyHexFile cannot be copied; so we cannot put it into a resizable vector
    //-> create instances manually
@@ -302,7 +311,33 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
    {
       (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_HEX_OPEN_START, C_NO_ERR, 0U, mc_CurrentNode,
                              "Opening HEX file " + orc_FilesToFlash[u32_File] + ".");
-      u32_Return = c_Files[u32_File]->LoadFromFile(orc_FilesToFlash[u32_File].c_str());
+      if ((TGL_FileExists(orc_FilesToFlash[u32_File]) == false) &&
+          (this->m_GetUpdatePackageFileName(orc_FilesToFlash[u32_File], c_PackageFileName) == true))
+      {
+         //not unpacked: parse directly from the update package
+         std::vector<uint8> c_FileContent;
+         if (C_OSCZipFile::h_ReadFileFromZipFile(this->mc_UpdatePackagePath, c_PackageFileName,
+                                                 c_FileContent) == C_NO_ERR)
+         {
+            u32_Return = c_Files[u32_File]->LoadDataDumpFromMemoryCached(c_FileContent,
+                                                                         this->mc_HexFileCacheDirectory);
+         }
+         else
+         {
+            u32_Return = stw_hex_file::ERR_CANT_OPEN_FILE;
+         }
+      }
+      else
+      {
+         u32_Return = c_Files[u32_File]->LoadDataDumpFromFileCached(orc_FilesToFlash[u32_File],
+                                                                    this->mc_HexFileCacheDirectory);
+      }
+      if (c_Files[u32_File]->IsLoadedFromCache() == true)
+      {
+         osc_write_log_info("Update Node", "Bus Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_BusIdentifier) +
+                            " Node Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_NodeIdentifier) +
+                            ": Took data of HEX file " + orc_FilesToFlash[u32_File] + " from cache.");
+      }
       if (u32_Return != stw_hex_file::NO_ERR)
       {
          C_SCLString c_ErrorText = c_Files[u32_File]->ErrorCodeToErrorText(u32_Return);
@@ -323,6 +358,14 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
       }
    }
 
+   //keep the cache within its limits; the files just loaded are the newest ones and removed last
+   if (this->mc_HexFileCacheDirectory != "")
+   {
+      C_OsyHexFile::h_CleanUpCacheDirectory(this->mc_HexFileCacheDirectory,
+                                            static_cast<uint64>(this->mu32_HexFileCacheMaxSizeMB) * 1024U * 1024U,
+                                            this->mu32_HexFileCacheMaxAgeDays);
+   }
+
    if (s32_Return == C_NO_ERR)
    {
       C_SCLString c_DeviceName;
@@ -475,6 +518,20 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
       s32_Return = this->m_WriteFingerPrintOsy();
       if (s32_Return == C_NO_ERR)
       {
+         //the features do not change while we are in the flashloader: read them once for all files
+         //if they can not be read we stay with the conservative approach (one block at a time, complete files)
+         C_OSCProtocolDriverOsy::C_ListOfFeatures c_AvailableFeatures;
+         if (this->mpc_ComDriver->SendOsyReadListOfFeatures(mc_CurrentNode, c_AvailableFeatures) != C_NO_ERR)
+         {
+            c_AvailableFeatures.q_PipelinedTransferDataSupported = false;
+            c_AvailableFeatures.q_FlashSectorChecksumsAvailable = false;
+         }
+         //pipelining is only used for device types which explicitly allow it
+         if (oq_PipelinedTransferData == false)
+         {
+            c_AvailableFeatures.q_PipelinedTransferDataSupported = false;
+         }
+
          //now do the real flashing ...
          for (uint32 u32_File = 0U; u32_File < orc_FilesToFlash.size(); u32_File++)
          {
@@ -484,11 +541,23 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
 
             if (pc_HexDump != NULL)
             {
+               stw_hex_file::C_HexDataDump c_ModifiedData;
+               const stw_hex_file::C_HexDataDump * pc_DataToFlash = pc_HexDump;
+
                // Save file index
                this->mu32_CurrentFile = u32_File;
 
+               //only transfer the modified sectors if the server can tell us what it has; otherwise flash everything
                //lint -e{613}  //see assertion
-               s32_Return = m_FlashOneFileOpenSydeHex(*pc_HexDump, c_SignatureAddresses[u32_File],
+               if ((oq_DeltaFlashing == true) &&
+                   (m_GetModifiedFlashData(*pc_HexDump, c_SignatureAddresses[u32_File], c_AvailableFeatures,
+                                           c_ModifiedData) == C_NO_ERR))
+               {
+                  pc_DataToFlash = &c_ModifiedData;
+               }
+
+               s32_Return = m_FlashOneFileOpenSydeHex(*pc_DataToFlash, c_SignatureAddresses[u32_File],
+                                                      c_AvailableFeatures.q_PipelinedTransferDataSupported,
                                                       ou32_RequestDownloadTimeout, ou32_TransferDataTimeout);
                if (s32_Return != C_NO_ERR)
                {
@@ -523,6 +592,9 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
 
    \param[in]     orc_HexDataDump               Dump of file to flash
    \param[in]     ou32_SignatureAddress         address of signature block within hex file
+   \param[in]     oq_PipelinedTransfer          true: keep multiple TransferData blocks in flight
+                                                (server reports "q_PipelinedTransferDataSupported" and the device
+                                                definition allows it)
    \param[in]     ou32_RequestDownloadTimeout   Maximum time in ms it can take to erase one continuous area in flash
    \param[in]     ou32_TransferDataTimeout      Maximum time in ms it can take to write up to 4kB of data to flash
 
@@ -534,12 +606,14 @@ sint32 C_OSCSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SCLString> &
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCSuSequences::m_FlashOneFileOpenSydeHex(const stw_hex_file::C_HexDataDump & orc_HexDataDump,
                                                    const uint32 ou32_SignatureAddress,
+                                                   const bool oq_PipelinedTransfer,
                                                    const uint32 ou32_RequestDownloadTimeout,
                                                    const uint32 ou32_TransferDataTimeout)
 {
    sint32 s32_Return = C_NO_ERR;
    uint32 u32_TotalNumberOfBytes = 0U;
    uint32 u32_TotalNumberOfBytesFlashed = 0U;
+   const uint32 u32_StartTime = stw_tgl::TGL_GetTickCount();
 
    (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FLASH_HEX_START, C_NO_ERR, 0U, mc_CurrentNode,
                           "Flashing HEX file ...");
@@ -600,7 +674,16 @@ sint32 C_OSCSuSequences::m_FlashOneFileOpenSydeHex(const stw_hex_file::C_HexData
             s32_Return = C_COM;
          }
       }
-      if (s32_Return == C_NO_ERR)
+      if ((s32_Return == C_NO_ERR) && (oq_PipelinedTransfer == true))
+      {
+         //perform the actual transfer with multiple blocks in flight
+         //set a proper timeout
+         (void)this->mpc_ComDriver->OsySetPollingTimeout(mc_CurrentNode, ou32_TransferDataTimeout);
+
+         s32_Return = m_TransferAreaPipelined(orc_HexDataDump, s32_Area, u32_MaxBlockLength, u32_TotalNumberOfBytes,
+                                              u32_TotalNumberOfBytesFlashed, u8_ProgressPercentage);
+      }
+      else if (s32_Return == C_NO_ERR)
       {
          //perform the actual transfer
          uint8 u8_BlockSequenceCounter = 1U;
@@ -669,6 +752,10 @@ sint32 C_OSCSuSequences::m_FlashOneFileOpenSydeHex(const stw_hex_file::C_HexData
             }
          }
       }
+      else
+      {
+         // Nothing to do
+      }
 
       // Reset the timeout. The services with the specific timeouts are finished.
       (void)this->mpc_ComDriver->OsyResetPollingTimeout(mc_CurrentNode);
@@ -717,8 +804,376 @@ sint32 C_OSCSuSequences::m_FlashOneFileOpenSydeHex(const stw_hex_file::C_HexData
 
    if (s32_Return == C_NO_ERR)
    {
-      (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FLASH_HEX_FINISHED, C_NO_ERR, 100U, mc_CurrentNode,
-                             "Flashing HEX file finished.");
+      //report effective throughput (including erasing and finalizing the areas)
+      const uint32 u32_Duration = stw_tgl::TGL_GetTickCount() - u32_StartTime;
+      const uint32 u32_BytesPerSecond =
+         static_cast<uint32>((static_cast<uint64>(u32_TotalNumberOfBytes) * 1000ULL) /
+                             static_cast<uint64>((u32_Duration > 0U) ? u32_Duration : 1U));
+      C_SCLString c_Text;
+      c_Text.PrintFormatted("Flashing HEX file finished. (%u bytes in %u ms: %u bytes/s; %s transfer)",
+                            u32_TotalNumberOfBytes, u32_Duration, u32_BytesPerSecond,
+                            (oq_PipelinedTransfer == true) ? "pipelined" : "sequential");
+      osc_write_log_info("Update Node", "Bus Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_BusIdentifier) +
+                         " Node Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_NodeIdentifier) + ": " + c_Text);
+      (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FLASH_HEX_FINISHED, C_NO_ERR, 100U, mc_CurrentNode, c_Text);
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get HEX data of flash sectors that need to be written
+
+   Used for servers reporting "q_FlashSectorChecksumsAvailable".
+   The server reports a CRC32 for each flash sector (erase unit) overlapping the areas of the HEX file.
+   For each sector the expected content is assembled from the HEX data (unused bytes are expected to be erased: 0xFF)
+   and its CRC32 compared with the one reported by the server.
+
+   orc_ModifiedData contains the HEX data of all sectors whose content differs, clipped to the areas of the HEX file
+   and merged into continuous blocks.
+   The sector containing the signature is always part of the result, so the final TransferExit still triggers the
+   signature check on the server.
+
+   Assumptions/prerequisites (not explicitly checked by this function):
+   * mc_CurrentNode contains ID of node to work with
+   * target is in programming session with security level 3 active
+   * areas of the HEX file are sorted by address and do not overlap
+
+   \param[in]     orc_HexDataDump         Dump of file to flash
+   \param[in]     ou32_SignatureAddress   address of signature block within hex file
+   \param[in]     orc_AvailableFeatures   features reported by the server
+   \param[out]    orc_ModifiedData        HEX data to flash (only valid if C_NO_ERR is returned)
+
+   \return
+   C_NO_ERR   modified data determined; it is sufficient to flash orc_ModifiedData
+   C_NOACT    server does not report sector checksums; the whole file needs to be flashed
+   C_RD_WR    server reported sectors that do not properly cover the file; the whole file needs to be flashed
+   C_COM      communication driver reported problem; the whole file needs to be flashed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCSuSequences::m_GetModifiedFlashData(const stw_hex_file::C_HexDataDump & orc_HexDataDump,
+                                                const uint32 ou32_SignatureAddress,
+                                                const C_OSCProtocolDriverOsy::C_ListOfFeatures & orc_AvailableFeatures,
+                                                stw_hex_file::C_HexDataDump & orc_ModifiedData)
+{
+   sint32 s32_Return = C_NO_ERR;
+   //all sectors covered by the file; sorted by start address:
+   std::map<uint32, C_OSCProtocolDriverOsy::C_FlashSectorChecksum> c_Sectors;
+   uint32 u32_TotalNumberOfBytes = 0U;
+   uint32 u32_ModifiedNumberOfBytes = 0U;
+
+   orc_ModifiedData.at_Blocks.SetLength(0);
+
+   if (orc_AvailableFeatures.q_FlashSectorChecksumsAvailable == false)
+   {
+      s32_Return = C_NOACT;
+   }
+
+   //get checksums of all sectors covered by the areas
+   for (sint32 s32_Area = 0; (s32_Area < orc_HexDataDump.at_Blocks.GetLength()) && (s32_Return == C_NO_ERR);
+        s32_Area++)
+   {
+      const stw_hex_file::C_HexDataDumpBlock & rc_Area = orc_HexDataDump.at_Blocks[s32_Area];
+      const uint32 u32_AreaSize = static_cast<uint32>(rc_Area.au8_Data.GetLength());
+      const uint64 u64_AreaEnd = static_cast<uint64>(rc_Area.u32_AddressOffset) + u32_AreaSize;
+      uint64 u64_CoveredUpTo = rc_Area.u32_AddressOffset;
+      std::vector<C_OSCProtocolDriverOsy::C_FlashSectorChecksum> c_AreaSectors;
+
+      u32_TotalNumberOfBytes += u32_AreaSize;
+      s32_Return = this->mpc_ComDriver->SendOsyReadFlashSectorChecksums(mc_CurrentNode, rc_Area.u32_AddressOffset,
+                                                                        u32_AreaSize, c_AreaSectors);
+      if (s32_Return != C_NO_ERR)
+      {
+         s32_Return = C_COM;
+      }
+
+      //the sectors must cover the area without gaps; otherwise we can not tell which parts remain unchanged
+      for (uint32 u32_Sector = 0U; (u32_Sector < c_AreaSectors.size()) && (s32_Return == C_NO_ERR); u32_Sector++)
+      {
+         const C_OSCProtocolDriverOsy::C_FlashSectorChecksum & rc_Sector = c_AreaSectors[u32_Sector];
+         const uint64 u64_SectorEnd = static_cast<uint64>(rc_Sector.u32_StartAddress) + rc_Sector.u32_Size;
+         if ((rc_Sector.u32_Size == 0U) || (rc_Sector.u32_StartAddress > u64_CoveredUpTo))
+         {
+            s32_Return = C_RD_WR;
+         }
+         else
+         {
+            if (u64_SectorEnd > u64_CoveredUpTo)
+            {
+               u64_CoveredUpTo = u64_SectorEnd;
+            }
+            c_Sectors[rc_Sector.u32_StartAddress] = rc_Sector;
+         }
+      }
+      if ((s32_Return == C_NO_ERR) && (u64_CoveredUpTo < u64_AreaEnd))
+      {
+         s32_Return = C_RD_WR;
+      }
+   }
+
+   //compare the checksums with the expected content of each sector
+   if (s32_Return == C_NO_ERR)
+   {
+      std::vector<uint8> c_Image;
+      uint64 u64_PreviousSectorEnd = 0U;
+
+      for (std::map<uint32, C_OSCProtocolDriverOsy::C_FlashSectorChecksum>::const_iterator c_It = c_Sectors.begin();
+           (c_It != c_Sectors.end()) && (s32_Return == C_NO_ERR); ++c_It)
+      {
+         const C_OSCProtocolDriverOsy::C_FlashSectorChecksum & rc_Sector = c_It->second;
+         const uint64 u64_SectorEnd = static_cast<uint64>(rc_Sector.u32_StartAddress) + rc_Sector.u32_Size;
+
+         if (rc_Sector.u32_StartAddress < u64_PreviousSectorEnd)
+         {
+            //overlapping sectors: inconsistent information from server
+            s32_Return = C_RD_WR;
+         }
+         else
+         {
+            uint32 u32_Checksum = 0xFFFFFFFFU;
+            bool q_Modified;
+
+            c_Image.assign(rc_Sector.u32_Size, 0xFFU);
+            for (sint32 s32_Area = 0; s32_Area < orc_HexDataDump.at_Blocks.GetLength(); s32_Area++)
+            {
+               const stw_hex_file::C_HexDataDumpBlock & rc_Area = orc_HexDataDump.at_Blocks[s32_Area];
+               const uint64 u64_AreaEnd = static_cast<uint64>(rc_Area.u32_AddressOffset) +
+                                          static_cast<uint64>(rc_Area.au8_Data.GetLength());
+               const uint64 u64_Start = std::max(static_cast<uint64>(rc_Area.u32_AddressOffset),
+                                                 static_cast<uint64>(rc_Sector.u32_StartAddress));
+               const uint64 u64_End = std::min(u64_AreaEnd, u64_SectorEnd);
+               if (u64_Start < u64_End)
+               {
+                  (void)memcpy(&c_Image[static_cast<uintn>(u64_Start - rc_Sector.u32_StartAddress)],
+                               &rc_Area.au8_Data[static_cast<sint32>(u64_Start - rc_Area.u32_AddressOffset)],
+                               static_cast<size_t>(u64_End - u64_Start));
+               }
+            }
+            C_SCLChecksums::CalcCRC32(&c_Image[0], rc_Sector.u32_Size, u32_Checksum);
+            u32_Checksum ^= 0xFFFFFFFFU;
+
+            q_Modified = (u32_Checksum != rc_Sector.u32_Checksum) ||
+                         ((ou32_SignatureAddress >= rc_Sector.u32_StartAddress) &&
+                          (static_cast<uint64>(ou32_SignatureAddress) < u64_SectorEnd));
+            if (q_Modified == true)
+            {
+               //add the file's data within the sector; append to the previous block if continuous
+               for (sint32 s32_Area = 0; s32_Area < orc_HexDataDump.at_Blocks.GetLength(); s32_Area++)
+               {
+                  const stw_hex_file::C_HexDataDumpBlock & rc_Area = orc_HexDataDump.at_Blocks[s32_Area];
+                  const uint64 u64_AreaEnd = static_cast<uint64>(rc_Area.u32_AddressOffset) +
+                                             static_cast<uint64>(rc_Area.au8_Data.GetLength());
+                  const uint64 u64_Start = std::max(static_cast<uint64>(rc_Area.u32_AddressOffset),
+                                                    static_cast<uint64>(rc_Sector.u32_StartAddress));
+                  const uint64 u64_End = std::min(u64_AreaEnd, u64_SectorEnd);
+                  if (u64_Start < u64_End)
+                  {
+                     const sint32 s32_Size = static_cast<sint32>(u64_End - u64_Start);
+                     const sint32 s32_LastBlock = orc_ModifiedData.at_Blocks.GetHigh();
+                     stw_hex_file::C_HexDataDumpBlock * pc_Block = NULL;
+                     sint32 s32_Offset;
+
+                     if ((s32_LastBlock >= 0) &&
+                         ((static_cast<uint64>(orc_ModifiedData.at_Blocks[s32_LastBlock].u32_AddressOffset) +
+                           static_cast<uint64>(orc_ModifiedData.at_Blocks[s32_LastBlock].au8_Data.GetLength())) ==
+                          u64_Start))
+                     {
+                        pc_Block = &orc_ModifiedData.at_Blocks[s32_LastBlock];
+                     }
+                     else
+                     {
+                        orc_ModifiedData.at_Blocks.IncLength();
+                        pc_Block = &orc_ModifiedData.at_Blocks[orc_ModifiedData.at_Blocks.GetHigh()];
+                        pc_Block->u32_AddressOffset = static_cast<uint32>(u64_Start);
+                     }
+
+                     s32_Offset = pc_Block->au8_Data.GetLength();
+                     pc_Block->au8_Data.IncLength(s32_Size);
+                     (void)memcpy(&pc_Block->au8_Data[s32_Offset],
+                                  &rc_Area.au8_Data[static_cast<sint32>(u64_Start - rc_Area.u32_AddressOffset)],
+                                  static_cast<size_t>(s32_Size));
+                     u32_ModifiedNumberOfBytes += static_cast<uint32>(s32_Size);
+                  }
+               }
+            }
+            u64_PreviousSectorEnd = u64_SectorEnd;
+         }
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      C_SCLString c_Text;
+      c_Text.PrintFormatted("Delta flashing: %u of %u bytes in modified sectors (%u sectors checked).",
+                            u32_ModifiedNumberOfBytes, u32_TotalNumberOfBytes, static_cast<uint32>(c_Sectors.size()));
+      osc_write_log_info("Update Node", "Bus Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_BusIdentifier) +
+                         " Node Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_NodeIdentifier) + ": " + c_Text);
+   }
+   else if (s32_Return != C_NOACT)
+   {
+      osc_write_log_warning("Update Node", "Bus Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_BusIdentifier) +
+                            " Node Id: " + C_SCLString::IntToStr(mc_CurrentNode.u8_NodeIdentifier) +
+                            ": Could not determine modified flash sectors (error code: " +
+                            C_SCLString::IntToStr(s32_Return) + "). Flashing complete file.");
+   }
+   else
+   {
+      // Nothing to do
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Transfer data of one HEX file area with multiple TransferData requests in flight
+
+   Used for servers reporting "q_PipelinedTransferDataSupported".
+   Up to mhu32_TRANSFER_DATA_PIPELINE_DEPTH blocks are sent before the response to the oldest block is awaited.
+   The server responds in the order of the requests.
+
+   If the server rejects the oldest outstanding block with "busy" or "wrong block sequence counter" it will reject
+   all following blocks as well. In this case the responses to the remaining blocks are drained and the transfer is
+   resumed at the rejected block (up to mhu32_TRANSFER_DATA_MAX_RETRIES times per block).
+
+   Assumptions/prerequisites (not explicitly checked by this function):
+   * mc_CurrentNode contains ID of node to work with
+   * RequestDownload for the area was successful
+
+   \param[in]     orc_HexDataDump                  HEX data to flash
+   \param[in]     os32_Area                        index of area within orc_HexDataDump
+   \param[in]     ou32_MaxBlockLength              maximum block length reported by RequestDownload
+   \param[in]     ou32_TotalNumberOfBytes          total number of bytes of all areas (for progress calculation)
+   \param[in,out] oru32_TotalNumberOfBytesFlashed  number of bytes of all areas confirmed by the server
+   \param[in,out] oru8_ProgressPercentage          progress of flashing the HEX file
+
+   \return
+   C_NO_ERR   area transferred
+   C_BUSY     aborted by user
+   C_COM      communication error (was reported with eUPDATE_SYSTEM_OSY_NODE_FLASH_HEX_AREA_TRANSFER_ERROR)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCSuSequences::m_TransferAreaPipelined(const stw_hex_file::C_HexDataDump & orc_HexDataDump,
+                                                 const sint32 os32_Area, const uint32 ou32_MaxBlockLength,
+                                                 const uint32 ou32_TotalNumberOfBytes,
+                                                 uint32 & oru32_TotalNumberOfBytesFlashed,
+                                                 uint8 & oru8_ProgressPercentage)
+{
+   sint32 s32_Return = C_NO_ERR;
+   const uint32 u32_AreaSize = orc_HexDataDump.at_Blocks[os32_Area].au8_Data.GetLength();
+   const uint32 u32_BlockSize = ou32_MaxBlockLength - 5U;
+   std::deque<C_TransferDataBlock> c_Outstanding;
+   std::vector<uint8> c_Data;
+   uint8 u8_BlockSequenceCounter = 1U;
+   uint8 u8_NrCode = 0U;
+   uint32 u32_NextOffset = 0U;
+   uint32 u32_ConfirmedBytes = 0U;
+   uint32 u32_NumRetries = 0U;
+
+   while ((s32_Return == C_NO_ERR) && (u32_ConfirmedBytes < u32_AreaSize))
+   {
+      C_SCLString c_Text;
+      bool q_Abort;
+
+      c_Text.PrintFormatted("Writing data for area %02d/%02d  byte %08d/%08d ...",
+                            os32_Area + 1, orc_HexDataDump.at_Blocks.GetLength(), u32_ConfirmedBytes, u32_AreaSize);
+      q_Abort = m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FLASH_HEX_AREA_TRANSFER_START, C_NO_ERR,
+                                 oru8_ProgressPercentage, mc_CurrentNode, c_Text);
+      if (q_Abort == true)
+      {
+         (void)m_ReportProgress(eUPDATE_SYSTEM_ABORTED, C_NO_ERR, oru8_ProgressPercentage,
+                                mc_CurrentNode, "Flashing HEX file aborted.");
+         s32_Return = C_BUSY;
+      }
+
+      //fill the pipeline
+      while ((s32_Return == C_NO_ERR) && (c_Outstanding.size() < mhu32_TRANSFER_DATA_PIPELINE_DEPTH) &&
+             (u32_NextOffset < u32_AreaSize))
+      {
+         C_TransferDataBlock c_Block;
+         c_Block.u8_BlockSequenceCounter = u8_BlockSequenceCounter;
+         c_Block.u32_Offset = u32_NextOffset;
+         c_Block.u32_Size = ((u32_AreaSize - u32_NextOffset) > u32_BlockSize) ? u32_BlockSize :
+                            (u32_AreaSize - u32_NextOffset);
+
+         c_Data.resize(c_Block.u32_Size);
+         (void)memcpy(&c_Data[0], &orc_HexDataDump.at_Blocks[os32_Area].au8_Data[static_cast<sint32>(u32_NextOffset)],
+                      c_Data.size());
+
+         s32_Return = this->mpc_ComDriver->SendOsyTransferDataRequest(mc_CurrentNode, u8_BlockSequenceCounter,
+                                                                      c_Data);
+         if (s32_Return == C_NO_ERR)
+         {
+            c_Outstanding.push_back(c_Block);
+            u32_NextOffset += c_Block.u32_Size;
+            u8_BlockSequenceCounter = (u8_BlockSequenceCounter < 0xFFU) ? (u8_BlockSequenceCounter + 1U) : 0x00U;
+         }
+         else
+         {
+            (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FLASH_HEX_AREA_TRANSFER_ERROR, s32_Return,
+                                   oru8_ProgressPercentage, mc_CurrentNode, "Could not write data. Details: " +
+                                   C_OSCProtocolDriverOsy::h_GetOpenSydeServiceErrorDetails(s32_Return, 0U));
+            s32_Return = C_COM;
+         }
+      }
+
+      //wait for the response to the oldest block
+      if (s32_Return == C_NO_ERR)
+      {
+         uint8 u8_ConfirmedSequenceCounter = 0U;
+
+         tgl_assert(c_Outstanding.empty() == false); //there is unconfirmed data left; so it must be in flight
+         s32_Return = this->mpc_ComDriver->ReceiveOsyTransferDataResponse(mc_CurrentNode,
+                                                                          u8_ConfirmedSequenceCounter, &u8_NrCode);
+         if ((s32_Return == C_NO_ERR) &&
+             (u8_ConfirmedSequenceCounter != c_Outstanding.front().u8_BlockSequenceCounter))
+         {
+            //response does not match the oldest request
+            s32_Return = C_RD_WR;
+         }
+
+         if (s32_Return == C_NO_ERR)
+         {
+            u32_ConfirmedBytes += c_Outstanding.front().u32_Size;
+            oru32_TotalNumberOfBytesFlashed += c_Outstanding.front().u32_Size;
+            c_Outstanding.pop_front();
+            u32_NumRetries = 0U;
+            // Prevent an overflow when file is bigger than 43MB
+            oru8_ProgressPercentage =
+               static_cast<uint8>((static_cast<uint64>(oru32_TotalNumberOfBytesFlashed) * 100ULL) /
+                                  static_cast<uint64>(ou32_TotalNumberOfBytes));
+         }
+         else if ((s32_Return == C_WARN) && (u32_NumRetries < mhu32_TRANSFER_DATA_MAX_RETRIES) &&
+                  ((u8_NrCode == C_OSCProtocolDriverOsy::hu8_NR_CODE_BUSY_REPEAT_REQUEST) ||
+                   (u8_NrCode == C_OSCProtocolDriverOsy::hu8_NR_CODE_WRONG_BLOCK_SEQUENCE_COUNTER)))
+         {
+            bool q_ResponsesLeft = true;
+
+            //the server rejected the oldest block; so it will reject all following blocks in flight as well
+            //drain the responses to these; results are irrelevant as all blocks will be sent again
+            for (uint32 u32_Block = 1U; (u32_Block < c_Outstanding.size()) && (q_ResponsesLeft == true); u32_Block++)
+            {
+               uint8 u8_Ignored;
+               if (this->mpc_ComDriver->ReceiveOsyTransferDataResponse(mc_CurrentNode, u8_Ignored) == C_TIMEOUT)
+               {
+                  q_ResponsesLeft = false;
+               }
+            }
+
+            //resume at the rejected block
+            u32_NextOffset = c_Outstanding.front().u32_Offset;
+            u8_BlockSequenceCounter = c_Outstanding.front().u8_BlockSequenceCounter;
+            c_Outstanding.clear();
+            u32_NumRetries++;
+            s32_Return = C_NO_ERR;
+         }
+         else
+         {
+            (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_FLASH_HEX_AREA_TRANSFER_ERROR, s32_Return,
+                                   oru8_ProgressPercentage, mc_CurrentNode, "Could not write data. Details: " +
+                                   C_OSCProtocolDriverOsy::h_GetOpenSydeServiceErrorDetails(s32_Return, u8_NrCode));
+            s32_Return = C_COM;
+         }
+      }
    }
 
    return s32_Return;
@@ -1543,7 +1998,12 @@ sint32 C_OSCSuSequences::m_ReadDeviceInformationStwFlashloader(const uint8 ou8_P
 C_OSCSuSequences::C_OSCSuSequences(void) :
    C_OSCComSequencesBase(true),
    mu32_CurrentNode(0U),
-   mu32_CurrentFile(0U)
+   mu32_CurrentFile(0U),
+   mc_HexFileCacheDirectory(""),
+   mu32_HexFileCacheMaxSizeMB(0U),
+   mu32_HexFileCacheMaxAgeDays(0U),
+   mc_UpdatePackagePath(""),
+   mc_UpdatePackageUnzipPath("")
 {
 }
 
@@ -1573,6 +2033,9 @@ C_OSCSuSequences::~C_OSCSuSequences(void)
    * Files for address based targets and NVM files will be renamed to prevent possible conflicts
    * Flash files for file based devices will not be renamed (as they need to be unique anyway)
    * Does not report any progress via m_ReportProgress().
+   * With oq_CopyFiles = false only the (empty) target folder is created and the resulting paths are returned
+     without copying any file. This can be used by callers that stream the files to their destination on their own
+     (e.g. into a zip archive).
 
    \param[in]     orc_Nodes               List of nodes (part of system definition)
    \param[in]     orc_ActiveNodes         Vector of flags for each node in orc_Nodes
@@ -1583,6 +2046,8 @@ C_OSCSuSequences::~C_OSCSuSequences(void)
                                           out: Paths to resulting files copied and renamed by this function
                                           if the function returns an error this parameter will not be modified
    \param[in,out] opc_ErrorPath           Optional pointer to store path error details (current: which file did fail)
+   \param[in]     oq_CopyFiles            true: copy files and create sub folders of nodes
+                                          false: do not copy files; only determine resulting paths
 
    \return
    C_NO_ERR    files copied
@@ -1603,7 +2068,7 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                                                  const std::vector<uint8> & orc_ActiveNodes,
                                                  const C_SCLString & orc_TargetPath,
                                                  std::vector<C_DoFlash> & orc_ApplicationsToWrite,
-                                                 C_SCLString * const opc_ErrorPath)
+                                                 C_SCLString * const opc_ErrorPath, const bool oq_CopyFiles)
 {
    sint32 s32_Return = C_NO_ERR;
 
@@ -1763,7 +2228,10 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                c_NodeTargetPaths[u16_Node] = TGL_FileIncludeTrailingDelimiter(
                   orc_TargetPath + orc_Nodes[u16_Node].c_Properties.c_Name);
 
-               s32_Return = TGL_CreateDirectory(c_NodeTargetPaths[u16_Node]);
+               if (oq_CopyFiles == true)
+               {
+                  s32_Return = TGL_CreateDirectory(c_NodeTargetPaths[u16_Node]);
+               }
                if (s32_Return != 0)
                {
                   if (opc_ErrorPath != NULL)
@@ -1809,7 +2277,10 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                }
 
                //copy file
-               s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               if (oq_CopyFiles == true)
+               {
+                  s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               }
                if (s32_Return == C_NO_ERR)
                {
                   c_NodesToFlashNewPaths[u16_Node].c_FilesToFlash[u16_File] = c_TargetFileName;
@@ -1834,7 +2305,10 @@ sint32 C_OSCSuSequences::h_CreateTemporaryFolder(const std::vector<C_OSCNode> &
                   TGL_ExtractFileName(orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u16_File]);
 
                //copy file
-               s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               if (oq_CopyFiles == true)
+               {
+                  s32_Return = mh_CopyFile(c_SourceFileName, c_TargetFileName, opc_ErrorPath);
+               }
                if (s32_Return == C_NO_ERR)
                {
                   c_NodesToFlashNewPaths[u16_Node].c_FilesToWriteToNvm[u16_File] = c_TargetFileName;
@@ -2663,6 +3137,10 @@ sint32 C_OSCSuSequences::ReadDeviceInformation(const bool oq_FailOnFirstError)
    *** flash all configured applications
    *** write all defined NVM parameter set files to NVM
 
+   The nodes are updated one after another in the order defined by orc_NodesOrder.
+   Nodes on other buses are reached via routing through the bus the PC is connected to, using the one communication
+   driver of this class. So there is no independent path per bus that nodes could be updated on in parallel.
+
    Progress report:
    * Reports 0..100 for the overall process
    * Reports 0..100 for each file of each individual node being flashed
@@ -2748,12 +3226,20 @@ sint32 C_OSCSuSequences::UpdateSystem(const std::vector<C_OSCSuSequences::C_DoFl
 
                if (s32_Return == C_NO_ERR)
                {
+                  //HEX files for address based openSYDE nodes can be parsed directly from the update package
+                  const C_OSCNode & rc_Node = this->mpc_SystemDefinition->c_Nodes[u16_Node];
+                  const bool q_HexFileFromPackage =
+                     (rc_Node.c_Properties.e_FlashLoader == C_OSCNodeProperties::eFL_OPEN_SYDE) &&
+                     (rc_Node.pc_DeviceDefinition != NULL) &&
+                     (rc_Node.pc_DeviceDefinition->q_FlashloaderOpenSydeIsFileBased == false);
+
                   //do all files exist ?
                   //files for flash:
                   for (uint32 u32_File = 0U; u32_File < orc_ApplicationsToWrite[u16_Node].c_FilesToFlash.size();
                        u32_File++)
                   {
-                     if (TGL_FileExists(orc_ApplicationsToWrite[u16_Node].c_FilesToFlash[u32_File]) == false)
+                     if (this->m_ProvideFile(orc_ApplicationsToWrite[u16_Node].c_FilesToFlash[u32_File],
+                                             q_HexFileFromPackage) != C_NO_ERR)
                      {
                         osc_write_log_error("System Update", "Could not find file \"" +
                                             orc_ApplicationsToWrite[u16_Node].c_FilesToFlash[u32_File] + "\" !");
@@ -2765,7 +3251,8 @@ sint32 C_OSCSuSequences::UpdateSystem(const std::vector<C_OSCSuSequences::C_DoFl
                   for (uint32 u32_File = 0U; u32_File < orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm.size();
                        u32_File++)
                   {
-                     if (TGL_FileExists(orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u32_File]) == false)
+                     if (this->m_ProvideFile(orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u32_File],
+                                             false) != C_NO_ERR)
                      {
                         osc_write_log_error("System Update", "Could not find file \"" +
                                             orc_ApplicationsToWrite[u16_Node].c_FilesToWriteToNvm[u32_File] + "\" !");
@@ -2890,7 +3377,9 @@ sint32 C_OSCSuSequences::UpdateSystem(const std::vector<C_OSCSuSequences::C_DoFl
                                     orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
                                     orc_ApplicationsToWrite[u32_NodeIndex].c_OtherAcceptedDeviceNames,
                                     pc_DeviceDefinition->u32_FlashloaderOpenSydeRequestDownloadTimeout,
-                                    pc_DeviceDefinition->u32_FlashloaderOpenSydeTransferDataTimeout);
+                                    pc_DeviceDefinition->u32_FlashloaderOpenSydeTransferDataTimeout,
+                                    pc_DeviceDefinition->q_FlashloaderOpenSydeDeltaFlashing,
+                                    pc_DeviceDefinition->q_FlashloaderOpenSydePipelinedTransferData);
                               }
                               else
                               {
@@ -2954,6 +3443,52 @@ sint32 C_OSCSuSequences::UpdateSystem(const std::vector<C_OSCSuSequences::C_DoFl
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set directory to cache parsed HEX files in
+
+   If set, UpdateSystem keeps the parsed data of each HEX file flashed to an openSYDE node in this directory
+   (see C_OsyHexFile::LoadDataDumpFromFileCached).
+   Repeated updates with the same HEX files then skip parsing and scanning the files.
+
+   After loading the HEX files of a node the cache is cleaned up (see C_OsyHexFile::h_CleanUpCacheDirectory):
+   files older than ou32_MaxAgeDays are removed, then the oldest files until the cache is ou32_MaxSizeMB or smaller.
+   Removing the directory or any of its files is safe at any time when no update is running.
+
+   SYDEsup does not use the cache:
+   it parses the HEX files straight from the update package (see SetUpdatePackage) and runs once per update,
+   so there is nothing to reuse between runs.
+
+   \param[in]  orc_Directory     directory for cache files (will be created if necessary); empty: do not cache (default)
+   \param[in]  ou32_MaxSizeMB    maximum total size of all cache files in MB
+   \param[in]  ou32_MaxAgeDays   maximum age of a cache file in days
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCSuSequences::SetHexFileCacheDirectory(const C_SCLString & orc_Directory, const uint32 ou32_MaxSizeMB,
+                                                const uint32 ou32_MaxAgeDays)
+{
+   this->mc_HexFileCacheDirectory = orc_Directory;
+   this->mu32_HexFileCacheMaxSizeMB = ou32_MaxSizeMB;
+   this->mu32_HexFileCacheMaxAgeDays = ou32_MaxAgeDays;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set service update package the files to update were not unpacked from
+
+   Counterpart of C_OSCSuServiceUpdatePackage::h_UnpackPackage with oq_UnpackFilesToUpdate = false.
+   UpdateSystem then takes files located in orc_UnzipPath that are not present on disk from the package:
+   * HEX files for address based openSYDE nodes are parsed directly from the package in memory
+   * all other files are unpacked on demand before the update starts (their consumers work on files)
+
+   \param[in]  orc_PackagePath   path of service update package; empty: do not use a package (default)
+   \param[in]  orc_UnzipPath     path the package was unpacked to (as passed to h_UnpackPackage)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCSuSequences::SetUpdatePackage(const C_SCLString & orc_PackagePath, const C_SCLString & orc_UnzipPath)
+{
+   this->mc_UpdatePackagePath = orc_PackagePath;
+   this->mc_UpdatePackageUnzipPath = orc_UnzipPath;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Reset all devices in the system
 
@@ -3212,6 +3747,12 @@ void C_OSCSuSequences::h_OpenSydeFlashloaderInformationToText(const C_OsyDeviceI
    c_Line.PrintFormatted("Ethernet2Ethernet routing supported: %d",
                          orc_Info.c_MoreInformation.c_AvailableFeatures.q_EthernetToEthernetRoutingSupported);
    orc_Text.Add(c_Line);
+   c_Line.PrintFormatted("Pipelined data transfer supported: %d",
+                         orc_Info.c_MoreInformation.c_AvailableFeatures.q_PipelinedTransferDataSupported);
+   orc_Text.Add(c_Line);
+   c_Line.PrintFormatted("Flash sector checksums available: %d",
+                         orc_Info.c_MoreInformation.c_AvailableFeatures.q_FlashSectorChecksumsAvailable);
+   orc_Text.Add(c_Line);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -3637,6 +4178,87 @@ sint32 C_OSCSuSequences::m_DisconnectFromTargetServer(const bool oq_DisconnectOn
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name of file within the service update package
+
+   \param[in]   orc_FilePath   path of file
+   \param[out]  orc_FileName   name of file within the service update package (only valid if true is returned)
+
+   \return
+   true    update package is set (see SetUpdatePackage) and file is located in its unzip path
+   false   file does not belong to an update package
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCSuSequences::m_GetUpdatePackageFileName(const C_SCLString & orc_FilePath, C_SCLString & orc_FileName) const
+{
+   bool q_Return = false;
+
+   if (this->mc_UpdatePackagePath != "")
+   {
+      const C_SCLString c_UnzipPath = TGL_FileIncludeTrailingDelimiter(this->mc_UpdatePackageUnzipPath);
+      if ((orc_FilePath.Length() > c_UnzipPath.Length()) && (orc_FilePath.Pos(c_UnzipPath) == 1U))
+      {
+         orc_FileName = C_OSCZipFile::h_GetArchiveFileName(
+            orc_FilePath.SubString(c_UnzipPath.Length() + 1U, orc_FilePath.Length() - c_UnzipPath.Length()));
+         q_Return = true;
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Make sure a file to update is available
+
+   Files that are not present on disk are taken from the service update package (see SetUpdatePackage).
+
+   \param[in]  orc_FilePath          path of file
+   \param[in]  oq_KeepInPackage      true: the consumer can work with the file content from the package;
+                                      only check the file is contained
+                                     false: the consumer needs the file on disk; unpack it from the package
+
+   \return
+   C_NO_ERR   file is available
+   C_RD_WR    file is neither present on disk nor in the update package (or could not be unpacked)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCSuSequences::m_ProvideFile(const C_SCLString & orc_FilePath, const bool oq_KeepInPackage) const
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (TGL_FileExists(orc_FilePath) == false)
+   {
+      C_SCLString c_FileName;
+
+      s32_Return = C_RD_WR;
+      if (this->m_GetUpdatePackageFileName(orc_FilePath, c_FileName) == true)
+      {
+         if (oq_KeepInPackage == true)
+         {
+            if (C_OSCZipFile::h_IsFileInZipFile(this->mc_UpdatePackagePath, c_FileName) == true)
+            {
+               s32_Return = C_NO_ERR;
+            }
+         }
+         else
+         {
+            C_SCLString c_ErrorText;
+            if (C_OSCZipFile::h_UnpackFileFromZipFile(this->mc_UpdatePackagePath, c_FileName, orc_FilePath,
+                                                      &c_ErrorText) == C_NO_ERR)
+            {
+               s32_Return = C_NO_ERR;
+            }
+            else
+            {
+               osc_write_log_error("System Update", c_ErrorText);
+            }
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Copies a file from source to target folder (internal function).
 
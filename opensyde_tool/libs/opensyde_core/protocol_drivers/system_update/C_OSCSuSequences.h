@@ -193,7 +193,8 @@ public:
                                                     const std::vector<stw_types::uint8> & orc_ActiveNodes,
                                                     const stw_scl::C_SCLString & orc_TargetPath,
                                                     std::vector<C_DoFlash> & orc_ApplicationsToWrite,
-                                                    stw_scl::C_SCLString * const opc_ErrorPath = NULL);
+                                                    stw_scl::C_SCLString * const opc_ErrorPath = NULL,
+                                                    const bool oq_CopyFiles = true);
    static void h_CheckForChangedApplications(const std::vector<C_ApplicationProperties> & orc_ClientSideApplications,
                                              const std::vector<C_ApplicationProperties> & orc_ServerSideApplications,
                                              std::vector<stw_types::uint8> & orc_ApplicationsPresentOnServer);
@@ -202,6 +203,9 @@ public:
    stw_types::sint32 ReadDeviceInformation(const bool oq_FailOnFirstError = true);
    stw_types::sint32 UpdateSystem(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
                                   const std::vector<stw_types::uint32> & orc_NodesOrder);
+   void SetHexFileCacheDirectory(const stw_scl::C_SCLString & orc_Directory, const stw_types::uint32 ou32_MaxSizeMB,
+                                 const stw_types::uint32 ou32_MaxAgeDays);
+   void SetUpdatePackage(const stw_scl::C_SCLString & orc_PackagePath, const stw_scl::C_SCLString & orc_UnzipPath);
    stw_types::sint32 ResetSystem(void);
 
    static void h_OpenSydeFlashloaderInformationToText(const C_OsyDeviceInformation & orc_Info,
@@ -235,14 +239,46 @@ private:
 
    C_OSCProtocolDriverOsyNode mc_CurrentNode; //node we currently deal with
 
+   stw_scl::C_SCLString mc_HexFileCacheDirectory;  ///< directory for cached HEX file data; empty: no cache
+   stw_types::uint32 mu32_HexFileCacheMaxSizeMB;   ///< maximum total size of cached HEX file data in MB
+   stw_types::uint32 mu32_HexFileCacheMaxAgeDays;  ///< maximum age of cached HEX file data in days
+   stw_scl::C_SCLString mc_UpdatePackagePath;      ///< update package to take missing files from; empty: none
+   stw_scl::C_SCLString mc_UpdatePackageUnzipPath; ///< path the update package was unpacked to
+
+   ///TransferData block sent to the server but not yet confirmed
+   class C_TransferDataBlock
+   {
+   public:
+      stw_types::uint8 u8_BlockSequenceCounter;
+      stw_types::uint32 u32_Offset; ///< offset of the block data within the area
+      stw_types::uint32 u32_Size;   ///< number of data bytes in the block
+   };
+
+   //number of TransferData requests in flight in pipelined mode:
+   static const stw_types::uint32 mhu32_TRANSFER_DATA_PIPELINE_DEPTH = 4U;
+   //number of retransmissions of one block after "busy" or "wrong block sequence counter" responses:
+   static const stw_types::uint32 mhu32_TRANSFER_DATA_MAX_RETRIES = 3U;
+
    stw_types::sint32 m_FlashNodeOpenSydeHex(const std::vector<stw_scl::C_SCLString> & orc_FilesToFlash,
                                             const std::vector<stw_scl::C_SCLString> & orc_OtherAcceptedDeviceNames,
                                             const stw_types::uint32 ou32_RequestDownloadTimeout,
-                                            const stw_types::uint32 ou32_TransferDataTimeout);
+                                            const stw_types::uint32 ou32_TransferDataTimeout,
+                                            const bool oq_DeltaFlashing, const bool oq_PipelinedTransferData);
    stw_types::sint32 m_FlashOneFileOpenSydeHex(const stw_hex_file::C_HexDataDump & orc_HexDataDump,
                                                const stw_types::uint32 ou32_SignatureAddress,
+                                               const bool oq_PipelinedTransfer,
                                                const stw_types::uint32 ou32_RequestDownloadTimeout,
                                                const stw_types::uint32 ou32_TransferDataTimeout);
+   stw_types::sint32 m_GetModifiedFlashData(const stw_hex_file::C_HexDataDump & orc_HexDataDump,
+                                            const stw_types::uint32 ou32_SignatureAddress,
+                                            const C_OSCProtocolDriverOsy::C_ListOfFeatures & orc_AvailableFeatures,
+                                            stw_hex_file::C_HexDataDump & orc_ModifiedData);
+   stw_types::sint32 m_TransferAreaPipelined(const stw_hex_file::C_HexDataDump & orc_HexDataDump,
+                                             const stw_types::sint32 os32_Area,
+                                             const stw_types::uint32 ou32_MaxBlockLength,
+                                             const stw_types::uint32 ou32_TotalNumberOfBytes,
+                                             stw_types::uint32 & oru32_TotalNumberOfBytesFlashed,
+                                             stw_types::uint8 & oru8_ProgressPercentage);
    stw_types::sint32 m_FlashNodeOpenSydeFile(const std::vector<stw_scl::C_SCLString> & orc_FilesToFlash,
                                              const stw_types::uint32 ou32_RequestDownloadTimeout,
                                              const stw_types::uint32 ou32_TransferDataTimeout);
@@ -268,6 +304,10 @@ private:
                                                const stw_types::uint32 ou32_NodeIndex = 0U);
    stw_types::sint32 m_DisconnectFromTargetServer(const bool oq_DisconnectOnIp2IpRouting = true);
 
+   bool m_GetUpdatePackageFileName(const stw_scl::C_SCLString & orc_FilePath,
+                                   stw_scl::C_SCLString & orc_FileName) const;
+   stw_types::sint32 m_ProvideFile(const stw_scl::C_SCLString & orc_FilePath, const bool oq_KeepInPackage) const;
+
    static stw_types::sint32 mh_CopyFile(const stw_scl::C_SCLString & orc_SourceFile,
                                         const stw_scl::C_SCLString & orc_TargetFile,
                                         stw_scl::C_SCLString * const opc_ErrorPath = NULL);
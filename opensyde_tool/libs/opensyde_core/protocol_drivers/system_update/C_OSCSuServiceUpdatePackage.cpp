@@ -13,7 +13,6 @@
 #include "precomp_headers.h"
 
 #include <fstream>
-#include <iterator>
 #include "stwtypes.h"
 #include "stwerrors.h"
 #include "CSCLString.h"
@@ -88,9 +87,12 @@ stw_scl::C_SCLString C_OSCSuServiceUpdatePackage::mhc_ErrorMessage;        // de
        * folders with device application files (only for nodes to update)
        * service update package file ("service_update_package.syde_supdef")
 
-   Function is temporarily creating a folder to save files for zip archive.
+   Function is temporarily creating a folder to save the generated files (system definition, devices.ini and
+   service update package file) for zip archive.
    In any case it is tried to delete the temporary folder at the end of this function.
    The temporary folder has the extension ".syde_sup_tmp" and must not exist already.
+   Application, parameter set and device definition files are not copied to the temporary folder but streamed
+   into the zip archive directly from their original location.
 
    Assumptions:
    * write permission to target folder
@@ -154,7 +156,10 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
    vector<C_OSCSuSequences::C_DoFlash> c_ApplicationsToWrite = orc_ApplicationsToWrite; // paths of applications
    std::set<stw_scl::C_SCLString> c_SupFiles;                                           // unique container with
                                                                                         // relative file paths for zip
-                                                                                        // archive
+                                                                                        // archive (generated files)
+   std::map<stw_scl::C_SCLString, stw_scl::C_SCLString> c_FilesToZip;                   // relative file paths for zip
+                                                                                        // archive with path of source
+                                                                                        // file
    // fill with constant file names
    c_SupFiles.insert(mc_INI_DEV);
    c_SupFiles.insert(mc_SUP_SYSDEF);
@@ -164,10 +169,11 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
    s32_Return = h_CheckParamsToCreatePackage(orc_PackagePath, orc_SystemDefinition, ou32_ActiveBusIndex,
                                              orc_ActiveNodes, orc_NodesUpdateOrder, orc_ApplicationsToWrite);
 
-   // * create folders with device application files (via h_CreateTemporaryFolder)
+   // * determine paths of device application files within package (via h_CreateTemporaryFolder)
    //   h_CreateTemporaryFolder is creating the temporary folder (and deleting in advance if it already exists)
-   //   where the other files (devices.ini, system definition etc.) also are placed
+   //   where the other files (devices.ini, system definition etc.) are placed
    //   and has therefore be the first action for creating service update package
+   //   The application files themselves are not copied; they are zipped from their original location
    if (s32_Return == C_NO_ERR)
    {
       stw_scl::C_SCLString c_ErrorPath;
@@ -177,9 +183,10 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
       // add trailing path delimiter to temporary folder if not present
       c_PackagePathTmp = TGL_FileIncludeTrailingDelimiter(c_PackagePathTmp);
 
-      // create folders and copy applications to them
+      // create folder and get paths of applications within package
       s32_Return = C_OSCSuSequences::h_CreateTemporaryFolder(orc_SystemDefinition.c_Nodes, orc_ActiveNodes,
-                                                             c_PackagePathTmp, c_ApplicationsToWrite, &c_ErrorPath);
+                                                             c_PackagePathTmp, c_ApplicationsToWrite, &c_ErrorPath,
+                                                             false);
       if (s32_Return != C_NO_ERR)
       {
          // very strange! normally the precondition check should
@@ -195,15 +202,16 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
       }
       else
       {
-         vector<C_OSCSuSequences::C_DoFlash>::const_iterator c_Iter;
-         for (c_Iter = c_ApplicationsToWrite.begin(); c_Iter != c_ApplicationsToWrite.end(); ++c_Iter)
+         for (uint32 u32_Node = 0U; u32_Node < c_ApplicationsToWrite.size(); u32_Node++)
          {
-            const C_OSCSuSequences::C_DoFlash c_DoFlash = *c_Iter; // current node
+            const C_OSCSuSequences::C_DoFlash & rc_DoFlash = c_ApplicationsToWrite[u32_Node];     // current node
+            const C_OSCSuSequences::C_DoFlash & rc_Source = orc_ApplicationsToWrite[u32_Node]; // original paths
             //Files
-            C_OSCSuServiceUpdatePackage::h_AppendFilesRelative(c_SupFiles, c_DoFlash.c_FilesToFlash, c_PackagePathTmp);
+            C_OSCSuServiceUpdatePackage::h_AppendFilesRelative(c_FilesToZip, rc_DoFlash.c_FilesToFlash,
+                                                               rc_Source.c_FilesToFlash, c_PackagePathTmp);
             //Parameter set files
-            C_OSCSuServiceUpdatePackage::h_AppendFilesRelative(c_SupFiles, c_DoFlash.c_FilesToWriteToNvm,
-                                                               c_PackagePathTmp);
+            C_OSCSuServiceUpdatePackage::h_AppendFilesRelative(c_FilesToZip, rc_DoFlash.c_FilesToWriteToNvm,
+                                                               rc_Source.c_FilesToWriteToNvm, c_PackagePathTmp);
          }
       }
 
@@ -264,7 +272,7 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
    }
 
    // * device definition files
-   // copy device definition files (is safer than using device definition filer):
+   // zip original device definition files (is safer than using device definition filer):
    // we have to store all device definition files of current system definition
    // because of routing functionality
    if (s32_Return == C_NO_ERR)
@@ -275,16 +283,17 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
            ++c_Iter)
       {
          const C_SCLString c_TargetFileName = TGL_ExtractFileName(*c_Iter);
-         c_SupFiles.insert(c_TargetFileName);
-         const C_SCLString c_TargetFilePath = c_PackagePathTmp + c_TargetFileName;
-         s32_Return = h_CopyFile(*c_Iter, c_TargetFilePath);
-         if (s32_Return != C_NO_ERR)
+         if (TGL_FileExists(*c_Iter) == false)
          {
             mhc_ErrorMessage = "Could not save device definition file \"" +
-                               TGL_ExtractFileName(c_TargetFilePath) + "\" to path \"" + orc_PackagePath + "\".";
+                               c_TargetFileName + "\" to path \"" + orc_PackagePath + "\".";
             osc_write_log_error("Creating Update Package", mhc_ErrorMessage);
             s32_Return = C_RD_WR;
          }
+         else
+         {
+            c_FilesToZip[c_TargetFileName] = *c_Iter;
+         }
       }
    }
 
@@ -300,10 +309,15 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
       h_CreateUpdatePackageDefFile(c_PackagePathTmp, c_SupDefContent);
    }
 
-   // package temporary result folder to zip file
+   // package temporary result folder and original files to zip file
    if ((s32_Return == C_NO_ERR) || (s32_Return == C_WARN))
    {
-      s32_Return = C_OSCZipFile::h_CreateZipFile(c_PackagePathTmp, c_SupFiles, c_TargetZipArchive, &mhc_ErrorMessage);
+      set<C_SCLString>::const_iterator c_Iter;
+      for (c_Iter = c_SupFiles.begin(); c_Iter != c_SupFiles.end(); ++c_Iter)
+      {
+         c_FilesToZip[*c_Iter] = c_PackagePathTmp + (*c_Iter);
+      }
+      s32_Return = C_OSCZipFile::h_CreateZipFile(c_FilesToZip, c_TargetZipArchive, &mhc_ErrorMessage);
       if (s32_Return != C_NO_ERR)
       {
          osc_write_log_error("Creating Update Package", mhc_ErrorMessage);
@@ -340,6 +354,11 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
    the application files for update. If orc_TargetUnzipPath folder exists already it will be deleted.
    Will create the target folder (recursively if it needs to be).
 
+   With oq_UnpackFilesToUpdate = false the application and parameter set files are not unpacked.
+   orc_ApplicationsToWrite still contains their paths in the target folder.
+   C_OSCSuSequences can take them from the package then (see C_OSCSuSequences::SetUpdatePackage).
+   This saves writing and reading them to/from disk once.
+
    Result of function after successful execution:
    * unzipped package at given target path with the following contents:
        * system definition as class instance
@@ -363,6 +382,8 @@ sint32 C_OSCSuServiceUpdatePackage::h_CreatePackage(const C_SCLString & orc_Pack
    \param[out] orc_ApplicationsToWrite   files for updating nodes
    \param[out] orc_WarningMessages       warning messages for imported package (empty list if no warnings)
    \param[out] orc_ErrorMessage          error message in case of failure (empty string if no error)
+   \param[in]  oq_UnpackFilesToUpdate    true: unpack all files (default)
+                                         false: do not unpack application and parameter set files
 
    \return
    C_NO_ERR    success
@@ -381,7 +402,7 @@ sint32 C_OSCSuServiceUpdatePackage::h_UnpackPackage(const C_SCLString & orc_Pack
                                                     vector<uint32> & orc_NodesUpdateOrder,
                                                     vector<C_OSCSuSequences::C_DoFlash> & orc_ApplicationsToWrite,
                                                     C_SCLStringList & orc_WarningMessages,
-                                                    C_SCLString & orc_ErrorMessage)
+                                                    C_SCLString & orc_ErrorMessage, const bool oq_UnpackFilesToUpdate)
 {
    sint32 s32_Return = C_NO_ERR;
 
@@ -445,23 +466,24 @@ sint32 C_OSCSuServiceUpdatePackage::h_UnpackPackage(const C_SCLString & orc_Pack
    // open zip file and unpack contents to target folder
    if (s32_Return == C_NO_ERR)
    {
-      s32_Return = C_OSCZipFile::h_UnpackZipFile(orc_PackagePath, c_TargetUnzipPath, &mhc_ErrorMessage);
+      if (oq_UnpackFilesToUpdate == true)
+      {
+         s32_Return = C_OSCZipFile::h_UnpackZipFile(orc_PackagePath, c_TargetUnzipPath, &mhc_ErrorMessage);
+      }
+      else
+      {
+         // only the service update package definition for now: it tells us which files not to unpack
+         s32_Return = C_OSCZipFile::h_UnpackFileFromZipFile(orc_PackagePath, mc_PACKAGE_UPDATE_DEF,
+                                                            c_TargetUnzipPath + mc_PACKAGE_UPDATE_DEF,
+                                                            &mhc_ErrorMessage);
+      }
       if (s32_Return != C_NO_ERR)
       {
          osc_write_log_error("Unpacking Update Package", mhc_ErrorMessage);
+         s32_Return = C_RD_WR;
       }
    }
 
-   // load system definition (has constant name)
-   if (s32_Return == C_NO_ERR)
-   {
-      const C_SCLString c_SysDefPath = c_TargetUnzipPath + mc_SUP_SYSDEF;
-      const C_SCLString c_DevIniPath = c_TargetUnzipPath + mc_INI_DEV;
-
-      s32_Return = C_OSCSystemDefinitionFiler::h_LoadSystemDefinitionFile(orc_SystemDefinition, c_SysDefPath,
-                                                                          c_DevIniPath);
-   }
-
    // load service update package definition
    if (s32_Return == C_NO_ERR)
    {
@@ -518,6 +540,35 @@ sint32 C_OSCSuServiceUpdatePackage::h_UnpackPackage(const C_SCLString & orc_Pack
       h_SetNodesUpdateOrder(c_UpdateOrderByNodes, orc_NodesUpdateOrder);
    }
 
+   // unpack all other files if not done yet
+   if ((s32_Return == C_NO_ERR) && (oq_UnpackFilesToUpdate == false))
+   {
+      std::set<C_SCLString> c_FilesToSkip;
+      c_FilesToSkip.insert(mc_PACKAGE_UPDATE_DEF); // unpacked already
+      for (uint32 u32_Node = 0U; u32_Node < orc_ApplicationsToWrite.size(); u32_Node++)
+      {
+         h_AppendArchiveFileNames(c_FilesToSkip, orc_ApplicationsToWrite[u32_Node].c_FilesToFlash, c_TargetUnzipPath);
+         h_AppendArchiveFileNames(c_FilesToSkip, orc_ApplicationsToWrite[u32_Node].c_FilesToWriteToNvm,
+                                  c_TargetUnzipPath);
+      }
+      s32_Return = C_OSCZipFile::h_UnpackZipFile(orc_PackagePath, c_TargetUnzipPath, &mhc_ErrorMessage,
+                                                 &c_FilesToSkip);
+      if (s32_Return != C_NO_ERR)
+      {
+         osc_write_log_error("Unpacking Update Package", mhc_ErrorMessage);
+      }
+   }
+
+   // load system definition (has constant name)
+   if (s32_Return == C_NO_ERR)
+   {
+      const C_SCLString c_SysDefPath = c_TargetUnzipPath + mc_SUP_SYSDEF;
+      const C_SCLString c_DevIniPath = c_TargetUnzipPath + mc_INI_DEV;
+
+      s32_Return = C_OSCSystemDefinitionFiler::h_LoadSystemDefinitionFile(orc_SystemDefinition, c_SysDefPath,
+                                                                          c_DevIniPath);
+   }
+
    orc_WarningMessages = mhc_WarningMessages; // set warning messages for caller
    orc_ErrorMessage = mhc_ErrorMessage;       // set error message for caller
 
@@ -685,66 +736,6 @@ sint32 C_OSCSuServiceUpdatePackage::h_CheckParamsToCreatePackage(const C_SCLStri
    return s32_Return;
 }
 
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Copies a file from source to target folder (internal function).
-
-   Assumptions:
-   * read permission of source folder
-   * write permission of target folder
-
-   \param[in]  orc_SourceFile            source file (full path required)
-   \param[in]  orc_TargetFile            target file (        -"-       )
-
-   \return
-   C_NO_ERR    success
-   C_RD_WR     read/write error (see log file)
-*/
-//----------------------------------------------------------------------------------------------------------------------
-sint32 C_OSCSuServiceUpdatePackage::h_CopyFile(const C_SCLString & orc_SourceFile, const C_SCLString & orc_TargetFile)
-{
-   sint32 s32_Return = C_NO_ERR;
-
-   //copy file
-   std::fstream c_Input(orc_SourceFile.c_str(), std::fstream::in | std::fstream::binary);
-   if (c_Input.fail() == true)
-   {
-      mhc_ErrorMessage = "Could not read \"" + orc_SourceFile + "\".";
-      osc_write_log_error("Copying file", mhc_ErrorMessage);
-      s32_Return = C_RD_WR;
-   }
-   else
-   {
-      c_Input << &std::noskipws;
-
-      std::istream_iterator<uint8> c_Begin(c_Input);
-      std::istream_iterator<uint8> c_End;
-
-      std::fstream c_Output(
-         orc_TargetFile.c_str(), std::fstream::out | std::fstream::trunc | std::fstream::binary);
-      if (c_Output.fail() == true)
-      {
-         mhc_ErrorMessage = "Could not write \"" + orc_TargetFile + "\".";
-         osc_write_log_error("Copying file", mhc_ErrorMessage);
-         s32_Return = C_RD_WR;
-      }
-      else
-      {
-         std::ostream_iterator<uint8> c_Begin2(c_Output);
-         try
-         {
-            std::copy(c_Begin, c_End, c_Begin2);
-         }
-         catch (...)
-         {
-            mhc_ErrorMessage = "Could not write stream of \"" + orc_TargetFile + "\".";
-            osc_write_log_error("Copying file", mhc_ErrorMessage);
-            s32_Return = C_RD_WR;
-         }
-      }
-   }
-   return s32_Return;
-}
-
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Creates update package definition file (internal function).
 
@@ -1046,19 +1037,22 @@ sint32 C_OSCSuServiceUpdatePackage::h_SetNodesUpdateOrder(const map<uint32, uint
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Append files to set as relative paths
+/*! \brief  Append files to map as relative paths
 
-   \param[in,out] orc_Set      Set to appen paths to
-   \param[in]     orc_Files    Vector of files to append
-   \param[in]     orc_BasePath Path the files will be raltive to
+   \param[in,out] orc_Map         Map to append relative paths (key) and source files (value) to
+   \param[in]     orc_Files       Vector of files to append (paths within orc_BasePath)
+   \param[in]     orc_SourceFiles Vector of source files; same size and order as orc_Files
+   \param[in]     orc_BasePath    Path the files will be relative to
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCSuServiceUpdatePackage::h_AppendFilesRelative(std::set<C_SCLString> & orc_Set,
+void C_OSCSuServiceUpdatePackage::h_AppendFilesRelative(std::map<C_SCLString, C_SCLString> & orc_Map,
                                                         const std::vector<C_SCLString> & orc_Files,
+                                                        const std::vector<C_SCLString> & orc_SourceFiles,
                                                         const C_SCLString & orc_BasePath)
 {
+   tgl_assert(orc_Files.size() == orc_SourceFiles.size());
    for (uint32 u32_PosFilesToFlash = 0;
-        u32_PosFilesToFlash < orc_Files.size();
+        (u32_PosFilesToFlash < orc_Files.size()) && (u32_PosFilesToFlash < orc_SourceFiles.size());
         u32_PosFilesToFlash++)
    {
       // for service_update_package.syde_supdef we need relative paths!
@@ -1066,7 +1060,27 @@ void C_OSCSuServiceUpdatePackage::h_AppendFilesRelative(std::set<C_SCLString> &
       c_RelativeFilePath = c_RelativeFilePath.SubString(
          orc_BasePath.Length() + 1,
          c_RelativeFilePath.Length() - orc_BasePath.Length());
-      orc_Set.insert(c_RelativeFilePath);
+      orc_Map[c_RelativeFilePath] = orc_SourceFiles[u32_PosFilesToFlash];
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append names of files within zip archive to set
+
+   \param[in,out] orc_Set         Set to append names to
+   \param[in]     orc_Files       Vector of files in orc_BasePath
+   \param[in]     orc_BasePath    Path the zip archive is unpacked to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCSuServiceUpdatePackage::h_AppendArchiveFileNames(std::set<C_SCLString> & orc_Set,
+                                                           const std::vector<C_SCLString> & orc_Files,
+                                                           const C_SCLString & orc_BasePath)
+{
+   for (uint32 u32_File = 0U; u32_File < orc_Files.size(); u32_File++)
+   {
+      const C_SCLString & rc_File = orc_Files[u32_File];
+      orc_Set.insert(C_OSCZipFile::h_GetArchiveFileName(
+                        rc_File.SubString(orc_BasePath.Length() + 1, rc_File.Length() - orc_BasePath.Length())));
    }
 }
 
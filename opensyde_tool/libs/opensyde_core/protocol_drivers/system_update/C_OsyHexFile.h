@@ -11,6 +11,8 @@
 #ifndef C_OSYHEXFILEH
 #define C_OSYHEXFILEH
 
+#include <vector>
+
 #include "stwtypes.h"
 #include "CXFLHexFile.h"
 #include "CSCLString.h"
@@ -26,9 +28,47 @@ class C_OsyHexFile :
    public stw_diag_lib::C_XFLHexFile
 {
 public:
+   C_OsyHexFile(void);
+
+   //hide the base class loaders so we can drop cached information when new content is loaded
+   stw_types::uint32 LoadFromFile(const stw_types::charn * const opcn_FileName);
+   stw_types::uint32 LoadDataDumpFromFile(const stw_types::charn * const opcn_FileName);
+   stw_types::uint32 LoadDataDumpFromMemory(const stw_types::charn * const opcn_Data,
+                                            const stw_types::uint32 ou32_Size);
+   //load data dump (and scan results) from cache directory if the same file content was loaded before
+   stw_types::uint32 LoadDataDumpFromFileCached(const stw_scl::C_SCLString & orc_FileName,
+                                                const stw_scl::C_SCLString & orc_CacheDirectory);
+   stw_types::uint32 LoadDataDumpFromMemoryCached(const std::vector<stw_types::uint8> & orc_Content,
+                                                  const stw_scl::C_SCLString & orc_CacheDirectory);
+   bool IsLoadedFromCache(void) const;
+   //remove cache files exceeding the age or size limits
+   static void h_CleanUpCacheDirectory(const stw_scl::C_SCLString & orc_CacheDirectory,
+                                       const stw_types::uint64 ou64_MaxTotalSize,
+                                       const stw_types::uint32 ou32_MaxAgeDays);
+
    stw_types::sint32 GetSignatureBlockAddress(stw_types::uint32 & oru32_Address);
    stw_types::sint32 ScanDeviceIdFromHexFile(stw_scl::C_SCLString & orc_DeviceID);
    stw_types::sint32 ScanApplicationInformationBlockFromHexFile(stw_diag_lib::C_XFLECUInformation & orc_InfoBlock);
+
+private:
+   static const stw_types::uint16 mhu16_CACHE_FILE_VERSION = 1U;
+
+   bool mq_LoadedFromCache;
+   //results of the scan functions; only valid if mq_ScanResultsValid is true
+   bool mq_ScanResultsValid;
+   stw_types::sint32 ms32_SignatureBlockResult;
+   stw_types::uint32 mu32_SignatureBlockAddress;
+   stw_types::sint32 ms32_DeviceIdResult;
+   stw_scl::C_SCLString mc_DeviceId;
+   stw_types::sint32 ms32_ApplicationInfoResult;
+   stw_diag_lib::C_XFLECUInformation mc_ApplicationInfo;
+
+   void m_ScanInformation(void);
+   stw_types::sint32 m_LoadCacheFile(const stw_scl::C_SCLString & orc_CacheFileName,
+                                     const stw_types::uint64 ou64_FileHash, const stw_types::uint32 ou32_FileSize);
+   stw_types::sint32 m_SaveCacheFile(const stw_scl::C_SCLString & orc_CacheFileName,
+                                     const stw_types::uint64 ou64_FileHash,
+                                     const stw_types::uint32 ou32_FileSize) const;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
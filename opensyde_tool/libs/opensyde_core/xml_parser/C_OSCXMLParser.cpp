@@ -13,6 +13,7 @@
 #include "precomp_headers.h" //pre-compiled headers
 
 #include <fstream>
+#include <cstring>
 #include "stwtypes.h"
 #include "stwerrors.h"
 #include "C_OSCXMLParser.h"
@@ -173,6 +174,36 @@ C_SCLString C_OSCXMLParserBase::SelectRoot(void)
    return c_RootName;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Compare viewed text with C string
+
+   \param[in]  opcn_Text   text to compare with (NULL is handled like "")
+
+   \return
+   true   texts are equal
+   false  texts differ
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLStringView::operator ==(const charn * const opcn_Text) const
+{
+   return (std::strcmp(this->mpcn_Text, (opcn_Text == NULL) ? "" : opcn_Text) == 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Compare viewed text with C string
+
+   \param[in]  opcn_Text   text to compare with (NULL is handled like "")
+
+   \return
+   true   texts differ
+   false  texts are equal
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLStringView::operator !=(const charn * const opcn_Text) const
+{
+   return (this->operator ==(opcn_Text) == false);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Select next node as active element
 
@@ -187,15 +218,64 @@ C_SCLString C_OSCXMLParserBase::SelectRoot(void)
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLString C_OSCXMLParserBase::SelectNodeNext(const C_SCLString & orc_Name)
 {
-   C_SCLString c_Name;
+   return this->SelectNodeNextView(orc_Name.c_str()).ToString();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select next node as active element
+
+   Select the next node on the same level as the current node as active element.
 
-   tinyxml2::XMLElement * pc_Save = mpc_CurrentNode;
+   \param[in]  orc_Name   if != "": select first child node with this name
+                          if == "": select first child node with any name
+
+   \return
+   name of selected element ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCXMLParserBase::SelectNodeChild(const C_SCLString & orc_Name)
+{
+   return this->SelectNodeChildView(orc_Name.c_str()).ToString();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select parent of active node as active element
+
+   Select the parent node of the current node as active element.
+
+   \return
+   name of selected element ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCXMLParserBase::SelectNodeParent(void)
+{
+   return this->SelectNodeParentView().ToString();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select next node as active element
+
+   Select the next node on the same level as the current node as active element.
+   Same as SelectNodeNext but without creating a copy of the node name.
+
+   \param[in]  opcn_Name   if != NULL and != "": select first node with this name
+                           else: select first node with any name
+
+   \return
+   name of selected element ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCXMLStringView C_OSCXMLParserBase::SelectNodeNextView(const charn * const opcn_Name)
+{
+   C_OSCXMLStringView c_Name;
+
+   tinyxml2::XMLElement * const pc_Save = mpc_CurrentNode;
 
    if (mpc_CurrentNode != NULL)
    {
-      if (orc_Name != "")
+      if ((opcn_Name != NULL) && (opcn_Name[0] != '\0'))
       {
-         mpc_CurrentNode = mpc_CurrentNode->NextSiblingElement(orc_Name.c_str());
+         mpc_CurrentNode = mpc_CurrentNode->NextSiblingElement(opcn_Name);
       }
       else
       {
@@ -204,7 +284,7 @@ C_SCLString C_OSCXMLParserBase::SelectNodeNext(const C_SCLString & orc_Name)
    }
    if (mpc_CurrentNode != NULL)
    {
-      c_Name = mpc_CurrentNode->Name();
+      c_Name = C_OSCXMLStringView(mpc_CurrentNode->Name());
    }
    else
    {
@@ -215,20 +295,21 @@ C_SCLString C_OSCXMLParserBase::SelectNodeNext(const C_SCLString & orc_Name)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Select next node as active element
+/*! \brief  Select child node as active element
 
-   Select the next node on the same level as the current node as active element.
+   Select the first child node of the current node as active element.
+   Same as SelectNodeChild but without creating a copy of the node name.
 
-   \param[in]  orc_Name   if != "": select first child node with this name
-                          if == "": select first child node with any name
+   \param[in]  opcn_Name   if != NULL and != "": select first child node with this name
+                           else: select first child node with any name
 
    \return
    name of selected element ("" on error)
 */
 //----------------------------------------------------------------------------------------------------------------------
-C_SCLString C_OSCXMLParserBase::SelectNodeChild(const C_SCLString & orc_Name)
+C_OSCXMLStringView C_OSCXMLParserBase::SelectNodeChildView(const charn * const opcn_Name)
 {
-   C_SCLString c_Name;
+   C_OSCXMLStringView c_Name;
 
    tinyxml2::XMLElement * pc_Element = NULL;
 
@@ -243,20 +324,20 @@ C_SCLString C_OSCXMLParserBase::SelectNodeChild(const C_SCLString & orc_Name)
 
    if (pc_Element != NULL)
    {
-      if (orc_Name == "")
+      if ((opcn_Name != NULL) && (opcn_Name[0] != '\0'))
       {
-         pc_Element = pc_Element->FirstChildElement();
+         pc_Element = pc_Element->FirstChildElement(opcn_Name);
       }
       else
       {
-         pc_Element = pc_Element->FirstChildElement(orc_Name.c_str());
+         pc_Element = pc_Element->FirstChildElement();
       }
    }
 
    if (pc_Element != NULL)
    {
       mpc_CurrentNode = pc_Element;
-      c_Name = mpc_CurrentNode->Name();
+      c_Name = C_OSCXMLStringView(mpc_CurrentNode->Name());
    }
    return c_Name;
 }
@@ -265,14 +346,15 @@ C_SCLString C_OSCXMLParserBase::SelectNodeChild(const C_SCLString & orc_Name)
 /*! \brief  Select parent of active node as active element
 
    Select the parent node of the current node as active element.
+   Same as SelectNodeParent but without creating a copy of the node name.
 
    \return
    name of selected element ("" on error)
 */
 //----------------------------------------------------------------------------------------------------------------------
-C_SCLString C_OSCXMLParserBase::SelectNodeParent(void)
+C_OSCXMLStringView C_OSCXMLParserBase::SelectNodeParentView(void)
 {
-   C_SCLString c_Name;
+   C_OSCXMLStringView c_Name;
 
    if (mpc_CurrentNode != NULL)
    {
@@ -280,7 +362,7 @@ C_SCLString C_OSCXMLParserBase::SelectNodeParent(void)
    }
    if (mpc_CurrentNode != NULL)
    {
-      c_Name = mpc_CurrentNode->Name();
+      c_Name = C_OSCXMLStringView(mpc_CurrentNode->Name());
    }
    return c_Name;
 }
@@ -299,15 +381,25 @@ C_SCLString C_OSCXMLParserBase::SelectNodeParent(void)
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLString C_OSCXMLParserBase::GetNodeContent(void) const
 {
-   C_SCLString c_Content;
+   return this->GetNodeContentView().ToString();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get content of selected node
+
+   Same as GetNodeContent but without creating a copy of the content.
+
+   \return
+   Content of selected element ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCXMLStringView C_OSCXMLParserBase::GetNodeContentView(void) const
+{
+   C_OSCXMLStringView c_Content;
 
    if (mpc_CurrentNode != NULL)
    {
-      const charn * const pcn_Content = mpc_CurrentNode->GetText();
-      if (pcn_Content != NULL)
-      {
-         c_Content = pcn_Content;
-      }
+      c_Content = C_OSCXMLStringView(mpc_CurrentNode->GetText());
    }
 
    return c_Content;
@@ -326,12 +418,29 @@ C_SCLString C_OSCXMLParserBase::GetNodeContent(void) const
 */
 //----------------------------------------------------------------------------------------------------------------------
 bool C_OSCXMLParserBase::AttributeExists(const C_SCLString & orc_Name) const
+{
+   return this->AttributeExists(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check whether specified attribute exists
+
+   Check whether the specified attribute exists in the current element.
+
+   \param[in]   opcn_Name   name of attribute to check for
+
+   \return
+   true   attribute exists
+   false  attribute does not exists (or: no element selected)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::AttributeExists(const charn * const opcn_Name) const
 {
    bool q_Return = false;
 
    if (mpc_CurrentNode != NULL)
    {
-      const charn * const pcn_Text = mpc_CurrentNode->Attribute(orc_Name.c_str());
+      const charn * const pcn_Text = mpc_CurrentNode->Attribute(opcn_Name);
       if (pcn_Text != NULL)
       {
          q_Return = true;
@@ -353,17 +462,7 @@ bool C_OSCXMLParserBase::AttributeExists(const C_SCLString & orc_Name) const
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLString C_OSCXMLParserBase::GetAttributeString(const C_SCLString & orc_Name) const
 {
-   C_SCLString c_Value;
-
-   if (mpc_CurrentNode != NULL)
-   {
-      const charn * const pcn_Text = mpc_CurrentNode->Attribute(orc_Name.c_str());
-      if (pcn_Text != NULL)
-      {
-         c_Value = pcn_Text;
-      }
-   }
-   return c_Value;
+   return this->GetAttributeView(orc_Name.c_str()).ToString();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -380,22 +479,7 @@ C_SCLString C_OSCXMLParserBase::GetAttributeString(const C_SCLString & orc_Name)
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCXMLParserBase::GetAttributeSint32(const C_SCLString & orc_Name) const
 {
-   sintn sn_Value = 0;
-   C_SCLString c_Text;
-
-   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
-   {
-      try
-      {
-         sn_Value = static_cast<sintn>(c_Text.ToInt());
-      }
-      catch (...)
-      {
-      }
-   }
-   return sn_Value;
+   return this->GetAttributeSint32(orc_Name.c_str());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -412,22 +496,7 @@ sint32 C_OSCXMLParserBase::GetAttributeSint32(const C_SCLString & orc_Name) cons
 //----------------------------------------------------------------------------------------------------------------------
 uint32 C_OSCXMLParserBase::GetAttributeUint32(const C_SCLString & orc_Name) const
 {
-   uintn un_Value = 0;
-   C_SCLString c_Text;
-
-   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
-   {
-      try
-      {
-         un_Value = static_cast<uintn>(c_Text.ToInt());
-      }
-      catch (...)
-      {
-      }
-   }
-   return un_Value;
+   return this->GetAttributeUint32(orc_Name.c_str());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -444,22 +513,165 @@ uint32 C_OSCXMLParserBase::GetAttributeUint32(const C_SCLString & orc_Name) cons
 //----------------------------------------------------------------------------------------------------------------------
 sint64 C_OSCXMLParserBase::GetAttributeSint64(const C_SCLString & orc_Name) const
 {
-   sint64 s64_Value = 0;
-   C_SCLString c_Text;
+   return this->GetAttributeSint64(orc_Name.c_str());
+}
 
-   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as bool value.
+
+   \param[in]  orc_Name   name of attribute
+
+   \return
+   true   attribute value is "1"
+   false  attribute value is "0" (also returned on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::GetAttributeBool(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeBool(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as float32 value.
+
+   \param[in]  orc_Name   name of attribute
+
+   \return
+   value (0.0F on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float32 C_OSCXMLParserBase::GetAttributeFloat32(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeFloat32(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as float64 value.
+
+   \param[in]  orc_Name   name of attribute
+
+   \return
+   value (0.0 on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64 C_OSCXMLParserBase::GetAttributeFloat64(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeFloat64(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node without creating a copy of the value.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   Content of selected attribute ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCXMLStringView C_OSCXMLParserBase::GetAttributeView(const charn * const opcn_Name) const
+{
+   C_OSCXMLStringView c_Value;
+
+   if (mpc_CurrentNode != NULL)
    {
-      try
-      {
-         s64_Value = c_Text.ToInt64();
-      }
-      catch (...)
-      {
-      }
+      c_Value = C_OSCXMLStringView(mpc_CurrentNode->Attribute(opcn_Name));
    }
-   return s64_Value;
+   return c_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as string.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   Content of selected attribute ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCXMLParserBase::GetAttributeString(const charn * const opcn_Name) const
+{
+   return this->GetAttributeView(opcn_Name).ToString();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as sint32 value.
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLParserBase::GetAttributeSint32(const charn * const opcn_Name) const
+{
+   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
+   return static_cast<sintn>(static_cast<uintn>(mh_ParseInteger(this->GetAttributeView(opcn_Name).c_str())));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as uint32 value.
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCXMLParserBase::GetAttributeUint32(const charn * const opcn_Name) const
+{
+   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
+   return static_cast<uintn>(mh_ParseInteger(this->GetAttributeView(opcn_Name).c_str()));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as sint64 value.
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint64 C_OSCXMLParserBase::GetAttributeSint64(const charn * const opcn_Name) const
+{
+   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
+   return static_cast<sint64>(mh_ParseInteger(this->GetAttributeView(opcn_Name).c_str()));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as uint64 value.
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_OSCXMLParserBase::GetAttributeUint64(const charn * const opcn_Name) const
+{
+   return mh_ParseInteger(this->GetAttributeView(opcn_Name).c_str());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -467,20 +679,20 @@ sint64 C_OSCXMLParserBase::GetAttributeSint64(const C_SCLString & orc_Name) cons
 
    Return one attribute value of selected node as bool value.
 
-   \param[in]  orc_Name   name of attribute
+   \param[in]  opcn_Name   name of attribute
 
    \return
    true   attribute value is "1"
    false  attribute value is "0" (also returned on error)
 */
 //----------------------------------------------------------------------------------------------------------------------
-bool C_OSCXMLParserBase::GetAttributeBool(const C_SCLString & orc_Name) const
+bool C_OSCXMLParserBase::GetAttributeBool(const charn * const opcn_Name) const
 {
    bool q_Value = false;
 
    if (mpc_CurrentNode != NULL)
    {
-      tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryBoolAttribute(orc_Name.c_str(), &q_Value);
+      tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryBoolAttribute(opcn_Name, &q_Value);
       if (e_Error != tinyxml2::XML_SUCCESS)
       {
          q_Value = false;
@@ -494,19 +706,19 @@ bool C_OSCXMLParserBase::GetAttributeBool(const C_SCLString & orc_Name) const
 
    Return one attribute value of selected node as float32 value.
 
-   \param[in]  orc_Name   name of attribute
+   \param[in]  opcn_Name   name of attribute
 
    \return
    value (0.0F on error)
 */
 //----------------------------------------------------------------------------------------------------------------------
-float32 C_OSCXMLParserBase::GetAttributeFloat32(const C_SCLString & orc_Name) const
+float32 C_OSCXMLParserBase::GetAttributeFloat32(const charn * const opcn_Name) const
 {
    float32 f32_Value = 0.0F;
 
    if (mpc_CurrentNode != NULL)
    {
-      tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryFloatAttribute(orc_Name.c_str(), &f32_Value);
+      tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryFloatAttribute(opcn_Name, &f32_Value);
       if (e_Error != tinyxml2::XML_SUCCESS)
       {
          f32_Value = 0.0F;
@@ -520,19 +732,19 @@ float32 C_OSCXMLParserBase::GetAttributeFloat32(const C_SCLString & orc_Name) co
 
    Return one attribute value of selected node as float64 value.
 
-   \param[in]  orc_Name   name of attribute
+   \param[in]  opcn_Name   name of attribute
 
    \return
    value (0.0 on error)
 */
 //----------------------------------------------------------------------------------------------------------------------
-float64 C_OSCXMLParserBase::GetAttributeFloat64(const C_SCLString & orc_Name) const
+float64 C_OSCXMLParserBase::GetAttributeFloat64(const charn * const opcn_Name) const
 {
    float64 f64_Value = 0.0;
 
    if (mpc_CurrentNode != NULL)
    {
-      tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryDoubleAttribute(orc_Name.c_str(), &f64_Value);
+      tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryDoubleAttribute(opcn_Name, &f64_Value);
       if (e_Error != tinyxml2::XML_SUCCESS)
       {
          f64_Value = 0.0;
@@ -853,3 +1065,90 @@ void C_OSCXMLParserString::SaveToString(C_SCLString & orc_String) const
    this->mc_Document.Print(&c_Printer);
    orc_String = C_SCLString(c_Printer.CStr());
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Parse integer directly from XML text
+
+   Interprets decimal values and hexadecimal values in "0x" notation; both can have a leading "-".
+   Same results as C_SCLString::ToInt / ToInt64 (values exceeding the range wrap around)
+    but without creating a temporary string and without throwing exceptions.
+
+   \param[in]  opcn_Text   zero terminated text to parse
+
+   \return
+   value (zero if the text is empty or does not contain a valid number)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_OSCXMLParserBase::mh_ParseInteger(const charn * const opcn_Text)
+{
+   uint64 u64_Value = 0U;
+   bool q_Valid;
+   bool q_Negative = false;
+   const charn * pcn_Act = opcn_Text;
+
+   if ((*pcn_Act) == '-')
+   {
+      q_Negative = true;
+      pcn_Act++;
+   }
+
+   if ((pcn_Act[0] == '0') && ((pcn_Act[1] == 'x') || (pcn_Act[1] == 'X')) && (pcn_Act[2] != '\0'))
+   {
+      pcn_Act += 2; //skip "0x"
+      q_Valid = true;
+      while (((*pcn_Act) != '\0') && (q_Valid == true))
+      {
+         const charn cn_Char = *pcn_Act;
+         uint8 u8_Digit = 0U;
+         if ((cn_Char >= '0') && (cn_Char <= '9'))
+         {
+            u8_Digit = static_cast<uint8>(cn_Char - '0');
+         }
+         else if ((cn_Char >= 'a') && (cn_Char <= 'f'))
+         {
+            u8_Digit = static_cast<uint8>((cn_Char - 'a') + 10);
+         }
+         else if ((cn_Char >= 'A') && (cn_Char <= 'F'))
+         {
+            u8_Digit = static_cast<uint8>((cn_Char - 'A') + 10);
+         }
+         else
+         {
+            q_Valid = false;
+         }
+         u64_Value = (u64_Value << 4U) + u8_Digit;
+         pcn_Act++;
+      }
+   }
+   else
+   {
+      q_Valid = ((*pcn_Act) != '\0');
+      while (((*pcn_Act) != '\0') && (q_Valid == true))
+      {
+         const charn cn_Char = *pcn_Act;
+         if ((cn_Char >= '0') && (cn_Char <= '9'))
+         {
+            u64_Value = (u64_Value * 10U) + static_cast<uint8>(cn_Char - '0');
+         }
+         else
+         {
+            q_Valid = false;
+         }
+         pcn_Act++;
+      }
+   }
+
+   if (q_Valid == false)
+   {
+      u64_Value = 0U;
+   }
+   else if (q_Negative == true)
+   {
+      u64_Value = (~u64_Value) + 1U; //two's complement
+   }
+   else
+   {
+      //positive value: nothing to do
+   }
+   return u64_Value;
+}
@@ -39,6 +39,47 @@ public:
 
 //----------------------------------------------------------------------------------------------------------------------
 
+///read-only reference to a text inside the parsed XML document (no copy is made)
+///only valid as long as the document is neither modified nor reloaded
+class C_OSCXMLStringView
+{
+public:
+   C_OSCXMLStringView(void) :
+      mpcn_Text("")
+   {
+   }
+
+   explicit C_OSCXMLStringView(const stw_types::charn * const opcn_Text) :
+      mpcn_Text((opcn_Text == NULL) ? "" : opcn_Text)
+   {
+   }
+
+   ///zero terminated text; never NULL
+   const stw_types::charn * c_str(void) const
+   {
+      return mpcn_Text;
+   }
+
+   bool IsEmpty(void) const
+   {
+      return (mpcn_Text[0] == '\0');
+   }
+
+   ///copy text into a string (use where the value needs to outlive the document)
+   stw_scl::C_SCLString ToString(void) const
+   {
+      return mpcn_Text;
+   }
+
+   bool operator ==(const stw_types::charn * const opcn_Text) const;
+   bool operator !=(const stw_types::charn * const opcn_Text) const;
+
+private:
+   const stw_types::charn * mpcn_Text;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
 ///General xml handling
 class C_OSCXMLParserBase
 {
@@ -48,6 +89,8 @@ private:
 
    tinyxml2::XMLElement * mpc_CurrentNode;
 
+   static stw_types::uint64 mh_ParseInteger(const stw_types::charn * const opcn_Text);
+
 protected:
    tinyxml2::XMLDocument mc_Document;
 
@@ -69,6 +112,11 @@ public:
    // select parent node of current node                         (go up)
    stw_scl::C_SCLString SelectNodeParent(void);
 
+   // node navigation without string copies; same behavior as above but returning a view on the node name
+   C_OSCXMLStringView SelectNodeNextView(const stw_types::charn * const opcn_Name = NULL);
+   C_OSCXMLStringView SelectNodeChildView(const stw_types::charn * const opcn_Name = NULL);
+   C_OSCXMLStringView SelectNodeParentView(void);
+
    //append new child node under the current node with content
    // if the document is still empty this will create the root node
    void CreateNodeChild(const stw_scl::C_SCLString & orc_Name, const stw_scl::C_SCLString & orc_Content = "");
@@ -80,9 +128,11 @@ public:
    // node text content
    void SetNodeContent(const stw_scl::C_SCLString & orc_Content);
    stw_scl::C_SCLString GetNodeContent(void) const;
+   C_OSCXMLStringView GetNodeContentView(void) const;
 
    // node attribute operations
    bool AttributeExists(const stw_scl::C_SCLString & orc_Name) const;
+   bool AttributeExists(const stw_types::charn * const opcn_Name) const;
 
    stw_scl::C_SCLString GetCurrentNodeName(void) const
    {
@@ -107,6 +157,18 @@ public:
    stw_types::float32 GetAttributeFloat32(const stw_scl::C_SCLString & orc_Name) const;
    stw_types::float64 GetAttributeFloat64(const stw_scl::C_SCLString & orc_Name) const;
 
+   // get attribute values without creating temporary strings
+   // (string literals bind to these; numbers are parsed directly from the document's buffer)
+   C_OSCXMLStringView GetAttributeView(const stw_types::charn * const opcn_Name) const;
+   stw_scl::C_SCLString GetAttributeString(const stw_types::charn * const opcn_Name) const;
+   stw_types::sint32 GetAttributeSint32(const stw_types::charn * const opcn_Name) const;
+   stw_types::uint32 GetAttributeUint32(const stw_types::charn * const opcn_Name) const;
+   stw_types::sint64 GetAttributeSint64(const stw_types::charn * const opcn_Name) const;
+   stw_types::uint64 GetAttributeUint64(const stw_types::charn * const opcn_Name) const;
+   bool GetAttributeBool(const stw_types::charn * const opcn_Name) const;
+   stw_types::float32 GetAttributeFloat32(const stw_types::charn * const opcn_Name) const;
+   stw_types::float64 GetAttributeFloat64(const stw_types::charn * const opcn_Name) const;
+
    // get all attributes
    std::vector<C_OSCXMLAttribute> GetAttributes(void) const;
 };
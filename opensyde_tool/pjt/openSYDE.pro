@@ -478,6 +478,7 @@ SOURCES += ../src/main.cpp \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartWidget.cpp \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataSelectorWidget.cpp \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataItemWidget.cpp \
+    ../src/system_views/dashboards/items/chart/C_SyvDaItChartSampleBuffer.cpp \
     ../src/graphic_items/system_view_items/dashboard/C_GiSvDaToggleBase.cpp \
     ../src/graphic_items/system_view_items/dashboard/C_GiSvDaChartBase.cpp \
     ../src/opensyde_gui_elements/label/C_OgeLabColorOnly.cpp \
@@ -1293,6 +1294,7 @@ HEADERS  += \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartWidget.h \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataSelectorWidget.h \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataItemWidget.h \
+    ../src/system_views/dashboards/items/chart/C_SyvDaItChartSampleBuffer.h \
     ../src/graphic_items/system_view_items/dashboard/C_GiSvDaToggleBase.h \
     ../src/graphic_items/system_view_items/dashboard/C_GiSvDaChartBase.h \
     ../src/opensyde_gui_elements/label/C_OgeLabColorOnly.h \
@@ -27,6 +27,7 @@ SOURCES += \
     ../src/util/C_Uti.cpp \
     ../src/system_views/communication/C_SyvComMessageMonitor.cpp \
     ../src/system_views/communication/C_SyvComMessageLoggerFileBlf.cpp \
+    ../src/system_views/communication/C_SyvComMessageLoggerFileBlfReader.cpp \
     ../src/system_views/communication/C_SyvComDriverThread.cpp \
     ../src/com_import_export/C_CieImportDbc.cpp \
     ../src/system_definition/node_edit/datapools/C_SdNdeDpContentUtil.cpp\
@@ -233,6 +234,7 @@ HEADERS  += \
     ../src/util/C_Uti.h \
     ../src/system_views/communication/C_SyvComMessageMonitor.h \
     ../src/system_views/communication/C_SyvComMessageLoggerFileBlf.h \
+    ../src/system_views/communication/C_SyvComMessageLoggerFileBlfReader.h \
     ../src/system_views/communication/C_SyvComDriverThread.h \
     ../libs/dbc_driver_library/src/Vector/DBC/Attribute.h \
     ../libs/dbc_driver_library/src/Vector/DBC/AttributeDefinition.h \
@@ -167,6 +167,8 @@ C_CamMainWindow::C_CamMainWindow(QWidget * const opc_Parent) :
            this->mpc_Ui->pc_TraceWidget, &C_CamMetWidget::AddLogFileAsc);
    connect(this->mpc_Ui->pc_SettingsWidget, &C_CamMosWidget::SigAddLogFileBlf,
            this->mpc_Ui->pc_TraceWidget, &C_CamMetWidget::AddLogFileBlf);
+   connect(this->mpc_Ui->pc_SettingsWidget, &C_CamMosWidget::SigAddLogFileBin,
+           this->mpc_Ui->pc_TraceWidget, &C_CamMetWidget::AddLogFileBin);
    connect(this->mpc_Ui->pc_SettingsWidget, &C_CamMosWidget::SigRemoveAllLogFiles,
            this->mpc_Ui->pc_TraceWidget, &C_CamMetWidget::RemoveAllLogFiles);
    connect(this->mpc_Ui->pc_TraceWidget, &C_CamMetWidget::SigLogFileAddResult,
@@ -94,7 +94,8 @@ C_CamMosLoggingWidget::C_CamMosLoggingWidget(QWidget * const opc_Parent) :
                                                         "Path of directory where log file(s) get saved at."));
    this->mpc_Ui->pc_LabFormat->setText(C_GtGetText::h_GetText("Format"));
    this->mpc_Ui->pc_LabFormat->SetToolTipInformation(C_GtGetText::h_GetText("Format"),
-                                                     C_GtGetText::h_GetText("File format of log file (*.asc or *.blf)."));
+                                                     C_GtGetText::h_GetText("File format of log file (*.asc, *.blf or "
+                                                                            "compact openSYDE binary trace *.osyt)."));
    this->mpc_Ui->pc_LabOverwrite->setText(C_GtGetText::h_GetText("File Options"));
    this->mpc_Ui->pc_LabOverwrite->SetToolTipInformation(
       C_GtGetText::h_GetText("File Options"),
@@ -106,6 +107,7 @@ C_CamMosLoggingWidget::C_CamMosLoggingWidget(QWidget * const opc_Parent) :
    // initialize combo boxes
    this->mpc_Ui->pc_CbxFormat->addItem("ASC");
    this->mpc_Ui->pc_CbxFormat->addItem("BLF");
+   this->mpc_Ui->pc_CbxFormat->addItem("OSYT");
 
    this->mpc_Ui->pc_CbxOverwrite->addItem(C_GtGetText::h_GetText("Add timestamp suffix"));
    this->mpc_Ui->pc_CbxOverwrite->addItem(C_GtGetText::h_GetText("Warn before overwriting"));
@@ -523,6 +525,10 @@ void C_CamMosLoggingWidget::m_CheckAndStartLogging()
       {
          Q_EMIT (this->SigAddLogFileBlf(c_FileInfo.absoluteFilePath()));
       }
+      else if (rc_LoggingData.e_FileFormat == C_CamProLoggingData::eOSYT)
+      {
+         Q_EMIT (this->SigAddLogFileBin(c_FileInfo.absoluteFilePath()));
+      }
       else
       {
          Q_EMIT (this->SigAddLogFileAsc(c_FileInfo.absoluteFilePath()));
@@ -49,6 +49,7 @@ Q_SIGNALS:
    //lint -restore
    void SigAddLogFileAsc(const QString & orc_FilePath);
    void SigAddLogFileBlf(const QString & orc_FilePath);
+   void SigAddLogFileBin(const QString & orc_FilePath);
    void SigRemoveAllLogFiles(void);
    void SigHide(void);
 
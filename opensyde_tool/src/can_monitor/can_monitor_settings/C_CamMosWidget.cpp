@@ -130,6 +130,8 @@ C_CamMosWidget::C_CamMosWidget(QWidget * const opc_Parent) :
            this, &C_CamMosWidget::SigAddLogFileAsc);
    connect(this->mpc_Ui->pc_WiLogging, &C_CamMosLoggingWidget::SigAddLogFileBlf,
            this, &C_CamMosWidget::SigAddLogFileBlf);
+   connect(this->mpc_Ui->pc_WiLogging, &C_CamMosLoggingWidget::SigAddLogFileBin,
+           this, &C_CamMosWidget::SigAddLogFileBin);
    connect(this->mpc_Ui->pc_WiLogging, &C_CamMosLoggingWidget::SigRemoveAllLogFiles,
            this, &C_CamMosWidget::SigRemoveAllLogFiles);
    connect(this->mpc_Ui->pc_WiDllConfig, &C_CamMosDllWidget::SigCANDllConfigured,
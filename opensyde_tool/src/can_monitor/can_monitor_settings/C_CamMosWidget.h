@@ -72,6 +72,7 @@ Q_SIGNALS:
    void SigSetDatabaseOsySysDefBus(const QString & orc_PathSystemDefinition, const stw_types::uint32 ou32_BusIndex);
    void SigAddLogFileAsc(const QString & orc_FilePath);
    void SigAddLogFileBlf(const QString & orc_FilePath);
+   void SigAddLogFileBin(const QString & orc_FilePath);
    void SigRemoveAllLogFiles(void);
    void SigCANDllConfigured(void);
 
@@ -75,9 +75,9 @@ C_OSCNodeDataPoolContent C_CamGenSigUtil::h_DecodeRawToContentSignal(const std::
 {
    C_OSCNodeDataPoolContent c_Retval = orc_SignalMin;
    //Convert to byte array
-   uint8 au8_Bytes[8];
+   uint8 au8_Bytes[stw_can::STWCAN_MAX_DATA_LENGTH_FD];
 
-   for (uint8 u8_ItByte = 0U; u8_ItByte < 8U; ++u8_ItByte)
+   for (uint8 u8_ItByte = 0U; u8_ItByte < stw_can::STWCAN_MAX_DATA_LENGTH_FD; ++u8_ItByte)
    {
       if (static_cast<uint32>(u8_ItByte) < orc_Raw.size())
       {
@@ -106,7 +106,7 @@ void C_CamGenSigUtil::h_DecodeSignalValueToRaw(std::vector<uint8> & orc_Raw, con
                                                const C_OSCNodeDataPoolContent & orc_Value)
 {
    //Convert to byte array
-   uint8 au8_Bytes[8];
+   uint8 au8_Bytes[stw_can::STWCAN_MAX_DATA_LENGTH_FD];
 
    //Step 1: zero all SIGNAL bits (required by core function)
    for (uint16 u16_ItBit = 0U; u16_ItBit < orc_Signal.u16_ComBitLength; ++u16_ItBit)
@@ -115,7 +115,7 @@ void C_CamGenSigUtil::h_DecodeSignalValueToRaw(std::vector<uint8> & orc_Raw, con
    }
 
    //Step 2: covert all bytes to array
-   for (uint8 u8_ItByte = 0U; u8_ItByte < 8U; ++u8_ItByte)
+   for (uint8 u8_ItByte = 0U; u8_ItByte < stw_can::STWCAN_MAX_DATA_LENGTH_FD; ++u8_ItByte)
    {
       if (static_cast<uint32>(u8_ItByte) < orc_Raw.size())
       {
@@ -129,7 +129,9 @@ void C_CamGenSigUtil::h_DecodeSignalValueToRaw(std::vector<uint8> & orc_Raw, con
    //Step 3: use core function
    C_OSCCanUtil::h_SetSignalValue(au8_Bytes, orc_Signal, orc_Value);
    //Step 4: write back to vector
-   for (uint8 u8_ItByte = 0U; (static_cast<uint32>(u8_ItByte) < orc_Raw.size()) && (u8_ItByte < 8U); ++u8_ItByte)
+   for (uint8 u8_ItByte = 0U;
+        (static_cast<uint32>(u8_ItByte) < orc_Raw.size()) && (u8_ItByte < stw_can::STWCAN_MAX_DATA_LENGTH_FD);
+        ++u8_ItByte)
    {
       orc_Raw[static_cast<uint32>(u8_ItByte)] = au8_Bytes[u8_ItByte];
    }
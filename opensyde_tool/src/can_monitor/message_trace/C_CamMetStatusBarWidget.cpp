@@ -51,7 +51,8 @@ C_CamMetStatusBarWidget::C_CamMetStatusBarWidget(QWidget * const opc_Parent) :
    mu32_TxErrors(0U),
    mu32_TransmittedMessages(0U),
    mu32_FilteredMessages(0U),
-   mu32_ActiveFilters(0U)
+   mu32_ActiveFilters(0U),
+   mu32_LogFileDroppedMessages(0U)
 {
    this->mpc_Ui->setupUi(this);
 
@@ -80,7 +81,9 @@ void C_CamMetStatusBarWidget::InitStaticNames(void)
    this->mpc_Ui->pc_ActiveFiltersLabel->SetToolTipInformation(
       C_GtGetText::h_GetText("Active Receive Filters"),
       C_GtGetText::h_GetText("Number of active receive filters and "
-                             "number of CAN messages which are filtered since measurement start."));
+                             "number of CAN messages which are filtered since measurement start.\n"
+                             "If the log file could not keep up with the bus traffic, the number of CAN messages "
+                             "missing in the log file is shown too."));
    this->mpc_Ui->pc_BusLoadLabel->SetToolTipInformation(
       C_GtGetText::h_GetText("Bus Load"),
       C_GtGetText::h_GetText("Approximate bus load."));
@@ -173,6 +176,21 @@ void C_CamMetStatusBarWidget::SetActiveFilters(const stw_types::uint32 ou32_Acti
    this->m_UpdateFilterLabel();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Sets the number of CAN messages which could not be written to the log files
+
+   \param[in] ou32_DroppedMessages Number of dropped messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetStatusBarWidget::SetLogFileDroppedMessages(const stw_types::uint32 ou32_DroppedMessages)
+{
+   if (this->mu32_LogFileDroppedMessages != ou32_DroppedMessages)
+   {
+      this->mu32_LogFileDroppedMessages = ou32_DroppedMessages;
+      this->m_UpdateFilterLabel();
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Update the filter label
 */
@@ -196,6 +214,13 @@ void C_CamMetStatusBarWidget::m_UpdateFilterLabel(void) const
                                                    QString(C_GtGetText::h_GetText(" (Filtered Messages: %1)")).
                                                    arg(QString::number(this->mu32_FilteredMessages)));
    }
+
+   if (this->mu32_LogFileDroppedMessages > 0U)
+   {
+      this->mpc_Ui->pc_ActiveFiltersLabel->setText(this->mpc_Ui->pc_ActiveFiltersLabel->text() +
+                                                   QString(C_GtGetText::h_GetText(" (Not Logged Messages: %1)")).
+                                                   arg(QString::number(this->mu32_LogFileDroppedMessages)));
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
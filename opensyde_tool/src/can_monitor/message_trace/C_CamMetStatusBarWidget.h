@@ -45,6 +45,7 @@ public:
    void SetTransmittedMessages(const stw_types::uint32 ou32_NumTxMessages);
    void SetFilteredMessages(const stw_types::uint32 ou32_FilteredMessages);
    void SetActiveFilters(const stw_types::uint32 ou32_ActiveFilters);
+   void SetLogFileDroppedMessages(const stw_types::uint32 ou32_DroppedMessages);
 
 private:
    Ui::C_CamMetStatusBarWidget * mpc_Ui;
@@ -62,6 +63,7 @@ private:
    stw_types::uint32 mu32_TransmittedMessages;
    stw_types::uint32 mu32_FilteredMessages;
    stw_types::uint32 mu32_ActiveFilters;
+   stw_types::uint32 mu32_LogFileDroppedMessages;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
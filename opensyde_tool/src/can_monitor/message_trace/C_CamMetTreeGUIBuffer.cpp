@@ -83,8 +83,8 @@ void C_CamMetTreeGUIBuffer::m_HandleUpdateUi(void)
 {
    std::list<C_CamMetTreeLoggerData> c_BufferCopy;
    this->mc_BufferMutex.lock();
-   c_BufferCopy = this->mc_Buffer;
-   this->mc_Buffer.clear();
+   //Hand over the collected data without copying it
+   c_BufferCopy.swap(this->mc_Buffer);
    this->mc_BufferMutex.unlock();
    if (c_BufferCopy.empty() == false)
    {
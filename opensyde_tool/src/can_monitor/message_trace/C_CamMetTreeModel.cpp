@@ -14,6 +14,7 @@
 
 #include <sstream>
 #include <iomanip>
+#include <iterator>
 
 #include <QBitArray>
 
@@ -69,6 +70,7 @@ C_CamMetTreeModel::C_CamMetTreeModel(QObject * const opc_Parent) :
    mu32_TraceBufferSizeConfig(1000U),
    mq_DataUnlocked(false),
    mu32_OldestItemIndex(0),
+   mu32_ItemCount(0),
    ms32_SelectedParentRow(-1),
    mq_GrayOutPause(false),
    mu32_GrayOutPauseTimeStamp(0U),
@@ -219,6 +221,7 @@ void C_CamMetTreeModel::ActionClearData(void)
 {
    this->beginResetModel();
    this->mu32_OldestItemIndex = 0UL;
+   this->mu32_ItemCount = 0UL;
    this->mc_DataBase.clear();
    this->mc_UniqueMessages.clear();
    this->mc_UniqueMessagesOrdering.clear();
@@ -729,7 +732,7 @@ sintn C_CamMetTreeModel::rowCount(const QModelIndex & orc_Parent) const
       }
       else
       {
-         sn_Retval = this->mc_DataBase.size();
+         sn_Retval = static_cast<sintn>(this->mu32_ItemCount);
       }
    }
    else
@@ -1581,124 +1584,95 @@ void C_CamMetTreeModel::m_AdaptTraceBufferSize(void)
 std::vector<sint32> C_CamMetTreeModel::m_AddRowsContinuousMode(const std::list<C_CamMetTreeLoggerData> & orc_Data)
 {
    std::vector<sint32> c_Retval;
-   if (orc_Data.empty() == false)
+   if ((orc_Data.empty() == false) && (this->mu32_TraceBufferSizeUsed > 0UL))
    {
-      //Columns which need to get updated on change of static message
-      const uint32 u32_CompleteSize = static_cast<uint32>(this->mc_DataBase.size()) +
-                                      static_cast<uint32>(orc_Data.size());
+      std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
+      uint32 u32_NumNew = static_cast<uint32>(orc_Data.size());
+      uint32 u32_NumEvict = 0UL;
 
-      //Check if only append case
-      if (u32_CompleteSize <= this->mu32_TraceBufferSizeUsed)
+      //Messages which would be evicted again by the same update are never stored
+      if (u32_NumNew > this->mu32_TraceBufferSizeUsed)
       {
-         //Appending so notify model of insert action
-         if (this->mq_UniqueMessageMode == false)
-         {
-            this->beginInsertRows(QModelIndex(), this->rowCount(),
-                                  this->rowCount() + (static_cast<sintn>(orc_Data.size()) - 1));
-         }
-         //Appending items in reserved space
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
-         {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            this->mc_DataBase.push_back(*c_ItData);
-            //Add tree item
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            this->mpc_RootItemContinuous->AddChild(pc_Item);
-         }
-         //Appending so notify model of insert action
-         if (this->mq_UniqueMessageMode == false)
-         {
-            this->endInsertRows();
-         }
+         std::advance(c_ItData, u32_NumNew - this->mu32_TraceBufferSizeUsed);
+         u32_NumNew = this->mu32_TraceBufferSizeUsed;
       }
-      //Check if we need to append any items to reach the max storage size
-      else if (this->mc_DataBase.size() < this->mu32_TraceBufferSizeUsed)
+      if ((this->mu32_ItemCount + u32_NumNew) > this->mu32_TraceBufferSizeUsed)
+      {
+         u32_NumEvict = (this->mu32_ItemCount + u32_NumNew) - this->mu32_TraceBufferSizeUsed;
+      }
+
+      //1. Evict the oldest items in one step
+      if (u32_NumEvict > 0UL)
       {
-         //Simple model reset notification (if replaced: look at two segments: adding new and queuing mechanism)
          if (this->mq_UniqueMessageMode == false)
          {
-            this->beginResetModel();
+            this->beginRemoveRows(QModelIndex(), 0, static_cast<sintn>(u32_NumEvict) - 1);
          }
-         //One time code doing both parts
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
+         //Ring buffer: the storage of the evicted items is reused by the new items
+         this->mu32_OldestItemIndex = (this->mu32_OldestItemIndex + u32_NumEvict) % this->mu32_TraceBufferSizeUsed;
+         this->mu32_ItemCount -= u32_NumEvict;
+         //Tree items: only one move of the remaining items per update
+         for (uint32 u32_ItItem = 0UL; u32_ItItem < u32_NumEvict; ++u32_ItItem)
          {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            //1. insert until space is no longer available
-            if (this->mc_DataBase.size() < this->mu32_TraceBufferSizeUsed)
-            {
-               //Append in reserved space
-               this->mc_DataBase.push_back(*c_ItData);
-               //Add tree item
-               this->mpc_RootItemContinuous->AddChild(pc_Item);
-            }
-            //2. start replacing oldest ones
-            else
+            delete (this->mpc_RootItemContinuous->c_Children[u32_ItItem]);
+         }
+         this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin(),
+                                                        this->mpc_RootItemContinuous->c_Children.begin() +
+                                                        u32_NumEvict);
+         //Keep the selection of the remaining items (selection refers to the unique view in unique message mode)
+         if ((this->mq_UniqueMessageMode == false) && (this->ms32_SelectedParentRow >= 0))
+         {
+            this->ms32_SelectedParentRow -= static_cast<sint32>(u32_NumEvict);
+            if (this->ms32_SelectedParentRow < 0)
             {
-               //Shift item
-               this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-               //Replace tree item
-               delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-               this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
-               this->mpc_RootItemContinuous->AddChild(pc_Item);
-               //Iterate
-               ++this->mu32_OldestItemIndex;
-               this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
+               this->ms32_SelectedParentRow = -1;
+               this->mc_SelectedChildBytes.clear();
             }
          }
-         //Simple model reset notification
          if (this->mq_UniqueMessageMode == false)
          {
-            //Every reset will clear the selection
-            this->SetSelection(-1, -1);
-            this->endResetModel();
+            this->endRemoveRows();
          }
       }
-      else
+
+      //2. Append the new items
+      if (this->mq_UniqueMessageMode == false)
       {
-         //Begin queue shift
-         if (this->mq_UniqueMessageMode == false)
-         {
-            //Use reset model to avoid console output, warning: does have negative side effects, but also faster
-            this->beginResetModel();
-            //this->beginRemoveRows(QModelIndex(), 0, orc_Data.size() - 1);
-            //this->beginInsertRows(QModelIndex(), this->rowCount() - (orc_Data.size() - 1), this->rowCount());
-         }
-         //Shift item in queue
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
+         this->beginInsertRows(QModelIndex(), static_cast<sintn>(this->mu32_ItemCount),
+                               static_cast<sintn>((this->mu32_ItemCount + u32_NumNew) - 1UL));
+      }
+      for (; c_ItData != orc_Data.end(); ++c_ItData)
+      {
+         const uint32 u32_Index = (this->mu32_OldestItemIndex + this->mu32_ItemCount) %
+                                  this->mu32_TraceBufferSizeUsed;
+         C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
+
+         if (u32_Index < this->mc_DataBase.size())
          {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-            //Replace tree item
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-            this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
-            this->mpc_RootItemContinuous->AddChild(pc_Item);
-            //Iterate
-            ++this->mu32_OldestItemIndex;
-            this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
+            //Reuse storage of an evicted item
+            this->mc_DataBase[u32_Index] = *c_ItData;
          }
-         //End queue shift
-         if (this->mq_UniqueMessageMode == false)
+         else
          {
-            //Every reset will clear the selection
-            this->SetSelection(-1, -1);
-            //Use reset model to avoid console output, warning: reset model does have negative side effects
-            this->endResetModel();
-            //this->endInsertRows();
-            //this->endRemoveRows();
+            //Append in reserved space
+            this->mc_DataBase.push_back(*c_ItData);
          }
+         ++this->mu32_ItemCount;
+         //Add tree item
+         m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
+         this->mpc_RootItemContinuous->AddChild(pc_Item);
       }
+      if (this->mq_UniqueMessageMode == false)
+      {
+         this->endInsertRows();
+      }
+
       //Every time count the actual indices
       if (this->mq_UniqueMessageMode == false)
       {
-         sint32 s32_Start = static_cast<sint32>(this->rowCount()) - (static_cast<sint32>(orc_Data.size()) - 1);
-         c_Retval.reserve(orc_Data.size());
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
+         sint32 s32_Start = static_cast<sint32>(this->rowCount()) - (static_cast<sint32>(u32_NumNew) - 1);
+         c_Retval.reserve(u32_NumNew);
+         for (uint32 u32_ItItem = 0UL; u32_ItItem < u32_NumNew; ++u32_ItItem)
          {
             c_Retval.push_back(s32_Start);
             ++s32_Start;
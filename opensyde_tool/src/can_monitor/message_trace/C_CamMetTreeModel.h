@@ -112,6 +112,7 @@ private:
    std::vector<C_CamMetTreeLoggerData> mc_DataBase;
    bool mq_DataUnlocked;
    stw_types::uint32 mu32_OldestItemIndex;
+   stw_types::uint32 mu32_ItemCount; // Number of valid items in the ring buffer mc_DataBase
    stw_types::sint32 ms32_SelectedParentRow;
    std::set<stw_types::uint16> mc_SelectedChildBytes;
    std::vector<QColor> mc_FontTransparcencyColors;
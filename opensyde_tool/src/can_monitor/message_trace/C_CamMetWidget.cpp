@@ -347,6 +347,19 @@ void C_CamMetWidget::AddLogFileBlf(const QString & orc_FilePath)
    Q_EMIT (this->SigLogFileAddResult(s32_Result));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add new compact openSYDE binary trace file logging.
+
+   \param[in]  orc_FilePath   file path to log file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetWidget::AddLogFileBin(const QString & orc_FilePath)
+{
+   const sint32 s32_Result = this->mpc_Ui->pc_TraceView->AddLogFileBin(orc_FilePath.toStdString().c_str());
+
+   Q_EMIT (this->SigLogFileAddResult(s32_Result));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Remove all configured log files.
 */
@@ -389,6 +402,7 @@ void C_CamMetWidget::m_StatusBarTimer(void)
    this->mpc_Ui->pc_StatusWidget->SetTransmittedMessages(this->mpc_Ui->pc_TraceView->GetTxCount());
    this->mpc_Ui->pc_StatusWidget->SetTxErrors(this->mpc_Ui->pc_TraceView->GetTxErrors());
    this->mpc_Ui->pc_StatusWidget->SetFilteredMessages(this->mpc_Ui->pc_TraceView->GetFilteredMessages());
+   this->mpc_Ui->pc_StatusWidget->SetLogFileDroppedMessages(this->mpc_Ui->pc_TraceView->GetLogFileDroppedMessages());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -70,6 +70,7 @@ public:
    // Logging configuration
    void AddLogFileAsc(const QString & orc_FilePath);
    void AddLogFileBlf(const QString & orc_FilePath);
+   void AddLogFileBin(const QString & orc_FilePath);
    void RemoveAllLogFiles(void) const;
 
    stw_opensyde_gui_logic::C_SyvComMessageMonitor * GetMessageMonitor(void) const;
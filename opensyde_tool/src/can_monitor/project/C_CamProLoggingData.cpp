@@ -95,6 +95,10 @@ QString C_CamProLoggingData::h_FormatEnumToString(const C_CamProLoggingData::E_F
    {
       c_Return = "blf";
    }
+   else if (oe_Format == eOSYT)
+   {
+      c_Return = "osyt";
+   }
    else
    {
       c_Return = "asc";
@@ -120,6 +124,10 @@ C_CamProLoggingData::E_Format C_CamProLoggingData::h_FormatStringToEnum(const QS
    {
       e_Return = eBLF;
    }
+   else if (orc_Format == "osyt")
+   {
+      e_Return = eOSYT;
+   }
    else
    {
       e_Return = eASC;
@@ -36,7 +36,8 @@ public:
    enum E_Format
    {
       eASC = 0,
-      eBLF
+      eBLF,
+      eOSYT ///< compact openSYDE binary trace
    };
 
    C_CamProLoggingData(void);
@@ -477,7 +477,7 @@ void C_GiSvNodeSyvUpdate::UpdateInitialPackageStatus(const C_SyvUpDeviceInfo & o
                   C_OsyHexFile c_HexFile;
                   uint32 u32_Result;
 
-                  u32_Result = c_HexFile.LoadFromFile(c_Path.c_str());
+                  u32_Result = c_HexFile.LoadDataDumpFromFile(c_Path.c_str());
                   if (u32_Result == stw_hex_file::NO_ERR)
                   {
                      stw_diag_lib::C_XFLECUInformation c_FileApplicationInfo;
@@ -58,6 +58,9 @@ uint32 C_PuiSdHandlerBusLogic::AddBusAndSort(C_OSCSystemBus & orc_OSCBus, const
 {
    const uint32 u32_Index = mc_CoreDefinition.c_Buses.size();
 
+   //Node indices or bus connections might change
+   this->m_SetAllNodeHashesChanged();
+
    if (opc_Name != NULL)
    {
       orc_OSCBus.c_Name = opc_Name->toStdString().c_str();
@@ -248,6 +251,9 @@ void C_PuiSdHandlerBusLogic::RemoveBus(const uint32 ou32_BusIndex)
 {
    uint32 u32_Counter;
 
+   //Node indices or bus connections might change
+   this->m_SetAllNodeHashesChanged();
+
    this->mc_CoreDefinition.DeleteBus(ou32_BusIndex);
    this->mc_UIBuses.erase(this->mc_UIBuses.begin() + ou32_BusIndex);
 
@@ -518,6 +524,8 @@ void C_PuiSdHandlerBusLogic::AddConnection(const uint32 ou32_NodeIndex, const ui
 {
    const C_OSCSystemBus * const pc_Bus = this->GetOSCBus(ou32_BusIndex);
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if ((ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size()) && (pc_Bus != NULL))
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -558,6 +566,8 @@ void C_PuiSdHandlerBusLogic::AddConnection(const uint32 ou32_NodeIndex, const ui
 //----------------------------------------------------------------------------------------------------------------------
 void C_PuiSdHandlerBusLogic::RemoveConnection(const uint32 ou32_NodeIndex, const C_PuiSdNodeConnectionId & orc_ID)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -584,6 +594,8 @@ void C_PuiSdHandlerBusLogic::ChangeConnection(const uint32 ou32_NodeIndex, const
 {
    C_PuiSdNodeConnectionId c_Tmp;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    c_Tmp.e_InterfaceType = orc_ID.e_InterfaceType;
    c_Tmp.u8_InterfaceNumber = ou8_NewInterface;
    ChangeCompleteConnection(ou32_NodeIndex, orc_ID, c_Tmp, oru8_NodeId);
@@ -604,6 +616,8 @@ void C_PuiSdHandlerBusLogic::ChangeCompleteConnection(const uint32 ou32_NodeInde
                                                       const C_PuiSdNodeConnectionId & orc_NewID,
                                                       const uint8 & oru8_NodeId, const uint32 & oru32_BusIndex)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -667,6 +681,8 @@ void C_PuiSdHandlerBusLogic::ChangeCompleteConnection(const uint32 ou32_NodeInde
 void C_PuiSdHandlerBusLogic::SetUINodeConnections(const uint32 ou32_NodeIndex,
                                                   const std::vector<C_PuiSdNodeConnection> & orc_Connections)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_UINodes.size())
    {
       C_PuiSdNode & rc_UINode = this->mc_UINodes[ou32_NodeIndex];
@@ -685,6 +701,8 @@ void C_PuiSdHandlerBusLogic::SetUINodeConnections(const uint32 ou32_NodeIndex,
 void C_PuiSdHandlerBusLogic::SetUINodeConnectionId(const uint32 ou32_NodeIndex, const uint32 ou32_ConnectionIndex,
                                                    const C_PuiSdNodeConnectionId & orc_Id)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_UINodes.size())
    {
       C_PuiSdNode & rc_UINode = this->mc_UINodes[ou32_NodeIndex];
@@ -1333,6 +1351,8 @@ void C_PuiSdHandlerBusLogic::SetCanProtocolMessageContainerConnected(const uint3
                                                                      const uint32 ou32_InterfaceIndex,
                                                                      const bool oq_Value)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -1373,6 +1393,8 @@ sint32 C_PuiSdHandlerBusLogic::SetCanMessageProperties(const C_OSCCanMessageIden
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       const C_OSCCanMessageContainer * const pc_MessageContainer = this->GetCanProtocolMessageContainer(
@@ -1493,6 +1515,8 @@ sint32 C_PuiSdHandlerBusLogic::SetUiCanMessage(const C_OSCCanMessageIdentificati
                                                                            orc_MessageId.e_ComProtocol,
                                                                            orc_MessageId.u32_DatapoolIndex);
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    //Ui message part
    if (pc_UiProtocol != NULL)
    {
@@ -1546,6 +1570,8 @@ sint32 C_PuiSdHandlerBusLogic::SetCanSignal(const C_OSCCanMessageIdentificationI
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    //Position
    tgl_assert(this->mc_CoreDefinition.c_Nodes.size() == this->mc_UINodes.size());
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -1661,6 +1687,8 @@ sint32 C_PuiSdHandlerBusLogic::SetCanSignalMUXValue(const C_OSCCanMessageIdentif
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    //Position
    tgl_assert(this->mc_CoreDefinition.c_Nodes.size() == this->mc_UINodes.size());
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -1698,6 +1726,8 @@ sint32 C_PuiSdHandlerBusLogic::SetCanSignalPosition(const C_OSCCanMessageIdentif
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    //Position
    tgl_assert(this->mc_CoreDefinition.c_Nodes.size() == this->mc_UINodes.size());
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -1771,6 +1801,8 @@ sint32 C_PuiSdHandlerBusLogic::AddCanMessage(const uint32 & oru32_NodeIndex,
                                                                                                      oru32_InterfaceIndex,
                                                                                                      ou32_DatapoolIndex);
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    if (pc_MessageContainer != NULL)
    {
       const std::vector<C_OSCCanMessage> & rc_Messages = pc_MessageContainer->GetMessagesConst(orq_MessageIsTx);
@@ -1813,6 +1845,8 @@ sint32 C_PuiSdHandlerBusLogic::InsertCanMessage(const C_OSCCanMessageIdentificat
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    tgl_assert(this->mc_CoreDefinition.c_Nodes.size() == this->mc_UINodes.size());
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -1863,6 +1897,8 @@ sint32 C_PuiSdHandlerBusLogic::DeleteCanMessage(const C_OSCCanMessageIdentificat
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    tgl_assert(this->mc_CoreDefinition.c_Nodes.size() == this->mc_UINodes.size());
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -1916,6 +1952,8 @@ sint32 C_PuiSdHandlerBusLogic::AddCanSignal(const C_OSCCanMessageIdentificationI
    sint32 s32_Retval = C_NO_ERR;
    const C_OSCCanMessage * const pc_Message = this->GetCanMessage(orc_MessageId);
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    if (pc_Message != NULL)
    {
       const uint32 u32_SignalIndex = pc_Message->c_Signals.size();
@@ -1952,6 +1990,8 @@ sint32 C_PuiSdHandlerBusLogic::InsertCanSignal(const C_OSCCanMessageIdentificati
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    tgl_assert(this->mc_CoreDefinition.c_Nodes.size() == this->mc_UINodes.size());
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -2058,6 +2098,8 @@ sint32 C_PuiSdHandlerBusLogic::DeleteCanSignal(const C_OSCCanMessageIdentificati
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(orc_MessageId.u32_NodeIndex);
+
    tgl_assert(this->mc_CoreDefinition.c_Nodes.size() == this->mc_UINodes.size());
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
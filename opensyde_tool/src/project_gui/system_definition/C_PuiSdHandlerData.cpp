@@ -17,6 +17,7 @@
 #include "TGLUtils.h"
 #include "stwerrors.h"
 #include "C_OSCUtils.h"
+#include "CSCLChecksums.h"
 #include "C_SdBueSortHelper.h"
 #include "C_PuiSdHandlerData.h"
 #include "C_OSCLoggingHandler.h"
@@ -70,6 +71,9 @@ sint32 C_PuiSdHandlerData::LoadFromFile(const stw_scl::C_SCLString & orc_Path, u
 
    const uint16 u16_TimerId = osc_write_log_performance_start();
 
+   //All nodes are replaced
+   this->m_SetAllNodeHashesChanged();
+
    if (TGL_FileExists(orc_Path) == true)
    {
       C_OSCXMLParser c_XMLParser;
@@ -183,6 +187,7 @@ sint32 C_PuiSdHandlerData::LoadFromFile(const stw_scl::C_SCLString & orc_Path, u
             m_FixCommInconsistencyErrors();
             m_FixAddressIssues();
             m_FixNameIssues();
+            this->m_SetAllNodeHashesChanged();
          }
 
          //AFTER automated adaptions!
@@ -375,6 +380,9 @@ bool C_PuiSdHandlerData::HasHashChanged(void) const
 
    Start value is 0xFFFFFFFF
 
+   The nodes contribute by their cached hashes, so only nodes changed since the last call are hashed again
+   (see m_SetNodeHashChanged).
+
    \return
    Calculated hash value
 */
@@ -385,8 +393,21 @@ uint32 C_PuiSdHandlerData::CalcHashSystemDefinition(void) const
    uint32 u32_Hash = 0xFFFFFFFFU;
    uint32 u32_Counter;
 
-   // calculate the hash for the core elements
-   this->mc_CoreDefinition.CalcHash(u32_Hash);
+   // calculate the hash for the nodes
+   for (u32_Counter = 0U; u32_Counter < this->mc_CoreDefinition.c_Nodes.size(); ++u32_Counter)
+   {
+      this->m_UpdateNodeHashes(u32_Counter);
+      stw_scl::C_SCLChecksums::CalcCRC32(&this->mc_CoreNodeHashes[u32_Counter],
+                                         sizeof(this->mc_CoreNodeHashes[u32_Counter]), u32_Hash);
+      stw_scl::C_SCLChecksums::CalcCRC32(&this->mc_UINodeHashes[u32_Counter],
+                                         sizeof(this->mc_UINodeHashes[u32_Counter]), u32_Hash);
+   }
+
+   // calculate the hash for the core buses
+   for (u32_Counter = 0U; u32_Counter < this->mc_CoreDefinition.c_Buses.size(); ++u32_Counter)
+   {
+      this->mc_CoreDefinition.c_Buses[u32_Counter].CalcHash(u32_Hash);
+   }
 
    // calculate the hash for the ui elements
    this->c_Elements.CalcHash(u32_Hash);
@@ -396,11 +417,6 @@ uint32 C_PuiSdHandlerData::CalcHashSystemDefinition(void) const
       this->c_BusTextElements[u32_Counter].CalcHash(u32_Hash);
    }
 
-   for (u32_Counter = 0U; u32_Counter < this->mc_UINodes.size(); ++u32_Counter)
-   {
-      this->mc_UINodes[u32_Counter].CalcHash(u32_Hash);
-   }
-
    for (u32_Counter = 0U; u32_Counter < this->mc_UIBuses.size(); ++u32_Counter)
    {
       this->mc_UIBuses[u32_Counter].CalcHash(u32_Hash);
@@ -424,6 +440,7 @@ void C_PuiSdHandlerData::Clear(void)
    this->c_Elements.Clear();
    this->c_BusTextElements.clear();
    this->mc_SharedDatapools.Clear();
+   this->m_SetAllNodeHashesChanged();
 
    //Reset hash
    this->mu32_CalculatedHashSystemDefinition = this->CalcHashSystemDefinition();
@@ -467,6 +484,8 @@ C_SdTopologyDataSnapshot C_PuiSdHandlerData::GetSnapshot(void) const
 //----------------------------------------------------------------------------------------------------------------------
 C_OSCSystemDefinition & C_PuiSdHandlerData::GetOSCSystemDefinition(void)
 {
+   //Caller might change any node
+   this->m_SetAllNodeHashesChanged();
    return this->mc_CoreDefinition;
 }
 
@@ -668,8 +687,8 @@ uint32 C_PuiSdHandlerData::m_GetHashNode(const uint32 ou32_NodeIndex) const
 
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
-      const C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
-      rc_Node.CalcHash(u32_Retval);
+      this->m_UpdateNodeHashes(ou32_NodeIndex);
+      u32_Retval = this->mc_CoreNodeHashes[ou32_NodeIndex];
    }
    return u32_Retval;
 }
@@ -695,6 +714,70 @@ uint32 C_PuiSdHandlerData::m_GetHashBus(const uint32 ou32_BusIndex) const
    return u32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Mark cached hashes of node as outdated
+
+   Has to be called by each function that changes the core or UI part of a node.
+
+   \param[in] ou32_NodeIndex Index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSdHandlerData::m_SetNodeHashChanged(const uint32 ou32_NodeIndex)
+{
+   if (ou32_NodeIndex < this->mc_NodeHashesValid.size())
+   {
+      this->mc_NodeHashesValid[ou32_NodeIndex] = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Mark cached hashes of all nodes as outdated
+
+   Has to be called if nodes are inserted in between or removed, or if an unknown set of nodes might be changed.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSdHandlerData::m_SetAllNodeHashesChanged(void)
+{
+   this->mc_NodeHashesValid.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Recalculate cached hashes of node if outdated
+
+   New nodes appended at the end start as outdated.
+
+   \param[in] ou32_NodeIndex Index (has to be valid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSdHandlerData::m_UpdateNodeHashes(const uint32 ou32_NodeIndex) const
+{
+   const uint32 u32_NodeCount = this->mc_CoreDefinition.c_Nodes.size();
+
+   if (this->mc_NodeHashesValid.size() != u32_NodeCount)
+   {
+      this->mc_NodeHashesValid.resize(u32_NodeCount, false);
+      this->mc_CoreNodeHashes.resize(u32_NodeCount, 0xFFFFFFFFU);
+      this->mc_UINodeHashes.resize(u32_NodeCount, 0xFFFFFFFFU);
+   }
+
+   if (this->mc_NodeHashesValid[ou32_NodeIndex] == false)
+   {
+      uint32 u32_Hash = 0xFFFFFFFFU;
+
+      this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex].CalcHash(u32_Hash);
+      this->mc_CoreNodeHashes[ou32_NodeIndex] = u32_Hash;
+
+      u32_Hash = 0xFFFFFFFFU;
+      if (ou32_NodeIndex < this->mc_UINodes.size())
+      {
+         this->mc_UINodes[ou32_NodeIndex].CalcHash(u32_Hash);
+      }
+      this->mc_UINodeHashes[ou32_NodeIndex] = u32_Hash;
+
+      this->mc_NodeHashesValid[ou32_NodeIndex] = true;
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Utility function to fix name errors for existing projects
 */
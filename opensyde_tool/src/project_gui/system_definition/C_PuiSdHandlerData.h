@@ -64,6 +64,8 @@ protected:
    static stw_types::sint32 mh_SortMessagesByName(stw_opensyde_core::C_OSCNode & orc_OSCNode, C_PuiSdNode & orc_UiNode);
    stw_types::uint32 m_GetHashNode(const stw_types::uint32 ou32_NodeIndex) const;
    stw_types::uint32 m_GetHashBus(const stw_types::uint32 ou32_BusIndex) const;
+   void m_SetNodeHashChanged(const stw_types::uint32 ou32_NodeIndex);
+   void m_SetAllNodeHashesChanged(void);
 
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
@@ -137,6 +139,11 @@ Q_SIGNALS:
    void SigSyncClear(void);
 
 private:
+   mutable std::vector<stw_types::uint32> mc_CoreNodeHashes; ///< Cached hash of each core node
+   mutable std::vector<stw_types::uint32> mc_UINodeHashes;   ///< Cached hash of each UI node
+   mutable std::vector<bool> mc_NodeHashesValid;             ///< Flag if cached hashes of node are up to date
+
+   void m_UpdateNodeHashes(const stw_types::uint32 ou32_NodeIndex) const;
    void m_FixNameIssues(void);
    void m_FixAddressIssues(void);
    void m_FixCommInconsistencyErrors(void);
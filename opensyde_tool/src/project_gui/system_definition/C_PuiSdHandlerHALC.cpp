@@ -394,6 +394,8 @@ sint32 C_PuiSdHandlerHALC::ClearHALCConfig(const uint32 ou32_NodeIndex)
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -422,6 +424,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCConfig(const uint32 ou32_NodeIndex, const C_OS
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -452,6 +456,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCConfigSafeDataBlock(const uint32 ou32_NodeInde
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -482,6 +488,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCConfigUnsafeDataBlock(const uint32 ou32_NodeIn
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -512,6 +520,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainConfig(const uint32 ou32_NodeIndex, cons
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -543,6 +553,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelConfig(const uint32 ou32_NodeInde
                                                       const uint32 ou32_ChannelIndex, const bool oq_UseChannelIndex,
                                                       const C_OSCHalcConfigChannel & orc_Channel)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    return this->SetHALCDomainChannelConfig(ou32_NodeIndex, ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex,
                                            orc_Channel.c_Name, orc_Channel.c_Comment, orc_Channel.q_SafetyRelevant,
                                            orc_Channel.u32_UseCaseIndex);
@@ -572,6 +584,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelConfig(const uint32 ou32_NodeInde
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -607,6 +621,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelConfigName(const uint32 ou32_Node
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -642,6 +658,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelConfigComment(const uint32 ou32_N
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -676,6 +694,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelConfigSafety(const uint32 ou32_No
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -711,6 +731,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelConfigUseCase(const uint32 ou32_N
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -749,6 +771,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelParameterConfig(const uint32 ou32
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -790,6 +814,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelParameterConfigElement(const uint
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -831,6 +857,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelParameterConfigElementEnum(const
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -875,6 +903,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCDomainChannelParameterConfigElementBitmask(con
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -908,6 +938,8 @@ sint32 C_PuiSdHandlerHALC::HALCGenerateDatapools(const uint32 ou32_NodeIndex)
 {
    sint32 s32_Retval;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if ((ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size()) &&
        (ou32_NodeIndex < this->mc_UINodes.size()))
    {
@@ -968,6 +1000,8 @@ sint32 C_PuiSdHandlerHALC::HALCRemoveDatapools(const uint32 ou32_NodeIndex)
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       const C_OSCNode & rc_OSCNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
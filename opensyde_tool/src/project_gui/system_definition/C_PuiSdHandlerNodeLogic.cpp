@@ -107,6 +107,8 @@ void C_PuiSdHandlerNodeLogic::SetOSCNodeEthernetConfiguration(const uint32 ou32_
                                                               const std::vector<sint32> & orc_NetMask,
                                                               const std::vector<sint32> & orc_DefaultGateway)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (((orc_Ip.size() == 4UL) && (orc_NetMask.size() == 4UL)) && (orc_DefaultGateway.size() == 4UL))
    {
       if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -247,6 +249,9 @@ C_OSCNode * C_PuiSdHandlerNodeLogic::GetOSCNode(const uint32 & oru32_Index)
 {
    C_OSCNode * pc_Retval;
 
+   //Caller might change the node
+   this->m_SetNodeHashChanged(oru32_Index);
+
    if (oru32_Index < this->mc_CoreDefinition.c_Nodes.size())
    {
       pc_Retval = &(this->mc_CoreDefinition.c_Nodes[oru32_Index]);
@@ -274,6 +279,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetStwFlashloaderSettings(const uint32 ou32_Inde
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_Index);
+
    if (ou32_Index < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_Index];
@@ -302,6 +309,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetNodeOpenSYDEServerSettings(const uint32 ou32_
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_Index);
+
    if (ou32_Index < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_Index];
@@ -330,6 +339,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetNodeCodeExportSettings(const uint32 ou32_Inde
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_Index);
+
    if (ou32_Index < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_Index];
@@ -352,6 +363,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetNodeCodeExportSettings(const uint32 ou32_Inde
 void C_PuiSdHandlerNodeLogic::SetOSCNodeProperties(const uint32 ou32_NodeIndex,
                                                    const C_OSCNodeProperties & orc_Properties)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_OSCNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -380,6 +393,8 @@ void C_PuiSdHandlerNodeLogic::SetOSCNodePropertiesDetailed(const uint32 ou32_Nod
                                                            const C_OSCNodeProperties::E_DiagnosticServerProtocol oe_DiagnosticServer, const C_OSCNodeProperties::E_FlashLoaderProtocol oe_FlashLoader, const std::vector<uint8> & orc_NodeIds, const std::vector<bool> & orc_UpdateFlags, const std::vector<bool> & orc_RoutingFlags,
                                                            const std::vector<bool> & orc_DiagnosisFlags)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_OSCNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -415,6 +430,8 @@ void C_PuiSdHandlerNodeLogic::SetOSCNodePropertiesDetailed(const uint32 ou32_Nod
 //----------------------------------------------------------------------------------------------------------------------
 void C_PuiSdHandlerNodeLogic::SetUINodeBox(const uint32 ou32_NodeIndex, const C_PuiBsBox & orc_Box)
 {
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_UINodes.size())
    {
       C_PuiSdNode & rc_UINode = this->mc_UINodes[ou32_NodeIndex];
@@ -471,6 +488,9 @@ uint32 C_PuiSdHandlerNodeLogic::AddNodeAndSort(C_OSCNode & orc_OSCNode, const C_
 //----------------------------------------------------------------------------------------------------------------------
 void C_PuiSdHandlerNodeLogic::RemoveNode(const uint32 ou32_NodeIndex)
 {
+   //Node indices or bus connections might change
+   this->m_SetAllNodeHashesChanged();
+
    //Synchronization engine (First!)
    Q_EMIT (this->SigSyncNodeAboutToBeDeleted(ou32_NodeIndex));
 
@@ -848,6 +868,8 @@ sint32 C_PuiSdHandlerNodeLogic::AddDataPool(const uint32 & oru32_NodeIndex, cons
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_UINodes.size())
@@ -918,6 +940,8 @@ sint32 C_PuiSdHandlerNodeLogic::AddAutoGenCommDataPool(const uint32 & oru32_Node
    QString c_Comment;
    QString c_ProtocolName = C_PuiSdUtil::h_ConvertProtocolTypeToString(ore_ComProtocolType);
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    // add the new datapool
    c_NewDatapool.e_Type = C_OSCNodeDataPool::eCOM;
 
@@ -966,6 +990,8 @@ sint32 C_PuiSdHandlerNodeLogic::InsertDataPool(const uint32 & oru32_NodeIndex, c
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_UINodes.size())
@@ -1022,6 +1048,8 @@ sint32 C_PuiSdHandlerNodeLogic::RemoveDataPool(const uint32 & oru32_NodeIndex, c
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_UINodes.size())
@@ -1079,6 +1107,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPool(const uint32 & oru32_NodeIndex, cons
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_UINodes.size())
@@ -1146,6 +1176,8 @@ sint32 C_PuiSdHandlerNodeLogic::UnassignDataPoolApplication(const uint32 & oru32
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
@@ -1184,6 +1216,8 @@ sint32 C_PuiSdHandlerNodeLogic::AssignDataPoolApplication(const uint32 ou32_Node
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -1370,6 +1404,8 @@ sint32 C_PuiSdHandlerNodeLogic::MoveDataPool(const uint32 ou32_NodeIndex, const
 {
    sint32 s32_Retval = C_RANGE;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (ou32_NodeIndex < this->mc_UINodes.size())
@@ -1567,6 +1603,8 @@ sint32 C_PuiSdHandlerNodeLogic::AddApplication(const uint32 ou32_NodeIndex, C_OS
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       const C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -1596,6 +1634,8 @@ sint32 C_PuiSdHandlerNodeLogic::InsertApplication(const uint32 ou32_NodeIndex, c
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -1635,6 +1675,8 @@ sint32 C_PuiSdHandlerNodeLogic::RemoveApplication(const uint32 ou32_NodeIndex, c
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -1676,6 +1718,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetApplication(const uint32 ou32_NodeIndex, cons
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -1741,6 +1785,8 @@ sint32 C_PuiSdHandlerNodeLogic::MoveApplication(const uint32 ou32_NodeIndex, con
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(ou32_NodeIndex);
+
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
@@ -2038,6 +2084,8 @@ sint32 C_PuiSdHandlerNodeLogic::InsertDataPoolList(const uint32 & oru32_NodeInde
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -2139,6 +2187,8 @@ sint32 C_PuiSdHandlerNodeLogic::RemoveDataPoolList(const uint32 & oru32_NodeInde
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -2226,6 +2276,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolList(const uint32 & oru32_NodeIndex,
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -2317,6 +2369,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListName(const uint32 & oru32_NodeInd
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -2402,6 +2456,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListComment(const uint32 & oru32_Node
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -2487,6 +2543,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListNVMSize(const uint32 & oru32_Node
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -2571,6 +2629,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListNVMCRC(const uint32 & oru32_NodeI
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -2793,6 +2853,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetOSCNodeDataPoolDataSet(const uint32 & oru32_N
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -2886,6 +2948,8 @@ sint32 C_PuiSdHandlerNodeLogic::InsertDataPoolListDataSet(const uint32 & oru32_N
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -3004,6 +3068,8 @@ sint32 C_PuiSdHandlerNodeLogic::RemoveDataPoolListDataSet(const uint32 & oru32_N
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -3113,6 +3179,8 @@ sint32 C_PuiSdHandlerNodeLogic::MoveDataPoolListDataSet(const uint32 & oru32_Nod
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -3290,6 +3358,8 @@ sint32 C_PuiSdHandlerNodeLogic::MoveDataPoolList(const uint32 & oru32_NodeIndex,
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -3576,6 +3646,8 @@ sint32 C_PuiSdHandlerNodeLogic::InsertDataPoolListElement(const uint32 & oru32_N
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -3694,6 +3766,8 @@ sint32 C_PuiSdHandlerNodeLogic::RemoveDataPoolListElement(const uint32 & oru32_N
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -3800,6 +3874,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListElement(const uint32 & oru32_Node
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
@@ -4037,6 +4113,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListElementMinArray(const uint32 & or
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -4175,6 +4253,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListElementMaxArray(const uint32 & or
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -4315,6 +4395,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListElementDataSetArray(const uint32
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -4460,6 +4542,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListElementNVMValue(const uint32 & or
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -4527,6 +4611,8 @@ sint32 C_PuiSdHandlerNodeLogic::SetDataPoolListElementNVMValueChanged(const uint
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
@@ -4678,6 +4764,8 @@ sint32 C_PuiSdHandlerNodeLogic::MoveDataPoolListElement(const uint32 & oru32_Nod
 {
    sint32 s32_Retval = C_NO_ERR;
 
+   this->m_SetNodeHashChanged(oru32_NodeIndex);
+
    //Check size & consistency
    tgl_assert(this->mc_UINodes.size() == this->mc_CoreDefinition.c_Nodes.size());
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
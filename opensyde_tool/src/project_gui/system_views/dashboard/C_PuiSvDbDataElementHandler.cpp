@@ -64,7 +64,9 @@ C_PuiSvDbDataElementHandler::C_PuiSvDbDataElementHandler(const uint32 & oru32_Vi
    C_PuiSvDbDataElement(oru32_ViewIndex, oru32_DashboardIndex, ors32_DataIndex, ore_Type),
    mq_ReadItem(oq_ReadItem),
    mu32_WidgetDataPoolElementCountMaximum(ou32_MaximumDataElements),
-   mu32_WidgetDataPoolElementCount(0U)
+   mu32_WidgetDataPoolElementCount(0U),
+   mu32_ReceivedValueCount(0U),
+   mu32_MaximumQueueDepth(0U)
 {
    this->mc_VecDataValues.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_VecNvmValue.resize(this->mu32_WidgetDataPoolElementCount);
@@ -109,6 +111,7 @@ sint32 C_PuiSvDbDataElementHandler::RegisterDataPoolElement(
 
          // Update the counter
          this->m_SetWidgetDataPoolElementCount(this->mc_MappingDpElementToDataSerie.size());
+         this->m_UpdateValueRouting();
          this->m_UpdateDataPoolElementTimeoutAndValidFlag();
          this->m_DataPoolElementsChanged();
          this->mc_CriticalSection.Release();
@@ -183,6 +186,7 @@ void C_PuiSvDbDataElementHandler::RemoveDataPoolElement(
             }
          }
       }
+      this->m_UpdateValueRouting();
 
       // Update all relevant items
       this->m_UpdateDataPoolElementTimeoutAndValidFlag();
@@ -211,6 +215,9 @@ void C_PuiSvDbDataElementHandler::ClearDataPoolElements(void)
    this->mc_CriticalSection.Acquire();
    this->mc_MappingDpElementToDataSerie.clear();
    this->m_SetWidgetDataPoolElementCount(this->mc_MappingDpElementToDataSerie.size());
+   this->m_UpdateValueRouting();
+   this->mu32_ReceivedValueCount = 0U;
+   this->mu32_MaximumQueueDepth = 0U;
    this->mc_CriticalSection.Release();
 
    this->m_DataPoolElementsChanged();
@@ -386,6 +393,9 @@ bool C_PuiSvDbDataElementHandler::IsDataElementRegistered(
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Inserts a new received value to the widget queue
 
+   The value is added to all data series showing the same data element (e.g. several array elements).
+   The data series are looked up in the routing table prepared on registration of the data elements.
+
    This function is thread safe.
 
    \param[in]  orc_WidgetDataPoolElementId   Datapool element identificator
@@ -396,25 +406,34 @@ void C_PuiSvDbDataElementHandler::InsertNewValueIntoQueue(
    const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId,
    const C_PuiSvDbDataElementContent & orc_NewValue)
 {
-   QMap<stw_opensyde_gui_logic::C_PuiSvDbNodeDataPoolListElementId, stw_types::uint32>::iterator c_ItItem;
-
-   //manual find because match is unreliable
-   for (c_ItItem = this->mc_MappingDpElementToDataSerie.begin(); c_ItItem != this->mc_MappingDpElementToDataSerie.end();
-        ++c_ItItem)
+   if (orc_WidgetDataPoolElementId.GetIsValid() == true)
    {
-      // Get the correct data series
-      if (c_ItItem.key().CheckSameDataElement(orc_WidgetDataPoolElementId))
+      const C_PuiSvDbNodeDataPoolListElementId c_Key = mh_GetRoutingKey(orc_WidgetDataPoolElementId);
+      QMap<C_PuiSvDbNodeDataPoolListElementId, std::vector<uint32> >::const_iterator c_ItRoute;
+
+      this->mc_CriticalSection.Acquire();
+      c_ItRoute = this->mc_RoutingDpElementToDataSeries.find(c_Key);
+      if (c_ItRoute != this->mc_RoutingDpElementToDataSeries.end())
       {
-         // Add the new value to the correct data series
-         const uint32 u32_DataSerieIndex = c_ItItem.value();
-         if (static_cast<sintn>(u32_DataSerieIndex) < this->mc_VecDataValues.size())
+         const std::vector<uint32> & rc_DataSeries = c_ItRoute.value();
+         for (uint32 u32_ItDataSerie = 0U; u32_ItDataSerie < rc_DataSeries.size(); ++u32_ItDataSerie)
          {
-            this->mc_CriticalSection.Acquire();
-            this->mc_VecDataValues[u32_DataSerieIndex].push_back(orc_NewValue);
-            this->mc_CriticalSection.Release();
+            // Add the new value to the correct data series
+            const uint32 u32_DataSerieIndex = rc_DataSeries[u32_ItDataSerie];
+            if (static_cast<sintn>(u32_DataSerieIndex) < this->mc_VecDataValues.size())
+            {
+               QList<C_PuiSvDbDataElementContent> & rc_Queue = this->mc_VecDataValues[u32_DataSerieIndex];
+               rc_Queue.push_back(orc_NewValue);
+
+               ++this->mu32_ReceivedValueCount;
+               if (static_cast<uint32>(rc_Queue.size()) > this->mu32_MaximumQueueDepth)
+               {
+                  this->mu32_MaximumQueueDepth = static_cast<uint32>(rc_Queue.size());
+               }
+            }
          }
-         //Don't stop as there might be multiple matches
       }
+      this->mc_CriticalSection.Release();
    }
 }
 
@@ -451,6 +470,27 @@ void C_PuiSvDbDataElementHandler::AddNewNvmValueIntoQueue(
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get statistics of the value queues
+
+   Can be used to monitor whether the UI keeps up with the received values.
+   Both values are reset by ClearDataPoolElements.
+
+   This function is thread safe.
+
+   \param[out]  oru32_ReceivedValueCount  Number of values added to the queues
+   \param[out]  oru32_MaximumQueueDepth   Maximum number of values waiting for one data element
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementHandler::GetQueueStatistics(uint32 & oru32_ReceivedValueCount,
+                                                     uint32 & oru32_MaximumQueueDepth) const
+{
+   this->mc_CriticalSection.Acquire();
+   oru32_ReceivedValueCount = this->mu32_ReceivedValueCount;
+   oru32_MaximumQueueDepth = this->mu32_MaximumQueueDepth;
+   this->mc_CriticalSection.Release();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get unscaled value as scaled string
 
@@ -582,17 +622,21 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
    if ((static_cast<sintn>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
        ((ou32_WidgetDataPoolElementIndex < this->mc_UsedScaling.size()) || (oq_UseScaling == false)))
    {
+      QList<C_PuiSvDbDataElementContent> c_Values;
+
+      // Only take over the queued values in the critical section so the receiving thread is not blocked
       this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      c_Values.swap(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex]);
+      this->mc_CriticalSection.Release();
+
+      if (c_Values.size() > 0)
       {
-         const sintn sn_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
+         const C_PuiSvDbDataElementContent & rc_LastValue = c_Values.last();
          uint32 u32_Counter;
          float64 f64_Temp;
 
          // Get the newest value
-         C_SdNdeDpContentUtil::h_GetValuesAsFloat64(
-            this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][sn_LastIndex],
-            orc_Values);
+         C_SdNdeDpContentUtil::h_GetValuesAsFloat64(rc_LastValue, orc_Values);
 
          // Scale all values
          if (oq_UseScaling == true)
@@ -611,8 +655,7 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
          //Save last timestamp
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsMs.size())
          {
-            this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] =
-               this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][sn_LastIndex].GetTimeStamp();
+            this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] = rc_LastValue.GetTimeStamp();
          }
          //Set timestamp valid
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsValid.size())
@@ -622,15 +665,12 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
             rc_Value = true;
          }
 
-         // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
          s32_Return = C_NO_ERR;
       }
       else
       {
          s32_Return = C_NOACT;
       }
-      this->mc_CriticalSection.Release();
    }
    if ((opc_StringifiedValues != NULL) && (ou32_WidgetDataPoolElementIndex < this->mc_MinimumType.size()))
    {
@@ -675,15 +715,20 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
         ((ou32_WidgetDataPoolElementIndex < this->mc_UsedScaling.size()) || (oq_UseScaling == false))) && (
           this->GetDataPoolElementIndex(ou32_WidgetDataPoolElementIndex, c_Id) == C_NO_ERR))
    {
+      QList<C_PuiSvDbDataElementContent> c_Values;
+
+      // Only take over the queued values in the critical section so the receiving thread is not blocked
       this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      c_Values.swap(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex]);
+      this->mc_CriticalSection.Release();
+
+      if (c_Values.size() > 0)
       {
-         const sintn sn_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
+         const C_PuiSvDbDataElementContent & rc_LastValue = c_Values.last();
          float64 f64_Temp;
          const uint32 u32_Index = c_Id.GetArrayElementIndexOrZero();
          // Get the newest value as float
-         C_SdNdeDpContentUtil::h_GetValueAsFloat64(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][
-                                                      sn_LastIndex], f64_Temp, u32_Index);
+         C_SdNdeDpContentUtil::h_GetValueAsFloat64(rc_LastValue, f64_Temp, u32_Index);
          // And calculate the scaling on the value
          if (oq_UseScaling == true)
          {
@@ -700,8 +745,7 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
          //Save last timestamp
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsMs.size())
          {
-            this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] =
-               this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][sn_LastIndex].GetTimeStamp();
+            this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] = rc_LastValue.GetTimeStamp();
          }
          //Set timestamp valid
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsValid.size())
@@ -711,15 +755,12 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
             rc_Value = true;
          }
 
-         // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
          s32_Return = C_NO_ERR;
       }
       else
       {
          s32_Return = C_NOACT;
       }
-      this->mc_CriticalSection.Release();
    }
 
    return s32_Return;
@@ -752,18 +793,22 @@ sint32 C_PuiSvDbDataElementHandler::m_GetAllValues(const uint32 ou32_WidgetDataP
         ((ou32_WidgetDataPoolElementIndex < this->mc_UsedScaling.size()) || (oq_UseScaling == false))) && (
           this->GetDataPoolElementIndex(ou32_WidgetDataPoolElementIndex, c_Id) == C_NO_ERR))
    {
+      QList<C_PuiSvDbDataElementContent> c_Values;
+
+      // Only take over the queued values in the critical section so the receiving thread is not blocked
       this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      c_Values.swap(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex]);
+      this->mc_CriticalSection.Release();
+
+      if (c_Values.size() > 0)
       {
          uint32 u32_Counter = 0U;
          QList<C_PuiSvDbDataElementContent>::const_iterator c_ItItem;
 
          // Copy all values and scale the values if necessary
-         orc_Values.resize(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size());
-         orc_Timestamps.resize(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size());
-         for (c_ItItem = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].begin();
-              c_ItItem != this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].end();
-              ++c_ItItem)
+         orc_Values.resize(c_Values.size());
+         orc_Timestamps.resize(c_Values.size());
+         for (c_ItItem = c_Values.begin(); c_ItItem != c_Values.end(); ++c_ItItem)
          {
             float64 f64_Value;
             const uint32 u32_Index = c_Id.GetArrayElementIndexOrZero();
@@ -787,8 +832,6 @@ sint32 C_PuiSvDbDataElementHandler::m_GetAllValues(const uint32 ou32_WidgetDataP
             ++u32_Counter;
          }
 
-         // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
          s32_Return = C_NO_ERR;
 
          //Save last timestamp
@@ -809,7 +852,6 @@ sint32 C_PuiSvDbDataElementHandler::m_GetAllValues(const uint32 ou32_WidgetDataP
       {
          s32_Return = C_NOACT;
       }
-      this->mc_CriticalSection.Release();
    }
    return s32_Return;
 }
@@ -1129,6 +1171,48 @@ void C_PuiSvDbDataElementHandler::m_SetWidgetDataPoolElementCount(const uint32 o
    this->mc_MinimumType.resize(this->mu32_WidgetDataPoolElementCount);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Rebuild routing table for received values
+
+   Groups all registered data series by their data element.
+   Has to be called after each change of mc_MappingDpElementToDataSerie (inside the critical section).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementHandler::m_UpdateValueRouting(void)
+{
+   QMap<C_PuiSvDbNodeDataPoolListElementId, uint32>::const_iterator c_ItItem;
+
+   this->mc_RoutingDpElementToDataSeries.clear();
+   for (c_ItItem = this->mc_MappingDpElementToDataSerie.begin();
+        c_ItItem != this->mc_MappingDpElementToDataSerie.end();
+        ++c_ItItem)
+   {
+      // Invalid elements never receive values
+      if (c_ItItem.key().GetIsValid() == true)
+      {
+         this->mc_RoutingDpElementToDataSeries[mh_GetRoutingKey(c_ItItem.key())].push_back(c_ItItem.value());
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get key for routing table
+
+   Same key for all IDs which refer to the same data element (cf. CheckSameDataElement):
+   array element information is removed.
+
+   \param[in]  orc_Id  Data element ID
+
+   \return
+   Key for mc_RoutingDpElementToDataSeries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_PuiSvDbNodeDataPoolListElementId C_PuiSvDbDataElementHandler::mh_GetRoutingKey(
+   const C_PuiSvDbNodeDataPoolListElementId & orc_Id)
+{
+   return C_PuiSvDbNodeDataPoolListElementId(orc_Id, orc_Id.GetType(), false, 0UL);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get string for scaled value
 
@@ -63,6 +63,8 @@ public:
                                 const C_PuiSvDbDataElementContent & orc_NewValue);
    void AddNewNvmValueIntoQueue(const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId,
                                 const C_PuiSvDbDataElementContent & orc_NewValue);
+   void GetQueueStatistics(stw_types::uint32 & oru32_ReceivedValueCount,
+                           stw_types::uint32 & oru32_MaximumQueueDepth) const;
    QString GetUnscaledValueAsScaledString(const stw_types::float64 f64_Value,
                                           const stw_types::uint32 ou32_IndexElement = 0UL) const;
    QString GetUnscaledValueInRangeAsScaledString(const stw_types::float64 of64_Value,
@@ -104,6 +106,11 @@ private:
    QVector<bool> mc_VecNvmValueReceived;
    // Mapping of datapool element id to index of datapool element list in mc_VecDataValues
    QMap<C_PuiSvDbNodeDataPoolListElementId, stw_types::uint32> mc_MappingDpElementToDataSerie;
+   // Routing of received values: data element (without array index) to all indices in mc_VecDataValues showing it
+   QMap<C_PuiSvDbNodeDataPoolListElementId, std::vector<stw_types::uint32> > mc_RoutingDpElementToDataSeries;
+   stw_types::uint32 mu32_ReceivedValueCount; ///< Number of received values since last clear
+   stw_types::uint32 mu32_MaximumQueueDepth;  ///< Maximum number of queued values of one data element since last
+   ///< clear
    QMap<C_PuiSvDbNodeDataPoolListElementId,
         C_PuiSvDbDataElementScaling> mc_MappingDpElementToScaling; ///< Configured Scaling
    ///< configuration for
@@ -127,6 +134,8 @@ private:
    mutable stw_tgl::C_TGLCriticalSection mc_CriticalSection;
 
    void m_SetWidgetDataPoolElementCount(const stw_types::uint32 ou32_Count);
+   void m_UpdateValueRouting(void);
+   static C_PuiSvDbNodeDataPoolListElementId mh_GetRoutingKey(const C_PuiSvDbNodeDataPoolListElementId & orc_Id);
    static QString mh_GetStringForScaledValue(const stw_types::float64 of64_Value,
                                              const stw_opensyde_core::C_OSCNodeDataPoolContent::E_Type oe_Type);
 
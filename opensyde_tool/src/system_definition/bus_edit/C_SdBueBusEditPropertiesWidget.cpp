@@ -103,6 +103,8 @@ void C_SdBueBusEditPropertiesWidget::InitStaticNames(void) const
    this->mpc_Ui->pc_LabelConfiguration->setText(C_GtGetText::h_GetText("Configuration"));
    this->mpc_Ui->pc_LabelBusID->setText(C_GtGetText::h_GetText("Bus ID"));
    this->mpc_Ui->pc_LabelBitRate->setText(C_GtGetText::h_GetText("Bitrate"));
+   this->mpc_Ui->pc_LabelCanFd->setText(C_GtGetText::h_GetText("CAN FD"));
+   this->mpc_Ui->pc_CheckBoxCanFd->setText(C_GtGetText::h_GetText("Active"));
 
    this->mpc_Ui->pc_TextEditComment->setPlaceholderText(C_GtGetText::h_GetText("Add your comment here ..."));
 
@@ -122,6 +124,10 @@ void C_SdBueBusEditPropertiesWidget::InitStaticNames(void) const
                                                          "\nThe ID is used for addressing in the communication protocol."));
    this->mpc_Ui->pc_LabelBitRate->SetToolTipInformation(C_GtGetText::h_GetText("Bitrate"),
                                                         C_GtGetText::h_GetText("CAN bus bitrate"));
+   this->mpc_Ui->pc_LabelCanFd->SetToolTipInformation(C_GtGetText::h_GetText("CAN FD"),
+                                                      C_GtGetText::h_GetText(
+                                                         "Use CAN FD frames for openSYDE communication on this bus."
+                                                         "\nAll connected nodes must support CAN FD."));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -182,6 +188,8 @@ void C_SdBueBusEditPropertiesWidget::m_LoadFromData(void)
                  &C_SdBueBusEditPropertiesWidget::m_RegisterChange);
       disconnect(this->mpc_Ui->pc_ComboBoxBitRate, &C_OgeCbxText::SigErrorFixed, this,
                  &C_SdBueBusEditPropertiesWidget::m_CanBitrateFixed);
+      disconnect(this->mpc_Ui->pc_CheckBoxCanFd, &C_OgeChxProperties::toggled, this,
+                 &C_SdBueBusEditPropertiesWidget::m_RegisterChange);
 
       //name
       this->mpc_Ui->pc_LineEditBusName->setText(pc_Bus->c_Name.c_str());
@@ -254,6 +262,11 @@ void C_SdBueBusEditPropertiesWidget::m_LoadFromData(void)
 
          this->mpc_Ui->pc_ComboBoxBitRate->setVisible(true);
          this->mpc_Ui->pc_LabelBitRate->setVisible(true);
+
+         //CAN FD
+         this->mpc_Ui->pc_CheckBoxCanFd->setChecked(pc_Bus->q_CanFd);
+         this->mpc_Ui->pc_CheckBoxCanFd->setVisible(true);
+         this->mpc_Ui->pc_LabelCanFd->setVisible(true);
       }
       else
       {
@@ -263,6 +276,10 @@ void C_SdBueBusEditPropertiesWidget::m_LoadFromData(void)
 
          this->mpc_Ui->pc_ComboBoxBitRate->setVisible(false);
          this->mpc_Ui->pc_LabelBitRate->setVisible(false);
+
+         this->mpc_Ui->pc_CheckBoxCanFd->setChecked(false);
+         this->mpc_Ui->pc_CheckBoxCanFd->setVisible(false);
+         this->mpc_Ui->pc_LabelCanFd->setVisible(false);
       }
 
       //Picture / text
@@ -291,6 +308,8 @@ void C_SdBueBusEditPropertiesWidget::m_LoadFromData(void)
               &C_SdBueBusEditPropertiesWidget::m_RegisterChange);
       connect(this->mpc_Ui->pc_ComboBoxBitRate, &C_OgeCbxText::SigErrorFixed, this,
               &C_SdBueBusEditPropertiesWidget::m_CanBitrateFixed);
+      connect(this->mpc_Ui->pc_CheckBoxCanFd, &C_OgeChxProperties::toggled, this,
+              &C_SdBueBusEditPropertiesWidget::m_RegisterChange);
    }
 }
 
@@ -346,11 +365,13 @@ void C_SdBueBusEditPropertiesWidget::SaveToData(void) const
          c_NewBus.u64_BitRate =
             static_cast<uint64>(this->m_GetBitrateFromComboBoxString(this->mpc_Ui->pc_ComboBoxBitRate->currentText())) *
             1000ULL;
+         c_NewBus.q_CanFd = this->mpc_Ui->pc_CheckBoxCanFd->isChecked();
       }
       else
       {
          // As dummy
          c_NewBus.u64_BitRate = 1000000ULL;
+         c_NewBus.q_CanFd = false;
       }
 
       //save new bus
@@ -532,6 +532,11 @@ void C_SdNdeNodePropertiesWidget::m_LoadFromData(void)
             {
                this->mpc_Ui->pc_LabelFlashAccessValue->setText(C_GtGetText::h_GetText("File based"));
             }
+            else if (pc_DevDef->q_FlashloaderOpenSydeDeltaFlashing == true)
+            {
+               this->mpc_Ui->pc_LabelFlashAccessValue->setText(C_GtGetText::h_GetText(
+                                                                  "Address based (only modified sectors are flashed)"));
+            }
             else
             {
                this->mpc_Ui->pc_LabelFlashAccessValue->setText(C_GtGetText::h_GetText("Address based"));
@@ -17,6 +17,7 @@
 #include "stwerrors.h"
 
 #include "C_SyvComDataDealer.h"
+#include "TGLTime.h"
 #include "C_OSCLoggingHandler.h"
 #include "C_PuiSvDbDataElementContent.h"
 
@@ -45,7 +46,9 @@ using namespace stw_opensyde_core;
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComDataDealer::C_SyvComDataDealer(void) :
-   C_OSCDataDealerNvmSafe()
+   C_OSCDataDealerNvmSafe(),
+   mc_DistributedValueCount(0U),
+   mc_StatisticsStartTimeMs(stw_tgl::TGL_GetTickCount())
 {
 }
 
@@ -61,7 +64,9 @@ C_SyvComDataDealer::C_SyvComDataDealer(void) :
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComDataDealer::C_SyvComDataDealer(C_OSCNode * const opc_Node, const uint32 ou32_NodeIndex,
                                        C_OSCDiagProtocolBase * const opc_DiagProtocol) :
-   C_OSCDataDealerNvmSafe(opc_Node, ou32_NodeIndex, opc_DiagProtocol)
+   C_OSCDataDealerNvmSafe(opc_Node, ou32_NodeIndex, opc_DiagProtocol),
+   mc_DistributedValueCount(0U),
+   mc_StatisticsStartTimeMs(stw_tgl::TGL_GetTickCount())
 {
 }
 
@@ -271,16 +276,16 @@ void C_SyvComDataDealer::m_OnReadDataPoolEventReceived(const uint8 ou8_DataPoolI
          const C_OSCNodeDataPoolContent * const pc_ElementContent =
             &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_Value;
          // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-         C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+         const C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+         const C_PuiSvDbNodeDataPoolListElementId c_WidgetElementId(
+            c_ElementId, C_PuiSvDbNodeDataPoolListElementId::eDATAPOOL_ELEMENT, false, 0UL);
 
          for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
          {
             // Update the value
-            (*c_ItWidget)->InsertNewValueIntoQueue(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
-                                                                                      C_PuiSvDbNodeDataPoolListElementId
-                                                                                      ::eDATAPOOL_ELEMENT, false, 0UL),
-                                                   c_DbContent);
+            (*c_ItWidget)->InsertNewValueIntoQueue(c_WidgetElementId, c_DbContent);
          }
+         this->m_UpdateStatistics(static_cast<uint32>(rc_ListWidgets.size()));
       }
       else
       {
@@ -383,3 +388,52 @@ void C_SyvComDataDealer::m_OnReadDataPoolNvmEventReceived(const uint8 ou8_DataPo
       }
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update and report statistics of the value distribution to the widgets
+
+   Logs the distributed values per second and the maximum queue depth of the registered widgets
+   once per interval. Can be called from several threads.
+
+   \param[in]  ou32_DistributedValueCount  Number of values passed to widgets since last call
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDataDealer::m_UpdateStatistics(const uint32 ou32_DistributedValueCount)
+{
+   const uint32 u32_Now = stw_tgl::TGL_GetTickCount();
+   uint32 u32_Start = this->mc_StatisticsStartTimeMs.load();
+
+   this->mc_DistributedValueCount += ou32_DistributedValueCount;
+
+   //only one thread may finish the interval
+   if (((u32_Now - u32_Start) >= mhu32_STATISTICS_INTERVAL_MS) &&
+       (this->mc_StatisticsStartTimeMs.compare_exchange_strong(u32_Start, u32_Now) == true))
+   {
+      const uint32 u32_ValueCount = this->mc_DistributedValueCount.exchange(0U);
+      const uint32 u32_ValuesPerSecond = static_cast<uint32>((static_cast<uint64>(u32_ValueCount) * 1000U) /
+                                                             (u32_Now - u32_Start));
+      uint32 u32_MaximumQueueDepth = 0U;
+      QMap<C_OSCNodeDataPoolListElementId, QList<C_PuiSvDbDataElementHandler *> >::const_iterator c_ItElement;
+      stw_scl::C_SCLString c_Info;
+
+      for (c_ItElement = this->mc_AllWidgets.begin(); c_ItElement != this->mc_AllWidgets.end(); ++c_ItElement)
+      {
+         QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
+         for (c_ItWidget = c_ItElement.value().begin(); c_ItWidget != c_ItElement.value().end(); ++c_ItWidget)
+         {
+            uint32 u32_ReceivedValueCount;
+            uint32 u32_QueueDepth;
+            (*c_ItWidget)->GetQueueStatistics(u32_ReceivedValueCount, u32_QueueDepth);
+            if (u32_QueueDepth > u32_MaximumQueueDepth)
+            {
+               u32_MaximumQueueDepth = u32_QueueDepth;
+            }
+         }
+      }
+
+      c_Info.PrintFormatted("C_SyvComDataDealer: node %u: %u values/s distributed to widgets " \
+                            "(max. queue depth: %u)", this->mu32_NodeIndex, u32_ValuesPerSecond,
+                            u32_MaximumQueueDepth);
+      osc_write_log_info("Asynchronous communication", c_Info);
+   }
+}
@@ -10,6 +10,7 @@
 #define C_SYVCOMDATADEALER_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <atomic>
 #include <QMap>
 #include <QList>
 
@@ -66,6 +67,12 @@ protected:
 
 private:
    QMap<stw_opensyde_core::C_OSCNodeDataPoolListElementId, QList<C_PuiSvDbDataElementHandler *> > mc_AllWidgets;
+
+   static const stw_types::uint32 mhu32_STATISTICS_INTERVAL_MS = 10000U;
+   std::atomic<stw_types::uint32> mc_DistributedValueCount; ///< values passed to widgets in current interval
+   std::atomic<stw_types::uint32> mc_StatisticsStartTimeMs; ///< start of current statistics interval
+
+   void m_UpdateStatistics(const stw_types::uint32 ou32_DistributedValueCount);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -684,6 +684,36 @@ sint32 C_SyvComDriverDiag::PollDataPoolRead(const uint32 ou32_NodeIndex, const u
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start thread for polled reading of multiple elements of one node from data pool
+
+   All elements are read in one polled operation, so only one finished notification is sent for all of them.
+
+   \param[in]  ou32_NodeIndex    node index to read from
+   \param[in]  orc_ElementIds    elements to read; all must belong to node ou32_NodeIndex
+
+   \return
+   C_RANGE   node index out of range
+   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_SyvComDriverDiag::PollDataPoolReadMultiple(const uint32 ou32_NodeIndex,
+                                                    const std::vector<C_OSCNodeDataPoolListElementId> & orc_ElementIds)
+{
+   sint32 s32_Return;
+   const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+
+   if (u32_ActiveIndex >= mc_DataDealers.size())
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      s32_Return = mc_PollingThread.StartDataPoolReadMultiple((*mc_DataDealers[u32_ActiveIndex]), orc_ElementIds);
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Start thread for polled writing to data pool
 
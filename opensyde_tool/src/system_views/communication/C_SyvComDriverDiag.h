@@ -59,6 +59,9 @@ public:
    stw_types::sint32 PollDataPoolRead(const stw_types::uint32 ou32_NodeIndex, const stw_types::uint8 ou8_DataPoolIndex,
                                       const stw_types::uint16 ou16_ListIndex,
                                       const stw_types::uint16 ou16_ElementIndex);
+   stw_types::sint32 PollDataPoolReadMultiple(const stw_types::uint32 ou32_NodeIndex,
+                                              const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> &
+                                              orc_ElementIds);
    stw_types::sint32 PollDataPoolWrite(const stw_types::uint32 ou32_NodeIndex, const stw_types::uint8 ou8_DataPoolIndex,
                                        const stw_types::uint16 ou16_ListIndex,
                                        const stw_types::uint16 ou16_ElementIndex);
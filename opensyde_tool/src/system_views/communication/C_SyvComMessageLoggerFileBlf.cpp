@@ -112,7 +112,46 @@ sint32 C_SyvComMessageLoggerFileBlf::OpenFile(void)
 //----------------------------------------------------------------------------------------------------------------------
 void C_SyvComMessageLoggerFileBlf::AddMessageToFile(const C_OSCComMessageLoggerData & orc_MessageData)
 {
-   if (this->mc_File.is_open() == true)
+   if ((this->mc_File.is_open() == true) && (orc_MessageData.c_CanMsg.u8_FDF != 0U))
+   {
+      Vector::BLF::CanFdMessage64 c_CanFdObj;
+      const uint8 u8_NumBytes = stw_can::STWCAN_DLCToNumBytes(orc_MessageData.c_CanMsg.u8_DLC, 1U);
+
+      c_CanFdObj.channel = 1U;
+      c_CanFdObj.dlc = orc_MessageData.c_CanMsg.u8_DLC;
+      c_CanFdObj.validDataBytes = u8_NumBytes;
+      c_CanFdObj.dir = (orc_MessageData.q_IsTx == true) ? 1U : 0U;
+
+      // EDL, BRS and ESI information
+      c_CanFdObj.flags = 0x1000U;
+      if (orc_MessageData.c_CanMsg.u8_BRS > 0U)
+      {
+         c_CanFdObj.flags |= 0x2000U;
+      }
+      if (orc_MessageData.c_CanMsg.u8_ESI > 0U)
+      {
+         c_CanFdObj.flags |= 0x4000U;
+      }
+
+      // CAN Id and extended flag
+      c_CanFdObj.id = orc_MessageData.c_CanMsg.u32_ID;
+      if (orc_MessageData.c_CanMsg.u8_XTD > 0U)
+      {
+         // Vector magic for extended identifier
+         c_CanFdObj.id |= 0x80000000U;
+      }
+
+      // CAN data
+      std::memcpy(&c_CanFdObj.data[0], orc_MessageData.c_CanMsg.au8_Data, u8_NumBytes);
+
+      // Timestamp in ns
+      c_CanFdObj.objectFlags = ObjectHeader::TimeOneNans;
+      // us into ns
+      c_CanFdObj.objectTimeStamp = orc_MessageData.u64_TimeStampAbsoluteStart * 1000U;
+
+      this->mc_File.write(&c_CanFdObj);
+   }
+   else if (this->mc_File.is_open() == true)
    {
       Vector::BLF::CanMessage c_CanObj;
 
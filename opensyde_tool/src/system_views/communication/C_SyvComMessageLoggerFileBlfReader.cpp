@@ -0,0 +1,282 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to read CAN messages from a BLF log file (implementation)
+
+   Reads the CAN and CAN FD message objects of a BLF file (as written by C_SyvComMessageLoggerFileBlf).
+   All other objects are skipped.
+   Intended as replay source for C_CAN_Replay.
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cstring>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+
+#include "C_SyvComMessageLoggerFileBlfReader.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_can;
+using namespace stw_opensyde_gui_logic;
+using namespace Vector;
+using namespace BLF;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComMessageLoggerFileBlfReader::C_SyvComMessageLoggerFileBlfReader(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComMessageLoggerFileBlfReader::~C_SyvComMessageLoggerFileBlfReader(void)
+{
+   this->Close();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Open BLF file
+
+   An already opened file will be closed.
+
+   \param[in]     orc_FilePath     Path of BLF file
+
+   \return
+   C_NO_ERR    File opened
+   C_RD_WR     File could not be opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_SyvComMessageLoggerFileBlfReader::Open(const C_SCLString & orc_FilePath)
+{
+   this->Close();
+   this->mc_FilePath = orc_FilePath;
+   return this->Restart();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Close file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComMessageLoggerFileBlfReader::Close(void)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      this->mc_File.close();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if a file is opened
+
+   \return
+   true     file opened
+   false    no file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvComMessageLoggerFileBlfReader::IsOpen(void) const
+{
+   return this->mc_File.is_open();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read next CAN message from file
+
+   Objects which are no CAN messages are skipped.
+
+   \param[out]    orc_Message      CAN message with time stamp of file (in us)
+   \param[out]    orq_IsTx         true: message was sent by the logging application
+
+   \return
+   C_NO_ERR    message read
+   C_NOACT     no more messages
+   C_CONFIG    no file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_SyvComMessageLoggerFileBlfReader::ReadNextMessage(T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx)
+{
+   sint32 s32_Return = C_CONFIG;
+
+   if (this->mc_File.is_open() == true)
+   {
+      bool q_Continue = true;
+      s32_Return = C_NOACT;
+      while ((s32_Return == C_NOACT) && (q_Continue == true) && (this->mc_File.eof() == false))
+      {
+         const ObjectHeaderBase * const pc_Object = this->mc_File.read();
+         if (pc_Object != NULL)
+         {
+            if (mh_ConvertObject(*pc_Object, orc_Message, orq_IsTx) == true)
+            {
+               s32_Return = C_NO_ERR;
+            }
+            delete pc_Object;
+         }
+         else
+         {
+            //unreadable rest of file
+            q_Continue = false;
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Restart reading at the beginning of the file
+
+   The BLF library can not seek, so the file is reopened.
+
+   \return
+   C_NO_ERR    restarted
+   C_RD_WR     File could not be opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_SyvComMessageLoggerFileBlfReader::Restart(void)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   this->Close();
+   this->mc_File.open(this->mc_FilePath.c_str(), File::OpenMode::Read);
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert BLF object to CAN message
+
+   \param[in]     orc_Object       BLF object
+   \param[out]    orc_Message      CAN message
+   \param[out]    orq_IsTx         true: message was sent
+
+   \return
+   true     object is a CAN message
+   false    other object
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvComMessageLoggerFileBlfReader::mh_ConvertObject(const ObjectHeaderBase & orc_Object,
+                                                          T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx)
+{
+   bool q_Return = true;
+
+   orc_Message.u8_FDF = 0U;
+   orc_Message.u8_BRS = 0U;
+   orc_Message.u8_ESI = 0U;
+   (void)std::memset(&orc_Message.au8_Data[0], 0, sizeof(orc_Message.au8_Data));
+
+   switch (orc_Object.objectType)
+   {
+   case ObjectType::CAN_MESSAGE:
+      {
+         const CanMessage & rc_Can = static_cast<const CanMessage &>(orc_Object);
+         orc_Message.u64_TimeStamp = mh_GetTimeStamp(rc_Can);
+         mh_ConvertId(rc_Can.id, orc_Message);
+         orq_IsTx = ((rc_Can.flags & 0x01U) != 0U);
+         orc_Message.u8_RTR = ((rc_Can.flags & 0x80U) != 0U) ? 1U : 0U;
+         orc_Message.u8_DLC = rc_Can.dlc & 0x0FU;
+         (void)std::memcpy(&orc_Message.au8_Data[0], &rc_Can.data[0], rc_Can.data.size());
+      }
+      break;
+   case ObjectType::CAN_MESSAGE2:
+      {
+         const CanMessage2 & rc_Can = static_cast<const CanMessage2 &>(orc_Object);
+         orc_Message.u64_TimeStamp = mh_GetTimeStamp(rc_Can);
+         mh_ConvertId(rc_Can.id, orc_Message);
+         orq_IsTx = ((rc_Can.flags & 0x01U) != 0U);
+         orc_Message.u8_RTR = ((rc_Can.flags & 0x80U) != 0U) ? 1U : 0U;
+         orc_Message.u8_DLC = rc_Can.dlc & 0x0FU;
+         (void)std::memcpy(&orc_Message.au8_Data[0], &rc_Can.data[0], rc_Can.data.size());
+      }
+      break;
+   case ObjectType::CAN_FD_MESSAGE_64:
+      {
+         const CanFdMessage64 & rc_CanFd = static_cast<const CanFdMessage64 &>(orc_Object);
+         const uint8 u8_NumBytes = (rc_CanFd.validDataBytes > STWCAN_MAX_DATA_LENGTH_FD) ?
+                                   STWCAN_MAX_DATA_LENGTH_FD : rc_CanFd.validDataBytes;
+         orc_Message.u64_TimeStamp = mh_GetTimeStamp(rc_CanFd);
+         mh_ConvertId(rc_CanFd.id, orc_Message);
+         orq_IsTx = (rc_CanFd.dir != 0U);
+         orc_Message.u8_FDF = ((rc_CanFd.flags & 0x1000U) != 0U) ? 1U : 0U;
+         orc_Message.u8_BRS = ((rc_CanFd.flags & 0x2000U) != 0U) ? 1U : 0U;
+         orc_Message.u8_ESI = ((rc_CanFd.flags & 0x4000U) != 0U) ? 1U : 0U;
+         orc_Message.u8_RTR = ((rc_CanFd.flags & 0x0010U) != 0U) ? 1U : 0U;
+         orc_Message.u8_DLC = rc_CanFd.dlc & 0x0FU;
+         (void)std::memcpy(&orc_Message.au8_Data[0], &rc_CanFd.data[0], u8_NumBytes);
+      }
+      break;
+   default:
+      q_Return = false;
+      break;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get time stamp of BLF object in us
+
+   \param[in]     orc_Header       BLF object header
+
+   \return
+   time stamp in us
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64 C_SyvComMessageLoggerFileBlfReader::mh_GetTimeStamp(const ObjectHeader & orc_Header)
+{
+   uint64 u64_Return;
+
+   if (orc_Header.objectFlags == ObjectHeader::TimeOneNans)
+   {
+      u64_Return = orc_Header.objectTimeStamp / 1000U;
+   }
+   else
+   {
+      //10us resolution
+      u64_Return = orc_Header.objectTimeStamp * 10U;
+   }
+
+   return u64_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert BLF identifier to CAN identifier and extended flag
+
+   \param[in]     ou32_BlfId       BLF identifier (bit 31 set for extended identifiers)
+   \param[out]    orc_Message      CAN message (ID and XTD flag set)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComMessageLoggerFileBlfReader::mh_ConvertId(const uint32 ou32_BlfId, T_STWCAN_Msg_RX & orc_Message)
+{
+   // Vector magic for extended identifier
+   orc_Message.u8_XTD = ((ou32_BlfId & 0x80000000U) != 0U) ? 1U : 0U;
+   orc_Message.u32_ID = ou32_BlfId & 0x1FFFFFFFU;
+}
@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class to read CAN messages from a BLF log file (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2020 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVCOMMESSAGELOGGERFILEBLFREADER_H
+#define C_SYVCOMMESSAGELOGGERFILEBLFREADER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+
+#include "stwtypes.h"
+#include "CSCLString.h"
+#include "CCANReplay.h"
+
+#include "BLF.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvComMessageLoggerFileBlfReader :
+   public stw_can::C_CAN_ReplaySource
+{
+public:
+   C_SyvComMessageLoggerFileBlfReader(void);
+   virtual ~C_SyvComMessageLoggerFileBlfReader(void);
+
+   stw_types::sint32 Open(const stw_scl::C_SCLString & orc_FilePath);
+   void Close(void);
+   bool IsOpen(void) const;
+
+   virtual stw_types::sint32 ReadNextMessage(stw_can::T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx) override;
+   virtual stw_types::sint32 Restart(void) override;
+
+private:
+   //Avoid call
+   C_SyvComMessageLoggerFileBlfReader(const C_SyvComMessageLoggerFileBlfReader &);
+   C_SyvComMessageLoggerFileBlfReader & operator =(const C_SyvComMessageLoggerFileBlfReader &);
+
+   static bool mh_ConvertObject(const Vector::BLF::ObjectHeaderBase & orc_Object,
+                                stw_can::T_STWCAN_Msg_RX & orc_Message, bool & orq_IsTx);
+   static stw_types::uint64 mh_GetTimeStamp(const Vector::BLF::ObjectHeader & orc_Header);
+   static void mh_ConvertId(const stw_types::uint32 ou32_BlfId, stw_can::T_STWCAN_Msg_RX & orc_Message);
+
+   stw_scl::C_SCLString mc_FilePath;
+   Vector::BLF::File mc_File;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
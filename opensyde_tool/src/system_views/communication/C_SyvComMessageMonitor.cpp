@@ -55,6 +55,9 @@ C_SyvComMessageMonitor::C_SyvComMessageMonitor(void) :
    mu32_TxErrors(0U)
 {
    mpc_LoadingThread = new C_SyvComDriverThread(&C_SyvComMessageMonitor::mh_ThreadFunc, this);
+
+   // Resize the vector for all potential CAN standard ids
+   this->mc_DbcIndexStandardId.resize(0x800U);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -81,6 +84,15 @@ C_SyvComMessageMonitor::~C_SyvComMessageMonitor(void)
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComMessageMonitor::C_DbcMessageIndexEntry::C_DbcMessageIndexEntry(void) :
+   pc_Message(NULL)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Function to react on the start of the communication
 
@@ -304,6 +316,7 @@ sint32 C_SyvComMessageMonitor::RemoveDatabase(const C_SCLString & orc_Path)
    {
       // Remove the entry
       this->mc_DbcFiles.erase(c_ItDbc);
+      this->m_UpdateDbcIndex();
 
       s32_Return = C_NO_ERR;
    }
@@ -336,6 +349,10 @@ sint32 C_SyvComMessageMonitor::ActivateDatabase(const C_SCLString & orc_Path, co
    //Logger handling
    this->mc_CriticalSectionConfig.Acquire();
    s32_Return = C_OSCComMessageLogger::ActivateDatabase(orc_Path, oq_Active);
+   if ((s32_Return == C_NO_ERR) && (this->mc_DbcFiles.find(orc_Path) != this->mc_DbcFiles.end()))
+   {
+      this->m_UpdateDbcIndex();
+   }
    this->mc_CriticalSectionConfig.Release();
 
    return s32_Return;
@@ -365,6 +382,27 @@ sint32 C_SyvComMessageMonitor::AddLogFileAsc(const C_SCLString & orc_FilePath, c
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Adds a log file in the compact openSYDE binary trace format
+
+   \param[in]  orc_FilePath   Path with file name. File extension must be .osyt
+
+   \return
+   C_NO_ERR    File added successfully
+   C_RD_WR     Error on creating file, folders or deleting old file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_SyvComMessageMonitor::AddLogFileBin(const C_SCLString & orc_FilePath)
+{
+   sint32 s32_Return;
+
+   this->mc_CriticalSectionConfig.Acquire();
+   s32_Return = C_OSCComMessageLogger::AddLogFileBin(orc_FilePath);
+   this->mc_CriticalSectionConfig.Release();
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Adds an BLF log file
 
@@ -382,10 +420,10 @@ sint32 C_SyvComMessageMonitor::AddLogFileBlf(const C_SCLString & orc_FilePath)
 
    s32_Return = pc_File->OpenFile();
 
-   this->mc_CriticalSectionConfig.Acquire();
+   this->mc_CriticalSectionFiles.Acquire();
    this->mc_LoggingFiles.insert(std::pair<C_SCLString,
                                           C_OSCComMessageLoggerFileBase * const>(orc_FilePath, pc_File));
-   this->mc_CriticalSectionConfig.Release();
+   this->mc_CriticalSectionFiles.Release();
 
    //lint -e{429}  no memory leak of pc_File because of handling of instance in map mc_LoggingFiles
    return s32_Return;
@@ -852,12 +890,17 @@ bool C_SyvComMessageMonitor::m_InterpretSysDef(C_OSCComMessageLoggerData & orc_M
 bool C_SyvComMessageMonitor::m_CheckInterpretation(stw_opensyde_core::C_OSCComMessageLoggerData & orc_MessageData)
 {
    bool q_Return = false;
-   const C_CieConverter::C_CIECanMessage * pc_DbcMessage = this->m_CheckDbcFile(orc_MessageData.c_CanMsg);
+   const C_DbcMessageIndexEntry * pc_DbcEntry;
+
+   // The index entry must not be changed between check and interpretation
+   this->mc_CriticalSectionConfig.Acquire();
+   pc_DbcEntry = this->m_CheckDbcFile(orc_MessageData.c_CanMsg);
 
-   if (pc_DbcMessage != NULL)
+   if (pc_DbcEntry != NULL)
    {
-      q_Return = this->m_InterpretDbcFile(pc_DbcMessage, orc_MessageData);
+      q_Return = this->m_InterpretDbcFile(pc_DbcEntry, orc_MessageData);
    }
+   this->mc_CriticalSectionConfig.Release();
    return q_Return;
 }
 
@@ -928,6 +971,8 @@ sint32 C_SyvComMessageMonitor::m_AddDbcFile(const C_SCLString & orc_PathDbc)
          // Register the database in the activation flag map
          this->mc_DatabaseActiveFlags.insert(std::pair<C_SCLString, bool>(orc_PathDbc, true));
 
+         this->m_UpdateDbcIndex();
+
          this->mc_CriticalSectionConfig.Release();
       }
    }
@@ -936,101 +981,161 @@ sint32 C_SyvComMessageMonitor::m_AddDbcFile(const C_SCLString & orc_PathDbc)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Checks if a matching CAN message is defined in at least one registered DBC file
+/*! \brief   Rebuilds the CAN message index of all active DBC files
 
-   This function is thread safe.
-
-   \param[in]  orc_Msg  Current CAN message
-
-   \return
-   Pointer     Matching CAN message found and pointer to message is returned
-   NULL        No matching CAN message found
+   Has to be called with locked mc_CriticalSectionConfig after each change of the registered DBC files or their
+   activation.
+   If a CAN ID is defined more than once in a DBC file, the first definition is used (Tx messages of nodes, Rx
+   messages of nodes, unmapped messages). If a CAN ID is defined in more than one DBC file, the definition of the last
+   DBC file (in order of their path) is used.
 */
 //----------------------------------------------------------------------------------------------------------------------
-const C_CieConverter::C_CIECanMessage * C_SyvComMessageMonitor::m_CheckDbcFile(const T_STWCAN_Msg_RX & orc_Msg)
+void C_SyvComMessageMonitor::m_UpdateDbcIndex(void)
 {
-   const C_CieConverter::C_CIECanMessage * pc_DbcMessage = NULL;
+   std::map<stw_scl::C_SCLString, C_CieConverter::C_CIECommDefinition>::const_reverse_iterator c_ItDbc;
 
-   std::map<stw_scl::C_SCLString, C_CieConverter::C_CIECommDefinition>::const_iterator c_ItDbc;
+   this->mc_DbcIndexStandardId.assign(0x800U, C_DbcMessageIndexEntry());
+   this->mc_DbcIndexExtendedId.clear();
 
-   this->mc_CriticalSectionConfig.Acquire();
-
-   // Search for CAN message in all DBC files
-   for (c_ItDbc = this->mc_DbcFiles.begin(); c_ItDbc != this->mc_DbcFiles.end(); ++c_ItDbc)
+   // Reverse order: the first registered definition of a CAN ID is kept, so the last DBC file wins
+   for (c_ItDbc = this->mc_DbcFiles.rbegin(); c_ItDbc != this->mc_DbcFiles.rend(); ++c_ItDbc)
    {
+      const std::map<stw_scl::C_SCLString, bool>::const_iterator c_ItFlag =
+         this->mc_DatabaseActiveFlags.find(c_ItDbc->first);
+
       // Check if the database is active
-      if (this->mc_DatabaseActiveFlags[c_ItDbc->first] == true)
+      if ((c_ItFlag != this->mc_DatabaseActiveFlags.end()) && (c_ItFlag->second == true))
       {
+         std::vector<const C_CieConverter::C_CIECanMessage *> c_Messages;
          uint32 u32_NodeCounter;
+         uint32 u32_MsgCounter;
 
-         //Nodes
+         // Collect all messages of the file in search order
          for (u32_NodeCounter = 0U; u32_NodeCounter < c_ItDbc->second.c_Nodes.size(); ++u32_NodeCounter)
          {
             const C_CieConverter::C_CIENode & rc_Node = c_ItDbc->second.c_Nodes[u32_NodeCounter];
-            uint32 u32_MsgCounter;
 
             for (u32_MsgCounter = 0U; u32_MsgCounter < rc_Node.c_TxMessages.size(); ++u32_MsgCounter)
             {
-               const C_CieConverter::C_CIECanMessage & rc_Msg = rc_Node.c_TxMessages[u32_MsgCounter].c_CanMessage;
-
-               // No check of dlc here, it will be checked for each signal
-               if ((orc_Msg.u32_ID == rc_Msg.u32_CanId) &&
-                   ((orc_Msg.u8_XTD == 1U) == rc_Msg.q_IsExtended))
-               {
-                  // Matching CAN message found
-                  pc_DbcMessage = &rc_Msg;
-                  break;
-               }
+               c_Messages.push_back(&rc_Node.c_TxMessages[u32_MsgCounter].c_CanMessage);
+            }
+            for (u32_MsgCounter = 0U; u32_MsgCounter < rc_Node.c_RxMessages.size(); ++u32_MsgCounter)
+            {
+               c_Messages.push_back(&rc_Node.c_RxMessages[u32_MsgCounter].c_CanMessage);
             }
+         }
+         for (u32_MsgCounter = 0U; u32_MsgCounter < c_ItDbc->second.c_UnmappedMessages.size(); ++u32_MsgCounter)
+         {
+            c_Messages.push_back(&c_ItDbc->second.c_UnmappedMessages[u32_MsgCounter].c_CanMessage);
+         }
 
-            if (pc_DbcMessage == NULL)
+         for (u32_MsgCounter = 0U; u32_MsgCounter < c_Messages.size(); ++u32_MsgCounter)
+         {
+            const C_CieConverter::C_CIECanMessage * const pc_Msg = c_Messages[u32_MsgCounter];
+            C_DbcMessageIndexEntry * pc_Slot = NULL;
+
+            if (pc_Msg->q_IsExtended == false)
             {
-               // Not found yet, search in Rx messages
-               for (u32_MsgCounter = 0U; u32_MsgCounter < rc_Node.c_RxMessages.size(); ++u32_MsgCounter)
+               if (pc_Msg->u32_CanId < this->mc_DbcIndexStandardId.size())
                {
-                  const C_CieConverter::C_CIECanMessage & rc_Msg = rc_Node.c_RxMessages[u32_MsgCounter].c_CanMessage;
-
-                  // No check of dlc here, it will be checked for each signal
-                  if ((orc_Msg.u32_ID == rc_Msg.u32_CanId) &&
-                      ((orc_Msg.u8_XTD == 1U) == rc_Msg.q_IsExtended))
-                  {
-                     // Matching CAN message found
-                     pc_DbcMessage = &rc_Msg;
-                     break;
-                  }
+                  pc_Slot = &this->mc_DbcIndexStandardId[pc_Msg->u32_CanId];
                }
             }
-
-            if (pc_DbcMessage != NULL)
+            else
             {
-               break;
+               // Inserts an empty entry if not registered yet
+               pc_Slot = &this->mc_DbcIndexExtendedId[pc_Msg->u32_CanId];
             }
-         }
 
-         //Unmapped messages
-         if (pc_DbcMessage == NULL)
-         {
-            for (uint32 u32_ItMessage = 0U; u32_ItMessage < c_ItDbc->second.c_UnmappedMessages.size(); ++u32_ItMessage)
+            // Does not replace an already registered definition
+            if ((pc_Slot != NULL) && (pc_Slot->pc_Message == NULL))
             {
-               const C_CieConverter::C_CIECanMessage & rc_Msg =
-                  c_ItDbc->second.c_UnmappedMessages[u32_ItMessage].c_CanMessage;
-
-               // No check of dlc here, it will be checked for each signal
-               if ((orc_Msg.u32_ID == rc_Msg.u32_CanId) &&
-                   ((orc_Msg.u8_XTD == 1U) == rc_Msg.q_IsExtended))
-               {
-                  // Matching CAN message found
-                  pc_DbcMessage = &rc_Msg;
-                  break;
-               }
+               pc_Slot->pc_Message = pc_Msg;
+               mh_CompileDbcSignalDecoders(*pc_Slot);
             }
          }
       }
    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compiles the decoders for all signals of a DBC index entry
+
+   The type of each signal is taken from the minimum value of its element.
+
+   \param[in,out]  orc_Entry  Index entry with set message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComMessageMonitor::mh_CompileDbcSignalDecoders(C_DbcMessageIndexEntry & orc_Entry)
+{
+   orc_Entry.c_SignalDecoders.clear();
+
+   if (orc_Entry.pc_Message != NULL)
+   {
+      uint32 u32_SignalCounter;
+
+      orc_Entry.c_SignalDecoders.resize(orc_Entry.pc_Message->c_Signals.size());
+      for (u32_SignalCounter = 0U; u32_SignalCounter < orc_Entry.pc_Message->c_Signals.size(); ++u32_SignalCounter)
+      {
+         const C_CieConverter::C_CIECanSignal & rc_DbcSignal = orc_Entry.pc_Message->c_Signals[u32_SignalCounter];
+         C_OSCCanSignal c_OscSignal;
+
+         c_OscSignal.e_ComByteOrder = rc_DbcSignal.e_ComByteOrder;
+         c_OscSignal.u16_ComBitLength = rc_DbcSignal.u16_ComBitLength;
+         c_OscSignal.u16_ComBitStart = rc_DbcSignal.u16_ComBitStart;
+
+         orc_Entry.c_SignalDecoders[u32_SignalCounter].Compile(c_OscSignal, rc_DbcSignal.c_Element.c_MinValue.GetType(),
+                                                                rc_DbcSignal.c_Element.f64_Factor,
+                                                                rc_DbcSignal.c_Element.f64_Offset);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Checks if a matching CAN message is defined in at least one registered DBC file
+
+   This function is thread safe.
+   The message is looked up in the index of all active DBC files (see m_UpdateDbcIndex).
+
+   \param[in]  orc_Msg  Current CAN message
+
+   \return
+   Pointer     Matching CAN message found and pointer to its index entry is returned
+   NULL        No matching CAN message found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_SyvComMessageMonitor::C_DbcMessageIndexEntry * C_SyvComMessageMonitor::m_CheckDbcFile(
+   const T_STWCAN_Msg_RX & orc_Msg)
+{
+   const C_DbcMessageIndexEntry * pc_DbcEntry = NULL;
+
+   this->mc_CriticalSectionConfig.Acquire();
+
+   if (orc_Msg.u8_XTD == 0U)
+   {
+      if (orc_Msg.u32_ID < this->mc_DbcIndexStandardId.size())
+      {
+         pc_DbcEntry = &this->mc_DbcIndexStandardId[orc_Msg.u32_ID];
+      }
+   }
+   else
+   {
+      const std::map<uint32, C_DbcMessageIndexEntry>::const_iterator c_ItMsg =
+         this->mc_DbcIndexExtendedId.find(orc_Msg.u32_ID);
+      if (c_ItMsg != this->mc_DbcIndexExtendedId.end())
+      {
+         pc_DbcEntry = &c_ItMsg->second;
+      }
+   }
+
+   if ((pc_DbcEntry != NULL) && (pc_DbcEntry->pc_Message == NULL))
+   {
+      pc_DbcEntry = NULL;
+   }
 
    this->mc_CriticalSectionConfig.Release();
 
-   return pc_DbcMessage;
+   return pc_DbcEntry;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1038,7 +1143,7 @@ const C_CieConverter::C_CIECanMessage * C_SyvComMessageMonitor::m_CheckDbcFile(c
 
    This function is thread safe.
 
-   \param[in]      opc_DbcMessage   Detected DBC message for current CAN message
+   \param[in]      opc_DbcEntry     Index entry of detected DBC message for current CAN message
    \param[in,out]  orc_MessageData  Message data target for the interpretation
 
    \return
@@ -1046,30 +1151,32 @@ const C_CieConverter::C_CIECanMessage * C_SyvComMessageMonitor::m_CheckDbcFile(c
    false    No matching CAN message exists
 */
 //----------------------------------------------------------------------------------------------------------------------
-bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CIECanMessage * const opc_DbcMessage,
+bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_DbcMessageIndexEntry * const opc_DbcEntry,
                                                 C_OSCComMessageLoggerData & orc_MessageData) const
 {
    bool q_Return = false;
 
    this->mc_CriticalSectionConfig.Acquire();
 
-   if (opc_DbcMessage != NULL)
+   if ((opc_DbcEntry != NULL) && (opc_DbcEntry->pc_Message != NULL) &&
+       (opc_DbcEntry->c_SignalDecoders.size() == opc_DbcEntry->pc_Message->c_Signals.size()))
    {
+      const C_CieConverter::C_CIECanMessage * const pc_DbcMessage = opc_DbcEntry->pc_Message;
       uint32 u32_Counter;
       bool q_MultiplexerFound = false;
       uint32 u32_MultiplexerIndex = 0U;
       uint16 u16_MultiplexerValue = 0U;
 
-      orc_MessageData.c_Name = opc_DbcMessage->c_Name.c_str();
+      orc_MessageData.c_Name = pc_DbcMessage->c_Name.c_str();
 
       // Check if a multiplexer signal exists
-      for (u32_Counter = 0U; u32_Counter < opc_DbcMessage->c_Signals.size(); ++u32_Counter)
+      for (u32_Counter = 0U; u32_Counter < pc_DbcMessage->c_Signals.size(); ++u32_Counter)
       {
-         const C_CieConverter::C_CIECanSignal & rc_DbcSignal = opc_DbcMessage->c_Signals[u32_Counter];
+         const C_CieConverter::C_CIECanSignal & rc_DbcSignal = pc_DbcMessage->c_Signals[u32_Counter];
 
          if (rc_DbcSignal.e_MultiplexerType == C_OSCCanSignal::eMUX_MULTIPLEXER_SIGNAL)
          {
-            mh_InterpretDbcFileCanSignal(orc_MessageData, rc_DbcSignal);
+            mh_InterpretDbcFileCanSignal(orc_MessageData, rc_DbcSignal, opc_DbcEntry->c_SignalDecoders[u32_Counter]);
 
             if (orc_MessageData.c_Signals.size() > 0)
             {
@@ -1095,27 +1202,28 @@ bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CIECanMe
       }
 
       // Interpret the signals
-      for (u32_Counter = 0U; u32_Counter < opc_DbcMessage->c_Signals.size(); ++u32_Counter)
+      for (u32_Counter = 0U; u32_Counter < pc_DbcMessage->c_Signals.size(); ++u32_Counter)
       {
          // Skip the multiplexer signal if one was found. It was added already.
          if ((q_MultiplexerFound == false) ||
              (u32_Counter != u32_MultiplexerIndex))
          {
-            const C_CieConverter::C_CIECanSignal & rc_DbcSignal = opc_DbcMessage->c_Signals[u32_Counter];
+            const C_CieConverter::C_CIECanSignal & rc_DbcSignal = pc_DbcMessage->c_Signals[u32_Counter];
 
             // Interpret all not multiplexed signals and all multiplexed signals with the matching multiplexer value
             if ((rc_DbcSignal.e_MultiplexerType == C_OSCCanSignal::eMUX_DEFAULT) ||
                 ((q_MultiplexerFound == true) &&
                  (u16_MultiplexerValue == rc_DbcSignal.u16_MultiplexValue)))
             {
-               mh_InterpretDbcFileCanSignal(orc_MessageData, rc_DbcSignal);
+               mh_InterpretDbcFileCanSignal(orc_MessageData, rc_DbcSignal,
+                                            opc_DbcEntry->c_SignalDecoders[u32_Counter]);
             }
          }
       }
 
       orc_MessageData.SortSignals();
 
-      if (orc_MessageData.c_CanMsg.u8_DLC != opc_DbcMessage->u16_Dlc)
+      if (orc_MessageData.c_CanMsg.u8_DLC != pc_DbcMessage->u16_Dlc)
       {
          // CAN message does not have the expected size
          orc_MessageData.q_CanDlcError = true;
@@ -1134,10 +1242,12 @@ bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CIECanMe
 
    \param[in,out]  orc_MessageData  Message data target for the interpretation
    \param[in]      orc_DbcSignal    CAN signal of DBC file
+   \param[in]      orc_Decoder      Decoder of CAN signal
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_SyvComMessageMonitor::mh_InterpretDbcFileCanSignal(C_OSCComMessageLoggerData & orc_MessageData,
-                                                          const C_CieConverter::C_CIECanSignal & orc_DbcSignal)
+                                                          const C_CieConverter::C_CIECanSignal & orc_DbcSignal,
+                                                          const C_OSCComMessageLoggerSignalDecoder & orc_Decoder)
 {
    C_OSCComMessageLoggerDataSignal c_Signal;
    C_OSCCanSignal c_OscSignal;
@@ -1153,12 +1263,9 @@ void C_SyvComMessageMonitor::mh_InterpretDbcFileCanSignal(C_OSCComMessageLoggerD
    c_OscSignal.e_MultiplexerType = orc_DbcSignal.e_MultiplexerType;
    c_OscSignal.u16_MultiplexValue = orc_DbcSignal.u16_MultiplexValue;
 
-   // Get the the minimum value for the correct type configuration
-   mh_InterpretCanSignalValue(c_Signal, orc_MessageData.c_CanMsg.au8_Data, orc_MessageData.c_CanMsg.u8_DLC,
-                              c_OscSignal,
-                              orc_DbcSignal.c_Element.c_MinValue,
-                              orc_DbcSignal.c_Element.f64_Factor,
-                              orc_DbcSignal.c_Element.f64_Offset);
+   mh_InterpretCanSignalValue(c_Signal, orc_MessageData.c_CanMsg.au8_Data,
+                              STWCAN_DLCToNumBytes(orc_MessageData.c_CanMsg.u8_DLC, orc_MessageData.c_CanMsg.u8_FDF),
+                              c_OscSignal, orc_Decoder);
 
    if (orc_DbcSignal.c_ValueDescription.size() > 0)
    {
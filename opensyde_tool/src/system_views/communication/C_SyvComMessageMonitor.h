@@ -23,6 +23,7 @@
 
 #include "C_OSCComMessageLogger.h"
 #include "C_OSCComMessageLoggerData.h"
+#include "C_OSCComMessageLoggerSignalDecoder.h"
 
 #include "C_SyvComDriverThread.h"
 #include "C_OSCSystemBus.h"
@@ -69,6 +70,7 @@ public:
    virtual stw_types::sint32 AddLogFileAsc(const stw_scl::C_SCLString & orc_FilePath, const bool oq_HexActive,
                                            const bool oq_RelativeTimeStampActive) override;
    virtual stw_types::sint32 AddLogFileBlf(const stw_scl::C_SCLString & orc_FilePath);
+   virtual stw_types::sint32 AddLogFileBin(const stw_scl::C_SCLString & orc_FilePath) override;
    virtual stw_types::sint32 RemoveLogFile(const stw_scl::C_SCLString & orc_FilePath) override;
    virtual void RemoveAllLogFiles(void) override;
 
@@ -118,16 +120,29 @@ private:
       eADD_DBC_FILE
    };
 
+   ///Location of a CAN message in a registered DBC file
+   class C_DbcMessageIndexEntry
+   {
+   public:
+      C_DbcMessageIndexEntry(void);
+
+      const C_CieConverter::C_CIECanMessage * pc_Message; ///< NULL: CAN ID not defined
+      std::vector<stw_opensyde_core::C_OSCComMessageLoggerSignalDecoder> c_SignalDecoders; ///< for each signal
+   };
+
    //Avoid call
    C_SyvComMessageMonitor(const C_SyvComMessageMonitor &);
    C_SyvComMessageMonitor & operator =(const C_SyvComMessageMonitor &);
 
    stw_types::sint32 m_AddDbcFile(const stw_scl::C_SCLString & orc_PathDbc);
-   const C_CieConverter::C_CIECanMessage * m_CheckDbcFile(const stw_can::T_STWCAN_Msg_RX & orc_Msg);
-   bool m_InterpretDbcFile(const C_CieConverter::C_CIECanMessage * const opc_DbcMessage,
+   void m_UpdateDbcIndex(void);
+   static void mh_CompileDbcSignalDecoders(C_DbcMessageIndexEntry & orc_Entry);
+   const C_DbcMessageIndexEntry * m_CheckDbcFile(const stw_can::T_STWCAN_Msg_RX & orc_Msg);
+   bool m_InterpretDbcFile(const C_DbcMessageIndexEntry * const opc_DbcEntry,
                            stw_opensyde_core::C_OSCComMessageLoggerData & orc_MessageData) const;
    static void mh_InterpretDbcFileCanSignal(stw_opensyde_core::C_OSCComMessageLoggerData & orc_MessageData,
-                                            const C_CieConverter::C_CIECanSignal & orc_DbcSignal);
+                                            const C_CieConverter::C_CIECanSignal & orc_DbcSignal,
+                                            const stw_opensyde_core::C_OSCComMessageLoggerSignalDecoder & orc_Decoder);
 
    static void mh_ThreadFunc(void * const opv_Instance);
    void m_ThreadFunc(void);
@@ -159,6 +174,9 @@ private:
 
    // DBC files
    std::map<stw_scl::C_SCLString, C_CieConverter::C_CIECommDefinition> mc_DbcFiles;
+   // Lookup of CAN messages of all active DBC files (see m_UpdateDbcIndex)
+   std::vector<C_DbcMessageIndexEntry> mc_DbcIndexStandardId;                ///< index is 11bit CAN ID
+   std::map<stw_types::uint32, C_DbcMessageIndexEntry> mc_DbcIndexExtendedId; ///< key is 29bit CAN ID
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -103,6 +103,23 @@ void C_SyvComPollingThreadDiag::m_SetRunParams(const C_SyvComPollingThreadDiag::
    mc_ListIds = orc_ListIds;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: remember parameters for service execution
+
+   \param[in]      oe_Service       Service
+   \param[in,out]  orc_Dealer       Dealer
+   \param[in]      orc_ElementIds   Element ids
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComPollingThreadDiag::m_SetRunParams(
+   const C_SyvComPollingThreadDiag::E_Service oe_Service, C_SyvComDataDealer & orc_Dealer,
+   const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_ElementIds)
+{
+   me_Service = oe_Service;
+   mpc_Dealer = &orc_Dealer;
+   mc_ElementIds = orc_ElementIds;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Utility: remember parameters for service execution
 
@@ -130,6 +147,9 @@ void C_SyvComPollingThreadDiag::run(void)
    case eDPREAD:
       ms32_Result = mpc_Dealer->DataPoolRead(mu8_DataPoolIndex, mu16_ListIndex, mu16_ElementIndex, &mu8_NRC);
       break;
+   case eDPREADMULTIPLE:
+      ms32_Result = mpc_Dealer->DataPoolReadMultiple(this->mc_ElementIds, NULL, &mu8_NRC);
+      break;
    case eDPWRITE:
       ms32_Result = mpc_Dealer->DataPoolWrite(mu8_DataPoolIndex, mu16_ListIndex, mu16_ElementIndex, &mu8_NRC);
       break;
@@ -227,6 +247,38 @@ sint32 C_SyvComPollingThreadDiag::StartDataPoolRead(C_SyvComDataDealer & orc_Dea
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start executing service in thread
+
+   All elements are read in one thread execution (see C_OSCDataDealer::DataPoolReadMultiple).
+
+   \param[in]  orc_Dealer       data dealer to use
+   \param[in]  orc_ElementIds   elements to read; all must belong to the node of the data dealer
+
+   \return
+   C_NO_ERR   started polling
+   C_BUSY     previously started polled communication still going on
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_SyvComPollingThreadDiag::StartDataPoolReadMultiple(
+   C_SyvComDataDealer & orc_Dealer,
+   const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_ElementIds)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if ((this->isRunning() == true) || (this->mq_AcceptNextRequest == false))
+   {
+      s32_Return = C_BUSY;
+   }
+   else
+   {
+      this->mq_AcceptNextRequest = false;
+      this->m_SetRunParams(eDPREADMULTIPLE, orc_Dealer, orc_ElementIds);
+      this->start();
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Start executing service in thread
 
@@ -34,6 +34,7 @@ private:
    enum E_Service
    {
       eDPREAD,
+      eDPREADMULTIPLE,
       eDPWRITE,
       eNVMREAD,
       eNVMWRITE,
@@ -52,6 +53,8 @@ private:
                        const stw_types::uint8 ou8_DataPoolIndex, const stw_types::uint16 ou16_ListIndex);
    void m_SetRunParams(const E_Service oe_Service, stw_opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
                        const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListId> & orc_ListIds);
+   void m_SetRunParams(const E_Service oe_Service, stw_opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
+                       const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_ElementIds);
    void m_SetRunParams(const E_Service oe_Service, stw_opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer);
 
    //service execution parameters:
@@ -63,6 +66,7 @@ private:
    stw_types::uint16 mu16_ElementIndex;
    const stw_opensyde_core::C_OSCNode * mpc_ParamNodeValues;
    std::vector<stw_opensyde_core::C_OSCNodeDataPoolListId>  mc_ListIds;
+   std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> mc_ElementIds;
    // Output
    std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> mc_ChangedElements;
    bool mq_ApplicationAcknowledge;
@@ -81,6 +85,9 @@ public:
    stw_types::sint32 StartDataPoolRead(stw_opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
                                        const stw_types::uint8 ou8_DataPoolIndex, const stw_types::uint16 ou16_ListIndex,
                                        const stw_types::uint16 ou16_ElementIndex);
+   stw_types::sint32 StartDataPoolReadMultiple(stw_opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
+                                               const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> &
+                                               orc_ElementIds);
    stw_types::sint32 StartDataPoolWrite(stw_opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
                                         const stw_types::uint8 ou8_DataPoolIndex,
                                         const stw_types::uint16 ou16_ListIndex,
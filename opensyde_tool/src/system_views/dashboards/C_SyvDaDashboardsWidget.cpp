@@ -935,15 +935,23 @@ void C_SyvDaDashboardsWidget::m_HandleManualOperationFinished(const sint32 os32_
       {
          if (this->mc_MissedReadOperations.size() > 0)
          {
-            const C_OSCNodeDataPoolListElementId c_Id = *this->mc_MissedReadOperations.begin();
-            const sint32 s32_Return =
-               this->mpc_ComDriver->PollDataPoolRead(c_Id.u32_NodeIndex, static_cast<uint8>(c_Id.u32_DataPoolIndex),
-                                                     static_cast<uint16>(c_Id.u32_ListIndex),
-                                                     static_cast<uint16>(c_Id.u32_ElementIndex));
+            //Read all missed elements of one node in one operation
+            //(the set is sorted by node so all elements of the node are in one block at the beginning)
+            const uint32 u32_NodeIndex = this->mc_MissedReadOperations.begin()->u32_NodeIndex;
+            std::set<C_OSCNodeDataPoolListElementId>::iterator c_ItEnd = this->mc_MissedReadOperations.begin();
+            std::vector<C_OSCNodeDataPoolListElementId> c_Ids;
+            sint32 s32_Return;
+
+            while ((c_ItEnd != this->mc_MissedReadOperations.end()) && (c_ItEnd->u32_NodeIndex == u32_NodeIndex))
+            {
+               c_Ids.push_back(*c_ItEnd);
+               ++c_ItEnd;
+            }
+            s32_Return = this->mpc_ComDriver->PollDataPoolReadMultiple(u32_NodeIndex, c_Ids);
             //Error handling
             if (s32_Return != C_BUSY)
             {
-               this->mc_MissedReadOperations.erase(this->mc_MissedReadOperations.begin());
+               this->mc_MissedReadOperations.erase(this->mc_MissedReadOperations.begin(), c_ItEnd);
             }
          }
          else
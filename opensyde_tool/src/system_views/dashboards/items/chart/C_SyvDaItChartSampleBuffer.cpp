@@ -0,0 +1,330 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Bounded sample storage of one chart data series with decimation for drawing
+
+   The chart keeps all received samples of a data series in this ring buffer instead of the line series itself.
+   Only a decimated copy of the currently visible time range is handed to the line series for drawing:
+   for each pixel column the first, minimum, maximum and last sample are kept (min/max envelope).
+   So the drawn line looks identical to the full data, but the count of drawn points is limited by the plot width
+   and not by the count of received samples.
+
+   \copyright   Copyright 2021 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include "C_SyvDaItChartSampleBuffer.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_opensyde_gui;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32 C_SyvDaItChartSampleBuffer::hu32_DEFAULT_CAPACITY;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   The storage is allocated on demand when samples are appended.
+
+   \param[in]  ou32_Capacity  Maximum number of stored samples; when reached the oldest samples are overwritten
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaItChartSampleBuffer::C_SyvDaItChartSampleBuffer(const uint32 ou32_Capacity) :
+   mu32_Capacity((ou32_Capacity > 0U) ? ou32_Capacity : 1U),
+   mu32_First(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append a new sample
+
+   The timestamps are expected in ascending order (as delivered by the chart).
+   A timestamp older than the newest stored sample is clamped to keep the buffer sorted.
+
+   \param[in]  of64_Time   Timestamp of sample
+   \param[in]  of64_Value  Value of sample
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartSampleBuffer::Append(const float64 of64_Time, const float64 of64_Value)
+{
+   float64 f64_Time = of64_Time;
+
+   if (this->mc_Times.empty() == false)
+   {
+      const float64 f64_Newest = this->mc_Times[this->m_GetStorageIndex(this->GetSize() - 1U)];
+      if (f64_Time < f64_Newest)
+      {
+         f64_Time = f64_Newest;
+      }
+   }
+
+   if (this->mc_Times.size() < this->mu32_Capacity)
+   {
+      this->mc_Times.push_back(f64_Time);
+      this->mc_Values.push_back(of64_Value);
+   }
+   else
+   {
+      // Full: overwrite the oldest sample
+      this->mc_Times[this->mu32_First] = f64_Time;
+      this->mc_Values[this->mu32_First] = of64_Value;
+      ++this->mu32_First;
+      if (this->mu32_First >= this->mu32_Capacity)
+      {
+         this->mu32_First = 0U;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartSampleBuffer::Clear(void)
+{
+   this->mc_Times.clear();
+   this->mc_Values.clear();
+   this->mu32_First = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of stored samples
+
+   \return
+   Number of stored samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_SyvDaItChartSampleBuffer::GetSize(void) const
+{
+   return static_cast<uint32>(this->mc_Times.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the samples of a time range reduced to what can be drawn
+
+   If the range contains not more than four samples per column all samples are returned.
+   Else the range is split into ou32_ColumnCount columns of equal time width and for each column the first,
+   the minimum, the maximum and the last sample are returned in their original order.
+   Additionally the nearest samples outside the range on both sides are returned so the drawn line reaches
+   the borders of the plot area.
+
+   \param[in]   of64_TimeStart     Start of visible time range
+   \param[in]   of64_TimeEnd       End of visible time range
+   \param[in]   ou32_ColumnCount   Number of columns (usually the width of the plot area in pixels)
+   \param[out]  orc_Times          Timestamps of resulting samples
+   \param[out]  orc_Values         Values of resulting samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartSampleBuffer::GetDecimatedSamples(const float64 of64_TimeStart, const float64 of64_TimeEnd,
+                                                     const uint32 ou32_ColumnCount, std::vector<float64> & orc_Times,
+                                                     std::vector<float64> & orc_Values) const
+{
+   orc_Times.clear();
+   orc_Values.clear();
+
+   if ((this->mc_Times.empty() == false) && (of64_TimeEnd > of64_TimeStart) && (ou32_ColumnCount > 0U))
+   {
+      const uint32 u32_Begin = this->m_GetFirstIndexNotBefore(of64_TimeStart, 0U, this->GetSize());
+      const uint32 u32_End = this->m_GetFirstIndexNotBefore(of64_TimeEnd, u32_Begin, this->GetSize());
+      const uint32 u32_MaxSampleCount = ou32_ColumnCount * 4U;
+
+      orc_Times.reserve(u32_MaxSampleCount + 2U);
+      orc_Values.reserve(u32_MaxSampleCount + 2U);
+
+      // Connection to the left border
+      if (u32_Begin > 0U)
+      {
+         this->m_AddSample(u32_Begin - 1U, orc_Times, orc_Values);
+      }
+
+      if ((u32_End - u32_Begin) <= u32_MaxSampleCount)
+      {
+         for (uint32 u32_It = u32_Begin; u32_It < u32_End; ++u32_It)
+         {
+            this->m_AddSample(u32_It, orc_Times, orc_Values);
+         }
+      }
+      else
+      {
+         const float64 f64_ColumnWidth = (of64_TimeEnd - of64_TimeStart) / static_cast<float64>(ou32_ColumnCount);
+         uint32 u32_ColumnBegin = u32_Begin;
+
+         for (uint32 u32_Column = 1U; (u32_Column <= ou32_ColumnCount) && (u32_ColumnBegin < u32_End); ++u32_Column)
+         {
+            uint32 u32_ColumnEnd = u32_End;
+
+            if (u32_Column < ou32_ColumnCount)
+            {
+               u32_ColumnEnd = this->m_GetFirstIndexNotBefore(
+                  of64_TimeStart + (static_cast<float64>(u32_Column) * f64_ColumnWidth), u32_ColumnBegin, u32_End);
+            }
+            if (u32_ColumnEnd > u32_ColumnBegin)
+            {
+               this->m_AddColumnEnvelope(u32_ColumnBegin, u32_ColumnEnd, orc_Times, orc_Values);
+               u32_ColumnBegin = u32_ColumnEnd;
+            }
+         }
+      }
+
+      // Connection to the right border
+      if (u32_End < this->GetSize())
+      {
+         this->m_AddSample(u32_End, orc_Times, orc_Values);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert the logical index (0 = oldest sample) to the index in the storage vectors
+
+   \param[in]  ou32_Index  Logical index
+
+   \return
+   Storage index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_SyvDaItChartSampleBuffer::m_GetStorageIndex(const uint32 ou32_Index) const
+{
+   uint32 u32_Index = this->mu32_First + ou32_Index;
+
+   if (u32_Index >= this->GetSize())
+   {
+      u32_Index -= this->GetSize();
+   }
+   return u32_Index;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Search the first sample with a timestamp not before the specified time
+
+   \param[in]  of64_Time   Searched time
+   \param[in]  ou32_Low    First logical index of search range
+   \param[in]  ou32_High   Logical index after search range
+
+   \return
+   Logical index of found sample; ou32_High if all samples of the search range are older
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_SyvDaItChartSampleBuffer::m_GetFirstIndexNotBefore(const float64 of64_Time, const uint32 ou32_Low,
+                                                            const uint32 ou32_High) const
+{
+   uint32 u32_Low = ou32_Low;
+   uint32 u32_High = ou32_High;
+
+   while (u32_Low < u32_High)
+   {
+      const uint32 u32_Mid = u32_Low + ((u32_High - u32_Low) / 2U);
+      if (this->mc_Times[this->m_GetStorageIndex(u32_Mid)] < of64_Time)
+      {
+         u32_Low = u32_Mid + 1U;
+      }
+      else
+      {
+         u32_High = u32_Mid;
+      }
+   }
+   return u32_Low;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add first, minimum, maximum and last sample of one column to result
+
+   \param[in]      ou32_Begin    Logical index of first sample of column
+   \param[in]      ou32_End      Logical index after last sample of column (must be greater than ou32_Begin)
+   \param[in,out]  orc_Times     Timestamps of result
+   \param[in,out]  orc_Values    Values of result
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartSampleBuffer::m_AddColumnEnvelope(const uint32 ou32_Begin, const uint32 ou32_End,
+                                                     std::vector<float64> & orc_Times,
+                                                     std::vector<float64> & orc_Values) const
+{
+   const uint32 u32_Last = ou32_End - 1U;
+   uint32 u32_Min = ou32_Begin;
+   uint32 u32_Max = ou32_Begin;
+   float64 f64_Min = this->mc_Values[this->m_GetStorageIndex(ou32_Begin)];
+   float64 f64_Max = f64_Min;
+   uint32 u32_SegmentBegin = ou32_Begin;
+
+   // The column is contiguous in the storage or split into two parts at the wrap around
+   while (u32_SegmentBegin < ou32_End)
+   {
+      const uint32 u32_StorageBegin = this->m_GetStorageIndex(u32_SegmentBegin);
+      const float64 * const pf64_Values = &this->mc_Values[u32_StorageBegin];
+      uint32 u32_SegmentLength = ou32_End - u32_SegmentBegin;
+
+      if (u32_SegmentLength > (this->GetSize() - u32_StorageBegin))
+      {
+         u32_SegmentLength = this->GetSize() - u32_StorageBegin;
+      }
+      for (uint32 u32_It = 0U; u32_It < u32_SegmentLength; ++u32_It)
+      {
+         if (pf64_Values[u32_It] < f64_Min)
+         {
+            f64_Min = pf64_Values[u32_It];
+            u32_Min = u32_SegmentBegin + u32_It;
+         }
+         else if (pf64_Values[u32_It] > f64_Max)
+         {
+            f64_Max = pf64_Values[u32_It];
+            u32_Max = u32_SegmentBegin + u32_It;
+         }
+         else
+         {
+            // Inside current envelope
+         }
+      }
+      u32_SegmentBegin += u32_SegmentLength;
+   }
+
+   // Keep the original order of the samples
+   {
+      const uint32 u32_Lower = (u32_Min < u32_Max) ? u32_Min : u32_Max;
+      const uint32 u32_Upper = (u32_Min < u32_Max) ? u32_Max : u32_Min;
+
+      this->m_AddSample(ou32_Begin, orc_Times, orc_Values);
+      if (u32_Lower != ou32_Begin)
+      {
+         this->m_AddSample(u32_Lower, orc_Times, orc_Values);
+      }
+      if (u32_Upper != u32_Lower)
+      {
+         this->m_AddSample(u32_Upper, orc_Times, orc_Values);
+      }
+      if (u32_Last != u32_Upper)
+      {
+         this->m_AddSample(u32_Last, orc_Times, orc_Values);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add sample to result
+
+   \param[in]      ou32_Index    Logical index of sample
+   \param[in,out]  orc_Times     Timestamps of result
+   \param[in,out]  orc_Values    Values of result
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartSampleBuffer::m_AddSample(const uint32 ou32_Index, std::vector<float64> & orc_Times,
+                                             std::vector<float64> & orc_Values) const
+{
+   const uint32 u32_StorageIndex = this->m_GetStorageIndex(ou32_Index);
+
+   orc_Times.push_back(this->mc_Times[u32_StorageIndex]);
+   orc_Values.push_back(this->mc_Values[u32_StorageIndex]);
+}
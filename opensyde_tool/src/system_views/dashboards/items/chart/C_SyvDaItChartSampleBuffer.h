@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Bounded sample storage of one chart data series with decimation for drawing (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2021 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVDAITCHARTSAMPLEBUFFER_H
+#define C_SYVDAITCHARTSAMPLEBUFFER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_gui
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+class C_SyvDaItChartSampleBuffer
+{
+public:
+   C_SyvDaItChartSampleBuffer(const stw_types::uint32 ou32_Capacity = hu32_DEFAULT_CAPACITY);
+
+   void Append(const stw_types::float64 of64_Time, const stw_types::float64 of64_Value);
+   void Clear(void);
+   stw_types::uint32 GetSize(void) const;
+   void GetDecimatedSamples(const stw_types::float64 of64_TimeStart, const stw_types::float64 of64_TimeEnd,
+                            const stw_types::uint32 ou32_ColumnCount, std::vector<stw_types::float64> & orc_Times,
+                            std::vector<stw_types::float64> & orc_Values) const;
+
+   static const stw_types::uint32 hu32_DEFAULT_CAPACITY = 1000000U;
+
+private:
+   std::vector<stw_types::float64> mc_Times;
+   std::vector<stw_types::float64> mc_Values;
+   stw_types::uint32 mu32_Capacity;
+   stw_types::uint32 mu32_First; // storage index of the oldest sample once the buffer has wrapped around
+
+   stw_types::uint32 m_GetStorageIndex(const stw_types::uint32 ou32_Index) const;
+   stw_types::uint32 m_GetFirstIndexNotBefore(const stw_types::float64 of64_Time, const stw_types::uint32 ou32_Low,
+                                              const stw_types::uint32 ou32_High) const;
+   void m_AddColumnEnvelope(const stw_types::uint32 ou32_Begin, const stw_types::uint32 ou32_End,
+                            std::vector<stw_types::float64> & orc_Times,
+                            std::vector<stw_types::float64> & orc_Values) const;
+   void m_AddSample(const stw_types::uint32 ou32_Index, std::vector<stw_types::float64> & orc_Times,
+                    std::vector<stw_types::float64> & orc_Values) const;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
@@ -55,6 +55,8 @@ const QColor C_SyvDaItChartWidget::mhac_DataColors[10] =
    QColor(255, 242, 0),
    QColor(112, 48, 160)
 };
+// Used if the plot area is not known yet or very small so a later resize does not show too few points
+const uint32 C_SyvDaItChartWidget::mhu32_MINIMUM_COLUMN_COUNT = 1000U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -101,6 +103,7 @@ C_SyvDaItChartWidget::C_SyvDaItChartWidget(const uint32 ou32_ViewIndex, const ui
    mf64_DefaultTimeSlot(60000.0),
    // 60 seconds as default value
    mf64_CurrentTimeSlot(this->mf64_DefaultTimeSlot),
+   mq_DataSeriesPointsOutdated(false),
    mq_DrawingActive(true)
 {
    QPen c_Pen;
@@ -172,6 +175,9 @@ C_SyvDaItChartWidget::C_SyvDaItChartWidget(const uint32 ou32_ViewIndex, const ui
            this, &C_SyvDaItChartWidget::m_ZoomReseted);
    connect(this->mpc_ChartView, &C_OgeChaViewBase::SigScrolled,
            this, &C_SyvDaItChartWidget::m_Scrolled);
+   // The drawn points depend on the visible time range (zooming, scrolling and following the current time)
+   connect(this->mpc_AxisTime, &QValueAxis::rangeChanged,
+           this, &C_SyvDaItChartWidget::m_UpdateDataSeriesPoints);
 
    this->SetDisplayStyle(C_PuiSvDbWidgetBase::eOPENSYDE, false);
    this->SetWidthOfDataSeriesSelector(330);
@@ -328,6 +334,7 @@ void C_SyvDaItChartWidget::SetDrawingActive(const bool oq_Active)
          }
       }
    }
+   this->m_UpdateDataSeriesPoints();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -703,6 +710,8 @@ bool C_SyvDaItChartWidget::RemoveDataSerie(C_PuiSvDbNodeDataPoolListElementId &
          delete this->mc_DataPoolElementsDataSeries[u32_DataPoolElementConfigIndex];
          this->mc_DataPoolElementsDataSeries.erase(
             this->mc_DataPoolElementsDataSeries.begin() + u32_DataPoolElementConfigIndex);
+         this->mc_DataPoolElementsSampleBuffers.erase(
+            this->mc_DataPoolElementsSampleBuffers.begin() + u32_DataPoolElementConfigIndex);
       }
 
       // Remove used color
@@ -846,6 +855,7 @@ void C_SyvDaItChartWidget::AddDataSerieContent(const C_PuiSvDbNodeDataPoolListEl
              (u32_ConfigCounter < this->mc_DataPoolElementsDataSeries.size()))
          {
             QLineSeries * const pc_LineSerie = this->mc_DataPoolElementsDataSeries[u32_ConfigCounter];
+            C_SyvDaItChartSampleBuffer & rc_SampleBuffer = this->mc_DataPoolElementsSampleBuffers[u32_ConfigCounter];
 
             if (pc_LineSerie != NULL)
             {
@@ -920,8 +930,10 @@ void C_SyvDaItChartWidget::AddDataSerieContent(const C_PuiSvDbNodeDataPoolListEl
                      }
                   }
 
-                  pc_LineSerie->append(f64_Timestamp, f64_Value);
+                  // Drawn points are updated once per refresh (see UpdateTimeAxis)
+                  rc_SampleBuffer.Append(f64_Timestamp, f64_Value);
                }
+               this->mq_DataSeriesPointsOutdated = true;
 
                // Show the last value in the selector widget
                C_OSCNodeDataPoolContentUtil::h_SetValueInContent(f64_Value, c_Tmp, u32_Index);
@@ -985,10 +997,14 @@ void C_SyvDaItChartWidget::UpdateTimeAxis(void)
          this->mf64_MaxTime = static_cast<float64>(u32_NextTimeStamp);
 
          // Do not use the new maximum for the axis. In case of zooming, we need an dynamic adaption
-         this->mpc_AxisTime->setMax(this->mpc_AxisTime->max() + f64_Diff);
+         // Adapt minimum and maximum in one step to update the drawn points only once
+         this->mpc_AxisTime->setRange(this->mpc_AxisTime->min() + f64_Diff, this->mpc_AxisTime->max() + f64_Diff);
+      }
 
-         // Adapt minimum
-         this->mpc_AxisTime->setMin(this->mpc_AxisTime->min() + f64_Diff);
+      // New samples without change of the time range
+      if (this->mq_DataSeriesPointsOutdated == true)
+      {
+         this->m_UpdateDataSeriesPoints();
       }
    }
 }
@@ -1154,6 +1170,7 @@ void C_SyvDaItChartWidget::m_AddDataSerie(const stw_types::uint32 ou32_DataPoolE
    pc_Serie->attachAxis(this->mpc_AxisValueInvisible);
    pc_Serie->setVisible(this->mc_Data.c_DataPoolElementsActive[ou32_DataPoolElementConfigIndex]);
    this->mc_DataPoolElementsDataSeries.push_back(pc_Serie);
+   this->mc_DataPoolElementsSampleBuffers.push_back(C_SyvDaItChartSampleBuffer());
 
    // Set the axis for the new data serie
    this->SelectDataSeriesAxis(ou32_DataPoolElementConfigIndex);
@@ -1171,6 +1188,13 @@ void C_SyvDaItChartWidget::m_ResetChart(void)
    {
       this->mc_DataPoolElementsDataSeries[u32_CounterItem]->clear();
    }
+   for (u32_CounterItem = 0;
+        u32_CounterItem < this->mc_DataPoolElementsSampleBuffers.size();
+        ++u32_CounterItem)
+   {
+      this->mc_DataPoolElementsSampleBuffers[u32_CounterItem].Clear();
+   }
+   this->mq_DataSeriesPointsOutdated = false;
 
    // Reset the range
    this->mf64_MaxValue = 1.0;
@@ -1185,6 +1209,58 @@ void C_SyvDaItChartWidget::m_ResetChart(void)
    this->mpc_AxisTime->setMin(0.0);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Hand the visible part of the received samples to the line series
+
+   Each line series gets only the samples of the visible time range, reduced to the minimum and maximum
+   per pixel column. So the drawing effort does not depend on the count of received samples.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartWidget::m_UpdateDataSeriesPoints(void)
+{
+   if (this->mq_DrawingActive == true)
+   {
+      const float64 f64_PlotWidth = this->mpc_Chart->plotArea().width();
+      uint32 u32_ColumnCount = mhu32_MINIMUM_COLUMN_COUNT;
+      std::vector<float64> c_Times;
+      std::vector<float64> c_Values;
+
+      if (f64_PlotWidth > static_cast<float64>(u32_ColumnCount))
+      {
+         u32_ColumnCount = static_cast<uint32>(f64_PlotWidth);
+      }
+
+      for (uint32 u32_Counter = 0U; (u32_Counter < this->mc_DataPoolElementsDataSeries.size()) &&
+           (u32_Counter < this->mc_DataPoolElementsSampleBuffers.size()); ++u32_Counter)
+      {
+         QLineSeries * const pc_LineSerie = this->mc_DataPoolElementsDataSeries[u32_Counter];
+
+         if ((pc_LineSerie != NULL) && (pc_LineSerie->isVisible() == true))
+         {
+            QVector<QPointF> c_Points;
+
+            this->mc_DataPoolElementsSampleBuffers[u32_Counter].GetDecimatedSamples(this->mpc_AxisTime->min(),
+                                                                                   this->mpc_AxisTime->max(),
+                                                                                   u32_ColumnCount, c_Times,
+                                                                                   c_Values);
+            c_Points.reserve(static_cast<sintn>(c_Times.size()));
+            for (uint32 u32_ItPoint = 0U; u32_ItPoint < c_Times.size(); ++u32_ItPoint)
+            {
+               c_Points.append(QPointF(c_Times[u32_ItPoint], c_Values[u32_ItPoint]));
+            }
+            // One update of the series instead of one per point
+            pc_LineSerie->replace(c_Points);
+         }
+      }
+      this->mq_DataSeriesPointsOutdated = false;
+   }
+   else
+   {
+      // Update when drawing is activated again
+      this->mq_DataSeriesPointsOutdated = true;
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 QColor C_SyvDaItChartWidget::m_GetColor(void)
 {
@@ -1217,6 +1293,8 @@ void C_SyvDaItChartWidget::m_DataItemToggled(const stw_types::uint32 ou32_DataPo
    if (ou32_DataPoolElementConfigIndex < this->mc_DataPoolElementsDataSeries.size())
    {
       this->mc_DataPoolElementsDataSeries[ou32_DataPoolElementConfigIndex]->setVisible(oq_Checked);
+      // Hidden data series are not updated
+      this->m_UpdateDataSeriesPoints();
    }
 
    if (ou32_DataPoolElementConfigIndex < this->mc_Data.c_DataPoolElementsActive.size())
@@ -31,6 +31,7 @@
 #include "C_PuiSvDbNodeDataPoolListElementId.h"
 #include "C_PuiSvDbWidgetBase.h"
 #include "C_PuiSvDbChart.h"
+#include "C_SyvDaItChartSampleBuffer.h"
 
 namespace Ui
 {
@@ -120,6 +121,9 @@ private:
    stw_types::float64 mf64_CurrentTimeSlot;
 
    std::vector<QtCharts::QLineSeries *> mc_DataPoolElementsDataSeries;
+   // Received samples of each data series; the line series only get the decimated visible part
+   std::vector<C_SyvDaItChartSampleBuffer> mc_DataPoolElementsSampleBuffers;
+   bool mq_DataSeriesPointsOutdated;
    std::vector<stw_types::uint32> mc_DataPoolElementsDataColorIndexes;
    // Saving for each datapool element the minimum content to have the type
    std::vector<stw_opensyde_core::C_OSCNodeDataPoolContent> mc_DataPoolElementContentMin;
@@ -131,10 +135,13 @@ private:
 
    std::map<stw_types::uint32, stw_types::uint32> mc_ElementHandlerRegIndexToDataElementIndex;
 
+   static const stw_types::uint32 mhu32_MINIMUM_COLUMN_COUNT;
+
    void m_AddDataSerie(const stw_types::uint32 ou32_DataPoolElementConfigIndex, const bool oq_Warning = false,
                        const bool oq_Invalid = false, const QString & orc_InvalidPlaceholderName = "",
                        const stw_opensyde_core::C_OSCNodeDataPool::E_Type oe_InvalidPlaceholderDataPoolType = stw_opensyde_core::C_OSCNodeDataPool::eDIAG, const QString & orc_ToolTipErrorTextHeading = "", const QString & orc_ToolTipErrorText = "");
    void m_ResetChart(void);
+   void m_UpdateDataSeriesPoints(void);
    QColor m_GetColor(void);
    void m_DataItemToggled(const stw_types::uint32 ou32_DataPoolElementConfigIndex, const bool oq_Checked);
    void m_DataItemSelected(const stw_types::uint32 ou32_DataPoolElementConfigIndex);
@@ -143,7 +143,7 @@ void C_SyvUpHexFileView::m_LoadInfo(void) const
    C_OsyHexFile c_HexFile;
    uint32 u32_Result;
 
-   u32_Result = c_HexFile.LoadFromFile(this->mc_AbsoluteFilePath.toStdString().c_str());
+   u32_Result = c_HexFile.LoadDataDumpFromFile(this->mc_AbsoluteFilePath.toStdString().c_str());
    if (u32_Result == stw_hex_file::NO_ERR)
    {
       mh_AddFileSection(this->mc_AbsoluteFilePath, c_Text);
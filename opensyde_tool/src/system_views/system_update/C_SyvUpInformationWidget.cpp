@@ -373,7 +373,7 @@ void C_SyvUpInformationWidget::InitUpdatePackage(
                {
                   //Do the address based byte count stuff
                   C_OsyHexFile c_HexFile;
-                  const uint32 u32_Result = c_HexFile.LoadFromFile(rc_File.c_str());
+                  const uint32 u32_Result = c_HexFile.LoadDataDumpFromFile(rc_File.c_str());
                   if (u32_Result == stw_hex_file::NO_ERR)
                   {
                      q_UseFileSize = false;
@@ -92,7 +92,7 @@ void C_SyvUpPackageListNodeDatablocksWidget::AdaptFile(const QString & orc_File,
          if (this->mq_FileBased == false)
          {
             C_OsyHexFile * const pc_HexFile = new C_OsyHexFile();
-            if (pc_HexFile->LoadFromFile(c_AbsoluteFilePath.toStdString().c_str()) == stw_hex_file::NO_ERR)
+            if (pc_HexFile->LoadDataDumpFromFile(c_AbsoluteFilePath.toStdString().c_str()) == stw_hex_file::NO_ERR)
             {
                stw_diag_lib::C_XFLECUInformation c_FileApplicationInfo;
                const sint32 s32_Result = pc_HexFile->ScanApplicationInformationBlockFromHexFile(c_FileApplicationInfo);
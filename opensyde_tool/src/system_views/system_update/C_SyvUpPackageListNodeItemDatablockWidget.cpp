@@ -195,7 +195,7 @@ void C_SyvUpPackageListNodeItemDatablockWidget::m_LoadFileInformation(bool & orq
          C_OsyHexFile * const pc_HexFile = new C_OsyHexFile();
 
          // File information
-         if (pc_HexFile->LoadFromFile(this->mc_AbsoluteFilePath.toStdString().c_str()) == stw_hex_file::NO_ERR)
+         if (pc_HexFile->LoadDataDumpFromFile(this->mc_AbsoluteFilePath.toStdString().c_str()) == stw_hex_file::NO_ERR)
          {
             stw_diag_lib::C_XFLECUInformation c_FileApplicationInfo;
             const sint32 s32_Result = pc_HexFile->ScanApplicationInformationBlockFromHexFile(c_FileApplicationInfo);
@@ -8,6 +8,7 @@
 //----------------------------------------------------------------------------------------------------------------------
 #include <QApplication>
 #include <QFileInfo>
+#include <QStandardPaths>
 
 #include "C_SyvUpUpdateWidget.h"
 #include "ui_C_SyvUpUpdateWidget.h"
@@ -43,6 +44,9 @@ using namespace stw_opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
 const QString C_SyvUpUpdateWidget::mhc_TempFolder = "system_update_temp";
+const QString C_SyvUpUpdateWidget::mhc_HexFileCacheFolder = "system_update_hex_cache";
+const stw_types::uint32 C_SyvUpUpdateWidget::mhu32_HexFileCacheMaxSizeMB = 512U;
+const stw_types::uint32 C_SyvUpUpdateWidget::mhu32_HexFileCacheMaxAgeDays = 30U;
 const sintn C_SyvUpUpdateWidget::mhsn_WidgetBorder = 25;
 const sintn C_SyvUpUpdateWidget::mhsn_ToolboxInitPosY = 150;
 const stw_types::uint32 C_SyvUpUpdateWidget::mhu32_WaitTime = 5100U;
@@ -528,6 +532,16 @@ sint32 C_SyvUpUpdateWidget::m_InitSequence(void)
               &C_SyvUpUpdateWidget::m_ReportOpenSydeFlashloaderInformationRead);
       connect(this->mpc_UpSequences, &C_SyvUpSequences::SigReportStwFlashloaderInformationRead, this,
               &C_SyvUpUpdateWidget::m_ReportStwFlashloaderInformationRead);
+
+      // Keep parsed HEX files in the user's cache folder so repeated updates with unchanged files skip parsing
+      // (the folder of the executable might not be writable); no cache if there is no such folder
+      const QString c_CacheLocation = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+      if (c_CacheLocation.isEmpty() == false)
+      {
+         this->mpc_UpSequences->SetHexFileCacheDirectory(
+            (c_CacheLocation + "/" + mhc_HexFileCacheFolder + "/").toStdString().c_str(),
+            mhu32_HexFileCacheMaxSizeMB, mhu32_HexFileCacheMaxAgeDays);
+      }
    }
 
    if (this->mpc_UpSequences->IsInitialized() == false)
@@ -1001,6 +1015,12 @@ void C_SyvUpUpdateWidget::m_ReportOpenSydeFlashloaderInformationRead(void)
          this->m_UpdateReportText(QString(C_GtGetText::h_GetText(" Ethernet2Ethernet routing supported: %1")).arg(
                                      QString::number(rc_Info.c_MoreInformation.c_AvailableFeatures.
                                                      q_EthernetToEthernetRoutingSupported)));
+         this->m_UpdateReportText(QString(C_GtGetText::h_GetText(" Pipelined data transfer supported: %1")).arg(
+                                     QString::number(rc_Info.c_MoreInformation.c_AvailableFeatures.
+                                                     q_PipelinedTransferDataSupported)));
+         this->m_UpdateReportText(QString(C_GtGetText::h_GetText(" Flash sector checksums available: %1")).arg(
+                                     QString::number(rc_Info.c_MoreInformation.c_AvailableFeatures.
+                                                     q_FlashSectorChecksumsAvailable)));
       }
 
       //Convert to same basic class
@@ -161,6 +161,9 @@ private:
    stw_types::uint32 mu32_UpdateTime;
 
    static const QString mhc_TempFolder;
+   static const QString mhc_HexFileCacheFolder;
+   static const stw_types::uint32 mhu32_HexFileCacheMaxSizeMB;
+   static const stw_types::uint32 mhu32_HexFileCacheMaxAgeDays;
    static const stw_types::sintn mhsn_WidgetBorder;
    static const stw_types::sintn mhsn_ToolboxInitPosY;
    static const stw_types::uint32 mhu32_WaitTime;
@@ -0,0 +1,188 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       CAN dispatcher throughput benchmark
+
+   Measures how many messages per second pass from a (simulated) CAN driver through C_CAN_Dispatcher to one client.
+   One thread dispatches incoming messages, a second thread reads them from the client's queue.
+   The simulated driver only provides new messages while the client's queue is at most half full, so no messages
+   are dropped and the result is the lossless throughput.
+   Both queue types (eQUEUE_DEQUE and eQUEUE_SPSC_RING) are measured with single and batch reads.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "CCANDispatcher.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_can;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_MESSAGES = 1000000U;
+static const uint32 mu32_QUEUE_SIZE = 4096U;
+static const uint32 mu32_READ_BATCH_SIZE = 64U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///Dispatcher with a simulated driver providing a fixed number of messages
+class C_BenchDispatcher :
+   public C_CAN_Dispatcher
+{
+public:
+   C_BenchDispatcher(void) :
+      C_CAN_Dispatcher(),
+      mu32_Remaining(0U)
+   {
+   }
+
+   void Provide(const uint32 ou32_NumMessages)
+   {
+      mu32_Remaining += ou32_NumMessages;
+   }
+
+   virtual sint32 CAN_Init(void)
+   {
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Init(const sint32 os32_BitrateKBitS)
+   {
+      (void)os32_BitrateKBitS;
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Exit(void)
+   {
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Reset(void)
+   {
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
+   {
+      (void)orc_Message;
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Get_System_Time(uint64 & oru64_SystemTimeUs) const
+   {
+      oru64_SystemTimeUs = 0U;
+      return C_NO_ERR;
+   }
+
+protected:
+   virtual sint32 m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
+   {
+      sint32 s32_Return = C_NOACT;
+
+      if (mu32_Remaining > 0U)
+      {
+         const uint32 u32_Count = --mu32_Remaining;
+         orc_Message = T_STWCAN_Msg_RX();
+         orc_Message.u32_ID = 0x100U + (u32_Count & 0x7U);
+         orc_Message.u8_DLC = 8U;
+         (void)std::memcpy(&orc_Message.au8_Data[0], &u32_Count, sizeof(u32_Count));
+         s32_Return = C_NO_ERR;
+      }
+      return s32_Return;
+   }
+
+private:
+   std::atomic<uint32> mu32_Remaining; ///< number of messages the simulated driver still provides
+};
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run one measurement
+
+   \param[in]  oe_QueueType   queue type of the client
+   \param[in]  oq_BatchRead   true: read with ReadFromQueue batch overload; false: read one message per call
+
+   \return
+   received messages per second
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static float64 m_Measure(const C_CAN_Dispatcher::E_QueueType oe_QueueType, const bool oq_BatchRead)
+{
+   C_BenchDispatcher c_Dispatcher;
+   uint16 u16_Handle;
+   std::atomic<uint32> u32_Consumed(0U);
+   uint32 u32_Received = 0U;
+
+   (void)c_Dispatcher.RegisterClient(u16_Handle, NULL, mu32_QUEUE_SIZE, oe_QueueType);
+
+   const std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+
+   std::thread c_Producer([&c_Dispatcher, &u32_Consumed]()
+   {
+      uint32 u32_Produced = 0U;
+
+      while (u32_Produced < mu32_NUM_MESSAGES)
+      {
+         if ((u32_Produced - u32_Consumed.load()) <= (mu32_QUEUE_SIZE / 2U))
+         {
+            c_Dispatcher.Provide(mu32_READ_BATCH_SIZE);
+            u32_Produced += mu32_READ_BATCH_SIZE;
+         }
+         (void)c_Dispatcher.DispatchIncoming();
+      }
+   });
+
+   T_STWCAN_Msg_RX at_Messages[mu32_READ_BATCH_SIZE];
+   uint32 u32_Dropped = 0U;
+   while ((u32_Received + u32_Dropped) < mu32_NUM_MESSAGES)
+   {
+      if (oq_BatchRead == true)
+      {
+         uint32 u32_NumRead;
+         (void)c_Dispatcher.ReadFromQueue(u16_Handle, &at_Messages[0], mu32_READ_BATCH_SIZE, u32_NumRead);
+         u32_Received += u32_NumRead;
+         u32_Consumed.store(u32_Received);
+      }
+      else
+      {
+         if (c_Dispatcher.ReadFromQueue(u16_Handle, at_Messages[0]) == C_NO_ERR)
+         {
+            ++u32_Received;
+            u32_Consumed.store(u32_Received);
+         }
+      }
+      (void)c_Dispatcher.GetQueueOverflowCount(u16_Handle, u32_Dropped);
+   }
+   c_Producer.join();
+
+   const std::chrono::duration<float64> c_Elapsed = std::chrono::steady_clock::now() - c_Start;
+   std::printf("  received: %lu  dropped: %lu  time: %.3f s\n", static_cast<unsigned long>(u32_Received),
+               static_cast<unsigned long>(u32_Dropped), c_Elapsed.count());
+   (void)c_Dispatcher.RemoveClient(u16_Handle);
+   return static_cast<float64>(u32_Received) / c_Elapsed.count();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   std::printf("deque, single reads:\n");
+   std::printf("  %.0f msg/s\n", m_Measure(C_CAN_Dispatcher::eQUEUE_DEQUE, false));
+   std::printf("deque, batch reads:\n");
+   std::printf("  %.0f msg/s\n", m_Measure(C_CAN_Dispatcher::eQUEUE_DEQUE, true));
+   std::printf("SPSC ring, single reads:\n");
+   std::printf("  %.0f msg/s\n", m_Measure(C_CAN_Dispatcher::eQUEUE_SPSC_RING, false));
+   std::printf("SPSC ring, batch reads:\n");
+   std::printf("  %.0f msg/s\n", m_Measure(C_CAN_Dispatcher::eQUEUE_SPSC_RING, true));
+   return 0;
+}
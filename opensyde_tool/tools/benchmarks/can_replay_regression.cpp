@@ -0,0 +1,278 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Offline regression and throughput driver for C_CAN_Replay
+
+   Replays a recorded trace (*.asc or *.osyt) through C_CAN_Replay as fast as possible and
+   - checks that the dispatcher client receives every recorded message unchanged and in order
+     (compared against a direct read of the same file)
+   - writes the received messages to a compact openSYDE binary trace and checks that reading it back
+     yields the same messages
+   - reports the replay throughput in messages per second
+
+   Usage: can_replay_regression <trace file> [<output .osyt file>]
+   Exit code 0: all checks passed; 1: mismatch found; 2: files could not be opened
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "CSCLString.h"
+#include "CCANReplay.h"
+#include "C_OSCComMessageLoggerData.h"
+#include "C_OSCComMessageLoggerFileBin.h"
+#include "C_OSCComMessageLoggerFileAscReader.h"
+#include "C_OSCComMessageLoggerFileBinReader.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_can;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_READ_BATCH_SIZE = 64U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///Owns a reader for the trace format given by the file extension
+class C_TraceSource
+{
+public:
+   C_TraceSource(void) :
+      mpc_Source(NULL)
+   {
+   }
+
+   sint32 Open(const C_SCLString & orc_FilePath)
+   {
+      sint32 s32_Return;
+      const C_SCLString c_Extension = orc_FilePath.SubString(orc_FilePath.Length() - 3U, 4U).LowerCase();
+
+      if (c_Extension == "osyt")
+      {
+         s32_Return = this->mc_BinReader.Open(orc_FilePath);
+         this->mpc_Source = &this->mc_BinReader;
+      }
+      else
+      {
+         s32_Return = this->mc_AscReader.Open(orc_FilePath);
+         this->mpc_Source = &this->mc_AscReader;
+      }
+      return s32_Return;
+   }
+
+   C_CAN_ReplaySource * GetSource(void)
+   {
+      return this->mpc_Source;
+   }
+
+private:
+   C_OSCComMessageLoggerFileAscReader mc_AscReader;
+   C_OSCComMessageLoggerFileBinReader mc_BinReader;
+   C_CAN_ReplaySource * mpc_Source;
+};
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare two CAN messages
+
+   Only the payload bytes defined by the DLC are compared.
+
+   \param[in]  orc_Msg1   first message
+   \param[in]  orc_Msg2   second message
+
+   \return
+   true    equal
+   false   different
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_IsEqual(const T_STWCAN_Msg_RX & orc_Msg1, const T_STWCAN_Msg_RX & orc_Msg2)
+{
+   bool q_Return = ((orc_Msg1.u64_TimeStamp == orc_Msg2.u64_TimeStamp) && (orc_Msg1.u32_ID == orc_Msg2.u32_ID) &&
+                    (orc_Msg1.u8_XTD == orc_Msg2.u8_XTD) && (orc_Msg1.u8_RTR == orc_Msg2.u8_RTR) &&
+                    (orc_Msg1.u8_DLC == orc_Msg2.u8_DLC) && (orc_Msg1.u8_FDF == orc_Msg2.u8_FDF) &&
+                    (orc_Msg1.u8_BRS == orc_Msg2.u8_BRS));
+
+   if ((q_Return == true) && (orc_Msg1.u8_RTR == 0U))
+   {
+      q_Return = (std::memcmp(&orc_Msg1.au8_Data[0], &orc_Msg2.au8_Data[0],
+                              STWCAN_DLCToNumBytes(orc_Msg1.u8_DLC, orc_Msg1.u8_FDF)) == 0);
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Print message mismatch
+
+   \param[in]  opcn_Check   name of failed check
+   \param[in]  ou32_Index   index of message in trace
+   \param[in]  orc_Msg      received message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_ReportMismatch(const charn * const opcn_Check, const uint32 ou32_Index, const T_STWCAN_Msg_RX & orc_Msg)
+{
+   std::printf("%s: mismatch at message %lu (ID 0x%lX, time stamp %llu us)\n", opcn_Check,
+               static_cast<unsigned long>(ou32_Index), static_cast<unsigned long>(orc_Msg.u32_ID),
+               static_cast<unsigned long long>(orc_Msg.u64_TimeStamp));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(const sintn osn_Argc, const charn * const * const oppcn_Argv)
+{
+   sintn sn_Return = 0;
+
+   if (osn_Argc < 2)
+   {
+      std::printf("usage: can_replay_regression <trace file> [<output .osyt file>]\n");
+      return 2;
+   }
+
+   const C_SCLString c_TracePath = oppcn_Argv[1];
+   const C_SCLString c_OutputPath = (osn_Argc >= 3) ? C_SCLString(oppcn_Argv[2]) : C_SCLString("replay_out.osyt");
+   C_TraceSource c_ReplayTrace;
+   C_TraceSource c_ReferenceTrace;
+   C_OSCComMessageLoggerFileBin * pc_Output = new C_OSCComMessageLoggerFileBin(c_OutputPath, "");
+
+   if ((c_ReplayTrace.Open(c_TracePath) != C_NO_ERR) || (c_ReferenceTrace.Open(c_TracePath) != C_NO_ERR) ||
+       (pc_Output->OpenFile() != C_NO_ERR))
+   {
+      std::printf("could not open %s or create %s\n", c_TracePath.c_str(), c_OutputPath.c_str());
+      delete pc_Output;
+      return 2;
+   }
+
+   //replay as fast as possible and compare against the reference read
+   C_CAN_Replay c_Replay;
+   uint16 u16_Handle;
+   uint32 u32_NumReceived = 0U;
+   uint32 u32_NumMismatches = 0U;
+   T_STWCAN_Msg_RX at_Messages[mu32_READ_BATCH_SIZE];
+   C_OSCComMessageLoggerData c_LogData;
+
+   //as fast as possible means one DispatchIncoming() call delivers the whole trace: size the queue accordingly
+   uint32 u32_NumRecorded = 0U;
+   {
+      T_STWCAN_Msg_RX c_Message;
+      bool q_IsTx = false;
+      while (c_ReferenceTrace.GetSource()->ReadNextMessage(c_Message, q_IsTx) == C_NO_ERR)
+      {
+         ++u32_NumRecorded;
+      }
+      (void)c_ReferenceTrace.GetSource()->Restart();
+   }
+
+   c_Replay.SetSource(c_ReplayTrace.GetSource());
+   c_Replay.SetSpeedFactor(0.0);
+   c_Replay.SetSkipTxMessages(false);
+   (void)c_Replay.RegisterClient(u16_Handle, NULL, u32_NumRecorded + 1U, C_CAN_Dispatcher::eQUEUE_SPSC_RING);
+   (void)c_Replay.CAN_Init();
+
+   const std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+   bool q_Continue = true;
+   while (q_Continue == true)
+   {
+      uint32 u32_NumRead;
+      const bool q_Finished = c_Replay.IsFinished();
+
+      (void)c_Replay.DispatchIncoming();
+      (void)c_Replay.ReadFromQueue(u16_Handle, &at_Messages[0], mu32_READ_BATCH_SIZE, u32_NumRead);
+      for (uint32 u32_It = 0U; u32_It < u32_NumRead; ++u32_It)
+      {
+         T_STWCAN_Msg_RX c_Expected;
+         bool q_IsTx = false;
+         if ((c_ReferenceTrace.GetSource()->ReadNextMessage(c_Expected, q_IsTx) != C_NO_ERR) ||
+             (m_IsEqual(c_Expected, at_Messages[u32_It]) == false))
+         {
+            if (u32_NumMismatches < 10U)
+            {
+               m_ReportMismatch("replay", u32_NumReceived, at_Messages[u32_It]);
+            }
+            ++u32_NumMismatches;
+         }
+         c_LogData.c_CanMsg = at_Messages[u32_It];
+         c_LogData.q_IsTx = q_IsTx;
+         pc_Output->AddMessageToFile(c_LogData);
+         ++u32_NumReceived;
+      }
+      //finished before the last dispatch and nothing left in the queue
+      q_Continue = ((q_Finished == false) || (u32_NumRead > 0U));
+   }
+   const std::chrono::duration<float64> c_Elapsed = std::chrono::steady_clock::now() - c_Start;
+   (void)c_Replay.CAN_Exit();
+
+   //all recorded messages must have been delivered
+   {
+      T_STWCAN_Msg_RX c_Remaining;
+      bool q_IsTx = false;
+      if (c_ReferenceTrace.GetSource()->ReadNextMessage(c_Remaining, q_IsTx) == C_NO_ERR)
+      {
+         std::printf("replay: not all recorded messages were delivered\n");
+         ++u32_NumMismatches;
+      }
+   }
+
+   std::printf("replayed %lu messages in %.3f s (%.0f msg/s), %lu mismatches\n",
+               static_cast<unsigned long>(u32_NumReceived), c_Elapsed.count(),
+               (c_Elapsed.count() > 0.0) ? (static_cast<float64>(u32_NumReceived) / c_Elapsed.count()) : 0.0,
+               static_cast<unsigned long>(u32_NumMismatches));
+
+   //round trip of the received messages through the binary trace
+   {
+      C_OSCComMessageLoggerFileBinReader c_OutputReader;
+      uint32 u32_NumRoundTripMismatches = 0U;
+
+      //destruction writes the last chunk and closes the file
+      delete pc_Output;
+      pc_Output = NULL;
+      if (c_OutputReader.Open(c_OutputPath) != C_NO_ERR)
+      {
+         std::printf("could not read back %s\n", c_OutputPath.c_str());
+         sn_Return = 2;
+      }
+      else
+      {
+         C_TraceSource c_Reference;
+         (void)c_Reference.Open(c_TracePath);
+         for (uint64 u64_It = 0U; u64_It < c_OutputReader.GetNumRecords(); ++u64_It)
+         {
+            T_STWCAN_Msg_RX c_Written;
+            T_STWCAN_Msg_RX c_Expected;
+            bool q_IsTx = false;
+            (void)c_OutputReader.GetRecord(u64_It, c_Written, q_IsTx);
+            if ((c_Reference.GetSource()->ReadNextMessage(c_Expected, q_IsTx) != C_NO_ERR) ||
+                (m_IsEqual(c_Expected, c_Written) == false))
+            {
+               if (u32_NumRoundTripMismatches < 10U)
+               {
+                  m_ReportMismatch("osyt round trip", static_cast<uint32>(u64_It), c_Written);
+               }
+               ++u32_NumRoundTripMismatches;
+            }
+         }
+         if (c_OutputReader.GetNumRecords() != static_cast<uint64>(u32_NumReceived))
+         {
+            std::printf("osyt round trip: %llu records written, %lu received\n",
+                        static_cast<unsigned long long>(c_OutputReader.GetNumRecords()),
+                        static_cast<unsigned long>(u32_NumReceived));
+            ++u32_NumRoundTripMismatches;
+         }
+         std::printf("osyt round trip: %lu mismatches\n", static_cast<unsigned long>(u32_NumRoundTripMismatches));
+         u32_NumMismatches += u32_NumRoundTripMismatches;
+      }
+   }
+
+   if ((sn_Return == 0) && (u32_NumMismatches > 0U))
+   {
+      sn_Return = 1;
+   }
+   return sn_Return;
+}
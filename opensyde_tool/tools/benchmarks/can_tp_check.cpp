@@ -0,0 +1,263 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of segmented transfers of C_OSCProtocolDriverOsyTpCan at the service size limits
+
+   Two transport protocol instances are connected back to back by a pair of simulated CAN drivers.
+   Services of the sizes in mau32_SIZES are sent in both directions, in classic CAN and in CAN FD mode. They have to
+   arrive unchanged within mu32_MAX_CYCLES cycles and the sender must not send more frames than the service needs.
+   The sizes cover the frame type boundaries (single frame, first frame, escaped first frame) and the end of the
+   16bit range (services of 65516..65535 bytes let a 16bit transmission index wrap in CAN FD mode).
+   Services larger than the maximum service size of the mode have to be rejected by SendRequest().
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "CCANDispatcher.h"
+#include "C_OSCProtocolDriverOsyTpCan.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_can;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_MAX_CYCLES = 100U;
+static const uint32 mau32_SIZES[] =
+{
+   1U, 7U, 8U, 62U, 63U, 64U, 4094U, 4095U, 4096U, 4097U, 65515U, 65516U, 65517U, 65534U, 65535U
+};
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///Simulated CAN driver; sent messages are received by the peer driver
+class C_LoopbackDispatcher :
+   public C_CAN_Dispatcher
+{
+public:
+   C_LoopbackDispatcher(void) :
+      C_CAN_Dispatcher(),
+      mpc_Peer(NULL),
+      mu32_NumSent(0U)
+   {
+   }
+
+   void SetPeer(C_LoopbackDispatcher * const opc_Peer)
+   {
+      mpc_Peer = opc_Peer;
+   }
+
+   uint32 GetNumSent(void) const
+   {
+      return mu32_NumSent;
+   }
+
+   virtual sint32 CAN_Init(void)
+   {
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Init(const sint32 os32_BitrateKBitS)
+   {
+      (void)os32_BitrateKBitS;
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Exit(void)
+   {
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Reset(void)
+   {
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Send_Msg(const T_STWCAN_Msg_TX & orc_Message)
+   {
+      T_STWCAN_Msg_RX c_Message;
+
+      c_Message.u32_ID = orc_Message.u32_ID;
+      c_Message.u8_XTD = orc_Message.u8_XTD;
+      c_Message.u8_DLC = orc_Message.u8_DLC;
+      c_Message.u8_RTR = orc_Message.u8_RTR;
+      c_Message.u8_FDF = orc_Message.u8_FDF;
+      c_Message.u8_BRS = orc_Message.u8_BRS;
+      c_Message.u64_TimeStamp = 0U;
+      (void)std::memcpy(&c_Message.au8_Data[0], &orc_Message.au8_Data[0], sizeof(c_Message.au8_Data));
+      mpc_Peer->mc_Incoming.push_back(c_Message);
+      mu32_NumSent++;
+      return C_NO_ERR;
+   }
+
+   virtual sint32 CAN_Get_System_Time(uint64 & oru64_SystemTimeUs) const
+   {
+      oru64_SystemTimeUs = 0U;
+      return C_NO_ERR;
+   }
+
+protected:
+   virtual sint32 m_CAN_Read_Msg(T_STWCAN_Msg_RX & orc_Message)
+   {
+      sint32 s32_Return = C_NOACT;
+
+      if (mc_Incoming.empty() == false)
+      {
+         orc_Message = mc_Incoming.front();
+         mc_Incoming.pop_front();
+         s32_Return = C_NO_ERR;
+      }
+      return s32_Return;
+   }
+
+private:
+   C_LoopbackDispatcher * mpc_Peer;
+   std::deque<T_STWCAN_Msg_RX> mc_Incoming;
+   uint32 mu32_NumSent;
+};
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of frames needed for a service (15765-2:2016)
+
+   \param[in]  ou32_Size   service size in bytes
+   \param[in]  oq_CanFd    true: CAN FD mode; false: classic CAN
+
+   \return
+   number of single, first and consecutive frames
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_GetNumFrames(const uint32 ou32_Size, const bool oq_CanFd)
+{
+   uint32 u32_NumFrames = 1U;
+   const uint32 u32_SingleFrameMax = (oq_CanFd == true) ? 62U : 7U;
+
+   if (ou32_Size > u32_SingleFrameMax)
+   {
+      const uint32 u32_FrameLength = (oq_CanFd == true) ? 64U : 8U;
+      const uint32 u32_FirstFramePayload = u32_FrameLength - ((ou32_Size > 4095U) ? 6U : 2U);
+      const uint32 u32_ConsecutiveFramePayload = u32_FrameLength - 1U;
+      u32_NumFrames += ((ou32_Size - u32_FirstFramePayload) + (u32_ConsecutiveFramePayload - 1U)) /
+                       u32_ConsecutiveFramePayload;
+   }
+   return u32_NumFrames;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Transfer one service and compare the received data
+
+   \param[in,out]  orc_Sender       sending protocol
+   \param[in,out]  orc_Receiver     receiving protocol
+   \param[in]      orc_SenderCan    CAN driver of sending protocol
+   \param[in]      ou32_Size        service size in bytes
+
+   \return
+   true    service received unchanged with the expected number of frames
+   false   service not received, changed or sent with a wrong number of frames
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_Transfer(C_OSCProtocolDriverOsyTpCan & orc_Sender, C_OSCProtocolDriverOsyTpCan & orc_Receiver,
+                       const C_LoopbackDispatcher & orc_SenderCan, const uint32 ou32_Size)
+{
+   const uint32 u32_NumSentBefore = orc_SenderCan.GetNumSent();
+   C_OSCProtocolDriverOsyService c_Request;
+   C_OSCProtocolDriverOsyService c_Received;
+   sint32 s32_Result = C_NOACT;
+
+   c_Request.c_Data.resize(ou32_Size);
+   for (uint32 u32_Byte = 0U; u32_Byte < ou32_Size; u32_Byte++)
+   {
+      c_Request.c_Data[u32_Byte] = static_cast<uint8>((u32_Byte * 7U) + (u32_Byte >> 8U) + ou32_Size);
+   }
+   //first byte is the service ID; avoid the special IDs handled by the openSYDE specific frames
+   c_Request.c_Data[0] = 0x22U;
+
+   if (orc_Sender.SendRequest(c_Request) == C_NO_ERR)
+   {
+      for (uint32 u32_Cycle = 0U; (u32_Cycle < mu32_MAX_CYCLES) && (s32_Result != C_NO_ERR); u32_Cycle++)
+      {
+         (void)orc_Sender.Cycle();
+         (void)orc_Receiver.Cycle();
+         s32_Result = orc_Receiver.ReadResponse(c_Received);
+      }
+   }
+   return (s32_Result == C_NO_ERR) && (c_Received.c_Data == c_Request.c_Data) &&
+          ((orc_SenderCan.GetNumSent() - u32_NumSentBefore) == m_GetNumFrames(ou32_Size, orc_Sender.GetCanFdMode()));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check all sizes in one mode
+
+   \param[in]  oq_CanFd   true: CAN FD mode; false: classic CAN
+
+   \return
+   number of errors
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_CheckMode(const bool oq_CanFd)
+{
+   C_LoopbackDispatcher c_ClientCan;
+   C_LoopbackDispatcher c_ServerCan;
+   C_OSCProtocolDriverOsyTpCan c_Client;
+   C_OSCProtocolDriverOsyTpCan c_Server;
+   const C_OSCProtocolDriverOsyNode c_ClientId(0U, 126U);
+   const C_OSCProtocolDriverOsyNode c_ServerId(0U, 1U);
+   const uint32 u32_MaxSize = (oq_CanFd == true) ? 65535U : 4095U;
+   uint32 u32_Errors = 0U;
+
+   c_ClientCan.SetPeer(&c_ServerCan);
+   c_ServerCan.SetPeer(&c_ClientCan);
+   (void)c_Client.SetDispatcher(&c_ClientCan);
+   (void)c_Server.SetDispatcher(&c_ServerCan);
+   //the server side sees the identifiers swapped
+   (void)c_Client.SetNodeIdentifiers(c_ClientId, c_ServerId);
+   (void)c_Server.SetNodeIdentifiers(c_ServerId, c_ClientId);
+   c_Client.SetCanFdMode(oq_CanFd);
+   c_Server.SetCanFdMode(oq_CanFd);
+
+   for (uint32 u32_Size = 0U; u32_Size < (sizeof(mau32_SIZES) / sizeof(mau32_SIZES[0])); u32_Size++)
+   {
+      const uint32 u32_ServiceSize = mau32_SIZES[u32_Size];
+      if (u32_ServiceSize <= u32_MaxSize)
+      {
+         const bool q_Request = m_Transfer(c_Client, c_Server, c_ClientCan, u32_ServiceSize);
+         const bool q_Response = m_Transfer(c_Server, c_Client, c_ServerCan, u32_ServiceSize);
+         std::printf("%s %5lu bytes: request %s, response %s\n", (oq_CanFd == true) ? "FD     " : "classic",
+                     static_cast<unsigned long>(u32_ServiceSize), (q_Request == true) ? "ok" : "FAILED",
+                     (q_Response == true) ? "ok" : "FAILED");
+         u32_Errors += (q_Request == true) ? 0U : 1U;
+         u32_Errors += (q_Response == true) ? 0U : 1U;
+      }
+   }
+
+   //one byte too much has to be rejected
+   {
+      C_OSCProtocolDriverOsyService c_TooLarge;
+      c_TooLarge.c_Data.resize(u32_MaxSize + 1U, 0x22U);
+      const sint32 s32_Result = c_Client.SendRequest(c_TooLarge);
+      std::printf("%s %5lu bytes: %s\n", (oq_CanFd == true) ? "FD     " : "classic",
+                  static_cast<unsigned long>(u32_MaxSize + 1U), (s32_Result != C_NO_ERR) ? "rejected" : "NOT REJECTED");
+      u32_Errors += (s32_Result != C_NO_ERR) ? 0U : 1U;
+   }
+   return u32_Errors;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   uint32 u32_Errors = m_CheckMode(false);
+
+   u32_Errors += m_CheckMode(true);
+   std::printf("%lu errors\n", static_cast<unsigned long>(u32_Errors));
+   return (u32_Errors == 0U) ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Latency and CPU load of waiting for CAN responses (SocketCAN)
+
+   Compares the two ways a client can wait for a response on a SocketCAN interface:
+   - polling: DispatchIncoming() + ReadFromQueue() + yield in a loop (behavior before WaitForIncoming() existed)
+   - waiting: WaitForIncoming() with up to 10 ms per call (as done by C_OSCProtocolDriverOsyTpCan::WaitForResponse())
+
+   A second C_CAN instance on the same interface plays the server: it sends one "response" frame every
+   mu32_RESPONSE_INTERVAL_MS ms. The receiving thread measures the time from sending to reading the frame from
+   its client queue and the CPU time it consumed.
+
+   Usage: can_wait_latency [<interface>]  (default: vcan0)
+   Set up a virtual interface with:
+   sudo modprobe vcan && sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <ctime>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "CSCLString.h"
+#include "CCAN.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_can;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_RESPONSES = 500U;
+static const uint32 mu32_RESPONSE_INTERVAL_MS = 2U;
+static const uint32 mu32_MAX_WAIT_TIME_MS = 10U; ///< same as the limit used by the protocol driver
+static const uint32 mu32_RESPONSE_ID = 0x5F1U;
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get steady clock time in microseconds
+
+   \return
+   time in us
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64 m_GetTimeUs(void)
+{
+   return static_cast<uint64>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get CPU time consumed by the calling thread in microseconds
+
+   \return
+   CPU time in us
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64 m_GetThreadCpuTimeUs(void)
+{
+   struct timespec c_Time;
+
+   (void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &c_Time);
+   return (static_cast<uint64>(c_Time.tv_sec) * 1000000U) + (static_cast<uint64>(c_Time.tv_nsec) / 1000U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run one measurement
+
+   \param[in]  orc_Interface   name of SocketCAN interface
+   \param[in]  oq_Wait         true: use WaitForIncoming(); false: poll with yield
+
+   \return
+   C_NO_ERR   measurement done
+   else       interface could not be opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static sint32 m_Measure(const C_SCLString & orc_Interface, const bool oq_Wait)
+{
+   C_CAN c_Client;
+   C_CAN c_Server;
+   uint16 u16_Handle;
+   std::atomic<uint64> u64_SendTimeUs(0U);
+   std::atomic<bool> q_Received(true);
+   uint64 u64_LatencySumUs = 0U;
+   uint64 u64_LatencyMaxUs = 0U;
+   uint32 u32_NumReceived = 0U;
+   uint32 u32_NumWaitCalls = 0U;
+
+   if ((c_Client.CAN_Init(orc_Interface) != C_NO_ERR) || (c_Server.CAN_Init(orc_Interface) != C_NO_ERR))
+   {
+      std::printf("could not open %s\n", orc_Interface.c_str());
+      return C_CONFIG;
+   }
+   (void)c_Client.RegisterClient(u16_Handle);
+
+   std::thread c_ServerThread([&c_Server, &u64_SendTimeUs, &q_Received]()
+   {
+      T_STWCAN_Msg_TX c_Response;
+
+      c_Response.u32_ID = mu32_RESPONSE_ID;
+      c_Response.u8_XTD = 0U;
+      c_Response.u8_RTR = 0U;
+      c_Response.u8_DLC = 8U;
+      for (uint32 u32_Response = 0U; u32_Response < mu32_NUM_RESPONSES; u32_Response++)
+      {
+         std::this_thread::sleep_for(std::chrono::milliseconds(mu32_RESPONSE_INTERVAL_MS));
+         //one response at a time; so the latency of each one is measured
+         while (q_Received.load() == false)
+         {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+         }
+         q_Received.store(false);
+         u64_SendTimeUs.store(m_GetTimeUs());
+         (void)c_Server.CAN_Send_Msg(c_Response);
+      }
+   });
+
+   const uint64 u64_CpuStartUs = m_GetThreadCpuTimeUs();
+   const uint64 u64_StartUs = m_GetTimeUs();
+   while (u32_NumReceived < mu32_NUM_RESPONSES)
+   {
+      T_STWCAN_Msg_RX c_Message;
+
+      if (oq_Wait == true)
+      {
+         (void)c_Client.WaitForIncoming(u16_Handle, mu32_MAX_WAIT_TIME_MS);
+         u32_NumWaitCalls++;
+      }
+      (void)c_Client.DispatchIncoming();
+      while (c_Client.ReadFromQueue(u16_Handle, c_Message) == C_NO_ERR)
+      {
+         if (c_Message.u32_ID == mu32_RESPONSE_ID)
+         {
+            const uint64 u64_LatencyUs = m_GetTimeUs() - u64_SendTimeUs.load();
+            u64_LatencySumUs += u64_LatencyUs;
+            u64_LatencyMaxUs = (u64_LatencyUs > u64_LatencyMaxUs) ? u64_LatencyUs : u64_LatencyMaxUs;
+            u32_NumReceived++;
+            q_Received.store(true);
+         }
+      }
+      if (oq_Wait == false)
+      {
+         std::this_thread::yield();
+      }
+   }
+   const uint64 u64_CpuUs = m_GetThreadCpuTimeUs() - u64_CpuStartUs;
+   const uint64 u64_ElapsedUs = m_GetTimeUs() - u64_StartUs;
+   c_ServerThread.join();
+
+   std::printf("%s: %lu responses in %.0f ms; latency mean %.1f us, max %lu us; receiver CPU time %.1f ms",
+               (oq_Wait == true) ? "WaitForIncoming" : "polling", static_cast<unsigned long>(u32_NumReceived),
+               static_cast<float64>(u64_ElapsedUs) / 1000.0,
+               static_cast<float64>(u64_LatencySumUs) / static_cast<float64>(u32_NumReceived),
+               static_cast<unsigned long>(u64_LatencyMaxUs), static_cast<float64>(u64_CpuUs) / 1000.0);
+   if (oq_Wait == true)
+   {
+      std::printf(" (%lu wait calls)", static_cast<unsigned long>(u32_NumWaitCalls));
+   }
+   std::printf("\n");
+
+   (void)c_Client.RemoveClient(u16_Handle);
+   (void)c_Server.CAN_Exit();
+   (void)c_Client.CAN_Exit();
+   return C_NO_ERR;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(const sintn osn_Argc, const charn * const * const oppcn_Argv)
+{
+   const C_SCLString c_Interface = (osn_Argc >= 2) ? C_SCLString(oppcn_Argv[1]) : C_SCLString("vcan0");
+   sintn sn_Return = 0;
+
+   if ((m_Measure(c_Interface, false) != C_NO_ERR) || (m_Measure(c_Interface, true) != C_NO_ERR))
+   {
+      sn_Return = 1;
+   }
+   return sn_Return;
+}
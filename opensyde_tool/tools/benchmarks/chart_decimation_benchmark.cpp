@@ -0,0 +1,215 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of the chart sample buffer decimation
+
+   Benchmark: mu32_NUM_SERIES data series with mu32_NUM_SAMPLES samples each (1 ms sample interval; more samples
+   than the default capacity, so all buffers have wrapped around) are decimated to mu32_NUM_COLUMNS columns:
+   - with the whole buffer visible (worst case)
+   - with a 60 s time range visible (default time slot of the chart)
+   The time per frame covers all series. It is the time C_SyvDaItChartWidget needs to get the points of all series
+   for one update; the widget frame time (QLineSeries::replace() and drawing of the chart) is not measured because
+   the benchmark has to run without Qt.
+
+   Check: buffers of random capacities are filled with more random samples than they can hold. The result of
+   GetDecimatedSamples() for a random time range is compared with a plain copy of the newest samples:
+   - the timestamps are sorted
+   - not more than four samples per column plus the two border samples are returned
+   - the minimum and the maximum of each column are contained in the result
+   - ranges with few samples return all samples in the range
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "stwtypes.h"
+#include "C_SyvDaItChartSampleBuffer.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_opensyde_gui;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_SERIES = 8U;
+static const uint32 mu32_NUM_SAMPLES = 1200000U;
+static const uint32 mu32_NUM_COLUMNS = 1000U;
+static const uint32 mu32_NUM_FRAMES = 30U;
+static const uint32 mu32_NUM_CHECKS = 500U;
+static const uint32 mu32_NUM_CHECK_COLUMNS = 50U;
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decimate all series for several frames and report the time per frame
+
+   \param[in]  orc_Buffers        buffers of all series
+   \param[in]  of64_RangeMs       visible time range in ms (ending at the newest sample)
+   \param[in]  opcn_Description   description for output
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_MeasureFrames(const std::vector<C_SyvDaItChartSampleBuffer> & orc_Buffers, const float64 of64_RangeMs,
+                            const charn * const opcn_Description)
+{
+   std::vector<float64> c_Times;
+   std::vector<float64> c_Values;
+   uint64 u64_NumPoints = 0U;
+   const float64 f64_End = static_cast<float64>(mu32_NUM_SAMPLES);
+
+   const std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Frame = 0U; u32_Frame < mu32_NUM_FRAMES; ++u32_Frame)
+   {
+      //move the range a little like a running chart does
+      const float64 f64_Shift = static_cast<float64>(u32_Frame);
+      for (uint32 u32_Series = 0U; u32_Series < orc_Buffers.size(); ++u32_Series)
+      {
+         orc_Buffers[u32_Series].GetDecimatedSamples((f64_End - of64_RangeMs) + f64_Shift, f64_End + f64_Shift,
+                                                     mu32_NUM_COLUMNS, c_Times, c_Values);
+         u64_NumPoints += c_Times.size();
+      }
+   }
+   const std::chrono::duration<float64, std::milli> c_Elapsed = std::chrono::steady_clock::now() - c_Start;
+
+   std::printf("%s: %.2f ms per frame, %lu points per series\n", opcn_Description,
+               c_Elapsed.count() / static_cast<float64>(mu32_NUM_FRAMES),
+               static_cast<unsigned long>(u64_NumPoints / (static_cast<uint64>(mu32_NUM_FRAMES) *
+                                                           orc_Buffers.size())));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check the decimation of one buffer filled with random samples
+
+   \param[in,out]  orc_Random   random generator
+
+   \return
+   number of detected errors
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_CheckRandomBuffer(std::mt19937 & orc_Random)
+{
+   uint32 u32_Errors = 0U;
+   const uint32 u32_Capacity = 100U + (orc_Random() % 2000U);
+   const uint32 u32_NumSamples = u32_Capacity + (orc_Random() % (3U * u32_Capacity));
+   C_SyvDaItChartSampleBuffer c_Buffer(u32_Capacity);
+   std::vector<float64> c_RefTimes;
+   std::vector<float64> c_RefValues;
+   std::vector<float64> c_Times;
+   std::vector<float64> c_Values;
+
+   for (uint32 u32_Sample = 0U; u32_Sample < u32_NumSamples; ++u32_Sample)
+   {
+      const float64 f64_Time = static_cast<float64>(u32_Sample) * 0.5;
+      const float64 f64_Value = static_cast<float64>(orc_Random() % 1000U);
+      c_Buffer.Append(f64_Time, f64_Value);
+      c_RefTimes.push_back(f64_Time);
+      c_RefValues.push_back(f64_Value);
+   }
+   //the buffer keeps the newest samples only
+   c_RefTimes.erase(c_RefTimes.begin(), c_RefTimes.end() - c_Buffer.GetSize());
+   c_RefValues.erase(c_RefValues.begin(), c_RefValues.end() - c_Buffer.GetSize());
+
+   {
+      const float64 f64_Span = c_RefTimes.back() - c_RefTimes.front();
+      const float64 f64_Start = c_RefTimes.front() + (f64_Span * static_cast<float64>(orc_Random() % 500U) / 1000.0);
+      const float64 f64_End = f64_Start + ((c_RefTimes.back() - f64_Start) *
+                                           static_cast<float64>(1U + (orc_Random() % 1000U)) / 1000.0);
+      const float64 f64_ColumnWidth = (f64_End - f64_Start) / static_cast<float64>(mu32_NUM_CHECK_COLUMNS);
+      uint32 u32_InRange = 0U;
+
+      c_Buffer.GetDecimatedSamples(f64_Start, f64_End, mu32_NUM_CHECK_COLUMNS, c_Times, c_Values);
+
+      for (uint32 u32_It = 1U; u32_It < c_Times.size(); ++u32_It)
+      {
+         if (c_Times[u32_It] <= c_Times[u32_It - 1U])
+         {
+            u32_Errors++;
+         }
+      }
+      if (c_Times.size() > ((mu32_NUM_CHECK_COLUMNS * 4U) + 2U))
+      {
+         u32_Errors++;
+      }
+
+      for (uint32 u32_Column = 0U; u32_Column < mu32_NUM_CHECK_COLUMNS; ++u32_Column)
+      {
+         const float64 f64_ColumnStart = f64_Start + (static_cast<float64>(u32_Column) * f64_ColumnWidth);
+         const float64 f64_ColumnEnd = (u32_Column == (mu32_NUM_CHECK_COLUMNS - 1U)) ?
+                                       f64_End :
+                                       (f64_Start + (static_cast<float64>(u32_Column + 1U) * f64_ColumnWidth));
+         float64 f64_Min = HUGE_VAL;
+         float64 f64_Max = -HUGE_VAL;
+         bool q_MinFound = false;
+         bool q_MaxFound = false;
+
+         for (uint32 u32_It = 0U; u32_It < c_RefTimes.size(); ++u32_It)
+         {
+            if ((c_RefTimes[u32_It] >= f64_ColumnStart) && (c_RefTimes[u32_It] < f64_ColumnEnd))
+            {
+               f64_Min = (c_RefValues[u32_It] < f64_Min) ? c_RefValues[u32_It] : f64_Min;
+               f64_Max = (c_RefValues[u32_It] > f64_Max) ? c_RefValues[u32_It] : f64_Max;
+               u32_InRange++;
+            }
+         }
+         for (uint32 u32_It = 0U; u32_It < c_Times.size(); ++u32_It)
+         {
+            if ((c_Times[u32_It] >= f64_ColumnStart) && (c_Times[u32_It] < f64_ColumnEnd))
+            {
+               q_MinFound = q_MinFound || (c_Values[u32_It] == f64_Min);
+               q_MaxFound = q_MaxFound || (c_Values[u32_It] == f64_Max);
+            }
+         }
+         if ((f64_Min <= f64_Max) && ((q_MinFound == false) || (q_MaxFound == false)))
+         {
+            u32_Errors++;
+         }
+      }
+
+      //few samples: everything in range plus the border samples
+      if ((u32_InRange <= (mu32_NUM_CHECK_COLUMNS * 4U)) && (c_Times.size() < u32_InRange))
+      {
+         u32_Errors++;
+      }
+   }
+   return u32_Errors;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   std::vector<C_SyvDaItChartSampleBuffer> c_Buffers(mu32_NUM_SERIES);
+   std::mt19937 c_Random(0x43484152U);
+   uint32 u32_Errors = 0U;
+
+   const std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Series = 0U; u32_Series < mu32_NUM_SERIES; ++u32_Series)
+   {
+      for (uint32 u32_Sample = 0U; u32_Sample < mu32_NUM_SAMPLES; ++u32_Sample)
+      {
+         const float64 f64_Time = static_cast<float64>(u32_Sample);
+         c_Buffers[u32_Series].Append(f64_Time, std::sin(f64_Time * 0.001 * static_cast<float64>(u32_Series + 1U)) +
+                                      (static_cast<float64>(u32_Sample % 7U) * 0.01));
+      }
+   }
+   const std::chrono::duration<float64, std::milli> c_Elapsed = std::chrono::steady_clock::now() - c_Start;
+   std::printf("%lu series x %lu samples appended in %.1f ms; %lu samples kept per series\n",
+               static_cast<unsigned long>(mu32_NUM_SERIES), static_cast<unsigned long>(mu32_NUM_SAMPLES),
+               c_Elapsed.count(), static_cast<unsigned long>(c_Buffers[0].GetSize()));
+
+   m_MeasureFrames(c_Buffers, static_cast<float64>(c_Buffers[0].GetSize()), "whole buffer visible");
+   m_MeasureFrames(c_Buffers, 60000.0, "60 s visible");
+
+   for (uint32 u32_Check = 0U; u32_Check < mu32_NUM_CHECKS; ++u32_Check)
+   {
+      u32_Errors += m_CheckRandomBuffer(c_Random);
+   }
+   std::printf("%lu random buffers checked: %lu errors\n", static_cast<unsigned long>(mu32_NUM_CHECKS),
+               static_cast<unsigned long>(u32_Errors));
+
+   return (u32_Errors == 0U) ? 0 : 1;
+}
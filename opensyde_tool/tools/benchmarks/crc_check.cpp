@@ -0,0 +1,254 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of the table driven CRC functions
+
+   Compares C_SCLChecksums::CalcCRC16() and CalcCRC32() with plain bitwise implementations:
+   - standard check values of "123456789"
+     (CRC16 with start 0xFFFF: 0x29B1; CRC32 with start 0xFFFFFFFF and inverted result: 0xCBF43926)
+   - mu32_NUM_RANDOM random buffers with random alignment (offset 0..63), length (0..5000) and start value
+   - the same buffers calculated in two calls split at a random position (continuing with the intermediate result)
+   Then the throughput of both functions is measured:
+   - over a 1 MB buffer (slicing-by-8 main loop)
+   - for many 4 byte inputs (shorter than one 8 byte block, so only the byte loop runs; shows the call overhead)
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "stwtypes.h"
+#include "CSCLChecksums.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_scl;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_RANDOM = 20000U;
+static const uint32 mu32_MAX_OFFSET = 64U;
+static const uint32 mu32_MAX_LENGTH = 5000U;
+static const uint32 mu32_BENCH_SIZE = 0x100000U;
+static const uint32 mu32_BENCH_RUNS = 200U;
+static const uint32 mu32_SMALL_SIZE = 4U;
+static const uint32 mu32_SMALL_RUNS = 20000000U;
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Bitwise CRC16 (CCITT polynomial 0x1021, not reflected)
+
+   \param[in]  opu8_Data       data
+   \param[in]  ou32_NumBytes   number of bytes
+   \param[in]  ou16_Start      start value
+
+   \return
+   CRC
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint16 m_CalcCRC16Reference(const uint8 * const opu8_Data, const uint32 ou32_NumBytes, const uint16 ou16_Start)
+{
+   uint16 u16_Crc = ou16_Start;
+
+   for (uint32 u32_Byte = 0U; u32_Byte < ou32_NumBytes; u32_Byte++)
+   {
+      u16_Crc = static_cast<uint16>(u16_Crc ^ (static_cast<uint16>(opu8_Data[u32_Byte]) << 8));
+      for (uint8 u8_Bit = 0U; u8_Bit < 8U; u8_Bit++)
+      {
+         u16_Crc = ((u16_Crc & 0x8000U) != 0U) ? static_cast<uint16>((u16_Crc << 1) ^ 0x1021U) :
+                   static_cast<uint16>(u16_Crc << 1);
+      }
+   }
+   return u16_Crc;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Bitwise CRC32 (reflected polynomial 0xEDB88320; no final inversion, like CalcCRC32)
+
+   \param[in]  opu8_Data       data
+   \param[in]  ou32_NumBytes   number of bytes
+   \param[in]  ou32_Start      start value
+
+   \return
+   CRC
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_CalcCRC32Reference(const uint8 * const opu8_Data, const uint32 ou32_NumBytes, const uint32 ou32_Start)
+{
+   uint32 u32_Crc = ou32_Start;
+
+   for (uint32 u32_Byte = 0U; u32_Byte < ou32_NumBytes; u32_Byte++)
+   {
+      u32_Crc ^= opu8_Data[u32_Byte];
+      for (uint8 u8_Bit = 0U; u8_Bit < 8U; u8_Bit++)
+      {
+         u32_Crc = ((u32_Crc & 1U) != 0U) ? ((u32_Crc >> 1) ^ 0xEDB88320UL) : (u32_Crc >> 1);
+      }
+   }
+   return u32_Crc & 0xFFFFFFFFUL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check the standard check values
+
+   \return
+   number of errors
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_CheckStandardValues(void)
+{
+   static const uint8 hau8_CHECK_DATA[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+   uint32 u32_Errors = 0U;
+   uint16 u16_Crc = 0xFFFFU;
+   uint32 u32_Crc = 0xFFFFFFFFUL;
+
+   C_SCLChecksums::CalcCRC16(&hau8_CHECK_DATA[0], sizeof(hau8_CHECK_DATA), u16_Crc);
+   C_SCLChecksums::CalcCRC32(&hau8_CHECK_DATA[0], sizeof(hau8_CHECK_DATA), u32_Crc);
+   u32_Crc = (~u32_Crc) & 0xFFFFFFFFUL;
+
+   std::printf("check value CRC16: %04X (expected 29B1); CRC32: %08lX (expected CBF43926)\n",
+               static_cast<uintn>(u16_Crc), static_cast<unsigned long>(u32_Crc));
+   u32_Errors += (u16_Crc == 0x29B1U) ? 0U : 1U;
+   u32_Errors += (u32_Crc == 0xCBF43926UL) ? 0U : 1U;
+   return u32_Errors;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare with the reference implementations for random buffers
+
+   \return
+   number of errors
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_CheckRandom(void)
+{
+   std::mt19937 c_Random(0x43524331U);
+   std::vector<uint8> c_Data(mu32_MAX_OFFSET + mu32_MAX_LENGTH);
+   uint32 u32_Errors = 0U;
+
+   for (uint32 u32_Byte = 0U; u32_Byte < c_Data.size(); u32_Byte++)
+   {
+      c_Data[u32_Byte] = static_cast<uint8>(c_Random());
+   }
+
+   for (uint32 u32_Case = 0U; u32_Case < mu32_NUM_RANDOM; u32_Case++)
+   {
+      const uint32 u32_Offset = c_Random() % mu32_MAX_OFFSET;
+      const uint32 u32_Length = c_Random() % (mu32_MAX_LENGTH + 1U);
+      const uint32 u32_Split = c_Random() % (u32_Length + 1U);
+      const uint16 u16_Start = static_cast<uint16>(c_Random());
+      const uint32 u32_Start = static_cast<uint32>(c_Random()) & 0xFFFFFFFFUL;
+      const uint8 * const pu8_Data = &c_Data[u32_Offset];
+      const uint16 u16_Expected = m_CalcCRC16Reference(pu8_Data, u32_Length, u16_Start);
+      const uint32 u32_Expected = m_CalcCRC32Reference(pu8_Data, u32_Length, u32_Start);
+      uint16 u16_Crc = u16_Start;
+      uint32 u32_Crc = u32_Start;
+
+      //one call
+      C_SCLChecksums::CalcCRC16(pu8_Data, u32_Length, u16_Crc);
+      C_SCLChecksums::CalcCRC32(pu8_Data, u32_Length, u32_Crc);
+      u32_Errors += (u16_Crc == u16_Expected) ? 0U : 1U;
+      u32_Errors += (u32_Crc == u32_Expected) ? 0U : 1U;
+
+      //two calls
+      u16_Crc = u16_Start;
+      u32_Crc = u32_Start;
+      C_SCLChecksums::CalcCRC16(pu8_Data, u32_Split, u16_Crc);
+      C_SCLChecksums::CalcCRC16(pu8_Data + u32_Split, u32_Length - u32_Split, u16_Crc);
+      C_SCLChecksums::CalcCRC32(pu8_Data, u32_Split, u32_Crc);
+      C_SCLChecksums::CalcCRC32(pu8_Data + u32_Split, u32_Length - u32_Split, u32_Crc);
+      u32_Errors += (u16_Crc == u16_Expected) ? 0U : 1U;
+      u32_Errors += (u32_Crc == u32_Expected) ? 0U : 1U;
+   }
+   std::printf("%lu random buffers checked (single and split calls): %lu errors\n",
+               static_cast<unsigned long>(mu32_NUM_RANDOM), static_cast<unsigned long>(u32_Errors));
+   return u32_Errors;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Measure throughput of CalcCRC16 and CalcCRC32
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Measure(void)
+{
+   std::vector<uint8> c_Data(mu32_BENCH_SIZE);
+   uint16 u16_Crc = 0xFFFFU;
+   uint32 u32_Crc = 0xFFFFFFFFUL;
+   const float64 f64_MegaBytes = (static_cast<float64>(mu32_BENCH_SIZE) * static_cast<float64>(mu32_BENCH_RUNS)) /
+                                 (1024.0 * 1024.0);
+
+   for (uint32 u32_Byte = 0U; u32_Byte < c_Data.size(); u32_Byte++)
+   {
+      c_Data[u32_Byte] = static_cast<uint8>(u32_Byte * 7U);
+   }
+
+   std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Run = 0U; u32_Run < mu32_BENCH_RUNS; u32_Run++)
+   {
+      C_SCLChecksums::CalcCRC16(&c_Data[0], mu32_BENCH_SIZE, u16_Crc);
+   }
+   const std::chrono::duration<float64> c_Crc16 = std::chrono::steady_clock::now() - c_Start;
+
+   c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Run = 0U; u32_Run < mu32_BENCH_RUNS; u32_Run++)
+   {
+      C_SCLChecksums::CalcCRC32(&c_Data[0], mu32_BENCH_SIZE, u32_Crc);
+   }
+   const std::chrono::duration<float64> c_Crc32 = std::chrono::steady_clock::now() - c_Start;
+
+   std::printf("CRC16: %.0f MB/s (%04X); CRC32: %.0f MB/s (%08lX)\n", f64_MegaBytes / c_Crc16.count(),
+               static_cast<uintn>(u16_Crc), f64_MegaBytes / c_Crc32.count(), static_cast<unsigned long>(u32_Crc));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Measure time per call of CalcCRC16 and CalcCRC32 for small inputs
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_MeasureSmall(void)
+{
+   uint8 au8_Data[mu32_SMALL_SIZE];
+   uint16 u16_Crc = 0xFFFFU;
+   uint32 u32_Crc = 0xFFFFFFFFUL;
+
+   for (uint32 u32_Byte = 0U; u32_Byte < mu32_SMALL_SIZE; u32_Byte++)
+   {
+      au8_Data[u32_Byte] = static_cast<uint8>(u32_Byte + 1U);
+   }
+
+   std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Run = 0U; u32_Run < mu32_SMALL_RUNS; u32_Run++)
+   {
+      au8_Data[0] = static_cast<uint8>(u32_Run);
+      C_SCLChecksums::CalcCRC16(&au8_Data[0], mu32_SMALL_SIZE, u16_Crc);
+   }
+   const std::chrono::duration<float64, std::nano> c_Crc16 = std::chrono::steady_clock::now() - c_Start;
+
+   c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Run = 0U; u32_Run < mu32_SMALL_RUNS; u32_Run++)
+   {
+      au8_Data[0] = static_cast<uint8>(u32_Run);
+      C_SCLChecksums::CalcCRC32(&au8_Data[0], mu32_SMALL_SIZE, u32_Crc);
+   }
+   const std::chrono::duration<float64, std::nano> c_Crc32 = std::chrono::steady_clock::now() - c_Start;
+
+   std::printf("%lu byte input: CRC16: %.1f ns per call (%04X); CRC32: %.1f ns per call (%08lX)\n",
+               static_cast<unsigned long>(mu32_SMALL_SIZE),
+               c_Crc16.count() / static_cast<float64>(mu32_SMALL_RUNS), static_cast<uintn>(u16_Crc),
+               c_Crc32.count() / static_cast<float64>(mu32_SMALL_RUNS), static_cast<unsigned long>(u32_Crc));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   uint32 u32_Errors = m_CheckStandardValues();
+
+   u32_Errors += m_CheckRandom();
+   m_Measure();
+   m_MeasureSmall();
+   return (u32_Errors == 0U) ? 0 : 1;
+}
@@ -0,0 +1,346 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of loading HEX files into a data dump
+
+   Compares C_HexFile::LoadDataDumpFromFile() with the previous way of getting a data dump:
+   C_HexFile::LoadFromFile() followed by C_HexFile::GetDataDump().
+
+   Files (created in <directory>; mu32_NUM_BLOCKS blocks with mu32_BLOCK_SIZE random bytes each):
+   - Intel HEX with 32 byte records (created by C_HexFile::CreateHexFile and SaveToFile)
+   - Motorola S-Record with 32 byte S3 records
+   - the Intel HEX file without EOF record
+   - the Intel HEX file with a wrong checksum in one line
+   Check: both ways return the same result and the same data dump for all files.
+   Benchmark: min and mean time of mu32_NUM_RUNS runs each for the two valid files.
+
+   Usage: hex_load_benchmark <directory>
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "stwtypes.h"
+#include "CHexFile.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_hex_file;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_BLOCKS = 4U;
+static const uint32 mu32_BLOCK_SIZE = 2U * 1024U * 1024U;
+static const uint32 mu32_RECORD_SIZE = 32U;
+static const uint32 mu32_NUM_RUNS = 5U;
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create data dump with random data
+
+   The blocks are not contiguous and the last one is above 16 bit segment and 24 bit S-Record addresses.
+
+   \param[out]  orc_Dump   created data dump
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CreateDump(C_HexDataDump & orc_Dump)
+{
+   std::mt19937 c_Random(0x48455846U);
+
+   orc_Dump.at_Blocks.SetLength(static_cast<sint32>(mu32_NUM_BLOCKS));
+   for (uint32 u32_Block = 0U; u32_Block < mu32_NUM_BLOCKS; u32_Block++)
+   {
+      C_HexDataDumpBlock & rc_Block = orc_Dump.at_Blocks[static_cast<sint32>(u32_Block)];
+      rc_Block.u32_AddressOffset = (u32_Block == (mu32_NUM_BLOCKS - 1U)) ? 0x80000000UL :
+                                   (u32_Block * (mu32_BLOCK_SIZE + 0x10000UL));
+      rc_Block.au8_Data.SetLength(static_cast<sint32>(mu32_BLOCK_SIZE));
+      for (uint32 u32_Byte = 0U; u32_Byte < mu32_BLOCK_SIZE; u32_Byte++)
+      {
+         rc_Block.au8_Data[static_cast<sint32>(u32_Byte)] = static_cast<uint8>(c_Random());
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write data dump as Motorola S-Record file with S3 records
+
+   \param[in]  orc_Dump       data dump
+   \param[in]  orc_FileName   file name
+
+   \return
+   true    file written
+   false   could not write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_WriteSRecordFile(const C_HexDataDump & orc_Dump, const std::string & orc_FileName)
+{
+   std::FILE * const pt_File = std::fopen(orc_FileName.c_str(), "wb");
+   bool q_Return = false;
+
+   if (pt_File != NULL)
+   {
+      (void)std::fprintf(pt_File, "S00600004844521B\n");
+      for (sint32 s32_Block = 0; s32_Block < orc_Dump.at_Blocks.GetLength(); s32_Block++)
+      {
+         const C_HexDataDumpBlock & rc_Block = orc_Dump.at_Blocks[s32_Block];
+         const uint32 u32_Size = static_cast<uint32>(rc_Block.au8_Data.GetLength());
+
+         for (uint32 u32_Offset = 0U; u32_Offset < u32_Size; u32_Offset += mu32_RECORD_SIZE)
+         {
+            const uint32 u32_Address = rc_Block.u32_AddressOffset + u32_Offset;
+            const uint32 u32_NumBytes = ((u32_Size - u32_Offset) < mu32_RECORD_SIZE) ? (u32_Size - u32_Offset) :
+                                        mu32_RECORD_SIZE;
+            const uint32 u32_Count = u32_NumBytes + 5U; //address, data, checksum
+            uint32 u32_Sum = u32_Count + (u32_Address >> 24U) + ((u32_Address >> 16U) & 0xFFU) +
+                             ((u32_Address >> 8U) & 0xFFU) + (u32_Address & 0xFFU);
+
+            (void)std::fprintf(pt_File, "S3%02X%08lX", static_cast<uintn>(u32_Count),
+                               static_cast<unsigned long>(u32_Address));
+            for (uint32 u32_Byte = 0U; u32_Byte < u32_NumBytes; u32_Byte++)
+            {
+               const uint8 u8_Value = rc_Block.au8_Data[static_cast<sint32>(u32_Offset + u32_Byte)];
+               (void)std::fprintf(pt_File, "%02X", static_cast<uintn>(u8_Value));
+               u32_Sum += u8_Value;
+            }
+            (void)std::fprintf(pt_File, "%02X\n", static_cast<uintn>((~u32_Sum) & 0xFFU));
+         }
+      }
+      (void)std::fprintf(pt_File, "S70500000000FA\n");
+      q_Return = (std::fclose(pt_File) == 0);
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write a changed copy of a text file
+
+   \param[in]  orc_Source        source file name
+   \param[in]  orc_Target        target file name
+   \param[in]  oq_RemoveLastLine true: remove the last line; false: change the checksum of the line in the middle
+
+   \return
+   true    file written
+   false   could not read or write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_WriteChangedCopy(const std::string & orc_Source, const std::string & orc_Target,
+                               const bool oq_RemoveLastLine)
+{
+   std::vector<std::string> c_Lines;
+   bool q_Return = false;
+   std::FILE * pt_File = std::fopen(orc_Source.c_str(), "rb");
+
+   if (pt_File != NULL)
+   {
+      charn acn_Line[600];
+      while (std::fgets(&acn_Line[0], static_cast<sintn>(sizeof(acn_Line)), pt_File) != NULL)
+      {
+         c_Lines.push_back(&acn_Line[0]);
+      }
+      (void)std::fclose(pt_File);
+   }
+   if (c_Lines.size() > 2U)
+   {
+      if (oq_RemoveLastLine == true)
+      {
+         c_Lines.pop_back();
+      }
+      else
+      {
+         std::string & rc_Line = c_Lines[c_Lines.size() / 2U];
+         //last character before the line end is part of the checksum
+         const uint32 u32_Position = static_cast<uint32>(rc_Line.find_last_not_of("\r\n"));
+         rc_Line[u32_Position] = (rc_Line[u32_Position] == '0') ? '1' : '0';
+      }
+      pt_File = std::fopen(orc_Target.c_str(), "wb");
+      if (pt_File != NULL)
+      {
+         for (uint32 u32_Line = 0U; u32_Line < c_Lines.size(); u32_Line++)
+         {
+            (void)std::fputs(c_Lines[u32_Line].c_str(), pt_File);
+         }
+         q_Return = (std::fclose(pt_File) == 0);
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare two data dumps
+
+   \param[in]  orc_Dump1   first data dump
+   \param[in]  orc_Dump2   second data dump
+
+   \return
+   true    same blocks with same data
+   false   different
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_CompareDumps(const C_HexDataDump & orc_Dump1, const C_HexDataDump & orc_Dump2)
+{
+   bool q_Return = (orc_Dump1.at_Blocks.GetLength() == orc_Dump2.at_Blocks.GetLength());
+
+   for (sint32 s32_Block = 0; (s32_Block < orc_Dump1.at_Blocks.GetLength()) && (q_Return == true); s32_Block++)
+   {
+      const C_HexDataDumpBlock & rc_Block1 = orc_Dump1.at_Blocks[s32_Block];
+      const C_HexDataDumpBlock & rc_Block2 = orc_Dump2.at_Blocks[s32_Block];
+
+      q_Return = (rc_Block1.u32_AddressOffset == rc_Block2.u32_AddressOffset) &&
+                 (rc_Block1.au8_Data.GetLength() == rc_Block2.au8_Data.GetLength()) &&
+                 ((rc_Block1.au8_Data.GetLength() == 0) ||
+                  (std::memcmp(&rc_Block1.au8_Data[0], &rc_Block2.au8_Data[0],
+                               static_cast<uintn>(rc_Block1.au8_Data.GetLength())) == 0));
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load file both ways and compare the results
+
+   \param[in]  orc_FileName   file name
+   \param[in]  ou32_Expected  expected result (only the error class is compared, not the line number)
+
+   \return
+   number of errors
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_Check(const std::string & orc_FileName, const uint32 ou32_Expected)
+{
+   C_HexFile c_Lines;
+   C_HexFile c_Direct;
+   uint32 u32_DumpResult = NO_ERR;
+   uint32 u32_LinesResult = c_Lines.LoadFromFile(orc_FileName.c_str());
+   const uint32 u32_DirectResult = c_Direct.LoadDataDumpFromFile(orc_FileName.c_str());
+   bool q_Ok;
+
+   if ((u32_LinesResult & ERR_MASK) < ERR_HEXLINE_SYNTAX)
+   {
+      const C_HexDataDump * const pc_LinesDump = c_Lines.GetDataDump(u32_DumpResult);
+      uint32 u32_Unused;
+      const C_HexDataDump * const pc_DirectDump = c_Direct.GetDataDump(u32_Unused);
+
+      //LoadDataDumpFromFile reports dump problems directly
+      u32_LinesResult = (u32_DumpResult != NO_ERR) ? u32_DumpResult : u32_LinesResult;
+      q_Ok = (pc_LinesDump != NULL) && (pc_DirectDump != NULL) && (m_CompareDumps(*pc_LinesDump, *pc_DirectDump));
+   }
+   else
+   {
+      q_Ok = true;
+   }
+   q_Ok = q_Ok && (u32_LinesResult == u32_DirectResult) && ((u32_DirectResult & ERR_MASK) == ou32_Expected);
+
+   std::printf("%s: LoadFromFile + GetDataDump %08lX, LoadDataDumpFromFile %08lX: %s\n", orc_FileName.c_str(),
+               static_cast<unsigned long>(u32_LinesResult), static_cast<unsigned long>(u32_DirectResult),
+               (q_Ok == true) ? "ok" : "FAILED");
+   return (q_Ok == true) ? 0U : 1U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Measure both ways of loading a file
+
+   \param[in]  orc_FileName   file name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Measure(const std::string & orc_FileName)
+{
+   float64 af64_MinMs[2] = {0.0, 0.0};
+   float64 af64_SumMs[2] = {0.0, 0.0};
+
+   for (uint32 u32_Run = 0U; u32_Run < mu32_NUM_RUNS; u32_Run++)
+   {
+      for (uint32 u32_Way = 0U; u32_Way < 2U; u32_Way++)
+      {
+         C_HexFile c_HexFile;
+         uint32 u32_Result;
+
+         const std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+         if (u32_Way == 0U)
+         {
+            (void)c_HexFile.LoadFromFile(orc_FileName.c_str());
+            (void)c_HexFile.GetDataDump(u32_Result);
+         }
+         else
+         {
+            (void)c_HexFile.LoadDataDumpFromFile(orc_FileName.c_str());
+         }
+         const std::chrono::duration<float64, std::milli> c_Elapsed = std::chrono::steady_clock::now() - c_Start;
+
+         af64_MinMs[u32_Way] = ((u32_Run == 0U) || (c_Elapsed.count() < af64_MinMs[u32_Way])) ?
+                               c_Elapsed.count() : af64_MinMs[u32_Way];
+         af64_SumMs[u32_Way] += c_Elapsed.count();
+      }
+   }
+   std::printf("%s:\n  LoadFromFile + GetDataDump: min %.1f ms, mean %.1f ms\n"
+               "  LoadDataDumpFromFile:       min %.1f ms, mean %.1f ms\n", orc_FileName.c_str(),
+               af64_MinMs[0], af64_SumMs[0] / static_cast<float64>(mu32_NUM_RUNS),
+               af64_MinMs[1], af64_SumMs[1] / static_cast<float64>(mu32_NUM_RUNS));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(const sintn osn_Argc, const charn * const * const oppcn_Argv)
+{
+   sintn sn_Return = 1;
+
+   if (osn_Argc != 2)
+   {
+      std::printf("usage: hex_load_benchmark <directory>\n");
+   }
+   else
+   {
+      const std::string c_Directory = oppcn_Argv[1];
+      const std::string c_IntelHex = c_Directory + "/benchmark.hex";
+      const std::string c_SRecord = c_Directory + "/benchmark.s37";
+      const std::string c_NoEof = c_Directory + "/benchmark_no_eof.hex";
+      const std::string c_Checksum = c_Directory + "/benchmark_checksum.hex";
+      C_HexDataDump c_Dump;
+      C_HexFile c_Writer;
+      bool q_Created;
+
+      m_CreateDump(c_Dump);
+      q_Created = (c_Writer.CreateHexFile(c_Dump, mu32_RECORD_SIZE) == NO_ERR) &&
+                  (c_Writer.SaveToFile(c_IntelHex.c_str()) == NO_ERR) &&
+                  (m_WriteSRecordFile(c_Dump, c_SRecord) == true) &&
+                  (m_WriteChangedCopy(c_IntelHex, c_NoEof, true) == true) &&
+                  (m_WriteChangedCopy(c_IntelHex, c_Checksum, false) == true);
+
+      if (q_Created == false)
+      {
+         std::printf("could not create files in %s\n", c_Directory.c_str());
+      }
+      else
+      {
+         uint32 u32_Errors = 0U;
+         C_HexFile c_Reference;
+         uint32 u32_Result;
+
+         //the direct way has to return the data the files were created from
+         (void)c_Reference.LoadDataDumpFromFile(c_SRecord.c_str());
+         const C_HexDataDump * const pc_Dump = c_Reference.GetDataDump(u32_Result);
+         if ((pc_Dump == NULL) || (m_CompareDumps(*pc_Dump, c_Dump) == false))
+         {
+            std::printf("S-Record file: data dump differs from the written data\n");
+            u32_Errors++;
+         }
+
+         u32_Errors += m_Check(c_IntelHex, NO_ERR);
+         u32_Errors += m_Check(c_SRecord, NO_ERR);
+         u32_Errors += m_Check(c_NoEof, WRN_NO_EOF_RECORD);
+         u32_Errors += m_Check(c_Checksum, ERR_HEXLINE_CHECKSUM);
+
+         m_Measure(c_IntelHex);
+         m_Measure(c_SRecord);
+
+         std::printf("%lu errors\n", static_cast<unsigned long>(u32_Errors));
+         sn_Return = (u32_Errors == 0U) ? 0 : 1;
+      }
+   }
+   return sn_Return;
+}
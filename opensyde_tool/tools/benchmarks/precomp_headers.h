@@ -0,0 +1,22 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled header of the benchmarks (header)
+
+   Used by the Core and GUI logic sources built into the benchmarks (see CMakeLists.txt).
+   Contains the headers the application projects provide through their precompiled headers.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef PRECOMP_HEADERS_BENCHMARKS_H
+#define PRECOMP_HEADERS_BENCHMARKS_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+
+#if defined __cplusplus
+#include <cstdio>
+#include <cstring>
+#endif
+
+#endif
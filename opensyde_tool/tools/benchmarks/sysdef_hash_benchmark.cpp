@@ -0,0 +1,201 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       System definition hash benchmark
+
+   Compares the full C_OSCSystemDefinition::CalcHash() with the per-node hash cache of
+   C_PuiSdHandlerData::CalcHashSystemDefinition(). C_PuiSdHandlerData needs Qt, so C_NodeHashCache below mirrors its
+   caching (m_UpdateNodeHashes, m_SetNodeHashChanged) for the core part of the system definition.
+
+   Measured (mu32_NUM_RUNS runs each):
+   - full CalcHash
+   - cached hash, nothing changed
+   - cached hash after changing one node and marking it as changed
+   After each change the cached hash has to differ from the previous one and has to be equal to the hash of a
+   new cache (all nodes hashed again).
+
+   Usage: sysdef_hash_benchmark <directory>
+   The system definition in <directory> can be created with "sysdef_load_benchmark gen <directory>".
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <chrono>
+#include <vector>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "CSCLString.h"
+#include "CSCLChecksums.h"
+#include "C_OSCSystemDefinitionFiler.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_RUNS = 20U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///per-node hash cache as used by C_PuiSdHandlerData (core part only)
+class C_NodeHashCache
+{
+public:
+   uint32 CalcHash(const C_OSCSystemDefinition & orc_SystemDefinition);
+   void SetNodeHashChanged(const uint32 ou32_NodeIndex);
+
+private:
+   std::vector<bool> mc_NodeHashesValid;
+   std::vector<uint32> mc_NodeHashes;
+};
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Calculate hash of system definition using cached node hashes
+
+   \param[in]  orc_SystemDefinition   system definition
+
+   \return
+   hash value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_NodeHashCache::CalcHash(const C_OSCSystemDefinition & orc_SystemDefinition)
+{
+   uint32 u32_Hash = 0xFFFFFFFFU;
+
+   if (this->mc_NodeHashesValid.size() != orc_SystemDefinition.c_Nodes.size())
+   {
+      this->mc_NodeHashesValid.resize(orc_SystemDefinition.c_Nodes.size(), false);
+      this->mc_NodeHashes.resize(orc_SystemDefinition.c_Nodes.size(), 0xFFFFFFFFU);
+   }
+   for (uint32 u32_Node = 0U; u32_Node < orc_SystemDefinition.c_Nodes.size(); ++u32_Node)
+   {
+      if (this->mc_NodeHashesValid[u32_Node] == false)
+      {
+         uint32 u32_NodeHash = 0xFFFFFFFFU;
+         orc_SystemDefinition.c_Nodes[u32_Node].CalcHash(u32_NodeHash);
+         this->mc_NodeHashes[u32_Node] = u32_NodeHash;
+         this->mc_NodeHashesValid[u32_Node] = true;
+      }
+      C_SCLChecksums::CalcCRC32(&this->mc_NodeHashes[u32_Node], sizeof(this->mc_NodeHashes[u32_Node]), u32_Hash);
+   }
+   for (uint32 u32_Bus = 0U; u32_Bus < orc_SystemDefinition.c_Buses.size(); ++u32_Bus)
+   {
+      orc_SystemDefinition.c_Buses[u32_Bus].CalcHash(u32_Hash);
+   }
+   return u32_Hash;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Mark cached hash of node as outdated
+
+   \param[in]  ou32_NodeIndex   node index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_NodeHashCache::SetNodeHashChanged(const uint32 ou32_NodeIndex)
+{
+   if (ou32_NodeIndex < this->mc_NodeHashesValid.size())
+   {
+      this->mc_NodeHashesValid[ou32_NodeIndex] = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get milliseconds since start time per run
+
+   \param[in]  orc_Start   start time
+
+   \return
+   ms per run
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static float64 m_GetMsPerRun(const std::chrono::steady_clock::time_point & orc_Start)
+{
+   const std::chrono::duration<float64, std::milli> c_Elapsed = std::chrono::steady_clock::now() - orc_Start;
+
+   return c_Elapsed.count() / static_cast<float64>(mu32_NUM_RUNS);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(const sintn osn_Argc, const charn * const * const oppcn_Argv)
+{
+   sintn sn_Return = 1;
+
+   if (osn_Argc != 2)
+   {
+      std::printf("usage: sysdef_hash_benchmark <directory>\n");
+   }
+   else
+   {
+      C_OSCSystemDefinition c_SystemDefinition;
+      const sint32 s32_Result = C_OSCSystemDefinitionFiler::h_LoadSystemDefinitionFile(
+         c_SystemDefinition, C_SCLString(oppcn_Argv[1]) + "/sysdef.syde_sysdef", "", false);
+
+      if ((s32_Result != C_NO_ERR) || (c_SystemDefinition.c_Nodes.empty() == true))
+      {
+         std::printf("could not load system definition (result %ld)\n", static_cast<long>(s32_Result));
+      }
+      else
+      {
+         C_NodeHashCache c_Cache;
+         uint32 u32_Hash = 0U;
+         uint32 u32_Detected = 0U;
+         uint32 u32_Consistent = 0U;
+
+         std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+         for (uint32 u32_Run = 0U; u32_Run < mu32_NUM_RUNS; ++u32_Run)
+         {
+            u32_Hash = 0xFFFFFFFFU;
+            c_SystemDefinition.CalcHash(u32_Hash);
+         }
+         std::printf("%lu nodes; full CalcHash: %.2f ms\n",
+                     static_cast<unsigned long>(c_SystemDefinition.c_Nodes.size()), m_GetMsPerRun(c_Start));
+
+         const uint32 u32_Reference = c_Cache.CalcHash(c_SystemDefinition);
+         uint32 u32_Unchanged = 0U;
+         c_Start = std::chrono::steady_clock::now();
+         for (uint32 u32_Run = 0U; u32_Run < mu32_NUM_RUNS; ++u32_Run)
+         {
+            u32_Unchanged += (c_Cache.CalcHash(c_SystemDefinition) == u32_Reference) ? 1U : 0U;
+         }
+         std::printf("cached, nothing changed: %.4f ms (same hash %lu/%lu)\n", m_GetMsPerRun(c_Start),
+                     static_cast<unsigned long>(u32_Unchanged), static_cast<unsigned long>(mu32_NUM_RUNS));
+
+         //the verification with a new cache is not part of the measured time
+         u32_Hash = u32_Reference;
+         std::chrono::duration<float64, std::milli> c_Measured(0.0);
+         for (uint32 u32_Run = 0U; u32_Run < mu32_NUM_RUNS; ++u32_Run)
+         {
+            const uint32 u32_Node = u32_Run % c_SystemDefinition.c_Nodes.size();
+            const uint32 u32_Previous = u32_Hash;
+            C_NodeHashCache c_NewCache;
+
+            c_SystemDefinition.c_Nodes[u32_Node].c_Properties.c_Comment += "x";
+            c_Start = std::chrono::steady_clock::now();
+            c_Cache.SetNodeHashChanged(u32_Node);
+            u32_Hash = c_Cache.CalcHash(c_SystemDefinition);
+            c_Measured += std::chrono::steady_clock::now() - c_Start;
+
+            u32_Detected += (u32_Hash != u32_Previous) ? 1U : 0U;
+            u32_Consistent += (u32_Hash == c_NewCache.CalcHash(c_SystemDefinition)) ? 1U : 0U;
+         }
+         std::printf("cached, one node changed: %.3f ms (detected %lu/%lu, equal to new cache %lu/%lu)\n",
+                     c_Measured.count() / static_cast<float64>(mu32_NUM_RUNS),
+                     static_cast<unsigned long>(u32_Detected), static_cast<unsigned long>(mu32_NUM_RUNS),
+                     static_cast<unsigned long>(u32_Consistent), static_cast<unsigned long>(mu32_NUM_RUNS));
+
+         if ((u32_Unchanged == mu32_NUM_RUNS) && (u32_Detected == mu32_NUM_RUNS) &&
+             (u32_Consistent == mu32_NUM_RUNS))
+         {
+            sn_Return = 0;
+         }
+      }
+   }
+   return sn_Return;
+}
@@ -0,0 +1,185 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       System definition load benchmark
+
+   Measures how long C_OSCSystemDefinitionFiler::h_LoadSystemDefinitionFile() takes for a large system definition.
+   The node files are loaded in parallel, so the hash of the loaded data is compared over all runs to check the
+   result does not depend on the order the workers finish in.
+
+   Usage:
+   sysdef_load_benchmark gen <directory>   create a system definition with mu32_NUM_NODES nodes in <directory>
+   sysdef_load_benchmark <directory>       load it mu32_NUM_RUNS times and report the time
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <chrono>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "CSCLString.h"
+#include "C_OSCSystemDefinitionFiler.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_NODES = 60U;
+static const uint32 mu32_NUM_DATAPOOLS = 4U;
+static const uint32 mu32_NUM_LISTS = 4U;
+static const uint32 mu32_NUM_ELEMENTS = 150U;
+static const uint32 mu32_NUM_RUNS = 5U;
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get path of system definition file in directory
+
+   \param[in]  orc_Directory   directory
+
+   \return
+   path of system definition file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SCLString m_GetFilePath(const C_SCLString & orc_Directory)
+{
+   return orc_Directory + "/sysdef.syde_sysdef";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create a system definition with many nodes, datapools and elements
+
+   \param[in]  orc_Directory   target directory
+
+   \return
+   result of h_SaveSystemDefinitionFile
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static sint32 m_Generate(const C_SCLString & orc_Directory)
+{
+   C_OSCSystemDefinition c_SystemDefinition;
+
+   for (uint32 u32_Node = 0U; u32_Node < mu32_NUM_NODES; u32_Node++)
+   {
+      C_OSCNode c_Node;
+      c_Node.c_DeviceType = "ESX3CM";
+      c_Node.c_Properties.c_Name = "Node" + C_SCLString::IntToStr(u32_Node);
+      for (uint32 u32_DataPool = 0U; u32_DataPool < mu32_NUM_DATAPOOLS; u32_DataPool++)
+      {
+         C_OSCNodeDataPool c_DataPool;
+         c_DataPool.e_Type = ((u32_DataPool % 2U) == 1U) ? C_OSCNodeDataPool::eNVM : C_OSCNodeDataPool::eDIAG;
+         c_DataPool.c_Name = "DataPool" + C_SCLString::IntToStr(u32_DataPool);
+         for (uint32 u32_List = 0U; u32_List < mu32_NUM_LISTS; u32_List++)
+         {
+            C_OSCNodeDataPoolList c_List;
+            c_List.c_Name = "List" + C_SCLString::IntToStr(u32_List);
+            for (uint32 u32_Element = 0U; u32_Element < mu32_NUM_ELEMENTS; u32_Element++)
+            {
+               C_OSCNodeDataPoolListElement c_Element;
+               c_Element.c_Name = "Element" + C_SCLString::IntToStr(u32_Element);
+               c_Element.c_Comment = "Comment for element number " + C_SCLString::IntToStr(u32_Element);
+               c_Element.c_Value.SetType(C_OSCNodeDataPoolContent::eUINT32);
+               c_Element.c_Value.SetValueU32(u32_Element);
+               c_Element.c_MinValue.SetType(C_OSCNodeDataPoolContent::eUINT32);
+               c_Element.c_MaxValue.SetType(C_OSCNodeDataPoolContent::eUINT32);
+               c_Element.c_MaxValue.SetValueU32(1000U);
+               c_Element.c_NvmValue = c_Element.c_Value;
+               c_List.c_Elements.push_back(c_Element);
+            }
+            c_DataPool.c_Lists.push_back(c_List);
+         }
+         c_Node.c_DataPools.push_back(c_DataPool);
+      }
+      c_SystemDefinition.c_Nodes.push_back(c_Node);
+   }
+   return C_OSCSystemDefinitionFiler::h_SaveSystemDefinitionFile(c_SystemDefinition, m_GetFilePath(orc_Directory));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load the system definition several times and report the time
+
+   \param[in]  orc_Directory   directory containing the system definition
+
+   \return
+   C_NO_ERR   all runs loaded the same data
+   C_CONFIG   loading failed
+   C_CHECKSUM hash differs between runs
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static sint32 m_Load(const C_SCLString & orc_Directory)
+{
+   sint32 s32_Return = C_NO_ERR;
+   uint32 u32_FirstHash = 0U;
+   float64 f64_MinMs = 0.0;
+   float64 f64_SumMs = 0.0;
+
+   for (uint32 u32_Run = 0U; (u32_Run < mu32_NUM_RUNS) && (s32_Return == C_NO_ERR); u32_Run++)
+   {
+      C_OSCSystemDefinition c_SystemDefinition;
+      uint32 u32_Hash = 0xFFFFFFFFUL;
+
+      const std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+      const sint32 s32_Result = C_OSCSystemDefinitionFiler::h_LoadSystemDefinitionFile(
+         c_SystemDefinition, m_GetFilePath(orc_Directory), "", false);
+      const std::chrono::duration<float64, std::milli> c_Elapsed = std::chrono::steady_clock::now() - c_Start;
+
+      c_SystemDefinition.CalcHash(u32_Hash);
+      std::printf("run %lu: result %ld, %lu nodes, %.1f ms, hash %08lx\n", static_cast<unsigned long>(u32_Run),
+                  static_cast<long>(s32_Result), static_cast<unsigned long>(c_SystemDefinition.c_Nodes.size()),
+                  c_Elapsed.count(), static_cast<unsigned long>(u32_Hash));
+      if (s32_Result != C_NO_ERR)
+      {
+         s32_Return = C_CONFIG;
+      }
+      else if (u32_Run == 0U)
+      {
+         u32_FirstHash = u32_Hash;
+         f64_MinMs = c_Elapsed.count();
+      }
+      else if (u32_Hash != u32_FirstHash)
+      {
+         std::printf("hash differs from first run\n");
+         s32_Return = C_CHECKSUM;
+      }
+      else
+      {
+         f64_MinMs = (c_Elapsed.count() < f64_MinMs) ? c_Elapsed.count() : f64_MinMs;
+      }
+      f64_SumMs += c_Elapsed.count();
+   }
+   if (s32_Return == C_NO_ERR)
+   {
+      std::printf("min %.1f ms, mean %.1f ms\n", f64_MinMs, f64_SumMs / static_cast<float64>(mu32_NUM_RUNS));
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(const sintn osn_Argc, const charn * const * const oppcn_Argv)
+{
+   sintn sn_Return = 0;
+
+   if ((osn_Argc == 3) && (C_SCLString(oppcn_Argv[1]) == "gen"))
+   {
+      const sint32 s32_Result = m_Generate(oppcn_Argv[2]);
+      std::printf("save: result %ld\n", static_cast<long>(s32_Result));
+      sn_Return = (s32_Result == C_NO_ERR) ? 0 : 1;
+   }
+   else if (osn_Argc == 2)
+   {
+      sn_Return = (m_Load(oppcn_Argv[1]) == C_NO_ERR) ? 0 : 1;
+   }
+   else
+   {
+      std::printf("usage: sysdef_load_benchmark [gen] <directory>\n");
+      sn_Return = 1;
+   }
+   return sn_Return;
+}
@@ -0,0 +1,236 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of integer XML attribute parsing
+
+   Compares the integer attribute getters of C_OSCXMLParserBase with the C_SCLString based conversion they replaced
+   (GetAttributeString() followed by ToInt() / ToInt64() in a try/catch block):
+   - a list of edge cases (empty text, sign, hex prefix, range overflow, invalid characters)
+   - mu32_NUM_RANDOM random values in decimal and "0x" notation
+   GetAttributeUint64() is compared with the ToInt64() result cast to uint64.
+
+   Intended difference: decimal text containing 'A'/'a' gives 0 with the getters; ToInt() accepted it as digit 10.
+   Those cases are marked with "ex" and do not count as mismatches.
+
+   Finally both ways of reading a sint32 attribute are timed (mu32_NUM_TIMED_READS reads each).
+   The effect on loading a complete system definition can be measured with sysdef_load_benchmark.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <chrono>
+#include <random>
+
+#include "stwtypes.h"
+#include "CSCLString.h"
+#include "C_OSCXMLParser.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_scl;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_NUM_RANDOM = 100000U;
+static const uint32 mu32_NUM_TIMED_READS = 1000000U;
+
+static const charn * const mapcn_EDGE_CASES[] =
+{
+   "0", "1", "-1", "007", "123456", "2147483647", "2147483648", "-2147483648", "4294967295", "4294967296",
+   "9223372036854775807", "-9223372036854775808", "18446744073709551615",
+   "0x10", "0XfF", "-0x10", "0xFFFFFFFF", "0x7FFFFFFFFFFFFFFF", "0xFFFFFFFFFFFFFFFF",
+   "", "-", "0x", "-0x", " 1", "1 ", "+1", "0x0g", "12b", "1.5",
+   "A", "a", "12a", "1A0"
+};
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///results of the integer getters for one attribute value
+class C_Values
+{
+public:
+   sint32 s32_Value;
+   uintn un_Value;
+   sint64 s64_Value;
+   uint64 u64_Value;
+
+   bool operator ==(const C_Values & orc_Other) const
+   {
+      return (s32_Value == orc_Other.s32_Value) && (un_Value == orc_Other.un_Value) &&
+             (s64_Value == orc_Other.s64_Value) && (u64_Value == orc_Other.u64_Value);
+   }
+};
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get integer of attribute as done before the getters parsed the text themselves
+
+   \param[in]  orc_Parser   parser with selected node
+   \param[in]  oq_64Bit     true: use ToInt64(); false: use ToInt()
+
+   \return
+   value; zero on empty or invalid text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static sint64 m_GetReference(const C_OSCXMLParserBase & orc_Parser, const bool oq_64Bit)
+{
+   sint64 s64_Value = 0;
+   const C_SCLString c_Text = orc_Parser.GetAttributeString("value");
+
+   if (c_Text != "")
+   {
+      try
+      {
+         s64_Value = (oq_64Bit == true) ? c_Text.ToInt64() : static_cast<sint64>(static_cast<sintn>(c_Text.ToInt()));
+      }
+      catch (...)
+      {
+      }
+   }
+   return s64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether text is decimal and contains an 'A' digit
+
+   \param[in]  orc_Text   attribute text
+
+   \return
+   true   text is affected by the intended difference
+   false  text must give the same results
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_IsExpectedDifference(const C_SCLString & orc_Text)
+{
+   const bool q_Hex = (orc_Text.Pos("0x") != 0U) || (orc_Text.Pos("0X") != 0U);
+
+   return (q_Hex == false) && ((orc_Text.Pos("A") != 0U) || (orc_Text.Pos("a") != 0U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare getters and reference for one attribute text
+
+   \param[in]      orc_Text          attribute text
+   \param[in]      oq_Print          true: print result line
+   \param[in,out]  oru32_Mismatches  incremented on unexpected difference
+   \param[in,out]  oru32_Expected    incremented on intended difference
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const C_SCLString & orc_Text, const bool oq_Print, uint32 & oru32_Mismatches,
+                    uint32 & oru32_Expected)
+{
+   C_OSCXMLParserString c_Parser;
+   C_Values c_New;
+   C_Values c_Old;
+   const charn * pcn_Marker = "  ";
+
+   (void)c_Parser.LoadFromString("<node value=\"" + orc_Text + "\"/>");
+   (void)c_Parser.SelectRoot();
+
+   c_New.s32_Value = c_Parser.GetAttributeSint32("value");
+   c_New.un_Value = static_cast<uintn>(c_Parser.GetAttributeUint32("value"));
+   c_New.s64_Value = c_Parser.GetAttributeSint64("value");
+   c_New.u64_Value = c_Parser.GetAttributeUint64("value");
+
+   c_Old.s32_Value = static_cast<sint32>(m_GetReference(c_Parser, false));
+   c_Old.un_Value = static_cast<uintn>(m_GetReference(c_Parser, false));
+   c_Old.s64_Value = m_GetReference(c_Parser, true);
+   c_Old.u64_Value = static_cast<uint64>(c_Old.s64_Value);
+
+   if ((c_New == c_Old) == false)
+   {
+      if (m_IsExpectedDifference(orc_Text) == true)
+      {
+         oru32_Expected++;
+         pcn_Marker = "ex";
+      }
+      else
+      {
+         oru32_Mismatches++;
+         pcn_Marker = "!!";
+      }
+   }
+   if ((oq_Print == true) || (pcn_Marker[0] == '!'))
+   {
+      std::printf("%s %-22s new %ld / %lu / %lld / %llu   old %ld / %lu / %lld / %llu\n", pcn_Marker,
+                  ("\"" + orc_Text + "\"").c_str(),
+                  static_cast<long>(c_New.s32_Value), static_cast<unsigned long>(c_New.un_Value),
+                  static_cast<long long>(c_New.s64_Value), static_cast<unsigned long long>(c_New.u64_Value),
+                  static_cast<long>(c_Old.s32_Value), static_cast<unsigned long>(c_Old.un_Value),
+                  static_cast<long long>(c_Old.s64_Value), static_cast<unsigned long long>(c_Old.u64_Value));
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Time reading a sint32 attribute with the getter and with the reference conversion
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Measure(void)
+{
+   C_OSCXMLParserString c_Parser;
+   sint64 s64_Sum = 0;
+
+   (void)c_Parser.LoadFromString("<node value=\"123456\"/>");
+   (void)c_Parser.SelectRoot();
+
+   std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Read = 0U; u32_Read < mu32_NUM_TIMED_READS; u32_Read++)
+   {
+      s64_Sum += c_Parser.GetAttributeSint32("value");
+   }
+   const std::chrono::duration<float64, std::milli> c_New = std::chrono::steady_clock::now() - c_Start;
+
+   c_Start = std::chrono::steady_clock::now();
+   for (uint32 u32_Read = 0U; u32_Read < mu32_NUM_TIMED_READS; u32_Read++)
+   {
+      s64_Sum -= m_GetReference(c_Parser, false);
+   }
+   const std::chrono::duration<float64, std::milli> c_Old = std::chrono::steady_clock::now() - c_Start;
+
+   std::printf("%lu reads: GetAttributeSint32 %.1f ms, GetAttributeString + ToInt %.1f ms (checksum %lld)\n",
+               static_cast<unsigned long>(mu32_NUM_TIMED_READS), c_New.count(), c_Old.count(),
+               static_cast<long long>(s64_Sum));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   uint32 u32_Mismatches = 0U;
+   uint32 u32_Expected = 0U;
+   std::mt19937_64 c_Random(0x4F53594455U);
+
+   for (uint32 u32_Case = 0U; u32_Case < (sizeof(mapcn_EDGE_CASES) / sizeof(mapcn_EDGE_CASES[0])); u32_Case++)
+   {
+      m_Check(mapcn_EDGE_CASES[u32_Case], true, u32_Mismatches, u32_Expected);
+   }
+
+   for (uint32 u32_Case = 0U; u32_Case < mu32_NUM_RANDOM; u32_Case++)
+   {
+      //vary the magnitude so small and large values are both covered
+      const uint64 u64_Magnitude = c_Random() >> (c_Random() % 64U);
+      const bool q_Negative = ((c_Random() % 2U) == 1U);
+      charn acn_Text[32];
+
+      if ((u32_Case % 2U) == 0U)
+      {
+         (void)std::snprintf(acn_Text, sizeof(acn_Text), "%s%llu", (q_Negative == true) ? "-" : "",
+                             static_cast<unsigned long long>(u64_Magnitude));
+      }
+      else
+      {
+         (void)std::snprintf(acn_Text, sizeof(acn_Text), "%s0x%llX", (q_Negative == true) ? "-" : "",
+                             static_cast<unsigned long long>(u64_Magnitude));
+      }
+      m_Check(acn_Text, false, u32_Mismatches, u32_Expected);
+   }
+
+   std::printf("%lu random values checked; mismatches: %lu, intended differences: %lu\n",
+               static_cast<unsigned long>(mu32_NUM_RANDOM), static_cast<unsigned long>(u32_Mismatches),
+               static_cast<unsigned long>(u32_Expected));
+
+   m_Measure();
+   return (u32_Mismatches == 0U) ? 0 : 1;
+}
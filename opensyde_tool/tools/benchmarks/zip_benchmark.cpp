@@ -0,0 +1,354 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of creating zip archives with C_OSCZipFile
+
+   Compares C_OSCZipFile::h_CreateZipFile() with adding the files one by one with miniz
+   (mz_zip_writer_add_file; as h_CreateZipFile did before compressing in parallel).
+
+   Files (created in <directory>; HEX file like text):
+   - one file of 40 MB; larger than one batch so it is compressed window by window via a temporary file
+   - one file of 10 MB; compressed in memory with parallel chunks
+   - mu32_NUM_SMALL_FILES files of about 100 kB in a sub folder of the archive; compressed in memory one per thread
+   - one empty file
+   Check: all archives contain all files unchanged; the temporary file is removed.
+   Benchmark: time for best and default compression; max. resident set size of the process (Linux only).
+
+   Usage: zip_benchmark <directory>
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <vector>
+#if defined __linux__
+#include <sys/resource.h>
+#endif
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#define MINIZ_NO_ZLIB_COMPATIBLE_NAMES
+#include "miniz.h"
+#include "C_OSCZipFile.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32 mu32_LARGE_FILE_SIZE = 40U * 1024U * 1024U;
+static const uint32 mu32_MEDIUM_FILE_SIZE = 10U * 1024U * 1024U;
+static const uint32 mu32_SMALL_FILE_SIZE = 100000U;
+static const uint32 mu32_NUM_SMALL_FILES = 200U;
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write file with HEX file like content
+
+   Lines of 16 data bytes; most bytes are 0xFF (erased flash) so the content compresses like real HEX files.
+   Written line by line so the benchmark itself needs no memory for the file.
+
+   \param[in]  orc_FileName   file name
+   \param[in]  ou32_Size      file size in bytes
+   \param[in]  ou32_Seed      seed for the data bytes
+
+   \return
+   true    file written
+   false   could not write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_WriteFile(const C_SCLString & orc_FileName, const uint32 ou32_Size, const uint32 ou32_Seed)
+{
+   std::FILE * const pt_File = std::fopen(orc_FileName.c_str(), "wb");
+   bool q_Return = false;
+
+   if (pt_File != NULL)
+   {
+      std::mt19937 c_Random(ou32_Seed);
+      uint32 u32_Written = 0U;
+      uint32 u32_Address = 0U;
+      bool q_Ok = true;
+
+      while ((u32_Written < ou32_Size) && (q_Ok == true))
+      {
+         charn acn_Line[64];
+         sintn sn_Length = std::sprintf(&acn_Line[0], ":10%04X00", static_cast<uintn>(u32_Address & 0xFFFFU));
+         uint32 u32_Length;
+
+         for (uint32 u32_Byte = 0U; u32_Byte < 16U; u32_Byte++)
+         {
+            const uintn un_Value = ((c_Random() % 4U) == 0U) ? static_cast<uintn>(c_Random() & 0xFFU) : 0xFFU;
+            sn_Length += std::sprintf(&acn_Line[sn_Length], "%02X", un_Value);
+         }
+         sn_Length += std::sprintf(&acn_Line[sn_Length], "00\n");
+         u32_Length = std::min(static_cast<uint32>(sn_Length), ou32_Size - u32_Written);
+         q_Ok = (std::fwrite(&acn_Line[0], 1U, u32_Length, pt_File) == u32_Length);
+         u32_Written += u32_Length;
+         u32_Address += 16U;
+      }
+      q_Return = (std::fclose(pt_File) == 0) && (q_Ok == true);
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read complete file
+
+   \param[in]   orc_FileName   file name
+   \param[out]  orc_Data       file content
+
+   \return
+   true    file read
+   false   could not read file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_ReadFile(const C_SCLString & orc_FileName, std::vector<uint8> & orc_Data)
+{
+   std::FILE * const pt_File = std::fopen(orc_FileName.c_str(), "rb");
+   bool q_Return = false;
+
+   orc_Data.clear();
+   if (pt_File != NULL)
+   {
+      uint8 au8_Buffer[0x10000];
+      size_t un_Read;
+      do
+      {
+         un_Read = std::fread(&au8_Buffer[0], 1U, sizeof(au8_Buffer), pt_File);
+         orc_Data.insert(orc_Data.end(), &au8_Buffer[0], &au8_Buffer[un_Read]);
+      }
+      while (un_Read == sizeof(au8_Buffer));
+      q_Return = (std::ferror(pt_File) == 0);
+      (void)std::fclose(pt_File);
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check that an archive contains all files unchanged
+
+   \param[in]  orc_ArchivePath   zip archive
+   \param[in]  orc_Files         files expected in archive (key: name in archive; value: source file)
+
+   \return
+   number of errors
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_CheckArchive(const C_SCLString & orc_ArchivePath, const std::map<C_SCLString, C_SCLString> & orc_Files)
+{
+   mz_zip_archive c_Archive;
+   uint32 u32_Errors = 0U;
+
+   (void)std::memset(&c_Archive, 0, sizeof(c_Archive));
+   if ((mz_zip_reader_init_file(&c_Archive, orc_ArchivePath.c_str(), 0U) == MZ_FALSE) ||
+       (mz_zip_reader_get_num_files(&c_Archive) != orc_Files.size()))
+   {
+      u32_Errors++;
+   }
+   else
+   {
+      for (std::map<C_SCLString, C_SCLString>::const_iterator c_It = orc_Files.begin(); c_It != orc_Files.end();
+           ++c_It)
+      {
+         const C_SCLString c_Name = C_OSCZipFile::h_GetArchiveFileName(c_It->first);
+         std::vector<uint8> c_Source;
+         size_t un_Size = 0U;
+         void * const pv_Extracted = mz_zip_reader_extract_file_to_heap(&c_Archive, c_Name.c_str(), &un_Size, 0U);
+
+         if ((pv_Extracted == NULL) || (m_ReadFile(c_It->second, c_Source) == false) ||
+             (un_Size != c_Source.size()) ||
+             ((un_Size > 0U) && (std::memcmp(pv_Extracted, &c_Source[0], un_Size) != 0)))
+         {
+            std::printf("  %s: file %s differs\n", orc_ArchivePath.c_str(), c_Name.c_str());
+            u32_Errors++;
+         }
+         mz_free(pv_Extracted);
+      }
+   }
+   (void)mz_zip_reader_end(&c_Archive);
+   return u32_Errors;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add files one by one with miniz
+
+   \param[in]  orc_ArchivePath   zip archive
+   \param[in]  orc_Files         files to add (key: name in archive; value: source file)
+
+   \return
+   true    archive created
+   false   error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_CreateSerial(const C_SCLString & orc_ArchivePath, const std::map<C_SCLString, C_SCLString> & orc_Files)
+{
+   mz_zip_archive c_Archive;
+   bool q_Return;
+
+   (void)std::memset(&c_Archive, 0, sizeof(c_Archive));
+   q_Return = (mz_zip_writer_init_file(&c_Archive, orc_ArchivePath.c_str(), 0U) == MZ_TRUE);
+   for (std::map<C_SCLString, C_SCLString>::const_iterator c_It = orc_Files.begin();
+        (c_It != orc_Files.end()) && (q_Return == true); ++c_It)
+   {
+      const C_SCLString c_Name = C_OSCZipFile::h_GetArchiveFileName(c_It->first);
+      q_Return = (mz_zip_writer_add_file(&c_Archive, c_Name.c_str(), c_It->second.c_str(), NULL, 0U,
+                                         static_cast<mz_uint>(MZ_BEST_COMPRESSION)) == MZ_TRUE);
+   }
+   q_Return = (q_Return == true) && (mz_zip_writer_finalize_archive(&c_Archive) == MZ_TRUE);
+   (void)mz_zip_writer_end(&c_Archive);
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get size of file
+
+   \param[in]  orc_FileName   file name
+
+   \return
+   size in bytes; 0 if the file does not exist
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32 m_GetFileSize(const C_SCLString & orc_FileName)
+{
+   std::FILE * const pt_File = std::fopen(orc_FileName.c_str(), "rb");
+   uint32 u32_Size = 0U;
+
+   if (pt_File != NULL)
+   {
+      if (std::fseek(pt_File, 0, SEEK_END) == 0)
+      {
+         u32_Size = static_cast<uint32>(std::ftell(pt_File));
+      }
+      (void)std::fclose(pt_File);
+   }
+   return u32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether file exists
+
+   \param[in]  orc_FileName   file name
+
+   \return
+   true    file exists
+   false   file does not exist
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_FileExists(const C_SCLString & orc_FileName)
+{
+   std::FILE * const pt_File = std::fopen(orc_FileName.c_str(), "rb");
+
+   if (pt_File != NULL)
+   {
+      (void)std::fclose(pt_File);
+   }
+   return (pt_File != NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+int main(const sintn osn_Argc, const charn * const * const oppcn_Argv)
+{
+   sintn sn_Return = 1;
+
+   if (osn_Argc != 2)
+   {
+      std::printf("usage: zip_benchmark <directory>\n");
+   }
+   else
+   {
+      const C_SCLString c_Directory = C_SCLString(oppcn_Argv[1]) + "/";
+      std::map<C_SCLString, C_SCLString> c_Files;
+      bool q_Created;
+
+      c_Files["large.hex"] = c_Directory + "large.hex";
+      c_Files["medium.hex"] = c_Directory + "medium.hex";
+      c_Files["empty.bin"] = c_Directory + "empty.bin";
+      q_Created = m_WriteFile(c_Files["large.hex"], mu32_LARGE_FILE_SIZE, 1U) &&
+                  m_WriteFile(c_Files["medium.hex"], mu32_MEDIUM_FILE_SIZE, 2U) &&
+                  m_WriteFile(c_Files["empty.bin"], 0U, 3U);
+      for (uint32 u32_File = 0U; (u32_File < mu32_NUM_SMALL_FILES) && (q_Created == true); u32_File++)
+      {
+         const C_SCLString c_Name = "small" + C_SCLString(u32_File) + ".hex";
+         c_Files["sub\\" + c_Name] = c_Directory + c_Name;
+         q_Created = m_WriteFile(c_Directory + c_Name, mu32_SMALL_FILE_SIZE + u32_File, 10U + u32_File);
+      }
+
+      if (q_Created == false)
+      {
+         std::printf("could not create files in %s\n", c_Directory.c_str());
+      }
+      else
+      {
+         const C_SCLString c_Serial = c_Directory + "serial.zip";
+         const C_SCLString c_Best = c_Directory + "best.zip";
+         const C_SCLString c_Default = c_Directory + "default.zip";
+         C_SCLString c_Error;
+         uint32 u32_Errors = 0U;
+         std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+         bool q_Serial;
+         sint32 s32_Best;
+         sint32 s32_Default;
+         std::chrono::duration<float64, std::milli> c_SerialMs;
+         std::chrono::duration<float64, std::milli> c_BestMs;
+         std::chrono::duration<float64, std::milli> c_DefaultMs;
+
+         q_Serial = m_CreateSerial(c_Serial, c_Files);
+         c_SerialMs = std::chrono::steady_clock::now() - c_Start;
+         c_Start = std::chrono::steady_clock::now();
+         s32_Best = C_OSCZipFile::h_CreateZipFile(c_Files, c_Best, &c_Error);
+         c_BestMs = std::chrono::steady_clock::now() - c_Start;
+         c_Start = std::chrono::steady_clock::now();
+         s32_Default = C_OSCZipFile::h_CreateZipFile(c_Files, c_Default, &c_Error,
+                                                     C_OSCZipData::hu8_COMPRESSION_LEVEL_DEFAULT);
+         c_DefaultMs = std::chrono::steady_clock::now() - c_Start;
+
+         std::printf("miniz one by one (best):       %7.0f ms, %lu bytes\n", c_SerialMs.count(),
+                     static_cast<unsigned long>(m_GetFileSize(c_Serial)));
+         std::printf("h_CreateZipFile (best):        %7.0f ms, %lu bytes\n", c_BestMs.count(),
+                     static_cast<unsigned long>(m_GetFileSize(c_Best)));
+         std::printf("h_CreateZipFile (default):     %7.0f ms, %lu bytes\n", c_DefaultMs.count(),
+                     static_cast<unsigned long>(m_GetFileSize(c_Default)));
+#if defined __linux__
+         {
+            //only the files are held in memory; the benchmark creates and reads them in small pieces
+            struct rusage c_Usage;
+            if (getrusage(RUSAGE_SELF, &c_Usage) == 0)
+            {
+               std::printf("max. resident set size:        %7ld kB\n", static_cast<long>(c_Usage.ru_maxrss));
+            }
+         }
+#endif
+
+         if ((q_Serial == false) || (s32_Best != C_NO_ERR) || (s32_Default != C_NO_ERR))
+         {
+            std::printf("could not create archives: %s\n", c_Error.c_str());
+            u32_Errors++;
+         }
+         else
+         {
+            u32_Errors += m_CheckArchive(c_Serial, c_Files);
+            u32_Errors += m_CheckArchive(c_Best, c_Files);
+            u32_Errors += m_CheckArchive(c_Default, c_Files);
+            if ((m_FileExists(c_Best + ".tmp") == true) || (m_FileExists(c_Default + ".tmp") == true))
+            {
+               std::printf("temporary file not removed\n");
+               u32_Errors++;
+            }
+         }
+
+         std::printf("%lu errors\n", static_cast<unsigned long>(u32_Errors));
+         sn_Return = (u32_Errors == 0U) ? 0 : 1;
+      }
+   }
+   return sn_Return;
+}